@@ -1,3 +1,3 @@
 TEMPLATE = subdirs
-SUBDIRS =mgpview 
+SUBDIRS =mgpview mgpbatch
 CONFIG += ordered
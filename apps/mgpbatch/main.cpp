@@ -0,0 +1,387 @@
+// This program processes SIGMET/AIRMET area expressions in batch, typically for offline reprocessing of archived messages.
+// Each input line contains an area expression, optionally preceded by a FIR code (like 'ENOB N OF N7500'). The expression is converted
+// to filters that are applied to the FIR, and the resulting polygons (optionally along with the indices of the Norwegian municipalities
+// they intersect) are written to stdout as one JSON object per line, in the same order as the input.
+// See printUsageAndExit() for the options.
+
+#include "mgp.h"
+#include "mgpmath.h"
+#include "tracing.h"
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QMap>
+#include <QMutex>
+#include <QRunnable>
+#include <QScopedPointer>
+#include <QStringList>
+#include <QTextStream>
+#include <QThread>
+#include <QThreadPool>
+#include <QWaitCondition>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+
+static void printUsageAndExit(const char *argv0, int status)
+{
+    fprintf(
+                status ? stderr : stdout,
+                "usage: %s [--fir <code>] [--intersect] [--tolerance <km>] [--threads <n>] [--max-in-flight <n>] [--trace <file>] "
+                "[file ...]\n"
+                "  Reads area expressions (one per line, optionally preceded by a FIR code) from the files (or stdin if none or '-')\n"
+                "  and writes the resulting polygons to stdout as line-delimited JSON in input order.\n"
+                "  --fir <code>          FIR used when a line specifies none (default: ENOR)\n"
+                "  --intersect           also find the indices of the intersected Norwegian municipalities\n"
+                "  --tolerance <km>      simplify the FIR and municipality polygons with this tolerance (default: 0, i.e. none)\n"
+                "  --threads <n>         number of worker threads (default: the number of cores)\n"
+                "  --max-in-flight <n>   maximum number of expressions being processed or waiting to be written (default: 4 per thread)\n"
+                "  --trace <file>        write trace events in the Chrome trace event format to a file\n",
+                argv0);
+    exit(status);
+}
+
+// Returns the FIR with a given code (like 'ENOR'), or FIR::Unsupported if there is none.
+static mgp::FIR::Code firFromCode(const QString &code)
+{
+    foreach (const QString &name, mgp::FIR::instance().supportedNames()) {
+        if (name.section(' ', 0, 0).compare(code, Qt::CaseInsensitive) == 0)
+            return mgp::FIR::instance().firFromText(name);
+    }
+    return mgp::FIR::Unsupported;
+}
+
+// Returns the code of a FIR (like 'ENOR').
+static QString firCode(mgp::FIR::Code fir)
+{
+    foreach (const QString &name, mgp::FIR::instance().supportedNames()) {
+        if (mgp::FIR::instance().firFromText(name) == fir)
+            return name.section(' ', 0, 0);
+    }
+    return QString();
+}
+
+// Returns the polygons that are neither null nor empty (applyFilters() returns a null polygon for each degenerate piece).
+static mgp::Polygons nonEmptyPolygons(const mgp::Polygons &polygons)
+{
+    mgp::Polygons result(new QVector<mgp::Polygon>());
+    for (int i = 0; polygons && (i < polygons->size()); ++i) {
+        if (polygons->at(i) && (!polygons->at(i)->isEmpty()))
+            result->append(polygons->at(i));
+    }
+    return result;
+}
+
+// Returns polygons as a JSON array of arrays of [lon, lat] pairs in degrees. Null and empty polygons are skipped.
+static QString jsonPolygons(const mgp::Polygons &polygons)
+{
+    QString result("[");
+    int written = 0;
+    for (int i = 0; polygons && (i < polygons->size()); ++i) {
+        const mgp::Polygon &polygon = polygons->at(i);
+        if ((!polygon) || polygon->isEmpty())
+            continue;
+        result += (written++ > 0) ? ",[" : "[";
+        for (int j = 0; j < polygon->size(); ++j) {
+            result += (j > 0) ? ",[" : "[";
+            result += QString::number(RAD2DEG(polygon->at(j).first), 'f', 6);
+            result += ",";
+            result += QString::number(RAD2DEG(polygon->at(j).second), 'f', 6);
+            result += "]";
+        }
+        result += "]";
+    }
+    result += "]";
+    return result;
+}
+
+struct Options
+{
+    mgp::FIR::Code defaultFir;
+    bool intersect;
+    double toleranceKm;
+    Options() : defaultFir(mgp::FIR::ENOR), intersect(false), toleranceKm(0) {}
+};
+
+// Result of processing one input line.
+struct Result
+{
+    QByteArray json; // JSON object (without a trailing newline)
+    qint64 nsecs; // processing time
+    bool error;
+    int polygons; // number of output polygons
+    int intersected; // number of intersected municipalities
+    Result() : nsecs(0), error(false), polygons(0), intersected(0) {}
+};
+
+// Processes one input line.
+static Result process(const QString &source, int lineNo, const QString &line, const Options &options, const mgp::IntersectionLayer &layer)
+{
+    QElapsedTimer timer;
+    timer.start();
+    Result result;
+
+    // find the FIR, either from a leading FIR code, from the name of a FIR in the expression, or from the options
+    QString expr = line.trimmed();
+    mgp::FIR::Code fir = options.defaultFir;
+    const int sep = expr.indexOf(' ');
+    const mgp::FIR::Code codeFir = (sep > 0) ? firFromCode(expr.left(sep)) : mgp::FIR::Unsupported;
+    if (codeFir != mgp::FIR::Unsupported) {
+        fir = codeFir;
+        expr = expr.mid(sep + 1).trimmed();
+    } else {
+        const mgp::FIR::Code textFir = mgp::FIR::instance().firFromText(expr);
+        if (textFir != mgp::FIR::Unsupported)
+            fir = textFir;
+    }
+
+    QString json = "{\"source\":" + mgp::jsonString(source) + QString(",\"line\":%1").arg(lineNo);
+    if (fir == mgp::FIR::Unsupported) {
+        json += ",\"error\":\"no supported FIR\"}";
+        result.error = true;
+    } else {
+        QList<QPair<QPair<int, int>, QString> > incompleteRanges;
+        const mgp::Filters filters = mgp::filtersFromXmetExpr(expr, 0, &incompleteRanges, true, false);
+        const mgp::Polygons polygons = nonEmptyPolygons(
+                    mgp::applyFilters(mgp::FIR::instance().preparedPolygon(fir, options.toleranceKm), filters));
+        result.polygons = polygons->size();
+
+        json += ",\"fir\":" + mgp::jsonString(firCode(fir));
+        json += ",\"filters\":" + mgp::jsonString(mgp::xmetExprFromFilters(filters));
+
+        json += ",\"incomplete\":[";
+        for (int i = 0; i < incompleteRanges.size(); ++i) {
+            json += QString("%1{\"begin\":%2,\"end\":%3,\"reason\":")
+                    .arg((i > 0) ? "," : "").arg(incompleteRanges.at(i).first.first).arg(incompleteRanges.at(i).first.second);
+            json += mgp::jsonString(incompleteRanges.at(i).second) + "}";
+        }
+        json += "]";
+
+        json += ",\"polygons\":" + jsonPolygons(polygons);
+
+        if (options.intersect) {
+            // (each worker processes one expression at a time, so the layer is intersected using the calling thread only)
+            const QList<QPair<int, mgp::Polygons> > isct = layer.intersection(polygons, 1, options.toleranceKm);
+            json += ",\"municipalities\":[";
+            for (int i = 0; i < isct.size(); ++i)
+                json += QString("%1%2").arg((i > 0) ? "," : "").arg(isct.at(i).first);
+            json += "]";
+            result.intersected = isct.size();
+        }
+
+        json += "}";
+    }
+
+    result.json = json.toUtf8();
+    result.nsecs = timer.nsecsElapsed();
+    return result;
+}
+
+// Results of processed lines that are waiting to be written, keyed on input sequence number.
+class Results
+{
+public:
+    void put(qint64 seq, const Result &result)
+    {
+        QMutexLocker locker(&mutex_);
+        results_.insert(seq, result);
+        available_.wakeAll();
+    }
+
+    // Waits for the result of a given line and removes it.
+    Result take(qint64 seq)
+    {
+        QMutexLocker locker(&mutex_);
+        while (!results_.contains(seq))
+            available_.wait(&mutex_);
+        return results_.take(seq);
+    }
+
+private:
+    QMutex mutex_;
+    QWaitCondition available_;
+    QMap<qint64, Result> results_;
+};
+
+class LineTask : public QRunnable
+{
+public:
+    LineTask(
+            qint64 seq, const QString &source, int lineNo, const QString &line, const Options *options,
+            const mgp::IntersectionLayer *layer, Results *results)
+        : seq_(seq), source_(source), lineNo_(lineNo), line_(line), options_(options), layer_(layer), results_(results)
+    {
+    }
+
+    virtual void run()
+    {
+        results_->put(seq_, process(source_, lineNo_, line_, *options_, *layer_));
+    }
+
+private:
+    qint64 seq_;
+    QString source_;
+    int lineNo_;
+    QString line_;
+    const Options *options_;
+    const mgp::IntersectionLayer *layer_;
+    Results *results_;
+};
+
+// Accumulated statistics of the written results.
+struct Stats
+{
+    qint64 expressions;
+    qint64 errors;
+    qint64 polygons;
+    qint64 intersected;
+    QVector<qint64> nsecs; // processing time of each expression
+    Stats() : expressions(0), errors(0), polygons(0), intersected(0) {}
+};
+
+// Writes a result and adds it to the statistics.
+static void writeResult(const Result &result, QFile *out, Stats *stats)
+{
+    out->write(result.json + '\n');
+    stats->expressions++;
+    stats->errors += (result.error ? 1 : 0);
+    stats->polygons += result.polygons;
+    stats->intersected += result.intersected;
+    stats->nsecs.append(result.nsecs);
+}
+
+// Returns the value at a given fraction (in [0, 1]) of a sorted vector.
+static double percentile(const QVector<qint64> &sorted, double fraction)
+{
+    if (sorted.isEmpty())
+        return 0;
+    return sorted.at(qMin(sorted.size() - 1, int(fraction * sorted.size())));
+}
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+
+    Options options;
+    int threadCount = QThread::idealThreadCount();
+    int maxInFlight = 0;
+    QString traceFileName;
+    QStringList fileNames;
+
+    const QStringList args = app.arguments();
+    for (int i = 1; i < args.size(); ++i) {
+        const QString &arg = args.at(i);
+        const bool hasValue = (i < (args.size() - 1));
+        bool ok = true;
+        if ((arg == "--help") || (arg == "-h")) {
+            printUsageAndExit(argv[0], 0);
+        } else if (arg == "--intersect") {
+            options.intersect = true;
+        } else if ((arg == "--fir") && hasValue) {
+            options.defaultFir = firFromCode(args.at(++i));
+            ok = (options.defaultFir != mgp::FIR::Unsupported);
+        } else if ((arg == "--tolerance") && hasValue) {
+            options.toleranceKm = args.at(++i).toDouble(&ok);
+        } else if ((arg == "--threads") && hasValue) {
+            threadCount = args.at(++i).toInt(&ok);
+            ok = ok && (threadCount > 0);
+        } else if ((arg == "--max-in-flight") && hasValue) {
+            maxInFlight = args.at(++i).toInt(&ok);
+            ok = ok && (maxInFlight > 0);
+        } else if ((arg == "--trace") && hasValue) {
+            traceFileName = args.at(++i);
+        } else if (arg.startsWith("--")) {
+            ok = false;
+        } else {
+            fileNames.append(arg);
+        }
+        if (!ok)
+            printUsageAndExit(argv[0], 1);
+    }
+    threadCount = qMax(1, threadCount);
+    if (maxInFlight <= 0)
+        maxInFlight = 4 * threadCount;
+    if (fileNames.isEmpty())
+        fileNames.append("-");
+
+    QFile traceFile(traceFileName);
+    QScopedPointer<mgp::ChromeTraceSink> traceSink;
+    if (!traceFileName.isEmpty()) {
+        if (!traceFile.open(QIODevice::WriteOnly)) {
+            fprintf(stderr, "failed to open %s for writing\n", traceFileName.toLocal8Bit().constData());
+            return 1;
+        }
+        traceSink.reset(new mgp::ChromeTraceSink(&traceFile));
+        mgp::setTraceSink(traceSink.data());
+    }
+
+    mgp::IntersectionLayer layer;
+    if (options.intersect)
+        layer = mgp::IntersectionLayer(mgp::norwegianMunicipalities());
+
+    QFile out;
+    if (!out.open(stdout, QIODevice::WriteOnly)) {
+        fprintf(stderr, "failed to open stdout for writing\n");
+        return 1;
+    }
+
+    // let the workers process the lines while this thread reads the input and writes the results in input order, keeping at
+    // most maxInFlight lines between reading and writing so that memory use stays bounded regardless of the input size
+    Results results;
+    QThreadPool pool;
+    pool.setMaxThreadCount(threadCount);
+    Stats stats;
+    int status = 0;
+    qint64 nextRead = 0;
+    qint64 nextWrite = 0;
+    QElapsedTimer timer;
+    timer.start();
+
+    for (int f = 0; f < fileNames.size(); ++f) {
+        const QString &fileName = fileNames.at(f);
+        QFile in(fileName);
+        if (!((fileName == "-") ? in.open(stdin, QIODevice::ReadOnly) : in.open(QIODevice::ReadOnly))) {
+            fprintf(stderr, "failed to open %s for reading\n", fileName.toLocal8Bit().constData());
+            status = 1;
+            break; // (the lines already read are still processed and written)
+        }
+
+        QTextStream stream(&in);
+        int lineNo = 0;
+        for (QString line = stream.readLine(); !line.isNull(); line = stream.readLine()) {
+            lineNo++;
+            if (line.trimmed().isEmpty() || line.trimmed().startsWith('#'))
+                continue; // skip blank lines and comments
+
+            pool.start(new LineTask(nextRead++, fileName, lineNo, line, &options, &layer, &results));
+
+            while ((nextRead - nextWrite) >= maxInFlight)
+                writeResult(results.take(nextWrite++), &out, &stats);
+        }
+    }
+
+    while (nextWrite < nextRead)
+        writeResult(results.take(nextWrite++), &out, &stats);
+    out.flush();
+    const double secs = timer.nsecsElapsed() / 1e9;
+
+    mgp::setTraceSink(0);
+    traceSink.reset();
+
+    // report throughput statistics
+    std::sort(stats.nsecs.begin(), stats.nsecs.end());
+    qint64 totalNsecs = 0;
+    for (int i = 0; i < stats.nsecs.size(); ++i)
+        totalNsecs += stats.nsecs.at(i);
+    fprintf(stderr, "mgpbatch: %lld expressions (%lld errors) in %.3f s using %d threads: %.1f expressions/s\n",
+            (long long)stats.expressions, (long long)stats.errors, secs, threadCount, (secs > 0) ? (stats.expressions / secs) : 0.0);
+    fprintf(stderr, "mgpbatch: time per expression (ms): mean %.3f, median %.3f, 95th percentile %.3f, max %.3f\n",
+            stats.nsecs.isEmpty() ? 0.0 : (totalNsecs / 1e6 / stats.nsecs.size()), percentile(stats.nsecs, 0.5) / 1e6,
+            percentile(stats.nsecs, 0.95) / 1e6, percentile(stats.nsecs, 1) / 1e6);
+    if (options.intersect)
+        fprintf(stderr, "mgpbatch: %lld output polygons, %lld intersected municipalities\n", (long long)stats.polygons, (long long)stats.intersected);
+    else
+        fprintf(stderr, "mgpbatch: %lld output polygons\n", (long long)stats.polygons);
+
+    return status;
+}
@@ -0,0 +1,21 @@
+TEMPLATE = app
+TARGET = mgpbatch
+QT += xml xmlpatterns
+QT -= gui
+
+CONFIG += console debug
+CONFIG -= app_bundle
+
+INCLUDEPATH += . ../../lib
+DEPENDPATH += . ../../lib
+PRE_TARGETDEPS += ../../lib/libmgp.a
+
+SOURCES += main.cpp
+
+LIBS += -L ../../lib -lmgp
+
+BINDIR = $$PREFIX/bin
+
+target.path = $$BINDIR
+
+INSTALLS += target
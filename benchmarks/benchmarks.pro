@@ -0,0 +1,20 @@
+QT += xml xmlpatterns testlib
+TEMPLATE = app
+TARGET = benchmgp
+
+INCLUDEPATH += . ../lib
+DEPENDPATH += . ../lib
+PRE_TARGETDEPS += ../lib/libmgp.a
+
+DEFINES += MGP_DATA_DIR=\\\"$$PWD/../lib/data\\\"
+
+SOURCES += benchmgp.cpp
+HEADERS += benchmgp.h
+
+LIBS += -L ../lib -lmgp
+
+# 'make benchmark' runs the benchmarks and writes the results to benchmgp.xml (in the QTestLib XML format) for tracking
+# regressions between releases, in addition to printing them.
+benchmark.commands = ./$$TARGET -o benchmgp.xml,xml -o -,txt
+benchmark.depends = $$TARGET
+QMAKE_EXTRA_TARGETS += benchmark
@@ -0,0 +1,168 @@
+#include "benchmgp.h"
+#include "mgpmath.h"
+#include "kml.h"
+#include "polygongenerator.h"
+#include <QFile>
+
+Q_DECLARE_METATYPE(mgp::Polygons)
+Q_DECLARE_METATYPE(mgp::FIR::Code)
+
+// Returns a reproducible random polygon with n vertices and a given center and radius (km). The polygon is deliberately concave so
+// that the filters and intersections have some work to do.
+static mgp::Polygon randomPolygon(int n, double lon, double lat, double radiusKm)
+{
+    return mgp::PolygonGenerator(n).randomPolygon(n, qMakePair(DEG2RAD(lon), DEG2RAD(lat)), radiusKm, 0.3);
+}
+
+// Adds rows for a range of polygon sizes for measuring how the cost scales with the number of vertices.
+static void addScalingRows(int maxVertices)
+{
+    QTest::addColumn<int>("vertices");
+
+    for (int n = 10; n <= maxVertices; n *= 10)
+        QTest::newRow(qPrintable(QString::number(n))) << n;
+}
+
+void BenchMgp::applyFilters_data()
+{
+    QTest::addColumn<mgp::FIR::Code>("fir");
+    QTest::addColumn<QString>("expr");
+
+    QTest::newRow("ENOR N_OF") << mgp::FIR::ENOR << QString("N OF N6500");
+    QTest::newRow("ENOR N_OF E_OF") << mgp::FIR::ENOR << QString("N OF N6500 AND E OF E01000");
+    QTest::newRow("ENOR S_OF_LINE W_OF") << mgp::FIR::ENOR << QString("S OF LINE N7000 E00500 - N6800 E03000 AND W OF E02000");
+    QTest::newRow("ENOR WI") << mgp::FIR::ENOR << QString("WI N6000 E00500 - N6300 E01200 - N6700 E01500 - N6400 E00400 - N6000 E00500");
+    QTest::newRow("ENOB N_OF E_OF") << mgp::FIR::ENOB << QString("N OF N7500 AND E OF E01000");
+    QTest::newRow("ENOB WI") << mgp::FIR::ENOB << QString("WI N7000 E00500 - N7800 E01200 - N7600 E02500 - N7000 E00500");
+}
+
+void BenchMgp::applyFilters()
+{
+    QFETCH(mgp::FIR::Code, fir);
+    QFETCH(QString, expr);
+
+    const mgp::Polygon polygon = mgp::FIR::instance().polygon(fir);
+    const mgp::Filters filters = mgp::filtersFromXmetExpr(expr, 0, 0, true, false);
+    QBENCHMARK {
+        mgp::applyFilters(polygon, filters);
+    }
+}
+
+void BenchMgp::polygonIntersection_data()
+{
+    addScalingRows(10000);
+}
+
+void BenchMgp::polygonIntersection()
+{
+    QFETCH(int, vertices);
+
+    const mgp::Polygon subject = randomPolygon(vertices, 10, 65, 400);
+    const mgp::Polygon clip = randomPolygon(vertices + 1, 13, 66, 400);
+    QBENCHMARK {
+        mgp::math::polygonIntersection(subject, clip);
+    }
+}
+
+void BenchMgp::latFilter_data()
+{
+    addScalingRows(100000);
+}
+
+void BenchMgp::latFilter()
+{
+    QFETCH(int, vertices);
+
+    const mgp::Polygon polygon = randomPolygon(vertices, 10, 65, 400);
+    const mgp::Filter filter(new mgp::NOfFilter(DEG2RAD(65.0)));
+    QBENCHMARK {
+        filter->apply(polygon);
+    }
+}
+
+void BenchMgp::removeInvalidVertices_data()
+{
+    addScalingRows(100000);
+}
+
+void BenchMgp::removeInvalidVertices()
+{
+    QFETCH(int, vertices);
+
+    const mgp::Polygon polygon = randomPolygon(vertices, 10, 65, 400);
+    QBENCHMARK {
+        mgp::math::removeInvalidVertices(polygon);
+    }
+}
+
+void BenchMgp::intersectedPolygons_data()
+{
+    QTest::addColumn<mgp::Polygons>("intersectors");
+
+    mgp::Polygons small = mgp::Polygons(new QVector<mgp::Polygon>());
+    small->append(randomPolygon(32, 10, 61, 50));
+    QTest::newRow("small area") << small;
+
+    mgp::Polygons fir = mgp::Polygons(new QVector<mgp::Polygon>());
+    fir->append(mgp::FIR::instance().polygon(mgp::FIR::ENOR));
+    QTest::newRow("ENOR") << fir;
+}
+
+void BenchMgp::intersectedPolygons()
+{
+    QFETCH(mgp::Polygons, intersectors);
+
+    mgp::setIntersectablePolygons(mgp::norwegianMunicipalities());
+    QBENCHMARK {
+        mgp::intersectedPolygons(intersectors);
+    }
+}
+
+void BenchMgp::filtersFromXmetExpr_data()
+{
+    QTest::addColumn<QString>("expr");
+
+    QTest::newRow("lines") << QString("N OF N6500 AND E OF E01000 AND S OF LINE N7000 E00500 - N6800 E03000 AND "
+                                      "NE OF LINE N6000 E00500 - N6500 E01500 AND SW OF LINE N7100 E01000 - N6600 E03000");
+
+    // a WI polygon with many points, embedded in free text
+    QString wi("SIGMET VALID 101200/101600 ENMI- ENOR NORWAY FIR SEV TURB FCST WI N6000 E00500");
+    for (int i = 1; i < 100; ++i)
+        wi += QString(" - N%1%2 E%3%4")
+                .arg(60 + i / 10).arg(5 * (i % 10), 2, 10, QLatin1Char('0')).arg(5 + (i % 20), 3, 10, QLatin1Char('0')).arg("00");
+    wi += " - N6000 E00500 SFC/FL250 MOV E 15KT NC=";
+    QTest::newRow("long WI") << wi;
+}
+
+void BenchMgp::filtersFromXmetExpr()
+{
+    QFETCH(QString, expr);
+
+    QList<QPair<int, int> > matchedRanges;
+    QList<QPair<QPair<int, int>, QString> > incompleteRanges;
+    QBENCHMARK {
+        mgp::filtersFromXmetExpr(expr, &matchedRanges, &incompleteRanges, false, false);
+    }
+}
+
+void BenchMgp::loadKml()
+{
+    QFile file(QString("%1/norway_municipalities.kml").arg(MGP_DATA_DIR));
+    QVERIFY(file.open(QIODevice::ReadOnly));
+    const QByteArray data = file.readAll();
+
+    QString error;
+    QBENCHMARK {
+        kml::kml2polygons(data, &error);
+    }
+    QVERIFY(error.isEmpty());
+}
+
+void BenchMgp::loadMunicipalities()
+{
+    QBENCHMARK {
+        mgp::norwegianMunicipalities();
+    }
+}
+
+QTEST_MAIN(BenchMgp)
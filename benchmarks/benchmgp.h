@@ -0,0 +1,30 @@
+#include "mgp.h"
+#include <QtTest/QtTest>
+
+class BenchMgp: public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void applyFilters_data();
+    void applyFilters();
+
+    void polygonIntersection_data();
+    void polygonIntersection();
+
+    void latFilter_data();
+    void latFilter();
+
+    void removeInvalidVertices_data();
+    void removeInvalidVertices();
+
+    void intersectedPolygons_data();
+    void intersectedPolygons();
+
+    void filtersFromXmetExpr_data();
+    void filtersFromXmetExpr();
+
+    void loadKml();
+
+    void loadMunicipalities();
+};
@@ -3,7 +3,7 @@
 
 // Format: lat1, lon1, lat2, lon2, ..., lonN
 
-const float enob_fir[] = {
+const double enob_fir[] = {
     63,0,
     63,4,
     64,5.01472,
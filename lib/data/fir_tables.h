@@ -0,0 +1,6861 @@
+#ifndef FIR_TABLES_H
+#define FIR_TABLES_H
+
+// Generated by tools/firtables from enor_fir.h and enob_fir.h. Do not edit.
+
+#include "mgpmath.h"
+
+// ENOR_FIR
+
+static const double enor_fir_points[] = {
+    0, 1.0995574287564276,
+    0.069813170079773182, 1.0995574287564276,
+    0.087523375065610032, 1.1170107212763709,
+    0.10937402463595305, 1.1367905376892227,
+    0.11939029468022332, 1.1452553845613951,
+    0.12217304763960307, 1.1475539831862716,
+    0.13452613901936852, 1.1556016963672175,
+    0.16445364876916568, 1.1737339219661866,
+    0.26179938779914941, 1.2217304763960306,
+    0.31395157117799199, 1.2300312623185157,
+    0.43633231299858238, 1.245000951312871,
+    0.48869219055841229, 1.245000951312871,
+    0.52359877559829882, 1.2391837689159739,
+    0.55356084286728546, 1.2281305987630937,
+    0.54337859201115057, 1.2217304763960306,
+    0.5378720782211085, 1.2181473154416864,
+    0.53787033289185648, 1.2181455701124344,
+    0.53786509690410045, 1.2181420794539302,
+    0.53793316474492836, 1.2180862289178664,
+    0.53793665540343227, 1.2180408503573148,
+    0.53795236336670027, 1.2180146704185346,
+    0.53797854330548012, 1.2179937264675107,
+    0.538025667195284, 1.2179762731749908,
+    0.53807104575583586, 1.2179535838947149,
+    0.53807977240209581, 1.2179308946144392,
+    0.53811816964563974, 1.2179151866511713,
+    0.53822812538851528, 1.2178890067123911,
+    0.53827699460757117, 1.217871553419871,
+    0.53829619322934308, 1.2178523547980991,
+    0.53828746658308313, 1.2178331561763274,
+    0.53825779598579926, 1.2178139575545555,
+    0.53825954131505127, 1.2177738149817596,
+    0.53826826796131122, 1.2177598523477433,
+    0.53829270257083905, 1.2177493803722317,
+    0.53836251574091887, 1.2177389083967194,
+    0.53837124238717882, 1.2177336724089636,
+    0.53837647837493485, 1.2177301817504596,
+    0.5383677517286749, 1.2177162191164437,
+    0.53837996903343888, 1.2177040018116798,
+    0.53840440364296671, 1.2177005111531758,
+    0.53846025417903054, 1.2177074924701836,
+    0.53847596214229843, 1.2177074924701836,
+    0.53848468878855849, 1.2177040018116798,
+    0.53848294345930647, 1.217691784506916,
+    0.53844105555725863, 1.2176516419341199,
+    0.53844454621576265, 1.2176429152878598,
+    0.53848468878855849, 1.217627207324592,
+    0.53848817944706251, 1.2176219713368359,
+    0.53848294345930647, 1.217601027385812,
+    0.53844280088651064, 1.21757310211778,
+    0.53844803687426668, 1.2175591394837642,
+    0.53847596214229843, 1.2175504128375041,
+    0.53851959537359839, 1.2175486675082523,
+    0.53852483136135432, 1.2175521581667563,
+    0.53852657669060633, 1.2175800834347883,
+    0.53854577531237824, 1.2175905554103001,
+    0.53856497393415026, 1.2175940460688042,
+    0.53859115387293011, 1.2175940460688042,
+    0.53861733381171006, 1.2175870647517961,
+    0.53862955111647404, 1.2175800834347883,
+    0.5386749296770259, 1.2175434315204963,
+    0.53872728955458571, 1.2175155062524643,
+    0.53872903488383772, 1.2175067796062042,
+    0.53872030823757766, 1.2175015436184484,
+    0.53864874973824595, 1.2174753636796685,
+    0.53862780578722202, 1.2174334757776206,
+    0.53863304177497806, 1.2174177678143527,
+    0.53865573105525388, 1.2174072958388409,
+    0.53867318434777389, 1.2174072958388409,
+    0.53871158159131771, 1.2174090411680927,
+    0.53872379889608168, 1.2174142771558487,
+    0.53873427087159365, 1.2174299851191168,
+    0.53872728955458571, 1.2174648917041564,
+    0.53873950685934968, 1.2174736183504165,
+    0.53878837607840546, 1.2174753636796685,
+    0.53880932002942949, 1.2174718730211644,
+    0.53882153733419347, 1.2174648917041564,
+    0.53881979200494146, 1.2174526743993925,
+    0.53877964943214551, 1.2174317304483686,
+    0.53877964943214551, 1.2174247491313606,
+    0.5387953573954134, 1.2174125318265967,
+    0.53889484116277719, 1.217384606558565,
+    0.53890880379679307, 1.2173758799123049,
+    0.53890007715053312, 1.2173688985952968,
+    0.53887738787025719, 1.2173688985952968,
+    0.53886342523624131, 1.2173706439245489,
+    0.53883200930970543, 1.2173915878755728,
+    0.53880582937092547, 1.2173950785340766,
+    0.53876917745663355, 1.2173950785340766,
+    0.53874823350560963, 1.2173880972170688,
+    0.53874823350560963, 1.2173793705708087,
+    0.53878663074915345, 1.2173619172782888,
+    0.53880059338316943, 1.2173479546442729,
+    0.53880408404167346, 1.217323520034745,
+    0.53877964943214551, 1.2173060667422251,
+    0.53878139476139753, 1.217299085425217,
+    0.53882502799269738, 1.2172816321326969,
+    0.53884248128521728, 1.2172711601571853,
+    0.53884422661446929, 1.2172554521939172,
+    0.53883026398045342, 1.2172205456088774,
+    0.53886691589474522, 1.2172135642918693,
+    0.53887564254100517, 1.2172153096211213,
+    0.53888436918726523, 1.2172240362673812,
+    0.53889833182128111, 1.2172257815966332,
+    0.53891578511380112, 1.2172240362673812,
+    0.53894894636958901, 1.2171996016578532,
+    0.53893498373557303, 1.2171699310605695,
+    0.538947201040337, 1.2171559684265534,
+    0.53896116367435298, 1.2171524777680496,
+    0.53898908894238484, 1.2171524777680496,
+    0.53901701421041681, 1.2171716763898215,
+    0.53906413810022058, 1.2171734217190735,
+    0.5391007900145125, 1.2171646950728134,
+    0.53912696995329246, 1.2171524777680496,
+    0.53913918725805643, 1.2171420057925375,
+    0.53913220594104838, 1.2171350244755295,
+    0.53910253534376451, 1.2171175711830096,
+    0.53910253534376451, 1.2171105898660015,
+    0.53911649797778038, 1.2171053538782457,
+    0.53913744192880442, 1.2171036085489935,
+    0.53916187653833225, 1.2170879005857256,
+    0.53914442324581235, 1.21705648465919,
+    0.5391182433070324, 1.2170442673544259,
+    0.53906064744171667, 1.2170407766959221,
+    0.53905017546620471, 1.2170355407081659,
+    0.53905541145396063, 1.217026814061906,
+    0.53907286474648064, 1.2170198327448978,
+    0.53913395127030039, 1.2170111060986382,
+    0.53916536719683628, 1.2170111060986382,
+    0.53918456581860819, 1.2170041247816301,
+    0.53917932983085226, 1.216993652806118,
+    0.5391706031845922, 1.2169901621476138,
+    0.53914791390431638, 1.21698667148911,
+    0.53913569659955241, 1.2169796901721022,
+    0.53909729935600847, 1.2169308209530463,
+    0.5391007900145125, 1.2169081316727701,
+    0.53913918725805643, 1.2168749704169823,
+    0.53913918725805643, 1.2168697344292265,
+    0.53912347929478843, 1.2168644984414703,
+    0.53914093258730844, 1.2168522811367064,
+    0.53914267791656034, 1.2168400638319425,
+    0.53912522462404044, 1.2168348278441865,
+    0.53908159139274059, 1.2168295918564305,
+    0.53907286474648064, 1.2168261011979267,
+    0.53903621283218861, 1.2168051572469027,
+    0.53902050486892072, 1.2168016665883987,
+    0.53900130624714881, 1.2168034119176505,
+    0.53897163564986483, 1.2168156292224148,
+    0.53893672906482504, 1.2168191198809186,
+    0.53892276643080905, 1.2168173745516666,
+    0.5389140397845491, 1.2167981759298947,
+    0.53890007715053312, 1.2167911946128867,
+    0.53885644391923326, 1.2167772319788708,
+    0.53884946260222522, 1.2167580333570989,
+    0.53885644391923326, 1.2167510520400906,
+    0.53887738787025719, 1.216740580064579,
+    0.53894545571108499, 1.2167266174305629,
+    0.53897512630836886, 1.2167161454550508,
+    0.53898036229612489, 1.216705673479539,
+    0.53897512630836886, 1.2166917108455231,
+    0.53898559828388082, 1.2166637855774911,
+    0.53900130624714881, 1.216655058931231,
+    0.53904843013695269, 1.2166393509679632,
+    0.53906413810022058, 1.2166131710291832,
+    0.53909031803900054, 1.2166096803706792,
+    0.53913918725805643, 1.2166096803706792,
+    0.53918282048935628, 1.2165800097733954,
+    0.53920376444038021, 1.2165712831271354,
+    0.53928754024447589, 1.2165677924686316,
+    0.53929626689073584, 1.2165538298346157,
+    0.539270086951956, 1.2165451031883556,
+    0.53922994437916005, 1.2165398672005996,
+    0.53921249108664016, 1.2165416125298514,
+    0.53917583917234824, 1.2165503391761114,
+    0.5391531498920723, 1.2165468485176076,
+    0.53914442324581235, 1.2165363765420956,
+    0.5391531498920723, 1.2165189232495757,
+    0.53921772707439608, 1.2164909979815435,
+    0.53924390701317604, 1.2164875073230397,
+    0.53926485096419996, 1.2164909979815435,
+    0.53928404958597187, 1.2165189232495757,
+    0.53929801221998785, 1.2165224139080795,
+    0.53934688143904363, 1.2165241592373317,
+    0.5394097132921154, 1.2165084512740636,
+    0.53944112921865139, 1.2165084512740636,
+    0.5394603278404233, 1.2165032152863078,
+    0.53947079981593526, 1.2164944886400477,
+    0.53946381849892733, 1.2164717993597718,
+    0.53947429047443929, 1.2164595820550077,
+    0.53952490502274708, 1.2164421287624878,
+    0.539577264900307, 1.2164281661284722,
+    0.53960693549759087, 1.216412458165204,
+    0.53964184208263077, 1.216405476848196,
+    0.53965231405814262, 1.2163967502019359,
+    0.5396470780703867, 1.2163810422386681,
+    0.53961566214385082, 1.216370570263156,
+    0.53959820885133081, 1.2163600982876441,
+    0.53959297286357488, 1.216340899665872,
+    0.53961740747310283, 1.2163356636781162,
+    0.53970118327719852, 1.216340899665872,
+    0.53972387255747445, 1.2163339183488642,
+    0.53973783519149043, 1.2163234463733523,
+    0.53975005249625441, 1.2163059930808324,
+    0.53978146842279018, 1.2162885397883123,
+    0.53979892171531019, 1.2162710864957924,
+    0.5398006670445622, 1.2162449065570125,
+    0.53983033764184618, 1.2162291985937443,
+    0.53984779093436608, 1.2162291985937443,
+    0.53986698955613799, 1.2162361799107524,
+    0.53990887745818583, 1.2162623598495323,
+    0.53994378404322574, 1.2162675958372884,
+    0.53994727470172976, 1.2162571238617765,
+    0.53992807607995785, 1.2162431612277602,
+    0.53994902003098177, 1.2162379252400044,
+    0.54000312523779359, 1.2162379252400044,
+    0.5400223238595655, 1.2162361799107524,
+    0.54009388235889721, 1.2161995279964606,
+    0.54008166505413335, 1.2161890560209487,
+    0.5400554851153534, 1.2161820747039409,
+    0.54004850379834535, 1.2161646214114208,
+    0.54004675846909334, 1.216159385423665,
+    0.54005024912759736, 1.2161541494359087,
+    0.54009911834665325, 1.2161332054848848,
+    0.5401078449929132, 1.2161070255461051,
+    0.54010086367590515, 1.216098298899845,
+    0.54007642906637732, 1.216093062912089,
+    0.54004152248133741, 1.2160808456073251,
+    0.54004152248133741, 1.216070373631813,
+    0.5400554851153534, 1.2160616469855532,
+    0.54010435433440918, 1.2160564109977969,
+    0.54011657163917315, 1.2160476843515373,
+    0.54008515571263727, 1.2160389577052773,
+    0.54002057853031349, 1.2160389577052773,
+    0.53999788925003755, 1.2160441936930331,
+    0.53998916260377761, 1.2160616469855532,
+    0.53997519996976162, 1.216070373631813,
+    0.53993156673846177, 1.2160825909365769,
+    0.53990713212893382, 1.2160808456073251,
+    0.53989316949491795, 1.216070373631813,
+    0.53990015081192588, 1.2160599016563012,
+    0.53992633075070584, 1.2160564109977969,
+    0.53994727470172976, 1.2160424483637811,
+    0.5399210947629498, 1.216033721717521,
+    0.53989840548267387, 1.2160319763882692,
+    0.5398163750078302, 1.2160529203392931,
+    0.53979543105680627, 1.2160511750100411,
+    0.53979717638605818, 1.2160389577052773,
+    0.53974307117924647, 1.2160005604617332,
+    0.53970641926495455, 1.2159516912426773,
+    0.53970641926495455, 1.2159482005841735,
+    0.53972212722822244, 1.2159359832794097,
+    0.53972736321597836, 1.2159167846576375,
+    0.53976052447176637, 1.2158940953773616,
+    0.53976226980101838, 1.2158836234018497,
+    0.53975005249625441, 1.2158696607678334,
+    0.53976052447176637, 1.2158661701093296,
+    0.53979019506905024, 1.2158679154385819,
+    0.53981288434932617, 1.2158644247800776,
+    0.53983382830035009, 1.2158504621460617,
+    0.53984779093436608, 1.2158364995120456,
+    0.53983557362960211, 1.215798102268502,
+    0.53984080961735803, 1.215789375622242,
+    0.53982510165409014, 1.2157684316712181,
+    0.53982510165409014, 1.2157544690372022,
+    0.53982859231259417, 1.2157457423909421,
+    0.53984779093436608, 1.2157370157446821,
+    0.53985128159286999, 1.215721307781414,
+    0.53988095219015397, 1.2157073451473981,
+    0.53990713212893382, 1.2156864011963744,
+    0.53990189614117789, 1.2156689479038543,
+    0.53989316949491795, 1.2156637119160985,
+    0.53989491482416996, 1.2156480039528303,
+    0.53988095219015397, 1.2156270600018064,
+    0.53990015081192588, 1.2155799361120025,
+    0.53991760410444578, 1.2155677188072387,
+    0.53995774667724172, 1.2155607374902309,
+    0.53999439859153353, 1.2155624828194829,
+    0.54000661589629761, 1.2155310668929469,
+    0.53999090793302962, 1.2155118682711747,
+    0.54001010655480153, 1.2155013962956629,
+    0.5400554851153534, 1.2154891789908988,
+    0.54006246643236144, 1.2154664897106229,
+    0.54010260900515716, 1.215449036418103,
+    0.54014624223645713, 1.2154472910888512,
+    0.54015322355346507, 1.2154455457595992,
+    0.54015496888271697, 1.2154315831255831,
+    0.54016544085822904, 1.2154263471378273,
+    0.5402090740895289, 1.2154193658208192,
+    0.54022303672354477, 1.2154141298330632,
+    0.54022478205279678, 1.2154019125282993,
+    0.54020383810177297, 1.2153565339677472,
+    0.54020732876027688, 1.2153478073214872,
+    0.5402439806745688, 1.2153286086997155,
+    0.54025619797933278, 1.2153146460656996,
+    0.54024572600382081, 1.2152779941514078,
+    0.54025445265008076, 1.2152500688833756,
+    0.54022478205279678, 1.2152430875663676,
+    0.54020732876027688, 1.2152343609201075,
+    0.54022303672354477, 1.2152099263105798,
+    0.54019860211401693, 1.2151872370303041,
+    0.54021431007728482, 1.2151610570915239,
+    0.54018289415074894, 1.215147094457508,
+    0.54018463948000095, 1.2151331318234921,
+    0.54016544085822904, 1.2150772812874282,
+    0.54016369552897703, 1.2150650639826643,
+    0.54017416750448899, 1.2150528466779005,
+    0.54021954606504086, 1.2150179400928602,
+    0.54023176336980483, 1.2149935054833325,
+    0.54021605540653683, 1.2149725615323084,
+    0.54021605540653683, 1.2149394002765208,
+    0.54017765816299301, 1.2149236923132529,
+    0.54014624223645713, 1.214897512374473,
+    0.54014798756570914, 1.2148468978261648,
+    0.54016544085822904, 1.2148224632166371,
+    0.54017067684598497, 1.2147823206438413,
+    0.54015845954122099, 1.2147648673513212,
+    0.54013402493169316, 1.2147526500465573,
+    0.5400223238595655, 1.2147229794492733,
+    0.53998392661602157, 1.2146880728642335,
+    0.54000312523779359, 1.2146514209499415,
+    0.54004501313984143, 1.2146339676574218,
+    0.54011831696842516, 1.2146182596941537,
+    0.54013577026094517, 1.2145850984383657,
+    0.54011133565141722, 1.21453622921931,
+    0.54011482630992125, 1.2145083039512783,
+    0.54010086367590515, 1.2144925959880102,
+    0.54009388235889721, 1.2144594347322222,
+    0.54005897577385742, 1.2144262734764346,
+    0.54009039170039319, 1.2144105655131665,
+    0.54008166505413335, 1.2143651869526146,
+    0.54011831696842516, 1.2143529696478506,
+    0.54012529828543321, 1.2143320256968266,
+    0.54010260900515716, 1.2143163177335587,
+    0.54006421176161334, 1.2143075910872989,
+    0.54002406918881751, 1.214291883124031,
+    0.53998916260377761, 1.2142657031852508,
+    0.53998218128676967, 1.2142447592342269,
+    0.53999963457928957, 1.2142150886369429,
+    0.53999614392078554, 1.2141906540274152,
+    0.5399717093112576, 1.2141609834301312,
+    0.53999614392078554, 1.2140998969063113,
+    0.53998392661602157, 1.2140632449920197,
+    0.53988095219015397, 1.2140510276872558,
+    0.53986175356838195, 1.2140370650532397,
+    0.539853026922122, 1.2140353197239877,
+    0.53983208297109819, 1.2140353197239877,
+    0.53981462967857818, 1.2140300837362319,
+    0.53978844973979823, 1.2140004131389479,
+    0.53974481650849837, 1.2139864505049316,
+    0.5397151459112145, 1.2139881958341836,
+    0.53968896597243465, 1.2139724878709157,
+    0.53965231405814262, 1.2139724878709157,
+    0.53959995418058282, 1.2139620158954039,
+    0.53960344483908684, 1.213951543919892,
+    0.53958599154656695, 1.2139393266151279,
+    0.5394934890962112, 1.2139253639811123,
+    0.53942891191388742, 1.2139253639811123,
+    0.5393224468295158, 1.2139166373348522,
+    0.53930324820774378, 1.213913146676348,
+    0.53928928557372791, 1.2139044200300879,
+    0.5392369256961681, 1.213883476079064,
+    0.53914442324581235, 1.2138677681157961,
+    0.53912173396553642, 1.2138555508110322,
+    0.53910428067301652, 1.2138206442259925,
+    0.5390850820512445, 1.2138101722504804,
+    0.53890182247978513, 1.2137473403974084,
+    0.53886342523624131, 1.2137438497389046,
+    0.53881630134643743, 1.2137368684218965,
+    0.53875172416411365, 1.2136984711783527,
+    0.53874299751785359, 1.2136967258491007,
+    0.53871158159131771, 1.2137019618368567,
+    0.53869587362804983, 1.2137002165076047,
+    0.53864874973824595, 1.2136635645933129,
+    0.53862955111647404, 1.2136565832763051,
+    0.53861558848245805, 1.2136565832763051,
+    0.53857893656816624, 1.2136496019592971,
+    0.5384864341178105, 1.2136443659715408,
+    0.53845850884977853, 1.213637384654533,
+    0.53841138495997476, 1.213639129983785,
+    0.53834506244839886, 1.2136216766912649,
+    0.53828746658308313, 1.2136199313620131,
+    0.53824557868103529, 1.2136146953742568,
+    0.53821416275449929, 1.2136007327402409,
+    0.53821416275449929, 1.2135954967524851,
+    0.53819670946197951, 1.2135937514232329,
+    0.53818100149871151, 1.213583279447721,
+    0.53808849904835576, 1.2135518635211853,
+    0.53804835647555993, 1.2135501181919333,
+    0.53803264851229193, 1.2135431368749254,
+    0.53798726995174007, 1.2135448822041774,
+    0.53796981665922017, 1.2135501181919333,
+    0.5379575993544562, 1.2135483728626812,
+    0.53796283534221212, 1.2135396462164212,
+    0.5379575993544562, 1.2135344102286654,
+    0.53793316474492836, 1.2135291742409093,
+    0.53791396612315634, 1.2135291742409093,
+    0.53789825815988834, 1.2135204475946495,
+    0.53787731420886453, 1.2135152116068935,
+    0.53787033289185648, 1.2135117209483894,
+    0.53787731420886453, 1.2135064849606334,
+    0.53786684223335246, 1.2135047396313814,
+    0.53784764361158055, 1.2135029943021294,
+    0.53782495433130473, 1.2135082302898852,
+    0.53777259445374481, 1.2135029943021294,
+    0.53770627194216902, 1.2135082302898852,
+    0.53765914805236514, 1.2135117209483894,
+    0.53763820410134133, 1.2135047396313814,
+    0.53760329751630132, 1.2135082302898852,
+    0.53752475769996155, 1.2135274289116573,
+    0.53748810578566975, 1.2135448822041774,
+    0.53746192584688979, 1.2135518635211853,
+    0.53738338603055014, 1.2135605901674451,
+    0.53734149812850218, 1.2135675714844532,
+    0.53726470364141454, 1.2135623354966971,
+    0.53725074100739856, 1.2135588448381933,
+    0.53715823855704281, 1.2135605901674451,
+    0.53709191604546691, 1.2135553541796893,
+    0.53705002814341918, 1.2135570995089413,
+    0.53700814024137133, 1.2135640808259494,
+    0.5369173831202676, 1.2135728074722092,
+    0.53689818449849558, 1.213581534118469,
+    0.53687549521821976, 1.2135885154354771,
+    0.53686327791345578, 1.2135885154354771,
+    0.5368144086944, 1.213581534118469,
+    0.53679346474337597, 1.213581534118469,
+    0.53670096229302033, 1.2135850247769731,
+    0.53663289445219253, 1.213583279447721,
+    0.53661893181817655, 1.213581534118469,
+    0.53519125249004529, 1.2137124338123686,
+    0.53439363702188381, 1.2137246511171327,
+    0.53377753579592979, 1.2137316324341407,
+    0.53347908449383874, 1.2137386137511488,
+    0.53335516611694722, 1.2137351230926445,
+    0.5331980864842677, 1.2137263964463845,
+    0.53290836182843659, 1.2137211604586287,
+    0.53276349950052104, 1.2137124338123686,
+    0.53259594789232956, 1.2137071978246128,
+    0.53245806688142205, 1.2138380975185121,
+    0.53200253594665159, 1.2140457916994998,
+    0.53187338158200403, 1.2141103688818233,
+    0.53089076121313117, 1.2145711358043501,
+    0.53025720669465726, 1.2147858113023451,
+    0.52889759520735358, 1.2152518142126276,
+    0.52750482246426222, 1.2156741838916105,
+    0.52623596809806228, 1.2159569272304334,
+    0.52554656304352454, 1.2158609341215738,
+    0.52508754145025005, 1.2157631956834622,
+    0.52518702521761373, 1.2154961603079066,
+    0.52599511266128707, 1.2155066322834189,
+    0.52613299367219457, 1.2153181367242034,
+    0.52613822965995061, 1.2152937021146757,
+    0.52618186289125046, 1.2152518142126276,
+    0.52619582552526645, 1.215176765054792,
+    0.52623247743955825, 1.2151069518847122,
+    0.52623771342731429, 1.2150737906289244,
+    0.52622724145180233, 1.2150528466779005,
+    0.52622375079329831, 1.2150179400928602,
+    0.52627087468310207, 1.2149725615323084,
+    0.52626389336609414, 1.2149498722520327,
+    0.52624818540282636, 1.2149324189595128,
+    0.52624644007357435, 1.214902748362229,
+    0.52626738402459816, 1.2148870403989609,
+    0.52629705462188203, 1.2148835497404569,
+    0.52633894252392988, 1.214867841777189,
+    0.52635639581644988, 1.2148486431554169,
+    0.52638955707223778, 1.2147351967540372,
+    0.5264262089865297, 1.2146845822057297,
+    0.52648729551034956, 1.2146200050234057,
+    0.52658328861920911, 1.214557173170334,
+    0.52668975370358084, 1.2145240119145462,
+    0.52672466028862064, 1.2145065586220261,
+    0.52673862292263662, 1.2144891053295062,
+    0.52673862292263662, 1.2144611800614742,
+    0.52671244298385667, 1.2143966028791506,
+    0.52672466028862064, 1.2143704229403705,
+    0.52681716273897639, 1.214283156477771,
+    0.52685730531177222, 1.2142360325879669,
+    0.52688173992130016, 1.2141627287593832,
+    0.52687475860429223, 1.2141138595403271,
+    0.52685555998252021, 1.2140964062478075,
+    0.52677876549543257, 1.2140545183457596,
+    0.52675607621515663, 1.2140283384069797,
+    0.52675258555665261, 1.2140073944559557,
+    0.52676305753216457, 1.2139847051756798,
+    0.52683287070224438, 1.2139183826641042,
+    0.52683985201925232, 1.2138956933838283,
+    0.52683287070224438, 1.2138747494328039,
+    0.52681541740972448, 1.213852060152528,
+    0.52676131220291256, 1.2138119175797324,
+    0.52673862292263662, 1.2137892282994565,
+    0.52671942430086471, 1.2136967258491007,
+    0.52670720699610074, 1.2136740365688248,
+    0.52668800837432883, 1.2136496019592971,
+    0.52663913915527294, 1.213607714057249,
+    0.5265815432899571, 1.2135745528014612,
+    0.52648031419334151, 1.2135850247769731,
+    0.5264105010232617, 1.2135867701062251,
+    0.52636512246270994, 1.2135728074722092,
+    0.52626563869534615, 1.2135501181919333,
+    0.52621327881778635, 1.2135344102286654,
+    0.5261713909157385, 1.2135187022653973,
+    0.5261364843306986, 1.2134855410096095,
+    0.52610157774565869, 1.2134628517293335,
+    0.52605794451435883, 1.2134436531075616,
+    0.52593053547896329, 1.2134227091565377,
+    0.52588690224766343, 1.2134087465225218,
+    0.52579265446805568, 1.2133494053279539,
+    0.52572284129797597, 1.2132813374871261,
+    0.52567920806667612, 1.2132080336585425,
+    0.52565651878640007, 1.2131417111469667,
+    0.52564953746939214, 1.2130701526476348,
+    0.52564081082313219, 1.213056190013619,
+    0.52563906549388018, 1.2130160474408229,
+    0.52562684818911631, 1.212993358160547,
+    0.52563557483537626, 1.2128991103809394,
+    0.52559019627482439, 1.212722832126488,
+    0.52556227100679254, 1.212656509614912,
+    0.52556227100679254, 1.2126320750053843,
+    0.52557274298230439, 1.2126076403958563,
+    0.52559543226258032, 1.2125709884815645,
+    0.52565128279864415, 1.2125081566284925,
+    0.52561114022584832, 1.2124645233971927,
+    0.52555179903128046, 1.2124243808243971,
+    0.52550991112923262, 1.2124051822026249,
+    0.52494442445158651, 1.2121992333508895,
+    0.52479781679441895, 1.2120910229372659,
+    0.52476814619713508, 1.212071824315494,
+    0.52472625829508712, 1.2120508803644703,
+    0.52470007835630728, 1.2120334270719502,
+    0.52464597314949535, 1.2119897938406503,
+    0.52450460148008393, 1.2118606394760028,
+    0.52441733501748422, 1.211799552952183,
+    0.52426723670181263, 1.2117192678065911,
+    0.52415029964192905, 1.2116651625997794,
+    0.52397053072897359, 1.2116005854174556,
+    0.52383090438881408, 1.2115534615276518,
+    0.52372094864593843, 1.2115255362596198,
+    0.52359877559829882, 1.2115028469793439,
+    0.52358132230577881, 1.2114993563208398,
+    0.52353419841597504, 1.2114836483575717,
+    0.52341202536833542, 1.211457468418792,
+    0.52307692215195245, 1.2113946365657202,
+    0.52289889856824912, 1.2113702019561925,
+    0.52271389366753773, 1.2113510033344201,
+    0.52263360852194596, 1.2113510033344201,
+    0.52257601265663012, 1.2113527486636724,
+    0.52251318080355835, 1.2113632206391844,
+    0.52246256625525045, 1.2113806739317041,
+    0.52242940499946267, 1.211401617882728,
+    0.5224346409872187, 1.2114469964432801,
+    0.52242940499946267, 1.2114679403943041,
+    0.52241718769469869, 1.2114853936868237,
+    0.52235435584162693, 1.2115133189548557,
+    0.52220600285520735, 1.2115517161983997,
+    0.52216586028241152, 1.2115709148201717,
+    0.52211873639260764, 1.2115831321249355,
+    0.52205066855177995, 1.2115796414664317,
+    0.5219232595163843, 1.2115691694909196,
+    0.52185868233406052, 1.2115761508079277,
+    0.5217539625789408, 1.2116023307467076,
+    0.52153579642244152, 1.2116511999657633,
+    0.52135253685098215, 1.2116738892460395,
+    0.5212931956564143, 1.2116791252337953,
+    0.52117625859653072, 1.2116756345752915,
+    0.52103488692711919, 1.2116616719412756,
+    0.52091445920873158, 1.2116372373317474,
+    0.52083941005089573, 1.2116162933807235,
+    0.52074167161278417, 1.2115604428446598,
+    0.52062997054065652, 1.2115290269181238,
+    0.52054095874880479, 1.2114993563208398,
+    0.5203542085188414, 1.2114644497357998,
+    0.52027217804399761, 1.211424307163004,
+    0.52022330882494183, 1.2114103445289881,
+    0.52010462643580624, 1.2113841645902084,
+    0.52005401188749845, 1.2113667112976882,
+    0.52003481326572643, 1.2113195874078844,
+    0.52001212398545049, 1.2112986434568604,
+    0.51995976410789069, 1.2112567555548128,
+    0.51992311219359888, 1.2112358116037889,
+    0.5198777336330469, 1.2112166129820168,
+    0.51981141112147122, 1.2112218489697728,
+    0.51973636196363548, 1.2112218489697728,
+    0.51967527543981562, 1.211181706396977,
+    0.51962640622075973, 1.2111659984337091,
+    0.51950423317312011, 1.2111537811289452,
+    0.51942918401528437, 1.211152035799693,
+    0.51935762551595266, 1.2111537811289452,
+    0.51920927252953308, 1.2111136385561492,
+    0.51913596870094925, 1.2111031665806371,
+    0.51908011816488553, 1.2111014212513853,
+    0.51895270912948988, 1.2111014212513853,
+    0.51881657344783438, 1.2110857132881172,
+    0.51875897758251854, 1.2110700053248493,
+    0.51872058033897472, 1.2110228814350454,
+    0.51866822046141492, 1.2110019374840215,
+    0.51858793531582315, 1.2109844841915014,
+    0.51856699136479911, 1.2109740122159895,
+    0.51857048202330314, 1.2109460869479576,
+    0.51858618998657113, 1.2109233976676816,
+    0.51857920866956309, 1.2108989630581539,
+    0.51854430208452329, 1.21087801910713,
+    0.51844830897566352, 1.2108500938390978,
+    0.51838198646408773, 1.2108082059370502,
+    0.51832613592802401, 1.2107610820472463,
+    0.5183069373062521, 1.2107331567792143,
+    0.51832089994026798, 1.2106860328894105,
+    0.51831391862326004, 1.2106668342676388,
+    0.51829122934298411, 1.2106371636703548,
+    0.51826330407495214, 1.2106179650485827,
+    0.51817952827085645, 1.2105830584635429,
+    0.51803815660144492, 1.2105306985859832,
+    0.51794390882183716, 1.210499282659447,
+    0.51789154894427736, 1.2104835746961791,
+    0.51770130805580994, 1.2104189975138555,
+    0.5176070602762024, 1.2103910722458235,
+    0.51744823531427087, 1.2103561656607835,
+    0.51738191280269497, 1.2103404576975156,
+    0.5172492677795435, 1.21029158847846,
+    0.51721261586525158, 1.2102741351859398,
+    0.51713756670741584, 1.2102113033328681,
+    0.51709916946387202, 1.2101886140525921,
+    0.51692289120942059, 1.2101240368702681,
+    0.51666632780937738, 1.2100472423831807,
+    0.51642372704335016, 1.2099425226280609,
+    0.51633296992224642, 1.2099128520307771,
+    0.51618461693582696, 1.2098465295192014,
+    0.51610607711948719, 1.2098238402389254,
+    0.51599786670586356, 1.2098046416171535,
+    0.51581286180515207, 1.2097976603001455,
+    0.51566450881873271, 1.2097976603001455,
+    0.51559818630715681, 1.2098028962879013,
+    0.515544081100345, 1.2098133682634133,
+    0.51548997589353318, 1.2098273308974292,
+    0.51544983332073735, 1.2098465295192014,
+    0.51542016272345348, 1.2098657281409733,
+    0.51536605751664166, 1.2099145973600289,
+    0.51535034955337367, 1.2100053544811327,
+    0.51528053638329385, 1.2100175717858968,
+    0.51524213913975003, 1.2100193171151485,
+    0.51519676057919805, 1.2099983731641246,
+    0.51513916471388232, 1.2099879011886128,
+    0.51511298477510248, 1.2099879011886128,
+    0.51509204082407845, 1.2099879011886128,
+    0.51503095430025869, 1.2100070998103847,
+    0.51496986777643894, 1.2100140811273927,
+    0.51492623454513908, 1.2099966278348726,
+    0.51486514802131922, 1.2099547399328248,
+    0.51482326011927138, 1.2099390319695571,
+    0.51466094449883593, 1.2099006347260131,
+    0.51461905659678808, 1.209895398738257,
+    0.51443928768383262, 1.2098971440675093,
+    0.51422286685658536, 1.2098884174212492,
+    0.51416527099126952, 1.2098796907749891,
+    0.5141111657844577, 1.2098779454457371,
+    0.51403960728512599, 1.2098796907749891,
+    0.51391219824973033, 1.2098866720919972,
+    0.51384413040890253, 1.2098866720919972,
+    0.51364341754492315, 1.2098744547872331,
+    0.51349506455850369, 1.2098465295192014,
+    0.51343572336393584, 1.2098395482021933,
+    0.51336416486460412, 1.2098360575436893,
+    0.51330831432854029, 1.2098447841899493,
+    0.51323501049995657, 1.2098762001164853,
+    0.51309189350129303, 1.2099041253845171,
+    0.5130517509284972, 1.2099058707137693,
+    0.5129836830876694, 1.2099006347260131,
+    0.51293306853936149, 1.2098919080797532,
+    0.51288768997880962, 1.2098779454457371,
+    0.5128667460277857, 1.2098604921532172,
+    0.51281787680872981, 1.2098360575436893,
+    0.51272362902912216, 1.2098290762266812,
+    0.51265207052979045, 1.2098011509586495,
+    0.51257876670120661, 1.2097627537151057,
+    0.51253338814065486, 1.2097453004225855,
+    0.51237281784947131, 1.2097034125205377,
+    0.5122523901310837, 1.209680723240262,
+    0.51200629870655245, 1.2096475619844738,
+    0.5119783734385206, 1.2096370900089621,
+    0.5119452121827327, 1.20961789138719,
+    0.51186841769564495, 1.2096021834239219,
+    0.51172879135548544, 1.2095428422293542,
+    0.51162581692961773, 1.2095306249245903,
+    0.51143732137040232, 1.2095149169613224,
+    0.51138147083433849, 1.2095044449858103,
+    0.51132736562752668, 1.2094887370225422,
+    0.51123486317717104, 1.2094538304375024,
+    0.5111266527635473, 1.2093997252306907,
+    0.51111094480027941, 1.2093526013408868,
+    0.51111792611728735, 1.209303732121831,
+    0.51107254755673548, 1.2091920310497035,
+    0.51099924372815175, 1.2091274538673797,
+    0.51097306378937191, 1.2090803299775756,
+    0.51097306378937191, 1.2090576406972999,
+    0.5109556104968519, 1.2090122621367478,
+    0.51095910115535592, 1.2089441942959203,
+    0.51097655444787593, 1.2088953250768644,
+    0.51099575306964773, 1.2087993319680048,
+    0.51099749839889974, 1.2087452267611929,
+    0.51103065965468775, 1.208701593529893,
+    0.51105509426421558, 1.2086858855666252,
+    0.51106033025197162, 1.208668432274105,
+    0.51111443545878343, 1.2086405070060733,
+    0.51111443545878343, 1.2086282897013094,
+    0.51115108737307524, 1.2085898924577654,
+    0.51117028599484726, 1.2085759298237495,
+    0.51123835383567506, 1.2085567312019774,
+    0.51139717879760649, 1.2085235699461898,
+    0.51150015322347409, 1.2084886633611496,
+    0.51153680513776612, 1.2084694647393777,
+    0.51156298507654596, 1.2084485207883537,
+    0.51159789166158587, 1.2084310674958338,
+    0.51161709028335778, 1.2084066328863059,
+    0.51162407160036572, 1.208361254325754,
+    0.51161359962485375, 1.2082687518753985,
+    0.51159091034457793, 1.2082443172658703,
+    0.51144430268741026, 1.208150069486263,
+    0.51142510406563846, 1.2081256348767349,
+    0.51139194280985045, 1.2080575670359071,
+    0.51141288676087449, 1.2079947351828351,
+    0.51142684939489036, 1.2079755365610634,
+    0.51147397328469424, 1.2079563379392915,
+    0.51147920927245027, 1.2079388846467716,
+    0.51144779334591428, 1.2079249220127557,
+    0.51135180023705473, 1.2079092140494876,
+    0.51130816700575477, 1.2078987420739755,
+    0.5112627884452029, 1.2078812887814558,
+    0.51125231646969094, 1.2078585995011797,
+    0.51125580712819496, 1.2078394008794076,
+    0.51129071371323487, 1.2077678423800762,
+    0.5113151483227627, 1.2077399171120442,
+    0.51131689365201471, 1.2077242091487763,
+    0.51130293101799884, 1.2077050105270042,
+    0.51121217389689511, 1.2076491599909405,
+    0.51121740988465114, 1.2076299613691683,
+    0.51123660850642305, 1.2076020361011366,
+    0.51126627910370692, 1.2075793468208607,
+    0.51129245904248688, 1.2075392042480646,
+    0.51125057114043893, 1.207469391077985,
+    0.5111947206043751, 1.2074013232371572,
+    0.5111266527635473, 1.2073367460548332,
+    0.51091372259480405, 1.2071971197146738,
+    0.51084216409547234, 1.2071569771418782,
+    0.51079678553492047, 1.2071412691786101,
+    0.51068159380428879, 1.207122070556838,
+    0.51058909135393316, 1.2071168345690821,
+    0.51050182489133344, 1.2071081079228221,
+    0.51047564495255349, 1.207092399959554,
+    0.51049309824507338, 1.2070784373255381,
+    0.51055942075664917, 1.2070417854112465,
+    0.51063446991448502, 1.2069929161921906,
+    0.51063970590224095, 1.2069824442166786,
+    0.51063272458523301, 1.2069597549364026,
+    0.5105629114151532, 1.2069248483513628,
+    0.51053324081786933, 1.2069004137418349,
+    0.5104442290260176, 1.2068393272180149,
+    0.51042328507499368, 1.2067991846452191,
+    0.51036045322192192, 1.2067398434506511,
+    0.51032729196613391, 1.2066979555486035,
+    0.51031681999062195, 1.2066717756098237,
+    0.51032380130763, 1.2066560676465559,
+    0.51033776394164598, 1.2066455956710438,
+    0.51040059579471775, 1.2065670558547039,
+    0.5104093224409777, 1.2065338945989161,
+    0.51040059579471775, 1.2065216772941523,
+    0.51038488783144975, 1.2065042240016322,
+    0.51034649058790593, 1.2064832800506082,
+    0.51033427328314196, 1.2064710627458441,
+    0.51031158400286603, 1.2064623360995843,
+    0.51025747879605421, 1.2064605907703323,
+    0.51020162825999038, 1.2064501187948202,
+    0.51017893897971445, 1.2064064855635206,
+    0.51018242963821847, 1.2063907776002525,
+    0.51025573346680209, 1.2063680883199766,
+    0.51037441585593779, 1.2062494059308408,
+    0.50892753790603451, 1.2054448091456715,
+    0.50862385061618742, 1.2053767413048437,
+    0.50778958323373424, 1.2049648436013731,
+    0.50713333943498429, 1.2045389832638866,
+    0.50686630405942923, 1.2044621887767986,
+    0.50648931294099842, 1.2047152615183379,
+    0.50490978996794367, 1.2051830097578724,
+    0.5036723515282796, 1.205624578058627,
+    0.5032115846057531, 1.2058863774464263,
+    0.50297072916897789, 1.2061289782124534,
+    0.50279096025602243, 1.2065024786723801,
+    0.50289742534039417, 1.2067887126697072,
+    0.50296549318122186, 1.2070505120575064,
+    0.50297072916897789, 1.2070644746915222,
+    0.50311559149689333, 1.207404813895661,
+    0.50312955413090932, 1.2076474146616885,
+    0.50316795137445325, 1.2079528472807874,
+    0.50312955413090932, 1.2082425719366183,
+    0.50308068491185354, 1.2082774785216586,
+    0.50508432289314298, 1.2091641057816715,
+    0.50635841324709885, 1.2097453004225855,
+    0.50955411110750048, 1.2112253396282766,
+    0.51004280329805884, 1.2114435057847761,
+    0.51154204112552204, 1.2123737662760889,
+    0.51201153469430849, 1.2127315587727476,
+    0.51195393882899265, 1.2128397691863715,
+    0.51163279824662566, 1.2131452018054705,
+    0.51142510406563846, 1.2133825665837417,
+    0.5111441060560673, 1.2136146953742568,
+    0.51028540406408618, 1.2144245281471826,
+    0.50854007481209185, 1.2160878269243329,
+    0.50850167756854792, 1.216440383433236,
+    0.50672667771926971, 1.2167510520400906,
+    0.50531645168365824, 1.2169988887938739,
+    0.49623026759777572, 1.2185993557179526,
+    0.49617267173245999, 1.2186080823642127,
+    0.49598941216100051, 1.2187337460703562,
+    0.4954501054221343, 1.2189082789955559,
+    0.49523193926563508, 1.2189815828241395,
+    0.49488287341523618, 1.2190932838962671,
+    0.4948444761716923, 1.2196605159031655,
+    0.49306598566391002, 1.220096848216164,
+    0.49201355212495745, 1.2204267154447908,
+    0.49075342440501757, 1.2209154076353492,
+    0.48988075977902046, 1.2214826396422473,
+    0.48941475686873792, 1.2217304763960306,
+    0.48939032225920998, 1.2217444390300465,
+    0.48904649239656711, 1.2219346799185142,
+    0.48872186115569621, 1.2221127035022175,
+    0.48868695457065625, 1.2221423740995014,
+    0.48837628596380134, 1.2224530427063562,
+    0.4883186900984855, 1.2227043701186435,
+    0.48827505686718559, 1.2229853681282146,
+    0.48828552884269766, 1.2230691439323105,
+    0.48829425548895755, 1.2232140062602259,
+    0.48829425548895755, 1.2232192422479817,
+    0.48829949147671348, 1.2232908007473136,
+    0.48830472746446951, 1.2233449059541253,
+    0.48805165472293033, 1.2234077378071975,
+    0.48790679239501483, 1.2233990111609374,
+    0.48752456528882809, 1.2233693405636534,
+    0.48711092225610542, 1.2233065087105817,
+    0.48670949652814671, 1.2232384408697536,
+    0.48452259897539779, 1.2229330082506549,
+    0.48404786941885536, 1.2229085736411267,
+    0.48369356758070048, 1.2230150387254985,
+    0.4835871024963288, 1.2230255107010106,
+    0.48271967385808767, 1.2231215038098702,
+    0.48269523924855978, 1.2231215038098702,
+    0.48196743695047811, 1.2230970692003422,
+    0.48191507707291825, 1.2230970692003422,
+    0.48187144384161845, 1.2230970692003422,
+    0.4814106769190919, 1.2230499453105383,
+    0.48098830724010921, 1.2228754123853389,
+    0.48095514598432137, 1.2228352698125431,
+    0.48093943802105349, 1.2228160711907712,
+    0.48058688151215062, 1.2223745028900166,
+    0.48049961504955085, 1.2223169070247009,
+    0.48030937416108355, 1.222234876549857,
+    0.48010691596785215, 1.2221807713430453,
+    0.47997601627395253, 1.2221772806845412,
+    0.47934071642622667, 1.2221336474532414,
+    0.47910684230645939, 1.2221179394899733,
+    0.47904924644114366, 1.2221127035022175,
+    0.478913110759488, 1.2220795422464295,
+    0.47808931535254667, 1.2218753387239463,
+    0.47777341075793578, 1.2217409483715427,
+    0.47774548548990386, 1.2217304763960306,
+    0.47747321412659272, 1.221629247299415,
+    0.47740514628576491, 1.2216048126898871,
+    0.47711891228843784, 1.2215699061048471,
+    0.47639285531960823, 1.2215262728735472,
+    0.47605251611546939, 1.2214686770082315,
+    0.47599492025015355, 1.2214198077891758,
+    0.47598095761613757, 1.2214058451551595,
+    0.47628639023523656, 1.2210899405605486,
+    0.47596524965286963, 1.2209695128421612,
+    0.47513272759966824, 1.2208438491360176,
+    0.47483602162682931, 1.2208037065632218,
+    0.47380802269740463, 1.2205628511264464,
+    0.473668396357245, 1.2205279445414066,
+    0.47289172484010761, 1.2203045423971515,
+    0.4725915282087646, 1.2202713811413632,
+    0.47226689696789365, 1.2202364745563234,
+    0.47211156266446619, 1.2202033133005357,
+    0.47209236404269417, 1.2202033133005357,
+    0.47203825883588235, 1.2201893506665196,
+    0.47201033356785044, 1.2201841146787638,
+    0.47189863249572284, 1.2201649160569918,
+    0.47159843586437988, 1.2202417105440793,
+    0.47157400125485188, 1.2202469465318355,
+    0.47151116940178012, 1.2202609091658516,
+    0.47146753617048021, 1.2203150143726631,
+    0.4714326295854403, 1.2203534116162069,
+    0.47124413402622495, 1.2204755846638466,
+    0.4708950681758261, 1.2206012483699902,
+    0.47083223632275428, 1.2206099750162502,
+    0.47055996495944313, 1.2206640802230622,
+    0.47009047139065674, 1.2206693162108182,
+    0.46988626786817339, 1.2206501175890463,
+    0.46964890308990209, 1.2206204469917623,
+    0.46961050584635827, 1.2206152110040061,
+    0.46908167108300397, 1.2205820497482185,
+    0.46890713815780449, 1.2205855404067223,
+    0.46882859834146479, 1.2205855404067223,
+    0.46878496511016499, 1.2206099750162502,
+    0.46868897200130527, 1.2206536082475501,
+    0.46860694152646154, 1.2207810172829456,
+    0.46858250691693359, 1.2208246505142457,
+    0.468762275829889, 1.2210026740979489,
+    0.46877623846390493, 1.2210183820612168,
+    0.468746567866621, 1.2210271087074769,
+    0.46865406541626542, 1.221046307329249,
+    0.46860694152646154, 1.2210567793047609,
+    0.46844637123527805, 1.2210567793047609,
+    0.46768540768140848, 1.221037580682989,
+    0.46745676954939724, 1.2210323446952327,
+    0.46737473907455357, 1.221013146073461,
+    0.46678830844588348, 1.2209014450013334,
+    0.46669057000777175, 1.2208822463795614,
+    0.46658061426489611, 1.2208438491360176,
+    0.46656490630162811, 1.2208386131482616,
+    0.46656490630162811, 1.2208333771605056,
+    0.46652650905808424, 1.2208386131482616,
+    0.46627518164579707, 1.2208438491360176,
+    0.46600814627024195, 1.2209119169768454,
+    0.46598371166071406, 1.2209154076353492,
+    0.46582314136953057, 1.221037580682989,
+    0.46569747766338704, 1.2211300831333445,
+    0.46568700568787497, 1.2211300831333445,
+    0.46567827904161502, 1.2211335737918485,
+    0.46439895269990317, 1.221007910085705,
+    0.46309344641941141, 1.2208141785387339,
+    0.46271645530098071, 1.2207653093196777,
+    0.46193978378384321, 1.2206728068693222,
+    0.46189615055254329, 1.2206693162108182,
+    0.46189615055254329, 1.2204267154447908,
+    0.46177048684639965, 1.2203481756284511,
+    0.46158199128718436, 1.2202277479100634,
+    0.46121372681501349, 1.2201404814474639,
+    0.46098508868300231, 1.220086376240652,
+    0.46103395790205814, 1.2200183083998242,
+    0.46117358424221772, 1.219810614218837,
+    0.46112122436465791, 1.2196308453058815,
+    0.460761686538747, 1.2193638099303263,
+    0.46069361869791925, 1.2193166860405225,
+    0.46017001992232093, 1.219107246530283,
+    0.45934622451537965, 1.218836720496224,
+    0.45905475453029659, 1.2187442180458685,
+    0.45859573293702205, 1.2186220449982288,
+    0.45829379097642697, 1.2185016172798411,
+    0.45829030031792306, 1.2183654815981855,
+    0.45828506433016702, 1.2182939230988539,
+    0.4582798283424111, 1.2182398178920419,
+    0.45731466126605824, 1.2178139575545555,
+    0.45719946953542656, 1.2177598523477433,
+    0.45710696708507087, 1.2177057471409318,
+    0.45664096417478839, 1.2174299851191168,
+    0.45662700154077246, 1.2174247491313606,
+    0.4565484617244327, 1.2173968238633288,
+    0.45639836340876117, 1.2173566812905328,
+    0.45557456800181984, 1.2171245525000174,
+    0.45479440582617842, 1.2169988887938739,
+    0.45373673629946981, 1.2168767157462346,
+    0.45341734104635484, 1.2167667600033587,
+    0.45307351118371197, 1.2165625564808755,
+    0.45287977963674064, 1.2163775515801638,
+    0.45260750827342949, 1.2162134906304765,
+    0.45220084655771475, 1.2161017895583488,
+    0.45207867351007525, 1.2160005604617332,
+    0.4522252811672427, 1.215820791548778,
+    0.4525150058230738, 1.2157195624521622,
+    0.45254991240811376, 1.2157090904766501,
+    0.45274887994284102, 1.2156898918548782,
+    0.45282567442992883, 1.2156846558671224,
+    0.45309794579323992, 1.2155834267705066,
+    0.45315554165855576, 1.2155642281487347,
+    0.45325677075517135, 1.2153216273827074,
+    0.45328120536469929, 1.2152535595418796,
+    0.45336847182729906, 1.2150790266166802,
+    0.45344177565588278, 1.2149341642887648,
+    0.45345050230214268, 1.2149184563254969,
+    0.45311714441501189, 1.2146618929254536,
+    0.45303336861091614, 1.214560663828838,
+    0.45291817688028441, 1.2144105655131665,
+    0.45290246891701658, 1.2144000935376544,
+    0.45285010903945672, 1.2143808949158825,
+    0.45233174625161432, 1.2141819273811552,
+    0.45164234119707658, 1.2140126304437118,
+    0.45129327534667779, 1.2139637612246559,
+    0.45117808361604611, 1.2138223895552442,
+    0.45119728223781808, 1.2138136629089844,
+    0.45125487810313392, 1.2137700296776843,
+    0.45138577779703348, 1.213677527227329,
+    0.45145908162561732, 1.2136286580082729,
+    0.45151667749093305, 1.2135902607647291,
+    0.45174531562294434, 1.2134157278395297,
+    0.45175927825696027, 1.2133965292177575,
+    0.45174531562294434, 1.2133912932300017,
+    0.45138577779703348, 1.2132324682680702,
+    0.45133167259022167, 1.2130614260013748,
+    0.45128803935892176, 1.2129165636734593,
+    0.4514835162351451, 1.2127036335047159,
+    0.45142417504057736, 1.2126163670421162,
+    0.45106114655616253, 1.2125343365672727,
+    0.45104194793439062, 1.2125343365672727,
+    0.45097911608131885, 1.2124749953727048,
+    0.45080458315611932, 1.2123196610692772,
+    0.45073651531529152, 1.2122376305944336,
+    0.45064401286493594, 1.2121311655100619,
+    0.45061085160914799, 1.2120875322787621,
+    0.45059514364588005, 1.2120683336569902,
+    0.45041188407442062, 1.2118449315127346,
+    0.45042584670843661, 1.2118309688787188,
+    0.45050787718328034, 1.211738466428363,
+    0.45041537473292453, 1.2116756345752915,
+    0.45060037963363603, 1.2116128027222195,
+    0.45075571393706348, 1.2115586975154076,
+    0.45076094992481952, 1.211495865662336,
+    0.45076094992481952, 1.2114138351874923,
+    0.45083774441190727, 1.2113352953711523,
+    0.450919774886751, 1.2112585008840648,
+    0.45093024686226296, 1.2111764704092212,
+    0.45093897350852291, 1.2111328371779209,
+    0.45078887519285138, 1.2110211361057934,
+    0.45060561562139195, 1.210885000424138,
+    0.45061085160914799, 1.2107052315111826,
+    0.45053231179280823, 1.2106912688771665,
+    0.45043631868394857, 1.2106668342676388,
+    0.45032810827032488, 1.2106423996581106,
+    0.45008725283354967, 1.2105603691832669,
+    0.45007678085803771, 1.2105603691832669,
+    0.45009597947980962, 1.2104626307451551,
+    0.45009597947980962, 1.2104539040988953,
+    0.44978182021445073, 1.2102985697954678,
+    0.44952002082665155, 1.2101571981260564,
+    0.44934548790145207, 1.2097749710198695,
+    0.44934897855995609, 1.2097749710198695,
+    0.44951478483889551, 1.209649307313726,
+    0.44935421454771202, 1.2095620408511263,
+    0.44934897855995609, 1.2095568048633702,
+    0.449392611791256, 1.2095323702538425,
+    0.44950431286338355, 1.2094695384007703,
+    0.44936468652322409, 1.209338638706871,
+    0.44941704640078389, 1.2092566082320273,
+    0.44942228238853982, 1.2092461362565152,
+    0.44930534532865624, 1.2091745777571836,
+    0.44921458820755256, 1.2091152365626154,
+    0.44919364425652852, 1.2091012739285996,
+    0.44919888024428456, 1.2090960379408435,
+    0.44926171209735632, 1.2089948088442282,
+    0.44925822143885241, 1.2089895728564719,
+    0.44914652036672476, 1.2089267410034004,
+    0.44904878192861303, 1.2088691451380842,
+    0.44871367871223011, 1.2087382454441848,
+    0.44876778391904193, 1.2086789042496171,
+    0.44881141715034184, 1.208630035030561,
+    0.44884981439388566, 1.2085916377870174,
+    0.44883585175986973, 1.2084659740808736,
+    0.44883061577211381, 1.20839267025229,
+    0.44895627947825734, 1.2083455463624859,
+    0.44893184486872945, 1.2082914411556744,
+    0.44884108774762577, 1.2081169082304748,
+    0.44883061577211381, 1.2081029455964589,
+    0.44877301990679797, 1.2080156791338594,
+    0.44867004548093031, 1.2078690714766915,
+    0.44887424900341361, 1.2076753399297204,
+    0.44894755283199739, 1.2075601481990887,
+    0.44901562067282519, 1.2074432111392051,
+    0.44917444563475667, 1.2072198089949497,
+    0.44918491761026863, 1.2072110823486897,
+    0.449392611791256, 1.2069772082289227,
+    0.44941181041302786, 1.2069580096071506,
+    0.44947987825385566, 1.2068812151200627,
+    0.44946591561983973, 1.206827109913251,
+    0.44944671699806782, 1.2067258808166352,
+    0.44944148101031178, 1.2067014462071075,
+    0.44929138269464025, 1.2064728080750962,
+    0.44916048300074068, 1.2061534128219813,
+    0.44916571898849661, 1.2061429408464692,
+    0.44922855084156849, 1.2060329851035938,
+    0.44956714471645531, 1.2054221198653958,
+    0.44993540918862618, 1.2047571494203859,
+    0.4499563531396501, 1.2047239881645977,
+    0.45000347702945398, 1.2046314857142424,
+    0.44979054686071068, 1.2045145486543585,
+    0.44926694808511236, 1.2042283146570316,
+    0.44911684976944088, 1.204151520169944,
+    0.44908368851365299, 1.2041323215481716,
+    0.4490435459408571, 1.204083452329116,
+    0.44902434731908514, 1.204059017719588,
+    0.44893184486872945, 1.2039420806597045,
+    0.44859848698159849, 1.2035214563099739,
+    0.44853914578703075, 1.20344815248139,
+    0.44851994716525878, 1.2034184818841063,
+    0.44845711531218702, 1.2033172527874905,
+    0.44835065022781534, 1.2032003157276068,
+    0.44821451454615979, 1.2030659253752032,
+    0.44805568958422831, 1.2029629509493356,
+    0.44803998162096031, 1.202866957840476,
+    0.44788115665902883, 1.2027203501833081,
+    0.44780785283044505, 1.2026575183302368,
+    0.44776945558690129, 1.2026191210866928,
+    0.44752685482087401, 1.202551053245865,
+    0.44746402296780219, 1.2024986933683051,
+    0.44743435237051826, 1.2024742587587771,
+    0.44739071913921846, 1.2024341161859813,
+    0.44733312327390262, 1.2024061909179493,
+    0.44723014884803497, 1.2023520857111376,
+    0.44696485880173181, 1.2023276511016097,
+    0.44683744976633627, 1.20227529122405,
+    0.4466297555853489, 1.2022595832607819,
+    0.44654248912274924, 1.2022700552362939,
+    0.44646045864790551, 1.20228401787031,
+    0.44634352158802182, 1.2022944898458217,
+    0.44613931806553853, 1.2023084524798378,
+    0.4457867615566356, 1.2023189244553496,
+    0.44557208605864029, 1.2023765203206653,
+    0.44550576354706461, 1.2023957189424375,
+    0.4454516583402528, 1.2024306255274775,
+    0.44531028667084116, 1.2024829854050372,
+    0.44508862985583791, 1.2025807238431487,
+    0.44485999172382668, 1.2026295930622048,
+    0.44468022281087127, 1.2026191210866928,
+    0.44452488850744376, 1.202561525221377,
+    0.44428403307066849, 1.2025126560023212,
+    0.44404143230464138, 1.2024550601370052,
+    0.44399779907334147, 1.2024445881614934,
+    0.44380406752637014, 1.2024149175642094,
+    0.44357019340660286, 1.2024149175642094,
+    0.44356495741884683, 1.2024149175642094,
+    0.44350212556577506, 1.2023677936744057,
+    0.44346896430998711, 1.2023084524798378,
+    0.44346372832223119, 1.2023032164920817,
+    0.44343405772494726, 1.2022944898458217,
+    0.44332759264057564, 1.2022944898458217,
+    0.44316876767864416, 1.2022997258335779,
+    0.44314956905687219, 1.2022892538580658,
+    0.44304659463100454, 1.202245620626766,
+    0.44289649631533307, 1.2021932607492061,
+    0.44282842847450532, 1.2021635901519223,
+    0.44246016400233446, 1.2020414171042826,
+    0.44177250427704867, 1.2019314613614069,
+    0.44158749937633729, 1.201877356154595,
+    0.44143216507290983, 1.2017848537042397,
+    0.44128730274499423, 1.2017324938266798,
+    0.44124890550145046, 1.2017132952049077,
+    0.44103073934495113, 1.201634755388568,
+    0.44078290259116787, 1.2015666875477402,
+    0.44069563612856821, 1.2015422529382123,
+    0.44069040014081218, 1.2015387622797085,
+    0.44062756828774041, 1.2014514958171085,
+    0.44055426445915669, 1.2013973906102966,
+    0.4403710048876972, 1.2012717269041531,
+    0.44033609830265735, 1.2012472922946253,
+    0.44017727334072587, 1.2011251192469856,
+    0.43993467257469865, 1.201048324759898,
+    0.4394494710426442, 1.2008929904564705,
+    0.43920687027661703, 1.2008353945911545,
+    0.43899394010787374, 1.2007865253720986,
+    0.43895030687657388, 1.2007725627380827,
+    0.43881417119491828, 1.2007236935190271,
+    0.43874610335409059, 1.2006416630441834,
+    0.43873737670783053, 1.2005683592155993,
+    0.43869374347653078, 1.2004706207774876,
+    0.43862567563570287, 1.2003117958155562,
+    0.43861520366019091, 1.2002925971937843,
+    0.43860647701393102, 1.2002768892305162,
+    0.43858727839215911, 1.2002384919869726,
+    0.43847034133227542, 1.200039524452245,
+    0.43846510534451938, 1.1999958912209452,
+    0.43845114271050351, 1.1998510288930295,
+    0.43852444653908723, 1.1997445638086581,
+    0.43845986935676345, 1.1995700308834585,
+    0.43860124102617498, 1.1993605913732193,
+    0.438611713001687, 1.1993326661051875,
+    0.43861520366019091, 1.1993169581419194,
+    0.43860647701393102, 1.1993134674834154,
+    0.43826264715128815, 1.1992052570697918,
+    0.4381596727254205, 1.1989242590602207,
+    0.43818410733494839, 1.1988038313418332,
+    0.43820854194447628, 1.1986729316479336,
+    0.43832547900435992, 1.1985507586002939,
+    0.43840750947920365, 1.1984495295036781,
+    0.43837783888191972, 1.198285468553991,
+    0.43848953995404738, 1.1981144262872954,
+    0.43849477594180331, 1.1981056996410353,
+    0.43832024301660399, 1.1980620664097354,
+    0.43801481039750489, 1.1979939985689079,
+    0.43789787333762126, 1.1979835265933956,
+    0.43748597563415065, 1.1979014961185521,
+    0.43683671315240874, 1.1976780939742968,
+    0.43633231299858238, 1.197615262121225,
+    0.43595357655089961, 1.1976257340967369,
+    0.43583838482026799, 1.197615262121225,
+    0.43516817838750216, 1.1975471942803972,
+    0.43486798175615915, 1.1974651638055536,
+    0.43484878313438718, 1.1973831333307099,
+    0.43481911253710326, 1.197266196270826,
+    0.43481038589084331, 1.1972522336368101,
+    0.43478071529355949, 1.1971946377714944,
+    0.43461665434387198, 1.1970096328707831,
+    0.43458174775883202, 1.1969764716149951,
+    0.43464981559965982, 1.1965645739115243,
+    0.43400055311791796, 1.1966169337890842,
+    0.43374398971787476, 1.1968595345551114,
+    0.43355374882940745, 1.1971108619673987,
+    0.43319072034499262, 1.1975681382314212,
+    0.43292368496943745, 1.1978386642654804,
+    0.43248211666868286, 1.1980620664097354,
+    0.43118359170519904, 1.19846872812545,
+    0.43092702830515595, 1.1985507586002939,
+    0.43076645801397245, 1.1985996278193498,
+    0.43027776582341398, 1.1987549621227773,
+    0.42957439813486037, 1.198836992597621,
+    0.42700003748816873, 1.1991912944357759,
+    0.42419703870946585, 1.199521161664403,
+    0.42354777622772388, 1.199521161664403,
+    0.42307304667118145, 1.1996189001025144,
+    0.42264195034593882, 1.1998161223079897,
+    0.42210264360707261, 1.1999470220018895,
+    0.42149177836887464, 1.2000499964277571,
+    0.4213416800532031, 1.200069195049529,
+    0.42154064758793042, 1.2007289295067829,
+    0.41977611971416418, 1.2008161959693826,
+    0.41943578051002528, 1.2010378527843861,
+    0.41892788969769496, 1.2012856895381689,
+    0.41887902047863906, 1.2012909255259252,
+    0.41816692614382533, 1.2014026265980529,
+    0.41753686228385545, 1.2014270612075806,
+    0.41667816029187421, 1.2014741850973845,
+    0.41482636595550831, 1.2011792244537975,
+    0.41443890286156554, 1.2004706207774876,
+    0.41385596289139936, 1.1999435313433855,
+    0.41302169550894607, 1.1992733249106198,
+    0.41072484221332162, 1.1991092639609322,
+    0.40921164175184255, 1.1989975628888045,
+    0.40692875109023391, 1.1984495295036781,
+    0.40692351510247798, 1.1984495295036781,
+    0.4067053489459786, 1.1983971696261184,
+    0.40423221739590265, 1.1978055030096924,
+    0.40371385460806031, 1.1981004636532795,
+    0.40215353025677736, 1.1989870909132925,
+    0.39790539885742326, 1.1988858618166771,
+    0.3961653055931848, 1.1992209650330599,
+    0.39307258215865093, 1.1998126316494859,
+    0.39049822151195923, 1.1994007339460153,
+    0.39039699241534359, 1.199700930577358,
+    0.38984372304246145, 1.2013432854034849,
+    0.38743342334545722, 1.2028128526336641,
+    0.38702152564198661, 1.2035982507970615,
+    0.3837874305380411, 1.2054308465116557,
+    0.3835413391135099, 1.2055722181810671,
+    0.38350294186996597, 1.205591416802839,
+    0.38299330572838364, 1.2058811414586701,
+    0.38224106882077413, 1.206235443296825,
+    0.3820822438588426, 1.2064344108315523,
+    0.38178553788600361, 1.2065600745376959,
+    0.38089367463823448, 1.2070016428384505,
+    0.3777573179724007, 1.2089895728564719,
+    0.37617255901158986, 1.2091588697939157,
+    0.37605038596395018, 1.2091745777571836,
+    0.3715317285305369, 1.2096545433014818,
+    0.370285563444613, 1.2092618442197833,
+    0.36963630096287103, 1.2091937763789553,
+    0.36909873955325678, 1.209008771478244,
+    0.36837617324293115, 1.2087609347244608,
+    0.36723123725362289, 1.2083595089965022,
+    0.36695023924405179, 1.2081710134372867,
+    0.36693104062227982, 1.2078655808181877,
+    0.36689787936649199, 1.2074920803582609,
+    0.36770771213941739, 1.2064256841852923,
+    0.3683081054021034, 1.206235443296825,
+    0.36875490969061392, 1.2060905809689093,
+    0.36795380356394852, 1.2053872132803556,
+    0.36770771213941739, 1.2051690471238565,
+    0.36757157645776178, 1.2050521100639728,
+    0.36207902530173564, 1.2062947844913929,
+    0.36164269298873708, 1.2063960135880083,
+    0.35864072667530683, 1.2053243814272838,
+    0.35674878976614494, 1.2052650402327163,
+    0.35633689206267422, 1.2052493322694482,
+    0.35247098776950686, 1.2051358858680685,
+    0.35011130262081047, 1.2050713086857447,
+    0.35134699573122252, 1.2044569527890427,
+    0.35149534871764199, 1.2043801583019549,
+    0.3517100242156373, 1.2042754385468353,
+    0.35171176954488925, 1.2042736932175833,
+    0.3517362041544172, 1.2042667119005752,
+    0.35322671533562039, 1.20350923900521,
+    0.35366130231936699, 1.2033102714704824,
+    0.3544309925194965, 1.2029873855588638,
+    0.35467882927327965, 1.2017551831069557,
+    0.35472769849233554, 1.201605084791284,
+    0.35489350477127496, 1.2010099275163539,
+    0.35493713800257487, 1.2008214319571386,
+    0.35481321962568324, 1.2006957682509949,
+    0.35457760017666401, 1.2004845834115039,
+    0.35420759037524113, 1.2000971203175608,
+    0.35407145469358564, 1.1999679659529134,
+    0.35402433080378176, 1.1999121154168495,
+    0.35385328853708636, 1.1997410731501541,
+    0.35284448822943365, 1.1986921302697056,
+    0.35262632207293437, 1.1984460388451743,
+    0.3499873842439189, 1.1971387872354304,
+    0.3490658503988659, 1.1968717518598753,
+    0.34893669603421834, 1.1968350999455835,
+    0.34796803829936152, 1.1965610832530205,
+    0.3490658503988659, 1.1962259800366377,
+    0.34952138133363642, 1.1960880990257299,
+    0.35302425714238905, 1.1953899673249322,
+    0.35029107153376593, 1.1942764472621601,
+    0.3490658503988659, 1.1937598298035696,
+    0.34867489664641915, 1.1935957688538821,
+    0.34769053094829439, 1.19303377283474,
+    0.34302002986995755, 1.1938505869246734,
+    0.34128342726422317, 1.1941595102022762,
+    0.33844203124197642, 1.1947895740622463,
+    0.33470353598420455, 1.1952625582895369,
+    0.33319382618122945, 1.1955295936650918,
+    0.33133155986935153, 1.1958437529304509,
+    0.32698045404412968, 1.1957250705413152,
+    0.3261060440888805, 1.1956953999440312,
+    0.32499776001386405, 1.1956692200052514,
+    0.32475166858933291, 1.195765213114111,
+    0.32466091146822923, 1.195796629040647,
+    0.32444449064098191, 1.1958821501739947,
+    0.32426297639877449, 1.1959467273563185,
+    0.32417920059467881, 1.1959816339413583,
+    0.32391914653613157, 1.1960793723794698,
+    0.32360324194152063, 1.1961893281223457,
+    0.32333969722446948, 1.1962870665604572,
+    0.32323672279860177, 1.1963184824869932,
+    0.32297841406930666, 1.196417966254357,
+    0.32246703259847231, 1.1965890085210522,
+    0.32226981039299696, 1.1966483497156202,
+    0.3216973423983428, 1.1968350999455835,
+    0.32159262264322314, 1.1968630252136154,
+    0.32124355679282429, 1.1969764716149951,
+    0.32101666399006507, 1.1969415650299551,
+    0.32079849783356579, 1.1969031677864115,
+    0.32038834545934702, 1.1968403359333393,
+    0.32023126582666755, 1.1968124106653075,
+    0.32004975158446014, 1.1967844853972758,
+    0.31908458450810728, 1.1966239151060922,
+    0.31877740655975634, 1.1965785365455401,
+    0.31811243611474649, 1.1964703261319167,
+    0.31771450104529181, 1.196409239608097,
+    0.31737939782890884, 1.1963533890720333,
+    0.31720137424520539, 1.1963272091332531,
+    0.31698669874721008, 1.1962888118897093,
+    0.31668650211586713, 1.1962434333291574,
+    0.31658003703149545, 1.1962207440488815,
+    0.31635838021649221, 1.1961875827930937,
+    0.31623446183960058, 1.1954370912147361,
+    0.3159639358055415, 1.1941193676294806,
+    0.31596219047628948, 1.1940914423614484,
+    0.31592553856199757, 1.1939099281192411,
+    0.31592553856199757, 1.1938854935097132,
+    0.31617512064503278, 1.192698669618357,
+    0.31633918159472024, 1.1921052576726789,
+    0.31653465847094359, 1.1913338221432972,
+    0.3165713103852355, 1.1911959411323898,
+    0.3165887636777554, 1.1911697611936098,
+    0.3168016938464987, 1.1902901152506049,
+    0.31581209216061795, 1.1893581094300398,
+    0.31538099583537532, 1.1889776276531052,
+    0.31530420134828763, 1.1889147958000332,
+    0.31501098603395256, 1.1886547417414861,
+    0.31479107454820127, 1.1884679915115226,
+    0.31436346888146266, 1.188059584466556,
+    0.3141732279929953, 1.1878885421998608,
+    0.31415926535897931, 1.1878780702243488,
+    0.31413308542019941, 1.1878623622610807,
+    0.31410865081067146, 1.1878518902855686,
+    0.31389921130043213, 1.1876529227508414,
+    0.31298465877238713, 1.186822146026892,
+    0.31263733825124029, 1.1865062414322813,
+    0.31240171880222106, 1.1862845846172778,
+    0.31148193028641996, 1.1865603466390928,
+    0.31058483105089496, 1.186822146026892,
+    0.31015198939640032, 1.1869495550622875,
+    0.309321212672451, 1.1871956464868187,
+    0.30917460501528354, 1.1872375343888668,
+    0.30913620777173961, 1.1872462610351266,
+    0.30897738280980813, 1.1872968755834346,
+    0.30833335631582226, 1.1874836258133981,
+    0.30673812537949946, 1.1878326916637967,
+    0.30534884329491196, 1.188127652307384,
+    0.30528252078333612, 1.1881381242828959,
+    0.30408173425796403, 1.188389451695183,
+    0.30399621312461633, 1.188403414329199,
+    0.30163129198816402, 1.1888903611905053,
+    0.30161732935414809, 1.1888938518490093,
+    0.29985280148038179, 1.1877017919698971,
+    0.29681069259415571, 1.186822146026892,
+    0.29678102199687179, 1.1868134193806319,
+    0.29647035339001676, 1.1867278982472844,
+    0.29617713807568169, 1.1866388864554327,
+    0.29589614006611065, 1.186549874663581,
+    0.29550867697216793, 1.1864346829329493,
+    0.29513517651224114, 1.1863142552145616,
+    0.29411590422907646, 1.1859704253519188,
+    0.29374763975690565, 1.1858517429627833,
+    0.29336366732146685, 1.1857330605736476,
+    0.29277374603429279, 1.1855445650144323,
+    0.29235137635531017, 1.1854014480157686,
+    0.29213495552806285, 1.185324653528681,
+    0.29190806272530362, 1.1849895503122982,
+    0.29183301356746788, 1.1848621412769025,
+    0.29179810698242797, 1.1848167627163506,
+    0.29174225644636409, 1.1847260055952469,
+    0.29152758094836884, 1.1844083556713838,
+    0.2915048916680929, 1.1843821757326041,
+    0.29115408048844205, 1.1838463596522419,
+    0.29107554067210228, 1.1837433852263739,
+    0.29064095368835569, 1.183116812024908,
+    0.2903774089713046, 1.1827520382112413,
+    0.29012084557126139, 1.1823733017635587,
+    0.29011211892500144, 1.1823296685322588,
+    0.28998994587736188, 1.1821621169240673,
+    0.28992187803653408, 1.1820696144737113,
+    0.28969498523377479, 1.1817118219770526,
+    0.28936860866365183, 1.1812144031402343,
+    0.28895496563092921, 1.1806663697551081,
+    0.28786413484843276, 1.1797256372882832,
+    0.28777512305658104, 1.1796697867522195,
+    0.28748016241299396, 1.17946034724198,
+    0.28635966103321364, 1.1786906570418505,
+    0.2863439530699457, 1.1786889117125985,
+    0.28527232090922117, 1.1786330611765345,
+    0.28423210467503252, 1.1785841919574789,
+    0.28241172626520245, 1.1784550375928311,
+    0.28200506454948776, 1.1784288576540514,
+    0.28191954341614006, 1.1783293738866876,
+    0.28173279318617667, 1.1780832824621565,
+    0.28134009410447791, 1.1776155342226218,
+    0.28114461722825457, 1.1773624614810827,
+    0.28110447465545874, 1.1773188282497828,
+    0.28082173131663563, 1.1769645264116282,
+    0.28085663790167548, 1.1769453277898561,
+    0.28097182963230716, 1.1768598066565086,
+    0.28183402228279236, 1.1762471960890586,
+    0.28212898292637933, 1.1760290299325591,
+    0.28232969579035877, 1.1758911489216515,
+    0.28293881569930479, 1.1754478352916451,
+    0.28302259150340048, 1.1753919847555814,
+    0.28308193269796827, 1.1753378795487692,
+    0.28313952856328412, 1.1752959916467214,
+    0.2833245334639955, 1.1751703279405779,
+    0.28366312733888238, 1.1749190005282906,
+    0.28383591493482985, 1.1748020634684071,
+    0.2838708215198697, 1.1747741382003754,
+    0.28389874678790167, 1.1747584302371075,
+    0.28406280773758907, 1.1746310212017117,
+    0.28441187358798797, 1.1743814391186764,
+    0.28500354020441399, 1.1739468521349301,
+    0.28595299931749896, 1.1732050872028323,
+    0.28630555582640183, 1.172946778473537,
+    0.28607168170663455, 1.1708070048105921,
+    0.28601583117057072, 1.1701629783166061,
+    0.28479933668193069, 1.1697667885764036,
+    0.28457069854991945, 1.1696882487600635,
+    0.28448343208731974, 1.1696620688212838,
+    0.28360727680281861, 1.1693758348239567,
+    0.28359331416880262, 1.1693688535069489,
+    0.28352524632797488, 1.1693356922511611,
+    0.28260022182441785, 1.1690337502905659,
+    0.28230526118083082, 1.1689045959259183,
+    0.28218134280393919, 1.1688539813776104,
+    0.28198412059846389, 1.1687632242565067,
+    0.28190558078212413, 1.1687335536592227,
+    0.28071177557375998, 1.1681977375788606,
+    0.27992812273961454, 1.1678381997529497,
+    0.27925268031909273, 1.1672552597827837,
+    0.27913399792995713, 1.1671540306861681,
+    0.27785467158824528, 1.1661783916343029,
+    0.277627778785486, 1.1660073493676077,
+    0.2768336539758286, 1.1654313907144493,
+    0.27672718889145692, 1.1653580868858657,
+    0.27654043866149353, 1.1652184605457063,
+    0.27623675137164655, 1.1650072757062151,
+    0.2762192980791266, 1.164989822413695,
+    0.27588943085049966, 1.1647524576354238,
+    0.27446349685162025, 1.1636720988284392,
+    0.2743430691332327, 1.1635830870365877,
+    0.27429943590193279, 1.1635569070978076,
+    0.27399749394133777, 1.1633230329780402,
+    0.27387183023519424, 1.1632340211861887,
+    0.27329063559428013, 1.1627837262391743,
+    0.27320336913168036, 1.1627208943861025,
+    0.27317369853439644, 1.1626894784595663,
+    0.27303581752348893, 1.1625882493629509,
+    0.27264486377104213, 1.1622863074023557,
+    0.27114213528507503, 1.1616632248593939,
+    0.27110024738302724, 1.1616492622253778,
+    0.26967256805489581, 1.1610575956089519,
+    0.26889589653775836, 1.160656169880993,
+    0.26879466744114267, 1.1605898473694172,
+    0.26840545901794799, 1.160383898517682,
+    0.26838102440842004, 1.1603681905544141,
+    0.26841244033495598, 1.1603036133720903,
+    0.26887495258673444, 1.1595129792209369,
+    0.26905995748744582, 1.1591482054072699,
+    0.26916467724256549, 1.1590155603841183,
+    0.26931128489973305, 1.1587607423133273,
+    0.26961497218958003, 1.1581463864166253,
+    0.26978252379777151, 1.1578235005050062,
+    0.270257253354314, 1.1568443707946376,
+    0.27012460833116236, 1.1568094642095974,
+    0.26966035075013189, 1.1566785645156981,
+    0.26907566545071376, 1.1565179942245145,
+    0.26893778443980626, 1.1564761063224667,
+    0.26722038045584384, 1.1560013767659243,
+    0.26567052808007285, 1.1555406098433976,
+    0.2655256657521573, 1.155502212599854,
+    0.26510504140242663, 1.1553748035644582,
+    0.26410496774103392, 1.1550885695671314,
+    0.26241723435435538, 1.1545946413888168,
+    0.26195297677332496, 1.1545771880962969,
+    0.26132640357185893, 1.154547517499013,
+    0.26052180678668957, 1.154514356243225,
+    0.25951475180828881, 1.1544654870241693,
+    0.25797886206653386, 1.1544078911588533,
+    0.25692817385683325, 1.1543660032568055,
+    0.2548285427666841, 1.1542874634404658,
+    0.25335024889024488, 1.1542298675751499,
+    0.25357190570524818, 1.1535840957519121,
+    0.25380054383725942, 1.1529173799776502,
+    0.25386512101958325, 1.152643363285087,
+    0.2539000276046231, 1.1525316622129596,
+    0.2539593687991909, 1.1523012787516964,
+    0.25403092729852267, 1.1519626848768094,
+    0.25404314460328664, 1.1519155609870053,
+    0.25405187124954665, 1.1518858903897216,
+    0.25413215639513836, 1.1517026308182623,
+    0.25431716129584975, 1.1512470998834916,
+    0.25434857722238563, 1.151180777371916,
+    0.2543939557829375, 1.1509294499596285,
+    0.25453532745234903, 1.1502173556248152,
+    0.25485297737621199, 1.1495157332655133,
+    0.25525963909192667, 1.1486291060055001,
+    0.25485297737621199, 1.1481037619006498,
+    0.2544794769162852, 1.1476011070760757,
+    0.25443758901423735, 1.1475539831862716,
+    0.25444457033124529, 1.1475539831862716,
+    0.2543520678808896, 1.1474475181018999,
+    0.25430494399108577, 1.1473794502610721,
+    0.25378832653249545, 1.1466935358650383,
+    0.25377785455698348, 1.1466673559262586,
+    0.25377087323997549, 1.1466237226949587,
+    0.25359808564402803, 1.1458487965070732,
+    0.25352827247394827, 1.1456236490335658,
+    0.25351430983993234, 1.1454578427546267,
+    0.25332057829296101, 1.144660227286465,
+    0.25333977691473292, 1.1445432902265815,
+    0.25318095195280144, 1.144082523304055,
+    0.25305703357590981, 1.1435676511747168,
+    0.25305528824665785, 1.1431871693977818,
+    0.25308321351468976, 1.1422185116629251,
+    0.25310590279496564, 1.1409897998695211,
+    0.25318967859906139, 1.1398675531604887,
+    0.25249678288601962, 1.1395307046148537,
+    0.25231177798530824, 1.1394434381522542,
+    0.25210059314581695, 1.1393369730678824,
+    0.25150019988313088, 1.1390489937413031,
+    0.25113891672796806, 1.1388709701575999,
+    0.25095216649800473, 1.138787194353504,
+    0.25055074077004597, 1.1378447165574272,
+    0.25002539666519569, 1.1365374649476834,
+    0.24946689130455749, 1.1361360392197246,
+    0.24814916771930179, 1.1352022880699078,
+    0.24805666526894607, 1.1351289842413239,
+    0.2479711441355984, 1.1350713883760084,
+    0.24759938900492356, 1.134797371683445,
+    0.24742660140897613, 1.1346786892943095,
+    0.24737249620216434, 1.1346350560630096,
+    0.24715956603342099, 1.1344832124180861,
+    0.24711767813137311, 1.1344622684670622,
+    0.24711069681436518, 1.1344587778085584,
+    0.2459814687883248, 1.1336122931213408,
+    0.2456865081447378, 1.1333958722940936,
+    0.24536013157461481, 1.1331305822477904,
+    0.24460614933775329, 1.1325389156313646,
+    0.24434609527920614, 1.1323242401333691,
+    0.24396561350227136, 1.132011826197262,
+    0.24316625270485795, 1.1313712903617801,
+    0.243154035400094, 1.1313625637155202,
+    0.24213825377543333, 1.1305457496255868,
+    0.24158672973180312, 1.1300954546785724,
+    0.24115039741880451, 1.1297516248159296,
+    0.2407524623493498, 1.1294287389043105,
+    0.24009970920910392, 1.1289103761164681,
+    0.23942252145933013, 1.128358852072838,
+    0.23926718715590262, 1.1282366790251983,
+    0.23911010752322312, 1.128084835380275,
+    0.23898618914633155, 1.1279329917353513,
+    0.23877151364833626, 1.1276973722863324,
+    0.23850622360203308, 1.127372741045461,
+    0.23829678409179378, 1.1271406122549459,
+    0.23941903080082616, 1.126789801075295,
+    0.24244717705303628, 1.1258595405839822,
+    0.2437980618940799, 1.1256640637077588,
+    0.24430246204790629, 1.125587269220671,
+    0.24434609527920614, 1.1255802879036632,
+    0.24506691626027977, 1.1254738228192913,
+    0.24531475301406297, 1.1254319349172437,
+    0.24551197521953835, 1.1254075003077155,
+    0.24583137047265333, 1.1253586310886599,
+    0.24589769298422909, 1.1253254698328718,
+    0.24613156710399631, 1.1251928248097205,
+    0.24633402529722767, 1.1250846143960966,
+    0.24640732912581143, 1.1246727166926258,
+    0.24649634091766315, 1.1241002486979719,
+    0.24655568211223094, 1.1238000520666287,
+    0.24659757001427879, 1.1235120727400498,
+    0.24660804198979078, 1.1234876381305217,
+    0.24672323372042243, 1.1228017237344881,
+    0.24676163096396628, 1.1226184641630286,
+    0.24686111473132996, 1.1220372695221146,
+    0.24689427598711786, 1.1217580168417955,
+    0.24690823862113381, 1.121536360026792,
+    0.2469326732306617, 1.1214333856009246,
+    0.24697979712046556, 1.1210808290920218,
+    0.24708451687558525, 1.1204176039762639,
+    0.24629737338293581, 1.1196164978495984,
+    0.24601288471486069, 1.1193407358277834,
+    0.24557480707261012, 1.1188939315392727,
+    0.24520654260043936, 1.1185343937133618,
+    0.24455902544794944, 1.117886876560872,
+    0.24434609527920614, 1.1176844183676409,
+    0.24377886327230797, 1.1171451116287745,
+    0.24372475806549615, 1.1171555836042866,
+    0.24287303739052291, 1.1172829926396821,
+    0.24074897169084583, 1.1176093692098048,
+    0.23955516648248171, 1.1177873927935085,
+    0.23938761487429025, 1.1178153180615402,
+    0.2384154664809294, 1.1179200378166598,
+    0.23817635637340617, 1.1179427270969358,
+    0.23754280185493223, 1.1180107949377636,
+    0.23735081563721286, 1.1180282482302837,
+    0.23627569281798433, 1.1181521666071752,
+    0.2349771678545006, 1.1182621223500508,
+    0.23313759082289853, 1.1184366552752503,
+    0.23200487213835422, 1.1185396297011179,
+    0.23134862833960437, 1.1186024615541896,
+    0.23069762052861048, 1.1186687840657654,
+    0.23057544748097086, 1.1186740200535215,
+    0.22917394809161939, 1.1184855244943062,
+    0.22737625896206526, 1.1182499050452868,
+    0.22652279295784003, 1.1181347133146553,
+    0.22561522174680296, 1.1180160309255194,
+    0.2244144352214309, 1.1176076238805528,
+    0.22411947457784387, 1.117508140113189,
+    0.22399730153020422, 1.1174645068818894,
+    0.22292043338172374, 1.1170997330682226,
+    0.22266212465242857, 1.1170089759471187,
+    0.22193257702509495, 1.1167524125470756,
+    0.22163761638150789, 1.116654674108964,
+    0.22137058100595278, 1.1165569356708522,
+    0.22136185435969277, 1.1165516996830964,
+    0.22132345711614893, 1.1165255197443165,
+    0.22081033031606262, 1.1161240940163577,
+    0.22046475512416774, 1.1158640399578106,
+    0.2200092241893972, 1.1155079927904037,
+    0.21918542878245589, 1.1148814195889378,
+    0.21872291653067738, 1.1145183911045229,
+    0.21780138268562438, 1.1138289860499853,
+    0.21642257257654887, 1.1128725456198922,
+    0.21616077318874971, 1.112696267365441,
+    0.21608746936016593, 1.1126456528171329,
+    0.21607350672614997, 1.1126299448538652,
+    0.21584312326488675, 1.1124781012089415,
+    0.21564764638866335, 1.1123402201980339,
+    0.21519735144164884, 1.1120330422496829,
+    0.21475229248239025, 1.1114151956944771,
+    0.21466851667829454, 1.1112842960005775,
+    0.2134031529705987, 1.1105652203487559,
+    0.21206099477581503, 1.1099211938547699,
+    0.21211509998262684, 1.1098077474533903,
+    0.21278879707389667, 1.1085685636844744,
+    0.21315182555831147, 1.1079105745564726,
+    0.21188820717986759, 1.1067254959943682,
+    0.21090907746949875, 1.1057603289180156,
+    0.21058444622862782, 1.1055124921642323,
+    0.21035580809661655, 1.1053274872635208,
+    0.21003292218499761, 1.1050761598512338,
+    0.20943951023931953, 1.1046031756239432,
+    0.20936795173998779, 1.1045455797586274,
+    0.208994451280061, 1.1042523644442923,
+    0.20943951023931953, 1.1037654175829861,
+    0.21026156031700888, 1.1028595917012007,
+    0.21035057210886057, 1.1027635985923412,
+    0.2110242692001304, 1.1020218336602436,
+    0.21226519829829835, 1.1006726941484519,
+    0.21240307930920593, 1.1005086331987644,
+    0.21278705174464466, 1.1000897541782859,
+    0.21292144209704825, 1.0999274385578506,
+    0.21324781866717119, 1.0995626647441836,
+    0.21323909202091118, 1.0995556834271756,
+    0.21275738114736073, 1.0992223255400446,
+    0.2113907883430492, 1.0983007916949916,
+    0.21073803520280332, 1.0978557327357332,
+    0.21124243535662968, 1.0965798970525251,
+    0.21132621116072542, 1.096380929517798,
+    0.21162640779206843, 1.0956252019516843,
+    0.21176079814447199, 1.0952935893938054,
+    0.2118218846682918, 1.0951591990414018,
+    0.21111153566273011, 1.0939461952112657,
+    0.2106874206544955, 1.0932410821934602,
+    0.21042038527894036, 1.0927820606001857,
+    0.21063855143543966, 1.0924644106763226,
+    0.21097190932257057, 1.0919984077660401,
+    0.21135064577025334, 1.091441647734654,
+    0.21161069982880049, 1.091073383262483,
+    0.21170669293766015, 1.0909389929100797,
+    0.21182537532679577, 1.0907836586066522,
+    0.21184108329006376, 1.0907696959726361,
+    0.2119161324478995, 1.0906579949005086,
+    0.2123245394928662, 1.0900785455888462,
+    0.21243449523574182, 1.089930192602427,
+    0.21260728283168925, 1.0896823558486437,
+    0.21262997211196519, 1.0896579212391158,
+    0.21271898390381691, 1.0895357481914762,
+    0.21301394454740394, 1.0891081425247375,
+    0.21320069477736733, 1.0888498337954422,
+    0.21327399860595109, 1.0887346420648107,
+    0.21370684026044567, 1.0881220314973608,
+    0.21388486384414909, 1.0878829213898376,
+    0.21401576353804866, 1.0876839538551102,
+    0.2146580447027826, 1.0867694013270652,
+    0.21428803490135975, 1.0855284722288971,
+    0.21399831024552873, 1.0844777840191966,
+    0.21327574393520304, 1.0821041362364843,
+    0.21327574393520304, 1.0821023909072323,
+    0.21327399860595109, 1.0820971549194762,
+    0.21266487869700504, 1.0799765798783032,
+    0.21225123566428239, 1.0785977697692277,
+    0.21184282861931575, 1.077283536842476,
+    0.21424614699931194, 1.0758244415878087,
+    0.21539282831787221, 1.0753776372992983,
+    0.21676291178068777, 1.0744753020760172,
+    0.21723066002022226, 1.0745468605753488,
+    0.21937566967092326, 1.0745782765018848,
+    0.22109656431338964, 1.0733722539887567,
+    0.22348766538862189, 1.0717107005408579,
+    0.22463783736568615, 1.0708729424999008,
+    0.22399206554244824, 1.0691625198329464,
+    0.2232345926470827, 1.0680891423429699,
+    0.22177375206316349, 1.067150155205397,
+    0.22134614639642486, 1.0657172398895096,
+    0.22132694777465292, 1.0656858239629736,
+    0.22114543353244551, 1.0656352094146657,
+    0.22110005497189367, 1.065607284146634,
+    0.22090632342492228, 1.0655671415738379,
+    0.22080509432830661, 1.0655584149275781,
+    0.22009823598124889, 1.0654624218187183,
+    0.2199463923363254, 1.0654606764894663,
+    0.21991323108053751, 1.0654571858309623,
+    0.21989926844652155, 1.0654624218187183,
+    0.21982945527644179, 1.0654711484649784,
+    0.21794973567204387, 1.06555143361057,
+    0.21724636798349017, 1.0655339803180501,
+    0.21458299554494681, 1.0651255732730835,
+    0.21396514898974084, 1.0650417974689876,
+    0.21366844301690183, 1.06499990956694,
+    0.21362480978560194, 1.0649824562744199,
+    0.21334032111752688, 1.0648864631655603,
+    0.21354801529851419, 1.064650843716541,
+    0.21354626996926221, 1.0646490983872889,
+    0.21387264653938515, 1.0642773432566142,
+    0.21524273000220068, 1.0627344721978513,
+    0.21525145664846068, 1.0626698950155273,
+    0.21527589125798857, 1.0620764830698493,
+    0.21534221376956436, 1.0619246394249258,
+    0.21553769064578771, 1.0614725991486593,
+    0.21634228743095713, 1.0600047772477321,
+    0.21747675144475342, 1.0591635285482708,
+    0.21835639738775856, 1.0584095463114092,
+    0.21843493720409829, 1.0576712720378156,
+    0.2190213678327684, 1.0572297037370613,
+    0.21959034516891857, 1.0568108247165824,
+    0.21987832449549766, 1.0563744924035838,
+    0.22002842281116913, 1.0561458542715727,
+    0.22001096951864921, 1.0542800973011905,
+    0.2196688849852583, 1.0539380127677997,
+    0.21899344256473649, 1.0533027129200738,
+    0.21878749371300119, 1.0531770492139301,
+    0.21814695787751925, 1.0528471819853034,
+    0.21820280841358305, 1.0524265576355727,
+    0.21826738559590689, 1.052061783821906,
+    0.21827960290067083, 1.05203036789537,
+    0.21859550749528178, 1.0511053433918132,
+    0.21889395879737286, 1.0505730179699546,
+    0.21820804440133904, 1.0490004763139078,
+    0.21812252326799136, 1.0488538686567404,
+    0.21796020764755586, 1.0486409384879969,
+    0.21782407196590028, 1.0484733868798055,
+    0.21726731193451412, 1.0478817202633794,
+    0.21685017824328745, 1.0476565727898721,
+    0.21634577808946109, 1.0474698225599088,
+    0.21623582234658548, 1.0473755747803011,
+    0.21604209079961409, 1.0471958058673456,
+    0.21569651560771921, 1.0468746652849787,
+    0.21568953429071125, 1.0468676839679709,
+    0.21539806430562819, 1.0465971579339117,
+    0.21347471146993041, 1.0459269515011458,
+    0.21307154041271972, 1.0456686427718507,
+    0.21247987379629371, 1.0452741983609,
+    0.21214651590916273, 1.045220093154088,
+    0.21163687976758042, 1.0453440115309798,
+    0.21117611284505389, 1.0452864156656638,
+    0.21036628007212854, 1.0452061305200722,
+    0.21022316307346497, 1.0452270744710961,
+    0.20999277961220175, 1.0452654717146399,
+    0.20959833520125101, 1.0453265582384599,
+    0.20943951023931953, 1.0453754274575158,
+    0.20932257317943589, 1.0454085887133036,
+    0.20921261743656028, 1.0454312779935795,
+    0.20915502157124446, 1.0454592032616112,
+    0.20846910717521069, 1.0452881609949158,
+    0.20842721927316282, 1.045277689019404,
+    0.20825966766497137, 1.0452131118370802,
+    0.20823348772619144, 1.0452148571663322,
+    0.2081968358118996, 1.0452026398615681,
+    0.20816716521461567, 1.0451816959105442,
+    0.20809037072752792, 1.0451520253132602,
+    0.20805720947174003, 1.0451310813622365,
+    0.20805022815473206, 1.0450909387894407,
+    0.20805546414248804, 1.0450734854969206,
+    0.20808338941051996, 1.0450420695703846,
+    0.20808688006902393, 1.0450193802901087,
+    0.20806419078874802, 1.044998436339085,
+    0.20798390564315627, 1.044975747058809,
+    0.2079751789968963, 1.044975747058809,
+    0.2079420177411084, 1.0449652750832972,
+    0.20790012983906053, 1.0449582937662889,
+    0.20785649660776068, 1.0449652750832972,
+    0.20775526751114501, 1.044970511071053,
+    0.20770988895059317, 1.044968765741801,
+    0.20767149170704929, 1.0449582937662889,
+    0.20762785847574941, 1.0449513124492811,
+    0.20758422524444958, 1.0449617844247929,
+    0.2075405920131497, 1.044967020412549,
+    0.20743761758728205, 1.0449635297540449,
+    0.20738351238047023, 1.0449216418519971,
+    0.20736256842944628, 1.0448937165839651,
+    0.20736605908795031, 1.0448692819744374,
+    0.20738874836822618, 1.0448448473649095,
+    0.20742365495326609, 1.0447959781458536,
+    0.20748648680633786, 1.0447436182682939,
+    0.20748648680633786, 1.0447348916220338,
+    0.20743761758728205, 1.0446964943784898,
+    0.20740794698999812, 1.0446790410859699,
+    0.20733813381991836, 1.0446458798301819,
+    0.20729624591787049, 1.044633662525418,
+    0.20725610334507463, 1.0446249358791582,
+    0.2072299234062947, 1.0446039919281342,
+    0.20716011023621497, 1.0445778119893543,
+    0.20711647700491509, 1.0445655946845904,
+    0.20707982509062323, 1.0445463960628183,
+    0.20694543473821966, 1.0445149801362823,
+    0.20688260288514784, 1.0444853095389985,
+    0.20683547899534399, 1.0444853095389985,
+    0.20669759798443646, 1.0444399309784467,
+    0.20663825678986864, 1.0444277136736826,
+    0.20664523810687663, 1.0444137510396667,
+    0.20668189002116852, 1.0443701178083669,
+    0.2067010886429404, 1.044361391162107,
+    0.20672377792321636, 1.0443421925403349,
+    0.20682849767833605, 1.0442758700287591,
+    0.20687038558038387, 1.0442357274559635,
+    0.20694019875046368, 1.0442235101511994,
+    0.20696463335999157, 1.0442217648219474,
+    0.20701175724979543, 1.0442322367974595,
+    0.20702921054231535, 1.0442304914682075,
+    0.20708506107837921, 1.0442235101511994,
+    0.207144402272947, 1.0442112928464353,
+    0.20718978083349884, 1.0442078021879313,
+    0.20720897945527078, 1.0442043115294275,
+    0.20723865005255471, 1.0442060568586795,
+    0.20725435801582268, 1.0442112928464353,
+    0.20727530196684657, 1.0442043115294275,
+    0.20728926460086253, 1.0441955848831674,
+    0.20731020855188645, 1.0441920942246636,
+    0.20743063627027408, 1.0441344983593477,
+    0.20748299614783389, 1.0440961011158039,
+    0.20751441207436977, 1.0440803931525358,
+    0.20751790273287379, 1.0440664305185199,
+    0.2075440826716537, 1.0440332692627319,
+    0.20759818787846554, 1.0439896360314322,
+    0.20769243565807324, 1.0439337854953683,
+    0.20772734224311309, 1.0439250588491082,
+    0.20777446613291695, 1.0439076055565883,
+    0.2077919194254369, 1.0438709536422965,
+    0.20779541008394087, 1.0438168484354846,
+    0.2078477699615007, 1.0437697245456807,
+    0.20784951529075271, 1.0437592525701689,
+    0.20786871391252465, 1.0437365632898929,
+    0.20788442187579259, 1.0437313273021371,
+    0.2079071111560685, 1.043712128680365,
+    0.20792630977784043, 1.043712128680365,
+    0.20793503642410041, 1.0436999113756011,
+    0.20796645235063632, 1.043680712753829,
+    0.20801881222819613, 1.0436667501198131,
+    0.20803801084996812, 1.0436580234735531,
+    0.20806244545949601, 1.0436388248517812,
+    0.20812004132481182, 1.0436161355715055,
+    0.2081514572513477, 1.0436004276082376,
+    0.20816541988536366, 1.0435585397061895,
+    0.20816018389760768, 1.0435375957551656,
+    0.20816192922685969, 1.0435149064748896,
+    0.2081514572513477, 1.0435061798286296,
+    0.20814447593433977, 1.043466037255834,
+    0.20814971192209575, 1.043431130670794,
+    0.20817938251937962, 1.0433578268422103,
+    0.20820381712890756, 1.0433264109156744,
+    0.20821254377516754, 1.0432862683428783,
+    0.20824046904319943, 1.0432461257700827,
+    0.20823872371394747, 1.0432269271483108,
+    0.20822650640918347, 1.0432129645142947,
+    0.2082230157506795, 1.0431955112217746,
+    0.20823872371394747, 1.0431832939170107,
+    0.20825268634796343, 1.0431763126000027,
+    0.20824745036020739, 1.0431606046367348,
+    0.20825094101871142, 1.0431431513442149,
+    0.20826141299422338, 1.0431344246979548,
+    0.20824745036020739, 1.043090791466655,
+    0.20825443167721538, 1.0430768288326391,
+    0.20822476107993151, 1.0430558848816152,
+    0.20820032647040357, 1.0430436675768511,
+    0.20827363029898732, 1.0430157423088193,
+    0.20827363029898732, 1.0429965436870474,
+    0.20825094101871142, 1.0429616371020076,
+    0.20812702264181979, 1.0428883332734238,
+    0.20812702264181979, 1.0428708799809039,
+    0.20808862539827594, 1.0428464453713759,
+    0.20809211605677994, 1.0428237560911,
+    0.20810782402004785, 1.0428063027985799,
+    0.20814098527583574, 1.0427521975917682,
+    0.20819509048264759, 1.0426963470557042,
+    0.20826490365272737, 1.0426544591536564,
+    0.20828061161599529, 1.0426404965196405,
+    0.20828061161599529, 1.0426178072393646,
+    0.20826141299422338, 1.0425933726298366,
+    0.20827363029898732, 1.0425724286788127,
+    0.20827537562823933, 1.0425637020325527,
+    0.20826315832347536, 1.0425567207155446,
+    0.20826490365272737, 1.0425410127522767,
+    0.20827886628674333, 1.0425078514964889,
+    0.20827537562823933, 1.0424956341917251,
+    0.20826315832347536, 1.042488652874717,
+    0.20826839431123134, 1.042485162216213,
+    0.20828933826225529, 1.042478180899205,
+    0.20833646215205914, 1.0424677089236931,
+    0.208364387420091, 1.042452000960425,
+    0.20832599017654715, 1.0424188397046372,
+    0.20833471682280713, 1.0424031317413691,
+    0.20833297149355512, 1.0423856784488492,
+    0.2083416981398151, 1.0423315732420375,
+    0.20833471682280713, 1.0422722320474695,
+    0.2083416981398151, 1.0422565240842017,
+    0.20833297149355512, 1.0422495427671938,
+    0.20832424484729517, 1.0422163815114058,
+    0.20833122616430316, 1.0421919469018779,
+    0.20831726353028721, 1.042171002950854,
+    0.20828933826225529, 1.0421657669630979,
+    0.20827712095749132, 1.042144823012074,
+    0.20831202754253117, 1.0421343510365622,
+    0.20832424484729517, 1.0421273697195541,
+    0.20832948083505115, 1.0421186430732943,
+    0.20834344346906711, 1.0421134070855382,
+    0.2083504247860751, 1.0420837364882545,
+    0.2083382074813111, 1.0420785005004982,
+    0.20834693412757108, 1.0420697738542384,
+    0.20835740610308306, 1.0420435939154584,
+    0.20834344346906711, 1.0420034513426626,
+    0.2083504247860751, 1.0419912340378987,
+    0.20834693412757108, 1.0419667994283708,
+    0.20836089676158703, 1.0419580727821107,
+    0.20837835005410696, 1.0419563274528587,
+    0.20839580334662694, 1.0419615634406147,
+    0.20843943657792677, 1.0419685447576228,
+    0.20848656046773062, 1.0419720354161268,
+    0.20849703244324261, 1.0419667994283708,
+    0.20849528711399062, 1.0419545821236067,
+    0.20847957915072265, 1.0419406194895908,
+    0.20847783382147067, 1.0419301475140788,
+    0.20845688987044675, 1.0419284021848267,
+    0.20843420059017082, 1.0419214208678187,
+    0.20841500196839888, 1.0418847689535269,
+    0.20840103933438292, 1.041874296978015,
+    0.20837136873709902, 1.0418673156610072,
+    0.20750743075736183, 1.041842881051479,
+    0.20731369921039042, 1.0416578761507678,
+    0.20726657532058662, 1.0414798525670643,
+    0.20718105418723887, 1.0413053196418647,
+    0.20704666383483533, 1.0411377680336733,
+    0.20693845342121167, 1.0410679548635937,
+    0.20691925479943973, 1.0410662095343415,
+    0.20690703749467579, 1.0410574828880816,
+    0.20613734729454625, 1.0410016323520179,
+    0.20577082815162745, 1.040980688400994,
+    0.20558582325091607, 1.0409649804377259,
+    0.20527515464406107, 1.0408654966703623,
+    0.20456655096775139, 1.0406595478186269,
+    0.20448626582215967, 1.0405984612948072,
+    0.20417210655680068, 1.040369823162796,
+    0.20404644285065709, 1.0400364652756648,
+    0.20423842906837647, 1.0396350395477063,
+    0.20470094132015493, 1.0386646364835974,
+    0.2048929275378743, 1.038462178290366,
+    0.2050203365732699, 1.0383155706331986,
+    0.20513378297464951, 1.0381078764522114,
+    0.20524548404677714, 1.0377413573092924,
+    0.20526468266854908, 1.0372247398507022,
+    0.20549332080056035, 1.0369734124384151,
+    0.20559454989717604, 1.0364899562356125,
+    0.20581271605367532, 1.0362665540913572,
+    0.20576908282237549, 1.0362211755308055,
+    0.20610942202651439, 1.0359087615946985,
+    0.20622984974490199, 1.0357621539375308,
+    0.20632584285376165, 1.0351861952843726,
+    0.20630315357348572, 1.0350675128952371,
+    0.20631886153675369, 1.0349488305061016,
+    0.20639565602384141, 1.0343728718529435,
+    0.20641659997486536, 1.0343205119753835,
+    0.20649164913270113, 1.0340988551603802,
+    0.20648641314494515, 1.0339888994175046,
+    0.20639740135309342, 1.0338929063086448,
+    0.20615305525781422, 1.0337899318827772,
+    0.20604833550269458, 1.0337218640419494,
+    0.20596106904009484, 1.0336712494936418,
+    0.20590870916253504, 1.0336188896160818,
+    0.20587554790674714, 1.0335595484215141,
+    0.20584413198021126, 1.033542095128994,
+    0.20574115755434358, 1.0334391207031264,
+    0.20566959905501181, 1.0333815248378104,
+    0.20565214576249183, 1.0333570902282827,
+    0.20564865510398786, 1.0333413822650148,
+    0.20565563642099585, 1.0333204383139909,
+    0.20564167378697989, 1.033268078436431,
+    0.20563294714071992, 1.0332558611316669,
+    0.20564167378697989, 1.0332366625098952,
+    0.20566261773800382, 1.0332139732296191,
+    0.20565738175024786, 1.0331947746078471,
+    0.20565912707949982, 1.0331755759860752,
+    0.20566959905501181, 1.0331633586813114,
+    0.20566261773800382, 1.0331424147302872,
+    0.20563643779922389, 1.0331284520962714,
+    0.20561200318969597, 1.0330237323411517,
+    0.20554393534886817, 1.0328561807329604,
+    0.20551077409308033, 1.0327217903805568,
+    0.20551950073934028, 1.032655467868981,
+    0.20553869936111221, 1.0326345239179568,
+    0.20554742600737219, 1.0324652269805137,
+    0.20553695403186023, 1.0322854580675582,
+    0.20556138864138809, 1.0321912102879505,
+    0.20556662462914413, 1.0321196517886186,
+    0.20536242110666081, 1.0318683243763316,
+    0.20533798649713289, 1.0317915298892437,
+    0.20531529721685696, 1.0317496419871959,
+    0.20536416643591279, 1.0317426606701878,
+    0.20539209170394468, 1.0317252073776682,
+    0.20540256367945667, 1.031704263426644,
+    0.20542699828898459, 1.0316763381586123,
+    0.20556662462914413, 1.0315367118184526,
+    0.205596295226428, 1.0315122772089247,
+    0.20560327654343602, 1.0314895879286488,
+    0.20559978588493202, 1.0314668986483728,
+    0.20557884193390807, 1.031454681343609,
+    0.20554742600737219, 1.0314529360143569,
+    0.20554219001961621, 1.031421520087821,
+    0.20553346337335623, 1.0314058121245528,
+    0.2055404446903642, 1.0313866135027809,
+    0.2055404446903642, 1.0313639242225052,
+    0.2055491713366242, 1.0313429802714813,
+    0.20553520870260825, 1.0312679311136455,
+    0.20552124606859229, 1.0312469871626215,
+    0.20548459415430043, 1.0312434965041175,
+    0.20546190487402446, 1.0312365151871097,
+    0.20542874361823657, 1.0311998632728177,
+    0.20541129032571662, 1.0311893912973058,
+    0.20538860104544066, 1.0311684473462819,
+    0.2053275145216209, 1.0311265594442338,
+    0.20526991865630512, 1.0310811808836822,
+    0.20522279476650127, 1.0310497649571462,
+    0.20517218021819339, 1.0310061317258463,
+    0.20511982034063356, 1.0309729704700585,
+    0.20507269645082971, 1.0309363185557665,
+    0.20503778986578983, 1.0308926853244667,
+    0.20495401406169411, 1.0307687669475751,
+    0.20487547424535438, 1.0306849911434794,
+    0.2048667475990944, 1.0306675378509593,
+    0.20480217041677062, 1.0306099419856436,
+    0.20474108389295081, 1.0305715447420998,
+    0.20471315862491887, 1.0305314021693037,
+    0.20469745066165096, 1.0305174395352878,
+    0.20462065617456318, 1.0304720609747362,
+    0.2045979668942873, 1.0304371543896962,
+    0.20458225893101933, 1.0304231917556801,
+    0.20438503672554398, 1.0303289439760726,
+    0.20438329139629197, 1.0303202173298125,
+    0.20426286367790436, 1.0299397355528779,
+    0.20417385188605264, 1.0297442586766543,
+    0.20417036122754867, 1.0297355320303945,
+    0.20412672799624884, 1.0297006254453547,
+    0.20411276536223286, 1.0296866628113386,
+    0.20406389614317702, 1.0296744455065747,
+    0.20407436811868895, 1.0296517562262988,
+    0.20404644285065709, 1.0296255762875188,
+    0.20399059231459324, 1.029583688385471,
+    0.2039417230955374, 1.0295644897636991,
+    0.20392950579077343, 1.0295348191664151,
+    0.20394346842478941, 1.029515620544643,
+    0.20402898955813711, 1.0295068938983831,
+    0.20406215081392501, 1.0294859499473592,
+    0.20404818817990905, 1.0294370807283033,
+    0.204069132130933, 1.0294109007895234,
+    0.20408484009420091, 1.0293812301922394,
+    0.20396615770506535, 1.0293341063024359,
+    0.20396092171730934, 1.0293061810344037,
+    0.2039679030343173, 1.0292852370833798,
+    0.20399757363160123, 1.0292677837908599,
+    0.20396964836356932, 1.0292136785840482,
+    0.20400804560711319, 1.028943152549989,
+    0.2039068165104975, 1.0289047553064452,
+    0.20388761788872561, 1.0288663580629012,
+    0.20388761788872561, 1.0288331968071134,
+    0.20383874866966975, 1.0287930542343175,
+    0.20377417148734595, 1.0287616383077816,
+    0.20375148220706998, 1.0287197504057337,
+    0.20375148220706998, 1.0286865891499459,
+    0.20378987945061389, 1.0286220119676219,
+    0.20376369951183398, 1.0286045586751023,
+    0.20358218526962657, 1.0285993226873462,
+    0.20354378802608269, 1.0285836147240783,
+    0.20350364545328684, 1.0285731427485663,
+    0.20347921084375892, 1.0285417268220303,
+    0.20352284407505875, 1.0284946029322264,
+    0.20351411742879882, 1.0284754043104547,
+    0.2034722295267509, 1.0284719136519507,
+    0.20345652156348298, 1.0284544603594306,
+    0.20336576444237925, 1.0281106304967877,
+    0.20310221972532816, 1.0281403010940715,
+    0.20298353733619251, 1.0281490277403316,
+    0.20292943212938072, 1.0281088851675357,
+    0.2028666002763089, 1.0280774692409997,
+    0.20236569078098651, 1.0278645390722565,
+    0.20232903886669462, 1.0278540670967447,
+    0.20230809491567073, 1.0278383591334765,
+    0.20223130042858295, 1.0278610484137525,
+    0.20222257378232297, 1.0278854830232804,
+    0.20219464851429106, 1.0278994456572963,
+    0.20215974192925121, 1.0278942096695403,
+    0.20208818342991938, 1.0279413335593444,
+    0.2020567675033835, 1.0279378429008403,
+    0.20204629552787157, 1.0279238802668242,
+    0.2020305875646036, 1.0278523217674926,
+    0.2019834636747998, 1.0277982165606807,
+    0.20195379307751588, 1.0277894899144207,
+    0.20189445188294805, 1.0278243964994607,
+    0.20184558266389221, 1.0278575577552487,
+    0.20182463871286832, 1.0278802470355244,
+    0.20180020410334037, 1.0278907190110362,
+    0.20176529751830047, 1.0279308615838323,
+    0.20164137914140889, 1.0279727494858801,
+    0.20159774591010904, 1.0279605321811163,
+    0.20157331130058109, 1.0279395882300923,
+    0.20156632998357313, 1.0279238802668242,
+    0.20152095142302126, 1.0279134082913124,
+    0.20150524345975335, 1.0278942096695403,
+    0.20150524345975335, 1.0278715203892645,
+    0.20148429950872937, 1.0278523217674926,
+    0.2014546289114455, 1.0278086885361928,
+    0.20144764759443751, 1.0277894899144207,
+    0.20140226903388567, 1.0277772726096568,
+    0.20138830639986971, 1.0277545833293809,
+    0.20131674790053791, 1.0277336393783569,
+    0.20139005172912172, 1.027677788842293,
+    0.20139179705837368, 1.0276550995620171,
+    0.20138132508286172, 1.0276376462694972,
+    0.20134118251006586, 1.0276132116599694,
+    0.20128882263250603, 1.0276219383062293,
+    0.20124169874270217, 1.0276079756722134,
+    0.20115443228010246, 1.0276079756722134,
+    0.20109858174403863, 1.0276132116599694,
+    0.20100084330592696, 1.0276463729157572,
+    0.20100084330592696, 1.0276708075252852,
+    0.2009519740868711, 1.0276725528545372,
+    0.20088041558753933, 1.0277301487198529,
+    0.20080536642970356, 1.0277493473416248,
+    0.20072159062560788, 1.0278051978776888,
+    0.20064479613852013, 1.0277999618899327,
+    0.20056800165143235, 1.0278086885361928,
+    0.20049644315210061, 1.0278348684749727,
+    0.2004056860309969, 1.0278470857797366,
+    0.20001996826630616, 1.0278139245239488,
+    0.19994666443772235, 1.0277929805729247,
+    0.19993619246221042, 1.0278121791946966,
+    0.19995713641323434, 1.0278610484137525,
+    0.19993968312071442, 1.0279064269743043,
+    0.19994840976697442, 1.0279657681688723,
+    0.19994840976697442, 1.0282886540804912,
+    0.20007756413162198, 1.0285783787363223,
+    0.20005138419284205, 1.0287145144179779,
+    0.20004091221733006, 1.0287337130397498,
+    0.20003044024181812, 1.0287703649540416,
+    0.20000775096154216, 1.028913481952705,
+    0.20004789353433805, 1.0292154239133002,
+    0.20004963886359003, 1.0292765104371198,
+    0.19995364575473035, 1.0294074101310196,
+    0.1999065218649265, 1.0294894406058632,
+    0.19995190042547839, 1.0295016579106271,
+    0.19998157102276226, 1.0295330738371631,
+    0.2000269495833141, 1.0295435458126752,
+    0.20009327209488989, 1.029588924373227,
+    0.19993793779146243, 1.0297372773596465,
+    0.19993444713295841, 1.0297442586766543,
+    0.19985939797512267, 1.0298245438222462,
+    0.19971104498870315, 1.0299746421379177,
+    0.19965170379413535, 1.0300409646494935,
+    0.19930612860224048, 1.0303289439760726,
+    0.19920664483487679, 1.030445881035956,
+    0.19878776581439811, 1.0310811808836822,
+    0.19871097132731044, 1.0311544847122658,
+    0.19850851313407902, 1.0313639242225052,
+    0.19840902936671539, 1.0314616626606168,
+    0.19790811987139301, 1.0317513873164479,
+    0.19765155647134983, 1.0316850648048721,
+    0.19728329199917904, 1.0316012890007764,
+    0.19705465386716778, 1.0314913332579008,
+    0.19701276596511991, 1.0314791159531369,
+    0.19697262339232402, 1.0314721346361289,
+    0.19676318388208472, 1.031454681343609,
+    0.19669860669976091, 1.0314459546973489,
+    0.19655723503034941, 1.031433737392585,
+    0.19651185646979752, 1.031426756075577,
+    0.19642633533644985, 1.0314040667953011,
+    0.19639491940991391, 1.031398830807545,
+    0.1962360944479824, 1.0313517069177414,
+    0.19602490960849114, 1.0313028376986855,
+    0.19597254973093131, 1.0312853844061654,
+    0.19591320853636349, 1.0312731671014015,
+    0.19546291358934895, 1.0312225525530936,
+    0.19509115845867414, 1.0311771739925417,
+    0.19466180746268355, 1.0311283047734858,
+    0.19403174360271361, 1.0300217660277216,
+    0.19374900026389053, 1.0297442586766543,
+    0.19374027361763055, 1.0297337867011425,
+    0.19361635524073897, 1.0296185949705108,
+    0.1934680022543194, 1.0295348191664151,
+    0.19316082430596843, 1.0293637768997197,
+    0.19311544574541659, 1.0293480689364518,
+    0.19175583425811302, 1.0290670709268805,
+    0.19150974283358177, 1.0290042390738088,
+    0.19056726503750485, 1.0287389490275056,
+    0.19042938402659729, 1.0287127690887259,
+    0.18568383379042472, 1.0278627937430045,
+    0.18486876502974336, 1.0255746670936401,
+    0.18325957145940461, 1.0210176124166828,
+    0.1308996938995747, 0.99483767363676778,
+    0.087266462599716474, 0.99483767363676778,
+    0, 1.0471975511965976
+};
+
+static const double enor_fir_vertices[] = {
+    0.4539904997395468, 0, 0.89100652418836779,
+    0.45288460169966399, 0.031668776375164021, 0.89100652418836779,
+    0.43669318207342195, 0.0383187560831518, 0.89879404629916704,
+    0.41799587537443827, 0.045901070539595239, 0.90728856484212128,
+    0.40987490296198803, 0.04916892640409886, 0.91081555794692548,
+    0.40765741656804633, 0.050054036892120034, 0.91176204357708845,
+    0.39972360086692199, 0.054100021571609036, 0.91503783013377815,
+    0.3814934370719234, 0.063309756918858609, 0.92220097167045179,
+    0.3303660895493522, 0.088521326901376887, 0.93969262078590832,
+    0.31787238889798236, 0.10321001477760781, 0.94249925051741867,
+    0.29007506623922402, 0.13526422482716866, 0.94739645630971991,
+    0.28259834589058808, 0.1502602058819586, 0.94739645630971991,
+    0.2819502924231137, 0.16278407722857835, 0.94551857559931674,
+    0.28582023552688296, 0.17664128152406702, 0.94186233103617245,
+    0.29275786490671629, 0.17683498233034073, 0.93969262078590832,
+    0.29661691629781756, 0.17694408832310013, 0.93846107781488752,
+    0.29661863177411196, 0.17694440975004558, 0.93846047500289631,
+    0.29662237155699134, 0.17694453488253989, 0.93845926937033752,
+    0.29665533724894227, 0.17699157931069187, 0.93843997769427079,
+    0.29669128979432918, 0.17701443374811771, 0.93842430105204044,
+    0.29670960703299715, 0.17703168214393061, 0.93841525595634623,
+    0.2967218500918456, 0.17704952067852786, 0.93840801941670116,
+    0.29672757087131268, 0.17707189606975579, 0.93840198865255597,
+    0.2967378183501167, 0.17709627247657486, 0.93839414823181622,
+    0.29675455568638298, 0.1771097735832782, 0.93838630732798811,
+    0.2967604118868637, 0.17712872261819226, 0.93838087872696263,
+    0.29676202713595901, 0.177173945295412, 0.93837183054406248,
+    0.29676743014815771, 0.17719684372309202, 0.93836579806482312,
+    0.2967794957673488, 0.17721177717250702, 0.9383591620075119,
+    0.29679650980081423, 0.17721842303221069, 0.93835252560433358,
+    0.29681723559153306, 0.17721885205636245, 0.93834588885529069,
+    0.29684926754702762, 0.17723867997554463, 0.93833201089876483,
+    0.296858969800052, 0.17724798697705277, 0.93832718342901822,
+    0.29686307528770595, 0.17726027812289927, 0.9383235627066594,
+    0.29685913563969663, 0.17728604077855378, 0.93831994188140178,
+    0.29686180657031869, 0.17729115045362695, 0.93831813143018616,
+    0.29686369029496856, 0.17729438422611002, 0.93831692444841763,
+    0.29687648558353807, 0.17729851111570094, 0.93831209640701263,
+    0.29688416143233393, 0.17730801605551916, 0.9383078717207245,
+    0.29688264083693494, 0.17731694972143799, 0.93830666464177503,
+    0.29686711342047206, 0.17733017124268294, 0.93830907878824088,
+    0.29686432788803147, 0.17733483439851858, 0.93830907878824088,
+    0.29686559215249625, 0.17733910471994643, 0.9383078717207245,
+    0.29687574299842884, 0.17734446550099428, 0.93830364689438217,
+    0.29691550762536684, 0.17735134471950079, 0.93828976433602618,
+    0.29692191810300034, 0.17735658002189905, 0.93828674618848307,
+    0.29692745114831592, 0.17737605753370295, 0.93828131334284015,
+    0.29693104957351191, 0.1773796134916158, 0.93827950234284541,
+    0.29694884864328164, 0.17738813657152561, 0.93827225808563219,
+    0.29697846331210404, 0.1773896521934063, 0.93826259843579163,
+    0.29698878142191282, 0.17739792520137468, 0.93825776833649221,
+    0.29699085660230318, 0.17741041757401041, 0.93825474943154186,
+    0.29698452112660767, 0.17742421592567958, 0.93825414564197762,
+    0.29698078054580157, 0.1774240912156709, 0.93825535321824827,
+    0.2969579780893758, 0.17741117170841864, 0.93826501341684687,
+    0.29694613722451513, 0.1774118334734362, 0.93826863580268582,
+    0.29693991954539867, 0.17741585454361669, 0.93826984324176721,
+    0.29693527470742898, 0.17742362835173134, 0.93826984324176721,
+    0.29693625260980877, 0.17743476203789832, 0.93826742835217203,
+    0.29693970770142741, 0.1774417498450549, 0.93826501341684687,
+    0.29696117447034837, 0.17747286586997793, 0.93825233425613608,
+    0.29697437139674399, 0.17750185664631801, 0.93824267309722098,
+    0.29698108960196828, 0.1775065756257625, 0.93823965383501207,
+    0.29698685544180825, 0.17750650432379586, 0.93823784224339013,
+    0.29702064163033176, 0.17749785212241617, 0.93822878389944686,
+    0.29705809483003776, 0.17751179063694622, 0.93821428921159222,
+    0.29706981611189598, 0.17752090576521415, 0.93820885327923775,
+    0.29707422188243282, 0.17753268601229566, 0.93820522919572702,
+    0.29707112330728513, 0.1775378709085503, 0.93820522919572702,
+    0.29706290056117368, 0.17754843741404913, 0.9382058332167903,
+    0.29705651471423677, 0.17754954642634635, 0.93820764526283262,
+    0.29704200544957154, 0.17754509617615619, 0.93821308124663039,
+    0.29701513355261999, 0.17752622022461223, 0.93822516038181458,
+    0.29700593678621068, 0.17752564826540501, 0.93822817998698649,
+    0.29699585535964906, 0.17753932229721808, 0.93822878389944686,
+    0.29699494794777437, 0.17754722299202833, 0.93822757607166807,
+    0.29699840078142659, 0.17755421245296693, 0.93822516038181458,
+    0.29700854915458264, 0.17755957579839951, 0.93822093281453822,
+    0.29703254288601028, 0.17755773515338394, 0.93821368523054027,
+    0.29703816494790203, 0.17756109586452587, 0.93821126927775256,
+    0.29704521426917596, 0.17757164308542159, 0.93820704125034315,
+    0.29705003375605071, 0.17761463867143601, 0.93819737666183245,
+    0.29705458066923096, 0.17762298797717135, 0.93819435632788206,
+    0.29706175225221432, 0.17762375699908081, 0.93819194000927952,
+    0.29706578233095599, 0.17761701683600464, 0.93819194000927952,
+    0.29706685688863066, 0.1776120287204864, 0.93819254409321695,
+    0.29705557122389853, 0.17759261316103514, 0.93819979287755029,
+    0.29705740953507986, 0.17758315579598127, 0.93820100096826164,
+    0.29706391809815635, 0.17757226795399034, 0.93820100096826164,
+    0.29707325918934441, 0.17756940671197757, 0.93819858477540718,
+    0.29708028678330667, 0.17757360731116276, 0.93819556447003594,
+    0.29708752302472163, 0.17759341594185349, 0.93818952364495056,
+    0.29709628700285323, 0.17760428552491625, 0.93818469077911426,
+    0.29711534330288458, 0.17761708515391555, 0.9381762328237887,
+    0.29713373778481372, 0.17761822662972537, 0.93817019108418542,
+    0.29713904957746806, 0.17762210579081389, 0.93816777430832476,
+    0.2971453531267203, 0.17764347274684825, 0.93816173216862586,
+    0.29715068492165336, 0.17765370019870441, 0.93815810674763189,
+    0.29716302323823129, 0.17766178078097974, 0.93815266842323985,
+    0.29719361132164523, 0.1776744353840875, 0.9381405824291712,
+    0.29719272034440664, 0.17768868891936365, 0.93813816509318548,
+    0.29718976438280897, 0.17769044216192506, 0.93813876943146846,
+    0.29718118713320019, 0.17768883432359647, 0.93814179108001761,
+    0.29717730078975391, 0.17769214345688053, 0.93814239540115418,
+    0.29717560472718269, 0.17769817045825184, 0.93814179108001761,
+    0.29718938552321628, 0.17771978995740431, 0.938133330284043,
+    0.29721575632844588, 0.17772992584371217, 0.93812305570735144,
+    0.29722482682248691, 0.17774027965395686, 0.93811822032666858,
+    0.29722515551274187, 0.17774611037394372, 0.93811701145292115,
+    0.29722019178907749, 0.17775441039677112, 0.93811701145292115,
+    0.29719977087575311, 0.17775346556379243, 0.93812366011707726,
+    0.29718998896722754, 0.17776663007737356, 0.93812426452394537,
+    0.29719049883631199, 0.1777817252835657, 0.93812124246102802,
+    0.29719568000610413, 0.17779538972748735, 0.93811701145292115,
+    0.29720193820909818, 0.17780406421981776, 0.9381133847630948,
+    0.2972087997841843, 0.1778053516880711, 0.938110966912724,
+    0.29722812611984673, 0.17780493862622226, 0.93810492208676199,
+    0.29723374644469613, 0.17780830076266593, 0.93810250407636342,
+    0.29723547894241542, 0.17781497256685325, 0.93810069053855949,
+    0.2972331597760397, 0.17782203839334515, 0.93810008602024286,
+    0.29724145987165795, 0.17783686662266507, 0.93809464522680119,
+    0.29726985410213758, 0.17784680919280585, 0.93808376294552265,
+    0.29728434526355296, 0.17784491038014852, 0.93807953069720995,
+    0.29729739806054961, 0.17782946864216029, 0.93807832145768832,
+    0.29730347552757885, 0.17782887665227348, 0.93807650757697414,
+    0.29730956980271583, 0.17783463553803741, 0.93807348438529992,
+    0.29731208619376936, 0.17784318639885874, 0.93807106578052468,
+    0.29730824683523199, 0.17786555056708908, 0.93806804246026154,
+    0.29730265887744728, 0.17787489069335546, 0.93806804246026154,
+    0.29730486369799747, 0.17788396092714892, 0.9380656237526156,
+    0.2973142248335377, 0.17788744787760355, 0.93806199560542136,
+    0.29731858710426601, 0.17788653449841227, 0.93806078620016309,
+    0.29732543310091236, 0.17788146962559778, 0.93805957678347507,
+    0.29733322625253439, 0.17788119925718401, 0.93805715791580913,
+    0.29737939627073956, 0.17789331571850464, 0.93804022456199976,
+    0.29739704006619438, 0.17790527989360358, 0.93803236188622241,
+    0.29741690253829556, 0.1779326688030311, 0.9380208694145119,
+    0.29742111731319232, 0.1779351903347241, 0.93801905471942193,
+    0.29742812708228389, 0.17793303989339582, 0.93801723999861542,
+    0.29743485593334307, 0.17794411452716166, 0.9380130055500594,
+    0.29744437972091126, 0.17795051720001023, 0.93800877096149327,
+    0.29745170025377987, 0.17794784722946108, 0.93800695609496199,
+    0.29746367926780271, 0.17793738953277136, 0.93800514120271461,
+    0.29746804196833537, 0.17793647447281899, 0.93800393126026316,
+    0.29749142326566791, 0.17793565575942177, 0.93799667136553944,
+    0.29749702821354512, 0.1779326633979432, 0.9379954613430832,
+    0.29749903921602699, 0.1779261115370627, 0.93799606635573984,
+    0.2974944830270051, 0.17791140269503675, 0.93800030136433299,
+    0.29749788299214608, 0.17789933765209939, 0.93800151134107224,
+    0.29750177198523531, 0.17789602397038959, 0.93800090635413125,
+    0.29751878029661671, 0.17790266968685767, 0.93799425130919767,
+    0.2975268845997765, 0.17790187612565775, 0.93799183120713925,
+    0.29754588768459928, 0.17789561458442105, 0.93798699086587278,
+    0.2975625858775422, 0.17790277809867477, 0.93798033509804668,
+    0.29756696428013574, 0.17790821577997271, 0.93797791473311942,
+    0.29757166858945483, 0.17791948858952616, 0.93797428410001149,
+    0.29757079743047232, 0.17794646480059795, 0.9379694430958625,
+    0.29757394742829457, 0.17796033522463447, 0.93796581222274744,
+    0.29758144547374876, 0.17796693473943415, 0.937962181246773,
+    0.29759361708368581, 0.17797209841323824, 0.9379573397854708,
+    0.29761423259572634, 0.17798865854595944, 0.93794765631428856,
+    0.29761846137105408, 0.17799753469100407, 0.93794463007954321,
+    0.29762271706333943, 0.17801912225104671, 0.93793918267700194,
+    0.29764099361251389, 0.1780364022060392, 0.93793010315848424,
+    0.29763914218948762, 0.17804587508972167, 0.93792889250744438,
+    0.29763044087120838, 0.17806042026955049, 0.93792889250744438,
+    0.2976465518875685, 0.17808769493388685, 0.93791860151218653,
+    0.29764984554538043, 0.17809813133512631, 0.93791557459173647,
+    0.2976377334727629, 0.17812474781502188, 0.93791436380355719,
+    0.29764741607895728, 0.17813407026283468, 0.93790952053655774,
+    0.29765910275232249, 0.17813048078127089, 0.9379064934018293,
+    0.29767046716041956, 0.17812105344224713, 0.93790467708670788,
+    0.29767217122278999, 0.17811501757487391, 0.93790528252793859,
+    0.29767167565587033, 0.1780999048970896, 0.93790830969123729,
+    0.29767852602810074, 0.17809483175434779, 0.93790709883448897,
+    0.29768850868018315, 0.1780972765033384, 0.93790346619567511,
+    0.29770100181906328, 0.17810827854966566, 0.9378974115690909,
+    0.29771197415797118, 0.17814095097795579, 0.9378877235723011,
+    0.2977101196127252, 0.17815042607541984, 0.93788651252127686,
+    0.29770357913287215, 0.17815498012641875, 0.9378877235723011,
+    0.29767768494947361, 0.17814724599364745, 0.9378974115690909,
+    0.29767238829800552, 0.17814972109206501, 0.93789862251726375,
+    0.29766227733570821, 0.17816342720263251, 0.93789922798706482,
+    0.29766372302375133, 0.17818969654276148, 0.93789377865600432,
+    0.29765812488244503, 0.1781990478364818, 0.93789377865600432,
+    0.2976589170454354, 0.17820728497267177, 0.93789196216089177,
+    0.29766407310790599, 0.17821460634126143, 0.9378889346118976,
+    0.29768357512243898, 0.17822345924250582, 0.93788106265024784,
+    0.29769153977883211, 0.17823246255201403, 0.93787682370168046,
+    0.29769656205983602, 0.17825593906002718, 0.93787076781803047,
+    0.29769846282939394, 0.17827825409116727, 0.93786592290541249,
+    0.29770581174849287, 0.17829465614730314, 0.93786047216016399,
+    0.29770520495627523, 0.1783084122220466, 0.93785804953244112,
+    0.29771035894259573, 0.17831573519785895, 0.93785502118350783,
+    0.29772393081916859, 0.17832174605037804, 0.93784956997544511,
+    0.29773795841394152, 0.1783174388419419, 0.9378459357081782,
+    0.29774949624925545, 0.17831728829319002, 0.93784230133806501,
+    0.29776587690871958, 0.17832498012085857, 0.93783563805907733,
+    0.2977657322550768, 0.1783347789092217, 0.93783382074117849,
+    0.2977465785455552, 0.17835720044545136, 0.93783563805907733,
+    0.29774814829441121, 0.178367320716907, 0.9378332149628319,
+    0.29775408262309783, 0.17837652514196767, 0.93782958023275975,
+    0.29776594453739058, 0.17838857483247753, 0.93782352212076292,
+    0.29777438100999409, 0.17840634167570421, 0.93781746372308872,
+    0.2977853078109462, 0.17841995132083949, 0.93781140503973892,
+    0.29780605715338648, 0.178433089782225, 0.93780231647907675,
+    0.29781339893000447, 0.17844949734044532, 0.93779686303415433,
+    0.29781028435336793, 0.17845469513763354, 0.93779686303415433,
+    0.29780124229156785, 0.17845704731661011, 0.93779928681602021,
+    0.29777270752817059, 0.17845690046291834, 0.93780837559093633,
+    0.29776226622724489, 0.17846477022755414, 0.93781019326878812,
+    0.29777006683715901, 0.17847085834732024, 0.93780655788737399,
+    0.29778472468362377, 0.17847187293942415, 0.93780171055217876,
+    0.2977851984593734, 0.17848063404316672, 0.93779989275434483,
+    0.29777554129189709, 0.17849674551166728, 0.93779989275434483,
+    0.29777351819775744, 0.17850330391198291, 0.93779928681602021,
+    0.29779022342968953, 0.17854228628263566, 0.93778656145130646,
+    0.29780082739345726, 0.17854369781460996, 0.93778292540142649,
+    0.29781111674478128, 0.17853926768092304, 0.93778050131104029,
+    0.29782640114775216, 0.1785456042640037, 0.93777444088510964,
+    0.29783092414618062, 0.17854760915101975, 0.93777262270162631,
+    0.29783451225667429, 0.17855117347820368, 0.93777080449243322,
+    0.29784263111358411, 0.17857582778816167, 0.9377635313985665,
+    0.29786212852646904, 0.17859105150117402, 0.93775443945277392,
+    0.29787039390140291, 0.17859318013485501, 0.93775140866134787,
+    0.29787896886677434, 0.17858842649013598, 0.9377495901522136,
+    0.29789502890383324, 0.17858391917757691, 0.93774534686425448,
+    0.29790345141682212, 0.17858896835676064, 0.93774170964888459,
+    0.29790797649249712, 0.1785973355885753, 0.93773867855752202,
+    0.29790345929645257, 0.17861441874414996, 0.93773685986842614,
+    0.29790829547120184, 0.17862226644750578, 0.93773382866280308,
+    0.29792092540147269, 0.17861711519947648, 0.93773079738576737,
+    0.29793245937028229, 0.17859787593313647, 0.93773079738576737,
+    0.29793230023730088, 0.17858859164007651, 0.93773261616055825,
+    0.2979198208611451, 0.17857757719057449, 0.93773867855752202,
+    0.29791529523054427, 0.17856921025889261, 0.93774170964888459,
+    0.297913259582614, 0.17855032145146554, 0.93774595305681818,
+    0.29791902616948657, 0.1785438833471025, 0.93774534686425448,
+    0.29792994234530201, 0.17854477152499304, 0.93774170964888459,
+    0.29793711905443543, 0.17855189943286431, 0.93773807233067996,
+    0.29793525215457328, 0.17856138207264904, 0.93773685986842614,
+    0.29794274285125083, 0.17857435309001984, 0.93773200990515104,
+    0.29795443698470614, 0.17857075965162064, 0.93772897858526794,
+    0.29795989240037829, 0.17856484054955529, 0.93772837231272199,
+    0.29795769206430284, 0.17853030371583939, 0.93773564739474646,
+    0.29796283507585325, 0.17852490444241975, 0.93773504115362183,
+    0.29797235108370956, 0.17853131272664588, 0.93773079738576737,
+    0.29801289755382832, 0.17853369466608723, 0.9377174589184355,
+    0.29805875246093777, 0.17854632059874243, 0.93770048068777301,
+    0.29806156039838666, 0.17854800263926571, 0.93769926787131896,
+    0.29806858339614301, 0.17855857183635296, 0.93769502292375351,
+    0.29808309178893833, 0.17856938398291389, 0.93768835200908307,
+    0.29809542074087864, 0.17859020276494836, 0.93768046775524394,
+    0.29810353238154752, 0.17859576951713471, 0.9376768287060453,
+    0.29811694546936857, 0.17859885595148761, 0.9376719764804925,
+    0.29811788293126079, 0.17860365995635683, 0.93767076339554123,
+    0.29811117966763773, 0.17861166410135032, 0.93767136993944522,
+    0.29810993469198427, 0.17862011027071673, 0.93767015684878119,
+    0.29811742412325004, 0.1786330831937924, 0.93766530437187334,
+    0.29812616026123667, 0.17864397516522706, 0.93766045171216283,
+    0.298159226190649, 0.17865883837883403, 0.93764710595539036,
+    0.29816530960314841, 0.17866460533561773, 0.93764407263605443,
+    0.29818496138231365, 0.17867001534654667, 0.93763679237831365,
+    0.29819619154890964, 0.17867674437147385, 0.93763193864465655,
+    0.29820258665751642, 0.17868199091884795, 0.93762890496829454,
+    0.29820617486106632, 0.17869192173312401, 0.9376258712205281,
+    0.29821818469476064, 0.17870053306112293, 0.93762041029460963,
+    0.29822411200649451, 0.17871611082867014, 0.93761555594401924,
+    0.29823627714599577, 0.17873401293388957, 0.93760827407539715,
+    0.29825124961724203, 0.17874086346778417, 0.93760220553737206,
+    0.29825702040634877, 0.17874078430981327, 0.93760038492027065,
+    0.29826934135862748, 0.17874887560485142, 0.93759492291473712,
+    0.29828868104681228, 0.1787548049761282, 0.93758763988082705,
+    0.29832314703379725, 0.17878324364793907, 0.93757125155082111,
+    0.29832985179953453, 0.17879433873788075, 0.93756700238465718,
+    0.29832828852072618, 0.1788096793327304, 0.93756457422687456,
+    0.29832033107892303, 0.1788197722120819, 0.93756518127060418,
+    0.29834340947581789, 0.17883856055572553, 0.93755425404650616,
+    0.29836165719912805, 0.17884312831208402, 0.93754757584292081,
+    0.29836664449779959, 0.17885390426147588, 0.93754393304076711,
+    0.29836835212704693, 0.17887333310521972, 0.93753968297497658,
+    0.29838534785370296, 0.17888635395111904, 0.93753178962438366,
+    0.29839220044742165, 0.17890674599107756, 0.93752571748780833,
+    0.29838579722149389, 0.17892060711775709, 0.93752511025844354,
+    0.29838595144350843, 0.17892353172958023, 0.93752450302622281,
+    0.29839686576421726, 0.17893078443374782, 0.93751964506564622,
+    0.29839920192324237, 0.17893643373471749, 0.93751782328330857,
+    0.29839700715036127, 0.17895281993121123, 0.9375153942002098,
+    0.29839871823822706, 0.17895951105910202, 0.93751357235789945,
+    0.29840822864833511, 0.17896592291421423, 0.93750932129255471,
+    0.29844846141893355, 0.1789815530775869, 0.93749353039613359,
+    0.29845485283436224, 0.17898680254230853, 0.93749049346396029,
+    0.29846372760325313, 0.17900699878665963, 0.93748381196187269,
+    0.29847276603078704, 0.17901737796251699, 0.93747895247059088,
+    0.29850410734951344, 0.17903192539168022, 0.93746619543641041,
+    0.29852499539901556, 0.17904799553127856, 0.93745647494603657,
+    0.29853592039437327, 0.17904250415087036, 0.93745404470921667,
+    0.29854606111531529, 0.17904150119578369, 0.93745100684893956,
+    0.29856289287374427, 0.17905797197969153, 0.93744250046036481,
+    0.29858550912133158, 0.17906161585428501, 0.9374346011698137,
+    0.2986037434539619, 0.1790789283674121, 0.93742548600411957,
+    0.29862059446499795, 0.17907627889094488, 0.93742062431970408,
+    0.29863150707544317, 0.1790835315917815, 0.93741576245253366,
+    0.29867984574397644, 0.17910472307365732, 0.93739631315632077,
+    0.29868998022526583, 0.17911009149327689, 0.93739205823300009,
+    0.29869792635116771, 0.17911910914829809, 0.937387803169762,
+    0.29871785909202481, 0.17914949254526286, 0.93737564507525584,
+    0.29873531283630794, 0.17916492253873206, 0.93736713372951341,
+    0.29875496355257475, 0.17917032719774628, 0.93735983784486532,
+    0.29878162097663341, 0.17918631427737181, 0.93734828518660362,
+    0.29880112839388434, 0.17918241402818239, 0.93734281251502349,
+    0.29882780328888192, 0.17918564652198882, 0.93733369088176821,
+    0.29886817859151954, 0.17921056587733974, 0.93731605390247708,
+    0.29888469275454815, 0.17922756051188327, 0.93730753863925498,
+    0.29891602286616692, 0.17924847567739247, 0.93729354806336118,
+    0.29893224253358558, 0.17925323658974798, 0.93728746473317426,
+    0.29894644334643045, 0.17925182098287615, 0.93728320623216244,
+    0.29899031631737549, 0.17923272567473841, 0.93727286357583173,
+    0.29902525987835521, 0.17923806556300953, 0.93726069468846951,
+    0.29905128279391624, 0.17926146817907185, 0.93724791612763625,
+    0.2990578036724319, 0.17928240552533448, 0.93724183065613897,
+    0.29905728717434293, 0.17931189778992096, 0.93723635348768852,
+    0.29908081274118886, 0.17933310013039794, 0.93722478981709112,
+    0.29912447590279334, 0.17934934448404377, 0.93720774673976259,
+    0.29914629595258163, 0.17936384698471247, 0.93719800683350529,
+    0.29916142624900322, 0.17936724018692995, 0.93719252781506235,
+    0.29918933307963486, 0.17938113261138464, 0.93718096023896058,
+    0.29922224932728292, 0.17938666866610228, 0.9371693916322702,
+    0.29922923920880723, 0.17940363864837289, 0.93716391140623978,
+    0.29926727860084523, 0.17942289490591232, 0.93714807834323921,
+    0.29927052175847402, 0.17943975121331102, 0.93714381526578716,
+    0.29928610236735564, 0.17945193378241972, 0.93713650680757643,
+    0.2993027990176107, 0.17945271276518349, 0.93713102519415092,
+    0.29931670335608379, 0.17944542528376625, 0.93712797975344564,
+    0.299336532087629, 0.17944097835138353, 0.93712249778033296,
+    0.29936383847264419, 0.17944314285094795, 0.93711336064464412,
+    0.29938192545401981, 0.17945114342663918, 0.93710605047364592,
+    0.29940264142636691, 0.17947066380416338, 0.93709569369440993,
+    0.29942290729366727, 0.1794813910248888, 0.93708716396265879,
+    0.29945114071175655, 0.17948836893994807, 0.93707680567907814,
+    0.29949585206505924, 0.1795251158993674, 0.93705547720353399,
+    0.29952750333760125, 0.17953911419720703, 0.93704267843979527,
+    0.29955580953061189, 0.17951415428903675, 0.93703841190548409,
+    0.29957047865285685, 0.17951512833911742, 0.93703353569500836,
+    0.2995734480538404, 0.17951335471471336, 0.93703292615585421,
+    0.2995772077070456, 0.17950708042371807, 0.93703292615585421,
+    0.2995845492844571, 0.17950437350694562, 0.93703109752126568,
+    0.29961309773716782, 0.17951081936511809, 0.93702073477335723,
+    0.29963215341676375, 0.17950446980924836, 0.93701585790067266,
+    0.2996360763520024, 0.17949473904599367, 0.93701646751974832,
+    0.29965340201509905, 0.17949445795367433, 0.9370109808453122,
+    0.29965998062931476, 0.17948347496230571, 0.9370109808453122,
+    0.29967779609536155, 0.17947282606470463, 0.93700732293391131,
+    0.29968558770877329, 0.1794789136544811, 0.93700366491975606,
+    0.29969854133140872, 0.17947956470165832, 0.93699939710670532,
+    0.29972636711027595, 0.17945856181298916, 0.93699451943482015,
+    0.29973795541357234, 0.17943920595455634, 0.93699451943482015,
+    0.29976407388966708, 0.17941149254856428, 0.93699147079712874,
+    0.29977032477953136, 0.17940741709576491, 0.93699025132207248,
+    0.29977984602236907, 0.17940743048076399, 0.93698720258448276,
+    0.29980607884970445, 0.17940181042733674, 0.93697988532313692,
+    0.29983530290217425, 0.17938163311436392, 0.93697439710740504,
+    0.29984919645809144, 0.17938070685194496, 0.93697012833533466,
+    0.2998803946512163, 0.1793922637771326, 0.93695793107308001,
+    0.29989225894207722, 0.17939154334199284, 0.93695427167178014,
+    0.29997565554165168, 0.17936679386017643, 0.93693231310627623,
+    0.29998534956393891, 0.17935695378650177, 0.93693109307751554,
+    0.29999941548129394, 0.17934617343338832, 0.93692865298574524,
+    0.30004187584906661, 0.1793452575663857, 0.93691523166475421,
+    0.30004484452265451, 0.17934347816461599, 0.93691462157188798,
+    0.30004626772713722, 0.17933153512685196, 0.93691645184192474,
+    0.30005048826704012, 0.17932766088829724, 0.9369158417547665,
+    0.30008841568862449, 0.17933113651354454, 0.93690302926516988,
+    0.30009747325560915, 0.17932873037006386, 0.93690058864826209,
+    0.30009997712778697, 0.17932454020139527, 0.93690058864826209,
+    0.30011216438070593, 0.17931689572293777, 0.93689814798569071,
+    0.30013296172218568, 0.1792916496103952, 0.93689631745879565,
+    0.30014358361772575, 0.17928662243621549, 0.93689387671631374,
+    0.30015062811806176, 0.17927163982368463, 0.93689448690621513,
+    0.3001765562126642, 0.17926011653334345, 0.93688838487877379,
+    0.30018828430049077, 0.1792436656084018, 0.93688777466033313,
+    0.30020000411066405, 0.17923360591664339, 0.93688594398788727,
+    0.30021686674253911, 0.17923088031786916, 0.93688106206912636,
+    0.30022107872378312, 0.17923339489046605, 0.93687923130250161,
+    0.30022561089747513, 0.17922899318212937, 0.93687862104125208,
+    0.30023685028195374, 0.17922930607497559, 0.93687495941382404,
+    0.30027870164249887, 0.17921661675162201, 0.93686397391510223,
+    0.30028729972465268, 0.1792054005909135, 0.93686336358250599,
+    0.30029573111499741, 0.1792040353465495, 0.93686092222358264,
+    0.30030245867144179, 0.17918957031865848, 0.9368615325675943,
+    0.30030137355772618, 0.17918181552885371, 0.93686336358250599,
+    0.30030496683730157, 0.17917898445742242, 0.93686275324705592,
+    0.30031104953425447, 0.17918474595338488, 0.93685970152699782,
+    0.30031620026947931, 0.17918568696051712, 0.936857870460717,
+    0.30032479109550664, 0.17918086212466031, 0.93685603936875161,
+    0.30032823106575918, 0.17917509626956576, 0.93685603936875161,
+    0.30033806660476559, 0.17917456732451317, 0.93685298749173274,
+    0.30034603186404929, 0.17917079009780362, 0.93685115633127569,
+    0.30035009117979788, 0.17917036864580427, 0.93684993554336848,
+    0.3003530530154056, 0.17917497855079595, 0.93684810434010424,
+    0.30035633355122332, 0.17917267092541148, 0.93684749393330846,
+    0.30036117761567599, 0.17916774211149752, 0.93684688352365897,
+    0.30036102991132185, 0.17915841424013293, 0.93684871474404607,
+    0.30037462315794661, 0.17914519975352203, 0.93684688352365897,
+    0.3003822907445387, 0.17912276541381472, 0.93684871474404607,
+    0.30038792254739838, 0.17910693526506588, 0.93684993554336848,
+    0.30039729140503119, 0.17910399333180782, 0.93684749393330846,
+    0.30040073421584773, 0.1790918327702542, 0.93684871474404607,
+    0.30039934930802153, 0.17905902962518538, 0.9368554289990555,
+    0.30039186626775405, 0.17903964777465983, 0.9368615325675943,
+    0.30039093502066244, 0.17902843499683174, 0.93686397391510223,
+    0.30039797161630949, 0.17900065674039384, 0.93686702553527557,
+    0.30039985048742618, 0.17898472572375168, 0.93686946678004479,
+    0.30041780895650283, 0.17896416668485121, 0.93686763585074861,
+    0.30042311730028637, 0.17896164569572537, 0.93686641521694869,
+    0.30043826554779568, 0.17893301835971354, 0.93686702553527557,
+    0.3004543469116176, 0.17891560195237841, 0.93686519457173312,
+    0.30046043610063822, 0.17890217985038465, 0.93686580489576787,
+    0.30046230973832228, 0.17888624809494846, 0.93686824616336795,
+    0.30047151838196701, 0.17885479646287805, 0.93687129768365607,
+    0.30046792666923233, 0.17884484611099322, 0.93687434913259737,
+    0.30046636402199389, 0.17883468343776202, 0.93687679024038062,
+    0.30046854887739954, 0.17883101253527492, 0.93687679024038062,
+    0.30048290848560633, 0.17881967354125997, 0.93687434913259737,
+    0.3004866536101875, 0.178813380202722, 0.93687434913259737,
+    0.30050038249498073, 0.17878391156446949, 0.93687556969219676,
+    0.30051395654373608, 0.17876429270347891, 0.93687495941382404,
+    0.3005178578556672, 0.17876093266486678, 0.93687434913259737,
+    0.30066727378262709, 0.17826916063812426, 0.93692011230493999,
+    0.30079951762334539, 0.1780234570813059, 0.93692438271526646,
+    0.30090350992988485, 0.17783477237829892, 0.93692682288695006,
+    0.30095093947176693, 0.17774163311119817, 0.93692926301296897,
+    0.30097577886137683, 0.17770600119875082, 0.93692804295566756,
+    0.30101073039249115, 0.17766287773653666, 0.93692499276246832,
+    0.30106641653624239, 0.17757815235718191, 0.93692316261230046,
+    0.30109918078145786, 0.17753869012481072, 0.93692011230493999,
+    0.3011331496661574, 0.17749072895405527, 0.93691828208627548,
+    0.30105195288639414, 0.17738694550704029, 0.93696402984691496,
+    0.30096501377560742, 0.17715107098356339, 0.93703658334796347,
+    0.3009357383950218, 0.17708151001704889, 0.93705913376196537,
+    0.30073722897702937, 0.17656709644624299, 0.93721992059482018,
+    0.30067545754129432, 0.1762747665079199, 0.93729476469513673,
+    0.30053771023508619, 0.17564539049117478, 0.93745708249810245,
+    0.30043989613191313, 0.17502730929591603, 0.93760402612876881,
+    0.30043249227551028, 0.17451279140566248, 0.93770229989103104,
+    0.3006305951851635, 0.17435078769990456, 0.93766894374669207,
+    0.30078989256509853, 0.1742587138284411, 0.93763497224961379,
+    0.30098918224814392, 0.1744141655487827, 0.93754211160113521,
+    0.30083965129753781, 0.17465240482498737, 0.93754575445469568,
+    0.30096838421445404, 0.17478262931133648, 0.93748016736054562,
+    0.30098727782211765, 0.17479570894518376, 0.93747166289098149,
+    0.30101360724940046, 0.17482856381280937, 0.93745708249810245,
+    0.3010720032744677, 0.17486810204670888, 0.93743095518063657,
+    0.30112218376570465, 0.17491200803847534, 0.93740664595901046,
+    0.30114814755204899, 0.1749291983911383, 0.93739509747822081,
+    0.3011669559293666, 0.17493590576210052, 0.937387803169762,
+    0.30119586056541348, 0.17495128921504971, 0.93737564507525584,
+    0.30122439648550059, 0.1749868490984213, 0.93735983784486532,
+    0.30124400827869763, 0.17499542916618824, 0.93735193350583401,
+    0.30126090336522204, 0.17499891463514369, 0.93734585291667671,
+    0.30128525732251271, 0.17501235828570871, 0.93733551525981451,
+    0.30129432311703236, 0.17502606414660357, 0.93733004204858295,
+    0.30129195897787858, 0.17503664724029824, 0.93732882574801235,
+    0.30129735748635944, 0.17505666422863184, 0.93732335225410923,
+    0.30130986159967887, 0.17507096340047471, 0.93731666211415021,
+    0.30139599417081253, 0.17513437838482873, 0.93727712241660266,
+    0.30143059146376688, 0.17516926077972775, 0.93725947773692175,
+    0.30147221884495451, 0.17521808750286036, 0.93723696207338081,
+    0.30150630782264165, 0.17527662184785772, 0.93721505118983317,
+    0.30151451234771759, 0.1753243433871097, 0.93720348562070388,
+    0.30152253233505816, 0.17534309097955536, 0.93719739806509772,
+    0.30153422399273183, 0.1753555240125442, 0.93719131022400493,
+    0.30155684770323182, 0.17536868070354034, 0.93718156908444883,
+    0.30161375596752243, 0.17539120885810514, 0.93715903990008886,
+    0.30163282231451266, 0.17540722743314596, 0.9371499053336122,
+    0.30168728738715239, 0.17547624639870335, 0.9371194521398023,
+    0.30171841488869267, 0.17551056142599447, 0.93710300444774319,
+    0.30177350246597917, 0.175552475011055, 0.93707741501271313,
+    0.30181431143894155, 0.17557339494042506, 0.93706035259194009,
+    0.30183181905973888, 0.17557582394128318, 0.93705425832788813,
+    0.30187923114756626, 0.17557237786494154, 0.93703963092955911,
+    0.30190442076817331, 0.17557786117286228, 0.93703048797069399,
+    0.3019219984040814, 0.17558667340117515, 0.93702317314119554,
+    0.30193853787181213, 0.17560052346436303, 0.93701524827874272,
+    0.30197999579564516, 0.17565284843298259, 0.93699208053037553,
+    0.30199714629301039, 0.17566564605641569, 0.93698415377553756,
+    0.30201533578759376, 0.17567340466298392, 0.93697683634293893,
+    0.30203677857605044, 0.17567882226091891, 0.93696890866048399,
+    0.30207879663580678, 0.17568138919105061, 0.93695488157913209,
+    0.30210115978762309, 0.17568522232034564, 0.93694695256093541,
+    0.30217945408065833, 0.17572299057414567, 0.93691462157188798,
+    0.30219997761077744, 0.17572998483099847, 0.93690669010491257,
+    0.30222314165852826, 0.17573569058968058, 0.93689814798569071,
+    0.30226565618767892, 0.17574064640738399, 0.93688350305133816,
+    0.30230263687988645, 0.17573885106876813, 0.9368719079791521,
+    0.30231194288165864, 0.17570331842352466, 0.93687556969219676,
+    0.30232279476759777, 0.17568139108343114, 0.93687617996771566,
+    0.30234207716131634, 0.17567424385584504, 0.93687129768365607,
+    0.30237793295893522, 0.17565484233676798, 0.93686336358250599,
+    0.30239985510813572, 0.17564640100608078, 0.936857870460717,
+    0.30241993783472187, 0.17564112476173785, 0.93685237710776748,
+    0.30245293399526074, 0.17564616993846685, 0.93684077927020537,
+    0.30247744672983434, 0.17564628634805954, 0.93683284331407579,
+    0.30250066448473761, 0.1756421193071957, 0.93682612789757791,
+    0.30254000958069893, 0.17561342654048129, 0.93681880159485564,
+    0.30255898485893223, 0.17560679168978988, 0.9368139171647436,
+    0.30262361622322675, 0.17560617647135413, 0.93679315629923809,
+    0.30269102909492679, 0.17561704849065415, 0.93676933830313081,
+    0.30275808808079407, 0.17563829850011972, 0.93674368329956992,
+    0.30281581213683784, 0.17566260295079875, 0.93672046729238145,
+    0.30287501880888978, 0.17569412257509984, 0.93669541382141952,
+    0.3028878651280395, 0.17569804195125363, 0.93669052478002257,
+    0.30292069667440341, 0.17571638015409521, 0.93667646776879987,
+    0.30294122698353426, 0.17572334278397253, 0.93666852183391813,
+    0.30301605388385727, 0.17577028074718309, 0.93663551048137805,
+    0.30316684851359882, 0.17583936622476551, 0.93657374469285948,
+    0.3032254909715027, 0.17586206327975051, 0.93655049854456873,
+    0.303245286714389, 0.17587354424125207, 0.93654193313568634,
+    0.30326324039591879, 0.17588820087261958, 0.93653336716764135,
+    0.30328894197333361, 0.17591230372449609, 0.93652051716715556,
+    0.30333001541926274, 0.17595876814592462, 0.93649848566792593,
+    0.30337242506117418, 0.17596709378894324, 0.93648318384046569,
+    0.30341538596643891, 0.17596795082489103, 0.93646910458451627,
+    0.30343830956223194, 0.17596426040251736, 0.93646237049387637,
+    0.30370465469357699, 0.17588929457079791, 0.93639011035617103,
+    0.30381812745342945, 0.17589553498544172, 0.93635212724854577,
+    0.30383890392113538, 0.17589552694437233, 0.93634538716488835,
+    0.30386324384302082, 0.17589262410548959, 0.93633803395273962,
+    0.30388199228773333, 0.17589285556960282, 0.93633190596220139,
+    0.30392686849134626, 0.17589687818035271, 0.93631658473800949,
+    0.30405640285023927, 0.17591446783435774, 0.93627122346696512,
+    0.30412126020470992, 0.17591657022140172, 0.93624976337141885,
+    0.30421273192870368, 0.17590854656450416, 0.9362215533611894,
+    0.30427715370622327, 0.17589832278280215, 0.9362025388635925,
+    0.30436111554059392, 0.17587386812415384, 0.93617984055304937,
+    0.3044238696928433, 0.1758534364719562, 0.93616327445709946,
+    0.30446584239662128, 0.17583303625877023, 0.93615345653035853,
+    0.30450571704473534, 0.17580645770555792, 0.93614547892733824,
+    0.30451161539334148, 0.17580277688305274, 0.93614425156102155,
+    0.30453263483698279, 0.17579577853172731, 0.93613872827143985,
+    0.30457533685176696, 0.17577082154288259, 0.93612952227550905,
+    0.30468517439035386, 0.17569812994383555, 0.93610742526750568,
+    0.30473626484358296, 0.17565530880396185, 0.9360988309885695,
+    0.30478432865224647, 0.17560790019128314, 0.93609207794874949,
+    0.30479842637579035, 0.17558342997115117, 0.93609207794874949,
+    0.30480712301192414, 0.17556505910364326, 0.93609269187571809,
+    0.30480965873399141, 0.17554101500019584, 0.93609637537764712,
+    0.30480438486201716, 0.17551743404508544, 0.93610251431940739,
+    0.30479321453310082, 0.17549754323277739, 0.93610988067311762,
+    0.3047554824419364, 0.1754779421245351, 0.93612583969748475,
+    0.30473941027491724, 0.17546656316276127, 0.93613320475087536,
+    0.30472739464293791, 0.17545468745011542, 0.93613934198168891,
+    0.30471576223159608, 0.17542249766074616, 0.93614916095784806,
+    0.30471062834616253, 0.17535936070832581, 0.93616266085806588,
+    0.3047020894564394, 0.17533816446241618, 0.93616941029058987,
+    0.30470043812164455, 0.17531810143971824, 0.93617370520435494,
+    0.30471520351675518, 0.17529899027977217, 0.93617247810039517,
+    0.30474603404834322, 0.17526505293268135, 0.93616879672007358,
+    0.30475168577641393, 0.17524211493120359, 0.93617125098502818,
+    0.30474878740602251, 0.17519798511302689, 0.93618045407223416,
+    0.30474733393833003, 0.1751087014454954, 0.93619763145158208,
+    0.30476099946856738, 0.1750422711174088, 0.93620560590341451,
+    0.30476713528278709, 0.1750217447387207, 0.93620744609308548,
+    0.30479043382957222, 0.17498773209769605, 0.93620621930282333,
+    0.30482650638369047, 0.17495114850587626, 0.93620131202770096,
+    0.30486741463028749, 0.17492582226118608, 0.9361927238570551,
+    0.30489754938571229, 0.17491269858167563, 0.93618536212304826,
+    0.30495999905447957, 0.17490891101021563, 0.93616572882471627,
+    0.30500504831109371, 0.17488947504993027, 0.93615468381112488,
+    0.30504471150315715, 0.17487613974813826, 0.93614425156102155,
+    0.30510571665117991, 0.17483541631605154, 0.93613197727049302,
+    0.30515266368422073, 0.17482906862815178, 0.93611786042625955,
+    0.30517254857862036, 0.17482065291966034, 0.93611294986597282,
+    0.30521456115747114, 0.17479661247680173, 0.9361037420735413,
+    0.30523758604309564, 0.17478928276855718, 0.9360976031888113,
+    0.30527922232404775, 0.1748053423890448, 0.93608102677571314,
+    0.30530020206692199, 0.17480815739810682, 0.9360736588137577,
+    0.30534338242854508, 0.17481165290537048, 0.93605892165802662,
+    0.30536680348446626, 0.17481020124390104, 0.93605155246425731,
+    0.30539033233217383, 0.17480527140197988, 0.93604479700926946,
+    0.305397671436616, 0.17478258229472524, 0.93604663944030075,
+    0.30541078786215198, 0.17475966196447984, 0.93604663944030075,
+    0.30545407715120043, 0.17475966485483416, 0.93603251347991889,
+    0.30547537953360571, 0.17475203826526703, 0.93602698551961327,
+    0.30550665417904688, 0.17472039335485123, 0.93602268583525816,
+    0.30552118412793239, 0.17469827577312663, 0.9360220715832307,
+    0.30553226624323404, 0.1746756018624904, 0.93602268583525816,
+    0.30559079878384271, 0.17464891733852686, 0.93600855731725729,
+    0.30561211082626177, 0.17463137888162944, 0.93600487136885002,
+    0.30562328205260325, 0.17461512042595165, 0.93600425703413626,
+    0.30564552711600118, 0.17457617984122717, 0.93600425703413626,
+    0.30568205823261463, 0.17454185932491362, 0.9359987278934061,
+    0.30570487886115677, 0.17453154259775322, 0.93599319852172758,
+    0.30574988529144498, 0.17454167127018702, 0.93597660902101509,
+    0.30577604864398872, 0.17453537966668792, 0.9359692352424166,
+    0.30580424813045287, 0.17451892668402078, 0.93596309011329382,
+    0.30581641596041742, 0.17451737980537679, 0.93595940289896695,
+    0.30583850731861889, 0.17453140171420212, 0.93594956982563704,
+    0.30585420959636372, 0.17454673143969687, 0.93594157991613025,
+    0.30587529066390712, 0.1745559312432311, 0.93593297485935323,
+    0.30589840883044911, 0.17455496917465044, 0.93592559865164293,
+    0.30593786479838259, 0.17453855539913066, 0.93591576306940738,
+    0.30598349275664422, 0.1745376886859569, 0.93590100832759482,
+    0.30603155027677387, 0.17454244883403883, 0.93588440728020006,
+    0.30605760332947379, 0.17454952080648373, 0.93587456864178409,
+    0.3060934751344937, 0.17457564310426196, 0.93585796428455026,
+    0.30611030113499971, 0.17458240736615305, 0.93585119895060154,
+    0.30613838257565446, 0.17458921762762897, 0.93584074275601759,
+    0.30615886531033581, 0.17458956881114349, 0.93583397654403777,
+    0.30620186878091815, 0.17458009922021309, 0.93582167345671896,
+    0.306269116377207, 0.1745610723798586, 0.93580321668773858,
+    0.30631110996500899, 0.17454676168749297, 0.93579214139487932,
+    0.30633302053715233, 0.17453799993623192, 0.93578660340210285,
+    0.30641873021650973, 0.17450962541582735, 0.93576383367264704,
+    0.30645788426486292, 0.17449367518650172, 0.9357539860945352,
+    0.30651398191203205, 0.17446115741256393, 0.93574167559572718,
+    0.30653832670292575, 0.17444809824999821, 0.93573613549928125,
+    0.30660120990099954, 0.1744300481570584, 0.93571889816716292,
+    0.30662179808835172, 0.17442688569207002, 0.93571274143554961,
+    0.30668599193707669, 0.174432939842325, 0.93569057484167018,
+    0.3067111438265826, 0.1744316591208431, 0.9356825693305072,
+    0.30679441595040013, 0.17440745140461095, 0.93565978177765086,
+    0.30690162604719251, 0.17436422744423119, 0.93563267798712846,
+    0.30702911804089816, 0.1743381463244065, 0.93559570938049841,
+    0.3070690798733996, 0.17432398525352874, 0.93558523307661889,
+    0.30714890303934705, 0.17430905425312784, 0.93556181247799219,
+    0.30718105453726979, 0.1742954058270573, 0.93555379922319393,
+    0.30721553605117502, 0.17427102676708286, 0.93554701840064447,
+    0.30725345334985887, 0.17421740893808102, 0.93554455256149482,
+    0.30727929564155576, 0.17417182505371473, 0.93554455256149482,
+    0.30728658478965787, 0.17414902990205369, 0.93554640194513172,
+    0.30728748304462195, 0.17412757382184368, 0.93555010063546018,
+    0.30728553851634349, 0.17410450827124044, 0.93555503206297297,
+    0.30727689954893717, 0.17408331923675646, 0.93556181247799219,
+    0.30726643647107615, 0.17406534880840629, 0.93556859254817548,
+    0.30723607151795873, 0.17402619012495918, 0.93558584935258793,
+    0.30716492097512604, 0.17397951578144141, 0.93561789177569699,
+    0.30716711976479971, 0.17395243836470509, 0.93562220459027723,
+    0.30717237786596391, 0.17393983922736594, 0.93562282069524549,
+    0.30719732266408056, 0.17393555486000872, 0.93561542724752123,
+    0.30721586633825815, 0.17392268818226067, 0.93561173036975631,
+    0.30722041951830542, 0.17391464523008629, 0.93561173036975631,
+    0.30722406191073626, 0.17390821078252305, 0.93561173036975631,
+    0.30721905240831876, 0.1738805955567215, 0.93561850790061574,
+    0.30722398887082814, 0.17385861129194272, 0.93562097237179032,
+    0.30724578672775588, 0.17385324780608738, 0.93561481110835221,
+    0.30729051616943986, 0.1738537770569813, 0.9356000229132857,
+    0.30731058965559738, 0.17384814134210319, 0.93559447691690933,
+    0.30737007425945012, 0.17381594095813571, 0.93558091906503627,
+    0.30738161898397215, 0.17380547686711301, 0.93557907016018027,
+    0.30741143729209391, 0.17374941293920418, 0.93557968646464895,
+    0.30745614167684965, 0.17368689439085466, 0.93557660491380668,
+    0.30747325361435707, 0.17367320123532606, 0.93557352329171606,
+    0.30748407158951585, 0.1736573680656569, 0.93557290695874817,
+    0.30749507560471318, 0.17363456163556995, 0.93557352329171606,
+    0.30751150786959053, 0.17359217174773123, 0.93557598859508839,
+    0.30752332320151099, 0.1735712397012307, 0.93557598859508839,
+    0.30756811022731884, 0.17351512858577331, 0.93557167428426269,
+    0.30761660489578396, 0.17348233173809147, 0.93556181247799219,
+    0.30763258829726642, 0.17346728516441959, 0.93555934691242892,
+    0.30764784532453476, 0.17344687482149612, 0.93555811411254797,
+    0.30765041982393243, 0.17342568307827749, 0.93556119609087618,
+    0.30763752687379814, 0.17338869939398036, 0.93557229062293046,
+    0.30763957660051827, 0.17333184478185437, 0.93558215165402392,
+    0.3076451116741491, 0.17331869370840899, 0.93558276794424289,
+    0.30766117654563074, 0.17330015674540003, 0.93558091906503627,
+    0.30767706143630136, 0.17328859098296134, 0.93557783754269341,
+    0.3076963069894546, 0.17328103886406279, 0.93557290695874817,
+    0.30771416404891694, 0.17328260660627914, 0.93556674347232427,
+    0.3077425513700951, 0.17327878460560883, 0.93555811411254797,
+    0.30776457269879837, 0.17325298378768347, 0.93555564847858774,
+    0.30779973662060239, 0.17324377447467354, 0.93554578548676937,
+    0.30784374073123943, 0.17323882825933756, 0.93553222268178937,
+    0.30786583173157078, 0.17323286564009044, 0.93552605731446659,
+    0.30792779848958773, 0.17320264055742512, 0.93551125927018708,
+    0.30796715613200398, 0.1731759600017643, 0.93550324297750731,
+    0.30803680800033972, 0.17311536533697358, 0.93549152599112728,
+    0.30805018247122046, 0.17311156255610247, 0.93548782567643951,
+    0.30807158031569615, 0.17311014527277152, 0.93548104149973532,
+    0.30809768439434015, 0.17309368401251937, 0.93547549055323709,
+    0.30817025036032103, 0.17307784699365727, 0.93545451822784909,
+    0.30819803657522699, 0.17305170786505436, 0.93545019998723766,
+    0.3082434643396324, 0.17300080251840952, 0.93544464775842728,
+    0.30826166877952915, 0.17298838064410654, 0.93544094614432483,
+    0.30828384232573552, 0.17297889203802949, 0.93543539353082894,
+    0.30832831968435359, 0.17296634974120123, 0.9354230535633743,
+    0.30839117702074387, 0.17295774115428117, 0.9354039243613258,
+    0.30843233998989467, 0.17297445825918495, 0.93538726121232774,
+    0.30847100163974489, 0.17299897128258951, 0.93536997871566219,
+    0.30856998102616084, 0.17303607547892108, 0.93533046747786841,
+    0.30863534891640565, 0.17304299434920589, 0.93530761971979526,
+    0.30867832427269876, 0.17305646803822203, 0.93529094456983519,
+    0.3086968346834813, 0.17306684565809383, 0.93528291505317085,
+    0.30873687592978544, 0.17308221218190115, 0.93526685457538572,
+    0.30879180151683394, 0.17311442089087881, 0.93524276024762887,
+    0.30882864630066365, 0.17314216097164836, 0.93522545908361976,
+    0.30890362786309922, 0.17319199343224739, 0.93519146815183274,
+    0.30894746023387171, 0.17321727750163501, 0.93517230582923161,
+    0.30897730709933025, 0.1732474788926601, 0.93515685034917184,
+    0.30898588626264584, 0.17326221311730536, 0.93515128594050534,
+    0.30899921502842642, 0.17327181380399484, 0.93514510299358888,
+    0.30901261633210636, 0.1733013056877683, 0.93513520968601171,
+    0.30902258104651459, 0.17330689412631897, 0.93513088113463516,
+    0.30904754553932634, 0.17333578492249932, 0.93511727620733165,
+    0.30905560534035148, 0.17334810547582666, 0.93511232861921489,
+    0.30905946253788796, 0.17337792536779353, 0.93510552538788461,
+    0.30905896372383229, 0.17344218526191596, 0.93509377354013112,
+    0.30906956504388228, 0.17348998668266194, 0.93508140206317614,
+    0.30907886030099174, 0.17351010248505672, 0.93507459726519415,
+    0.30909139464465357, 0.17352778129561211, 0.93506717345613477,
+    0.30909956758950208, 0.17354656029051738, 0.9350609866352636,
+    0.3091161578584054, 0.17356368052369189, 0.93505232460752019,
+    0.30915194384858913, 0.17358661250258745, 0.93503623650343914,
+    0.30922917848831322, 0.17362572005304988, 0.93500343555919774,
+    0.30925303909859031, 0.17362988859029665, 0.93499476982302254,
+    0.30935533493687623, 0.1736276768779445, 0.93496133961146288,
+    0.30937859049642513, 0.173632918612661, 0.93495267116389069,
+    0.30943984584031581, 0.17365380371536177, 0.93492852040223284,
+    0.30948743548109831, 0.17368903377279032, 0.93490622354672959,
+    0.30950066253260344, 0.17370213957599068, 0.93489940988247633,
+    0.30950812837850394, 0.17372550949212598, 0.93489259587363127,
+    0.30952144743610727, 0.17373511666571631, 0.93488640102111176,
+    0.30953828841504749, 0.17373178155737881, 0.93488144493405267,
+    0.30956777062772273, 0.17370925343507737, 0.93487586911825349,
+    0.30958388771901529, 0.17370053624504786, 0.93487215177956984,
+    0.30960599978398662, 0.17369447093605767, 0.93486595598727473,
+    0.30962631779338939, 0.17370160681061897, 0.93485790103155042,
+    0.30964136438978035, 0.17371146903839207, 0.93485108492388191,
+    0.30969364112273207, 0.17375500970872301, 0.93482567639601455,
+    0.309712161713943, 0.17377535077734957, 0.93481575957441232,
+    0.30972466435429813, 0.17378307659556294, 0.93481018104190439,
+    0.30974274251203066, 0.17378753372489819, 0.93480336252227036,
+    0.30980404763355324, 0.17378496397014784, 0.9347835248696682,
+    0.3098187897164113, 0.17379536622740979, 0.93477670500314602,
+    0.3098382191577474, 0.17381408570924151, 0.93476678458223805,
+    0.30985155884839938, 0.17383365594560421, 0.93475872370350321,
+    0.30987973236860894, 0.1738601281291878, 0.93474446096998176,
+    0.30994392719535413, 0.1738790757540962, 0.93471965262832812,
+    0.31000912788659446, 0.17389289082296469, 0.93469546010892002,
+    0.31007360866149569, 0.17390131411587517, 0.93467250422830417,
+    0.31022446662008002, 0.17389909802090128, 0.93462285656718447,
+    0.3102696378714011, 0.17389524132244297, 0.93460857949227005,
+    0.31029033550006341, 0.17388833857018599, 0.93460299240081535,
+    0.31032601764153672, 0.17386136458331086, 0.93459616342031582,
+    0.31034636830877471, 0.17383504934755656, 0.93459430091130291,
+    0.31036865308025768, 0.17381195093284738, 0.93459119667267576,
+    0.31038601225844042, 0.17381099821070264, 0.93458560886379072,
+    0.31039436414878496, 0.17382279140014623, 0.9345806417289696,
+    0.31041272067254511, 0.1738601158624172, 0.93456760213318724,
+    0.31043951684672311, 0.173905732494159, 0.93455021405253724,
+    0.3104471443891752, 0.17391214099169716, 0.93454648774487969,
+    0.31046685772210614, 0.17392033672151549, 0.93453841372671043,
+    0.31050746001135721, 0.17391460263576497, 0.93452599122086455,
+    0.31053254291183824, 0.17391654760973543, 0.93451729478925005,
+    0.31059783119429624, 0.17391679595575399, 0.9344955512691776,
+    0.3106342049395277, 0.1739286175083915, 0.93448126077156146,
+    0.31069351878142021, 0.17393618758631985, 0.93446013292978736,
+    0.31073344149144139, 0.17394500404486013, 0.93444521717793527,
+    0.31075660970702706, 0.17395369937719637, 0.93443589400042981,
+    0.31076820313212755, 0.17396303849646819, 0.93443029978650893,
+    0.31077431258265392, 0.17397215747297248, 0.93442657018247199,
+    0.3108274161102037, 0.17402753595169571, 0.9343985948859489,
+    0.31085293377045853, 0.1740453859757875, 0.9343867813634984,
+    0.31086441331373638, 0.17404825012243544, 0.93438242875410749,
+    0.31088137686726686, 0.17405133372397569, 0.93437621049875708,
+    0.31090513554963439, 0.17404895588584646, 0.93436874821662896,
+    0.31091722283576895, 0.17405073353867853, 0.93436439502944502,
+    0.31092828683228185, 0.17404766174896733, 0.93436128552464082,
+    0.31093912630029719, 0.17403163512499858, 0.93436066361514125,
+    0.31095738405277273, 0.17401904706891178, 0.93435693209837334,
+    0.3109969094131585, 0.17403190032982441, 0.93434138300893732,
+    0.31100910950183025, 0.17404015301014997, 0.93433578490127522,
+    0.31101484979502636, 0.17407330445523242, 0.93432769833876439,
+    0.31109094280890748, 0.17416438333677645, 0.93428539155826762,
+    0.31199896617824713, 0.17408030455973955, 0.93399822947802924,
+    0.3121073446447854, 0.17401650561235166, 0.93397390819725123,
+    0.31258854641522682, 0.17394310938536239, 0.9338266409496826,
+    0.31305022771922658, 0.17393106434874514, 0.93367421501263126,
+    0.31315934744400115, 0.17388226869540663, 0.93364671034700575,
+    0.31301825101982539, 0.17364957036319081, 0.93373732989592362,
+    0.3129098546537265, 0.17294364514871247, 0.93390466240578329,
+    0.31276242025195833, 0.17235725485570885, 0.93406244179751796,
+    0.31262756908999978, 0.17209519421052386, 0.9341559008936996,
+    0.31247044068661095, 0.17191064501760986, 0.93424244916763688,
+    0.3121955624852889, 0.17168631304014373, 0.93437558865756754,
+    0.31194293232392417, 0.17159064105819041, 0.93447753256800725,
+    0.31171689312120937, 0.17149394252716568, 0.93457070691272459,
+    0.31170456214674552, 0.17148928460507259, 0.93457567441194733,
+    0.31140103985987028, 0.17138106599784841, 0.93469670085628986,
+    0.31119997995023985, 0.17127607303149875, 0.93478290489603999,
+    0.31094326217570684, 0.17115033874567798, 0.93489135692591008,
+    0.31071252520301795, 0.17100779108977729, 0.93499415082050596,
+    0.31069228794044418, 0.17097687111177851, 0.93500653032968617,
+    0.30962347907046911, 0.17119783632313007, 0.93532058784492578,
+    0.30892966403768524, 0.17132851123853371, 0.93552605731446659,
+    0.30717151940816007, 0.1716392933266836, 0.93604786771339799,
+    0.30690937429364351, 0.17168968082036279, 0.93612461214866372,
+    0.30589212908828284, 0.17172324778593831, 0.93645135032829474,
+    0.30551936481678521, 0.17170267801018568, 0.93657680308989,
+    0.30544089837192212, 0.17163543185934058, 0.93661472128736634,
+    0.30524654747050123, 0.17139726389477467, 0.93672168929022026,
+    0.30508823523837875, 0.1712250373686989, 0.93680475836602117,
+    0.30494666399117698, 0.17103292103737675, 0.93688594398788727,
+    0.30443125408475186, 0.17040036447538509, 0.93716878272968585,
+    0.30336623771183657, 0.16910955810722733, 0.93774777161737033,
+    0.30308393322275973, 0.16893693572157659, 0.93787016221395247,
+    0.30312855099382474, 0.16825728229498155, 0.93797791473311942,
+    0.30316210879455202, 0.1677170973323886, 0.93806380969187719,
+    0.30335283844168898, 0.16424060546355645, 0.93861710986234148,
+    0.30335509426890606, 0.16421923389144469, 0.9386201201770662,
+    0.30328144427950726, 0.16410750423452694, 0.93866346078328355,
+    0.30322577164478681, 0.16386602793976618, 0.93872363147929083,
+    0.30320096877958086, 0.1637671680605837, 0.93874889464464362,
+    0.30316583524086149, 0.16361151930202272, 0.93878738119682603,
+    0.30270343680727951, 0.16334696580008479, 0.93898263994014675,
+    0.30263253375792271, 0.16261441021259013, 0.9391326333923613,
+    0.30253044755130282, 0.16214946591542378, 0.93924590976365252,
+    0.30232967040035386, 0.16155176760442594, 0.93941353874611522,
+    0.30200029256654681, 0.16103712358041788, 0.9396078267653295,
+    0.30186976187939085, 0.16078689406599944, 0.93969262078590832,
+    0.30186211003976282, 0.16077335010521687, 0.93969739619639658,
+    0.30175955161624463, 0.16058556567065149, 0.9397624429112923,
+    0.30166394733043639, 0.16040904717233528, 0.9398232815089671,
+    0.30164492517946268, 0.16038542580471993, 0.93983341837950996,
+    0.30143687933559576, 0.16015470539593529, 0.93993950768970158,
+    0.301237471183947, 0.16002651199773357, 0.94002526636922901,
+    0.3010111633791227, 0.15988945018946701, 0.94012107903144959,
+    0.30093993249523904, 0.1598556547853712, 0.94014962993286399,
+    0.30081825825738112, 0.15979438876051771, 0.94019898363040577,
+    0.30081391069737518, 0.1597920793405451, 0.94020076712954059,
+    0.3007536567092452, 0.15976209157321308, 0.94022513903435367,
+    0.30070789400861209, 0.15973980096156967, 0.94024356337582204,
+    0.30069612970812637, 0.15963599289141869, 0.94026495593110593,
+    0.30072649970889997, 0.15959627816086394, 0.94026198496484648,
+    0.3008121274977828, 0.15949438922574893, 0.94025188314396002,
+    0.30093028127522653, 0.15939759924369376, 0.94023048832026279,
+    0.30105081025637537, 0.15930671870657992, 0.94020730640583861,
+    0.30165257947231905, 0.15878172335062921, 0.94010323136743901,
+    0.30174825586976584, 0.15864919196526606, 0.9400949015755391,
+    0.3017158393228862, 0.1584957253392065, 0.94013119156364833,
+    0.30172399572872638, 0.15845902470478637, 0.94013476049505762,
+    0.30178139818840644, 0.15815534887358351, 0.94016747089554509,
+    0.3017852625625112, 0.15814797491574339, 0.94016747089554509,
+    0.30192063868578611, 0.15793894134415348, 0.94015914543371593,
+    0.30192890793554678, 0.15792313259998705, 0.94015914543371593,
+    0.30193579834470186, 0.15790995831578347, 0.94015914543371593,
+    0.30204779412527255, 0.1577913334140868, 0.94014308760074472,
+    0.30225987727805859, 0.15773965637848858, 0.94008359596019397,
+    0.30229856391275223, 0.15774709114461685, 0.9400699088321568,
+    0.30231704239443608, 0.15775069184877213, 0.94006336227890219,
+    0.3027406911147153, 0.15783598442695465, 0.93991269592625393,
+    0.30280246829777158, 0.15783458689713786, 0.9398930302815246,
+    0.30290086456790283, 0.15781260237052072, 0.93986501625343033,
+    0.30297791096298082, 0.1577747611720707, 0.93984653545438157,
+    0.30300147101906105, 0.15773661498514391, 0.939845343050288,
+    0.3031380064232751, 0.15756299910924845, 0.93983043703288383,
+    0.30318794863459847, 0.15749890411247461, 0.93982507042859509,
+    0.30320138639617855, 0.15748370970088305, 0.9398232815089671,
+    0.30325048203339411, 0.15745679325402026, 0.93981195108631965,
+    0.30355047977076594, 0.15729521619798742, 0.93974215676012229,
+    0.30371230234876123, 0.15725738351640045, 0.93969620236094942,
+    0.30372543234279242, 0.15725342663578074, 0.93969262078590832,
+    0.30385272056940754, 0.1572144373191931, 0.93965799358116409,
+    0.30388381402517772, 0.15720430395939267, 0.93964963384771993,
+    0.30395793552210509, 0.15713237800121879, 0.93963769039817779,
+    0.30410837650492217, 0.15693044705810361, 0.93962275947620821,
+    0.30420986898009394, 0.15685173876783742, 0.93960304792003535,
+    0.3042597154576151, 0.15685525762078328, 0.93958632051896585,
+    0.30427356633969693, 0.15685702063360632, 0.93958154084936685,
+    0.30448941107028116, 0.15708602633576954, 0.93947335187120196,
+    0.30464040322837532, 0.15704007293118444, 0.93943208387547694,
+    0.3048760106360669, 0.15684040133539739, 0.93938900709322137,
+    0.30495607005769709, 0.15676717627453826, 0.93937524332817757,
+    0.30531838543732037, 0.15655682902262322, 0.93929262895028032,
+    0.30536941935698936, 0.15652915305626031, 0.93928065133114769,
+    0.30567770005561495, 0.15638750327706849, 0.93920396746791612,
+    0.3057523645251396, 0.15630990987050394, 0.9391925807115179,
+    0.305832286754186, 0.15622555841907471, 0.9391805935363835,
+    0.30588428760575603, 0.15619221367964617, 0.93916920466003939,
+    0.30588728622461753, 0.15618634109411758, 0.93916920466003939,
+    0.30590741549315476, 0.15617575339592399, 0.93916440903470888,
+    0.30591615637895631, 0.15616944664278851, 0.93916261062800577,
+    0.30594965871173185, 0.15614347080798283, 0.93915601624980893,
+    0.30593226836674553, 0.15601885244956917, 0.93918239168560713,
+    0.30593169971242334, 0.15600914307733574, 0.93918418980908269,
+    0.30592981884284509, 0.15598396391987329, 0.9391889846791367,
+    0.30589135295475689, 0.15594753495151631, 0.93920756307115305,
+    0.30586466695938824, 0.15592047864328307, 0.93922074606850126,
+    0.30579180909700615, 0.15581072578664246, 0.93926268275654379,
+    0.30574099124121162, 0.15565042469474255, 0.93930580300942867,
+    0.30574346534684177, 0.15562749572359114, 0.93930879692064428,
+    0.30574052853717998, 0.15552120281062856, 0.93932735757356778,
+    0.3058091262339197, 0.15537541463129842, 0.93932915361985792,
+    0.30585692732371605, 0.15532112950621513, 0.93932256799089453,
+    0.30591863900937666, 0.1552611387356132, 0.93931238951968021,
+    0.30592898618292036, 0.15525161787655778, 0.939310593233038,
+    0.30603882983737141, 0.15510389152501886, 0.9392992161529613,
+    0.30606297103912272, 0.15504899359414384, 0.93930041378897955,
+    0.30607514761461563, 0.15502495498642468, 0.93930041378897955,
+    0.30606143608211905, 0.15500123022364293, 0.93930879692064428,
+    0.30603974813140961, 0.15495333591575314, 0.93932376540373086,
+    0.30594567870434097, 0.15487417756856942, 0.93936746313921227,
+    0.30591289305793395, 0.15484819079117221, 0.93938242461184351,
+    0.30573585380104751, 0.15482762688263638, 0.93944344888579412,
+    0.30572052711907516, 0.15482522870526391, 0.93944883195115925,
+    0.30571780679309207, 0.15481245401580099, 0.93945182244286862,
+    0.30571603449430357, 0.1547760269907443, 0.93945840127279623,
+    0.30571455035251088, 0.1547571770162032, 0.93946198957953464,
+    0.30573939581628901, 0.15470808634700692, 0.93946198957953464,
+    0.30587313396602289, 0.15448351619577494, 0.93945541093848262,
+    0.30591283804466152, 0.15441579447088241, 0.93945361670355332,
+    0.30594160566561884, 0.15439882585816606, 0.93944703762179305,
+    0.30612580621304414, 0.15426660874023537, 0.93940875245986555,
+    0.30615698916410516, 0.15424480242159175, 0.93940217101723478,
+    0.30620616213264817, 0.154227363410019, 0.93938900709322137,
+    0.3062129776084308, 0.15422476601649299, 0.93938721190536578,
+    0.30621737051583592, 0.15422697851291287, 0.93938541669175635,
+    0.30621889918859829, 0.15421300816852784, 0.93938721190536578,
+    0.30625325391661262, 0.15413383086752397, 0.93938900709322137,
+    0.30623727750792962, 0.15402331382746356, 0.93941234219172254,
+    0.30623811137130541, 0.15401435765615162, 0.93941353874611522,
+    0.30616029285834995, 0.15391363141481743, 0.93945541093848262,
+    0.30610198287033064, 0.1538361333315619, 0.93948710484202269,
+    0.30610359382176783, 0.15383292783065813, 0.93948710484202269,
+    0.30610200602787108, 0.15382878400764863, 0.9394883006809831,
+    0.30640410627705156, 0.15348992983315246, 0.93944524326667134,
+    0.30676705241334723, 0.1531710865209242, 0.93937883402151778,
+    0.30686585369415037, 0.15307591886477431, 0.9393620765712577,
+    0.30706243549846046, 0.15287626517157674, 0.9393303509697446,
+    0.30707204097424379, 0.15286432812044051, 0.93932915361985792,
+    0.30727603394992203, 0.15296587839206213, 0.93924590976365252,
+    0.30736129493034275, 0.15296012949886939, 0.93921894846858367,
+    0.30749139068210668, 0.15295256378708427, 0.93917759656379263,
+    0.30762109074177552, 0.15287578920240308, 0.93914762290418574,
+    0.30770154415671908, 0.15282805414888323, 0.9391290356434715,
+    0.30775132481040057, 0.15287152911048485, 0.93910564776539673,
+    0.30790464069109214, 0.15300129021079792, 0.93903425786002115,
+    0.30806382417559142, 0.15306027774120884, 0.9389724338936124,
+    0.30834341456054248, 0.15306098793902223, 0.93888054227802376,
+    0.30839346308202964, 0.15305966854591155, 0.93886431916059554,
+    0.30864973658465161, 0.15298549559568153, 0.93879219119226209,
+    0.30900329136738636, 0.15284377357746776, 0.9386989649524079,
+    0.30912566868418501, 0.15279217656683836, 0.93866707183139408,
+    0.3092985992445908, 0.15270103151495854, 0.93862493653194712,
+    0.30944606182601542, 0.15265764265652504, 0.93858338945398057,
+    0.30956118147755785, 0.15271309057066956, 0.93853640680080863,
+    0.30962221044387128, 0.15274118174078735, 0.93851170381635562,
+    0.3096685485329046, 0.15276202499690753, 0.93849302275955593,
+    0.3101744147922651, 0.15263952724196436, 0.93834588885529069,
+    0.31023755008044379, 0.15262620796655407, 0.93832718342901822,
+    0.31029722275080751, 0.15261991618416504, 0.93830847525591188,
+    0.31060053656870645, 0.15258938646228143, 0.93821308124663039,
+    0.31060707624797945, 0.15258721566668126, 0.93821126927775256,
+    0.31064257574416199, 0.15257437036720384, 0.93820160500933059,
+    0.31069928012388809, 0.15254433984231641, 0.9381877113416961,
+    0.31102040023877869, 0.15238415001871011, 0.93810734005143848,
+    0.311245090557008, 0.1521932408174608, 0.93806380969187719,
+    0.31150889401466869, 0.15191419515100846, 0.93802147430716065,
+    0.31165011593859626, 0.15185987185395972, 0.93798336048991748,
+    0.31187451929039289, 0.15183654788003578, 0.9379125475998602,
+    0.31205994978713347, 0.15185204666654398, 0.93784835856445015,
+    0.31223965065894255, 0.15183436070605963, 0.93779140935783989,
+    0.31239559151557028, 0.15175314242087154, 0.93775262098648793,
+    0.31249951922144298, 0.15175644212328912, 0.9377174589184355,
+    0.31262888918884785, 0.15187591366117839, 0.93765499225148341,
+    0.31267023677406086, 0.15200798367209023, 0.93761980351078245,
+    0.31267376081633508, 0.15202319116169782, 0.93761616274783954,
+    0.31265969419844275, 0.1520932743657748, 0.93760948774872865,
+    0.31265242787128561, 0.15211943232003211, 0.93760766723444711,
+    0.31269633290593241, 0.15224610072941816, 0.93757246557259244,
+    0.31270374693414388, 0.15227199099382702, 0.93756578831147774,
+    0.31289280893480387, 0.15240324167154959, 0.93748138223907762,
+    0.31294645245077779, 0.15243883123938498, 0.93745769004731272,
+    0.31308023179557426, 0.15253780179109142, 0.93739692099108751,
+    0.31319111691396878, 0.15262023574423242, 0.93734646098844143,
+    0.31320302082994761, 0.15262941888342146, 0.93734098823976775,
+    0.31347009239245016, 0.15263027490916775, 0.9372515672734939,
+    0.31356818267163, 0.15264553961985747, 0.9372162685582095,
+    0.31371225148484189, 0.15267097440597152, 0.93716391140623978,
+    0.31372347410154622, 0.152670340962477, 0.93716025779375511,
+    0.31374764605451289, 0.1526617863256837, 0.93715355923728072,
+    0.31399444249060887, 0.1525806240154389, 0.93708411749429998,
+    0.31424229154819766, 0.15243335606425054, 0.9370250018871038,
+    0.31433668849808905, 0.15234362645659397, 0.93700793259294723,
+    0.31447344299901492, 0.15236517372502212, 0.93695854096330711,
+    0.31447787597524307, 0.15237477645847117, 0.93695549148363,
+    0.31450588908813593, 0.15241071730021924, 0.93694024301495016,
+    0.31456392330722027, 0.15248969032262172, 0.93690791036199506,
+    0.31459394273952163, 0.15253272391788156, 0.93689082572399751,
+    0.3146175256689529, 0.15256653943513182, 0.93687740051019164,
+    0.31472974323381092, 0.15270984735629581, 0.93681635940262931,
+    0.31474379219139431, 0.15272209335768619, 0.93680964313857629,
+    0.31475033763316584, 0.15271983995359395, 0.93680781137027069,
+    0.31493910820559895, 0.15267156696113127, 0.93675223552671327,
+    0.31509154396857131, 0.15272440873780577, 0.93669235819194641,
+    0.31522031105859016, 0.15276983695287402, 0.9366416243225143,
+    0.31536989053073827, 0.15291846437499348, 0.93656701596833103,
+    0.31545250677813041, 0.1529354039930497, 0.93653642650613234,
+    0.31557714576172652, 0.15285436456751955, 0.93650766590858281,
+    0.31558008029669904, 0.15284830589308851, 0.93650766590858281,
+    0.31563970015095189, 0.15285269837537582, 0.93648685644166063,
+    0.31579730513113979, 0.15286098385133012, 0.93643236898769855,
+    0.31587685236392959, 0.15287295058596806, 0.93640358559746895,
+    0.31598073183085246, 0.15288715106515635, 0.93636621903548989,
+    0.31602257970632475, 0.15289446623646366, 0.93635090180446057,
+    0.31604116363285717, 0.15289733097234789, 0.9363441616580529,
+    0.31625748953388561, 0.15293047124869544, 0.93626570549036781,
+    0.31626712304421667, 0.15294057820804782, 0.93626080042834348,
+    0.31633254019486112, 0.15300423098987481, 0.93622829978219713,
+    0.31639964961442407, 0.1530005773276151, 0.93620621930282333,
+    0.31642428986238308, 0.15308472791478892, 0.93618413512745535,
+    0.31644609944879243, 0.15315594391590467, 0.93616511523708956,
+    0.31649824260189657, 0.15318322591869968, 0.93614302418329842,
+    0.31656736346482017, 0.15321667999627647, 0.93611417752315396,
+    0.31662177142860348, 0.15327302478843649, 0.93608655247771644,
+    0.31667389738226998, 0.15333032403559743, 0.93605953573897327,
+    0.31674140072706991, 0.15336710302257178, 0.93603067085214553,
+    0.31677682143512742, 0.15338766636578102, 0.93601531462274545,
+    0.31689394848423452, 0.15338566761785694, 0.93597599455514646,
+    0.31703675075789906, 0.15338308243825582, 0.93592805743316243,
+    0.31718739870345691, 0.15345801577458246, 0.93586472927355391,
+    0.31721121349679782, 0.1534387934629208, 0.93585980931576074,
+    0.31724652752173332, 0.15341829812028199, 0.93585119895060154,
+    0.3172837144291949, 0.15339392097966645, 0.93584258802669207,
+    0.31738977217786585, 0.15335089380415889, 0.93581367583849084,
+    0.31739137804726758, 0.15334757009782857, 0.93581367583849084,
+    0.31747078795637179, 0.15339345482691283, 0.93577921905256278,
+    0.31747814084726156, 0.15339700754854688, 0.93577614211910609,
+    0.31765721354258397, 0.15336045665160766, 0.93572136077999823,
+    0.31781649194509959, 0.15333476941584934, 0.93567148398136979,
+    0.31816536259615097, 0.1534346362691808, 0.93553653826935268,
+    0.31816482700629467, 0.15343574687487463, 0.93553653826935268,
+    0.31824526356239324, 0.15353958175716084, 0.93549214270026826,
+    0.31834344494031575, 0.15352394030039343, 0.93546130375241787,
+    0.31834866061459438, 0.15352440107105206, 0.93545945318900303,
+    0.31836254953333143, 0.15354822121899012, 0.93545081688730225,
+    0.31839833286030311, 0.15360932073998645, 0.93542860668977812,
+    0.31853006608320905, 0.15361805143753915, 0.93538232358408402,
+    0.31859113177336035, 0.15366806346552297, 0.93535331133541477,
+    0.31859914948395185, 0.15367398698423618, 0.93534960719106053,
+    0.31867740580146253, 0.15366580082563647, 0.9353242927927542,
+    0.31874134688993916, 0.15366098042332324, 0.93530329673220469,
+    0.31875632884026955, 0.153659975531903, 0.93529835600401268,
+    0.31875993565406519, 0.15366377111644625, 0.93529650318393076,
+    0.31883556242251937, 0.15372491754765294, 0.93526067695572612,
+    0.31884051009777026, 0.15372593135915474, 0.93525882361427315,
+    0.3189106145405225, 0.15371583043395803, 0.93523658151688283,
+    0.31897416196595429, 0.15370804322088885, 0.93521618968414066,
+    0.31913595008054696, 0.15365425043958228, 0.93516983307206658,
+    0.31917763475889299, 0.15369559328782284, 0.93514881279592221,
+    0.31921210186157256, 0.15372934870631078, 0.93513149950766317,
+    0.31923854842860311, 0.15375718622421952, 0.93511789464302797,
+    0.31934656404471323, 0.15380371733411671, 0.93507335999216823,
+    0.31940912397698545, 0.15383178710500334, 0.93504737462672749,
+    0.31942948647339692, 0.15389104834869435, 0.9350306670957278,
+    0.31947882330059418, 0.15390519919021484, 0.93501148181436144,
+    0.31963981149699056, 0.15394701304225705, 0.93494957515447619,
+    0.31965318496911271, 0.15394933020494392, 0.93494462139131607,
+    0.31973556041257056, 0.15396631703031502, 0.93491365624199751,
+    0.31987490928776702, 0.15399284454656872, 0.93486161876322593,
+    0.32000662125934909, 0.15413675194700091, 0.93479282413238718,
+    0.32009232920937497, 0.15420694341283434, 0.93475190258409635,
+    0.32018030179673362, 0.15427617792204376, 0.93471034832568234,
+    0.32034388980760614, 0.15441769738182556, 0.93463092555202087,
+    0.32034961982947285, 0.15442459367657471, 0.93462782215325535,
+    0.32051441324438906, 0.15458607835898014, 0.93454462455261933,
+    0.32052760566791422, 0.15460002637100453, 0.93453779262846226,
+    0.32058171962052756, 0.15465302588694479, 0.93451046148727379,
+    0.32062941852301613, 0.15467051783710625, 0.934491202146705,
+    0.32071758925951538, 0.15470546097727028, 0.93445516119467986,
+    0.3207389646900432, 0.15471370175940083, 0.9344464602198792,
+    0.32095462136837277, 0.15475834767431265, 0.93436501692186713,
+    0.32124369094891742, 0.15484590747669774, 0.93425116321213875,
+    0.32125169318679103, 0.15485183760891322, 0.93424742868993904,
+    0.32133449463717823, 0.15491663204731387, 0.93420821002139909,
+    0.32179593275536322, 0.15527339776100943, 0.93399012286525662,
+    0.32229792146182246, 0.15566196931910251, 0.93375232322553703,
+    0.32232254342901406, 0.15568218662090813, 0.93374045364136604,
+    0.32239297978086506, 0.15573494454415399, 0.93370733832172703,
+    0.32252445618924919, 0.15571376387262037, 0.93366546412537443,
+    0.32284665704428889, 0.15566092946380636, 0.93356291222059118,
+    0.32293459970378491, 0.15564359524803958, 0.93353538528136182,
+    0.3229559062870323, 0.15564066713603225, 0.93352850268632526,
+    0.32300325154372395, 0.15564750672395311, 0.93351098180085634,
+    0.32302678845268479, 0.15565120694126278, 0.93350222052208998,
+    0.32313952735176549, 0.1556687006966726, 0.93346028382909108,
+    0.32354516125287386, 0.15573124468471938, 0.93330933138954519,
+    0.32361604871972005, 0.15574171264034381, 0.93328300742855508,
+    0.32364399068185601, 0.15574750730221204, 0.9332723510662202,
+    0.32373890671463579, 0.15576813281620061, 0.93323598788203987,
+    0.32385383036822618, 0.15578096957292545, 0.93319397023059869,
+    0.32398805612079529, 0.15579122695797276, 0.9331456655281628,
+    0.3240993990399722, 0.15578139436690117, 0.93310864142983529,
+    0.32418257557112273, 0.15581510526129266, 0.93307411852890099,
+    0.32433061851454525, 0.15582285367265464, 0.93302137605056135,
+    0.32439488251222892, 0.15582446167710856, 0.93299876599217246,
+    0.32443315808085149, 0.15582751604409223, 0.9329849469210173,
+    0.32452820383465775, 0.15577628489599815, 0.93296044609610951,
+    0.3245820307706509, 0.15577702998301535, 0.93294159636628438,
+    0.32460720454993042, 0.15577726213048762, 0.93293279895039005,
+    0.32464776546862029, 0.15577929974950577, 0.9329183448436339,
+    0.32468022562721816, 0.15577187018027247, 0.93290828892619404,
+    0.32474177483087169, 0.15576026436274076, 0.93288880351590919,
+    0.32480364044024185, 0.1556839606732528, 0.93288000275804772,
+    0.32486752264706403, 0.15566368317560261, 0.93286114211567683,
+    0.32491306201225206, 0.1556025359019807, 0.93285548342425217,
+    0.32491782867791652, 0.15556996261753087, 0.93285925591077679,
+    0.3249188405724579, 0.15553768496299006, 0.93286428573367697,
+    0.32492821456811022, 0.15549547188069854, 0.93286805798150196,
+    0.32494821010986391, 0.15542349690597587, 0.93287308748613484,
+    0.32499417114729667, 0.15530471254455122, 0.93287685949525834,
+    0.32497901933947082, 0.15521178424536139, 0.93289760371678909,
+    0.32497315043016944, 0.15518251262487742, 0.93290451776959482,
+    0.32495215919781095, 0.15515089863918086, 0.93291708789373939,
+    0.32493000576672193, 0.15508391740868788, 0.93293594094858057,
+    0.32488207173683575, 0.15497263187164648, 0.93297112647431735,
+    0.32487633951966555, 0.15487872685704127, 0.93298871589502363,
+    0.32491299669530521, 0.15482452453427131, 0.9329849469210173,
+    0.32498555553513531, 0.1547971603461322, 0.93296421573514454,
+    0.32506399643692702, 0.15473847763131546, 0.93294662321099397,
+    0.3251500489166167, 0.15468269571249205, 0.93292588630428641,
+    0.32516562022975271, 0.15467270476125655, 0.9329221156251134,
+    0.32522057778358004, 0.15462159229153119, 0.93291143147854383,
+    0.32525673087773277, 0.1545455273871886, 0.93291143147854383,
+    0.32525754007176333, 0.1545438243448097, 0.93291143147854383,
+    0.3253069585897238, 0.15454225184412473, 0.93289446085184302,
+    0.32536208676737066, 0.15455521711824588, 0.93287308748613484,
+    0.32536730804528441, 0.15455560932320292, 0.93287120144321023,
+    0.32537924713170374, 0.15454944818350747, 0.93286805798150196,
+    0.32539569940765645, 0.1545148057786796, 0.93286805798150196,
+    0.32541582347531894, 0.15446102838002601, 0.93286994406705204,
+    0.32542761419824157, 0.15445896962348482, 0.93286617187037701,
+    0.32548029147625157, 0.15444290747739811, 0.93285045328308769,
+    0.32554760017004875, 0.15441498395584938, 0.93283158863400251,
+    0.32558311794094563, 0.15440468400068955, 0.93282089753097808,
+    0.32574294599749443, 0.15433356764311171, 0.93277686668968285,
+    0.32594171350669182, 0.154153380474123, 0.93273722702844986,
+    0.3260158515444202, 0.15411464468895397, 0.93271771765854439,
+    0.32611779356986681, 0.15410086197605941, 0.93268435660482552,
+    0.32618427006034578, 0.15407447568146337, 0.93266546945230133,
+    0.32620637664231944, 0.15406959801531736, 0.93265854352238031,
+    0.32630622226089728, 0.15402969539696673, 0.93263020659302021,
+    0.32640180007353492, 0.15397590413606835, 0.93260564326741902,
+    0.32643584625817684, 0.15395714015985112, 0.93259682460938498,
+    0.32643959671919609, 0.15395681956937243, 0.93259556475564065,
+    0.3265228790501839, 0.15397101886918199, 0.9325640647189688,
+    0.32657980310821244, 0.15396859959738082, 0.93254453112965208,
+    0.32671401787367732, 0.15395870082347851, 0.93249915225998203,
+    0.32674000348178328, 0.15395700827952757, 0.93249032688084321,
+    0.32686751453452917, 0.15395365422450755, 0.93244619163410181,
+    0.32696964152341706, 0.15390484683024572, 0.93241844235525861,
+    0.32717534902424561, 0.15380780015373585, 0.93236229632194567,
+    0.32726125622654129, 0.15375125688145602, 0.93234147241254839,
+    0.32733522922013475, 0.15370093493033801, 0.93232380121551217,
+    0.32735371894099119, 0.1536921844596498, 0.93231875189310842,
+    0.32741588350488943, 0.15366697595614554, 0.93230107783333926,
+    0.32749557499826121, 0.1536771764198859, 0.9322714056561906,
+    0.32755878177692227, 0.15370334827613408, 0.93224488478592582,
+    0.32764797459594669, 0.15372775719800788, 0.9322095158332403,
+    0.32779247601298739, 0.15376833225984451, 0.93215202229212657,
+    0.32781028819969676, 0.15377249978630333, 0.93214507093043364,
+    0.32782488620784139, 0.15377585725882478, 0.93213938319713185,
+    0.32786024218912913, 0.15378476261616189, 0.93212547888080832,
+    0.32804613492876172, 0.15382515862961482, 0.93205340723097752,
+    0.32808376147794227, 0.15384070665880081, 0.93203759711140699,
+    0.32820815192981007, 0.15389344397004398, 0.93198509478953451,
+    0.32828670343627886, 0.15395963245035663, 0.93194649627684734,
+    0.32844390925449563, 0.15400748455419336, 0.93188319717382739,
+    0.32859882582313099, 0.15413679717232365, 0.93180720077981671,
+    0.32862076943652724, 0.15415128884446197, 0.93179706483897884,
+    0.32863348244405582, 0.15415865190330974, 0.93179136305293508,
+    0.32863777240928299, 0.15415716532218304, 0.93179009595814732,
+    0.32878205493161922, 0.15408694849157745, 0.93175081038842977,
+    0.32903499424248378, 0.15416416884170994, 0.93164874368465367,
+    0.32913282124727933, 0.15421981195545059, 0.93160497829188949,
+    0.32923947447879792, 0.15427959703979757, 0.93155739188853126,
+    0.32932448067642517, 0.15436639931846538, 0.93151296351079027,
+    0.32939719364337239, 0.15443344121752056, 0.93147614089335928,
+    0.32954013972220431, 0.15448853287254652, 0.93141644258771716,
+    0.3296671160583069, 0.15459297893276525, 0.9313541772357562,
+    0.32967366525505365, 0.15459815585015799, 0.93135099970152446,
+    0.32973743857730892, 0.15455786192083634, 0.93133511096647437,
+    0.32984203873556389, 0.15448402986424212, 0.93131032099922029,
+    0.32986893381767135, 0.15444959352592993, 0.93130650677511528,
+    0.33000172271261419, 0.15434607364768566, 0.9312766251529403,
+    0.33029036825853847, 0.15421980003255706, 0.93119521364403346,
+    0.33042114098709846, 0.15407790845859651, 0.93117230828338549,
+    0.33047063302829877, 0.15394863717987428, 0.93117612609878209,
+    0.33049720409904398, 0.15391468535817662, 0.93117230828338549,
+    0.33065775926166407, 0.15371986897404122, 0.93114748999428598,
+    0.33077316265929751, 0.15365277840932581, 0.9311175750416596,
+    0.33084538302249761, 0.15367860433406152, 0.93108765382354408,
+    0.33094868743693656, 0.15371465157092454, 0.93104498934057867,
+    0.33096181900985688, 0.15371723951044869, 0.93103989422310696,
+    0.33101501419466783, 0.15373000642035253, 0.93101887494491875,
+    0.33119645504429696, 0.15374822021380238, 0.93095133758278636,
+    0.33122982337707335, 0.15374965696537324, 0.93093922846156985,
+    0.3315671265474659, 0.15393365842325246, 0.93078873510452964,
+    0.33162278184174965, 0.15369785801983749, 0.93080787437776502,
+    0.33145729046306155, 0.15351786279601812, 0.93089651970636811,
+    0.33127416585817987, 0.15335651230035727, 0.93098829593611832,
+    0.33094338655432204, 0.15305752067800255, 0.93115512685044022,
+    0.33075557239314246, 0.15286345658250852, 0.93125373286367674,
+    0.33063414245431039, 0.15263019008232823, 0.93133511096647437,
+    0.33048795735106468, 0.15204241994854334, 0.93148312522670618,
+    0.33045752936456113, 0.15192570584866558, 0.93151296351079027,
+    0.33044055580016801, 0.15185363341586433, 0.93153073653040364,
+    0.33038321265482462, 0.15163177255537297, 0.93158721456855154,
+    0.33042030731006422, 0.15136752658769509, 0.93161703097992266,
+    0.33050842876462266, 0.15037969809164295, 0.93174574048793302,
+    0.33064851435964876, 0.14932618280456059, 0.93186546833798711,
+    0.3307453965497964, 0.14911147367101513, 0.93186546833798711,
+    0.33073309654542132, 0.14891704771360526, 0.93190092378414391,
+    0.33062963751503854, 0.14869906713208494, 0.93197244070343732,
+    0.33059849364600546, 0.14847075464556941, 0.9320198876708411,
+    0.330601551312873, 0.14822950986921332, 0.93205720139563031,
+    0.33060746732321428, 0.14817256696848721, 0.93206415709869406,
+    0.33001682237238084, 0.1479867092592167, 0.93230297158909914,
+    0.33020313865982265, 0.14737099647412721, 0.93233453042211445,
+    0.33006452262569347, 0.14717444264808138, 0.93241465793663914,
+    0.32992811492189866, 0.14691278070740965, 0.93250419508380711,
+    0.32993083357698705, 0.14689467127623135, 0.93250608609587227,
+    0.32994016391981479, 0.14661739255788486, 0.9325464215963154,
+    0.33001164780588793, 0.14640023993287532, 0.93255524343603313,
+    0.33009705435863712, 0.14609901827205962, 0.93257225541171418,
+    0.33061876142188246, 0.14559835253477149, 0.93246573896042995,
+    0.33127987878042392, 0.14573627038312537, 0.9322095158332403,
+    0.33181460781466376, 0.14574070508896753, 0.93201862262562729,
+    0.33250812429246884, 0.14571451879891445, 0.93177552355205429,
+    0.33298208151247244, 0.14501144698484869, 0.93171595115409589,
+    0.3332966103169176, 0.14454882109003719, 0.93167537687369051,
+    0.33409457542306381, 0.14398963024918671, 0.93147614089335928,
+    0.33409532934642505, 0.14398788093210671, 0.93147614089335928,
+    0.3341715278235321, 0.14393428250537277, 0.93145709096648666,
+    0.33503311032701316, 0.14332412748485895, 0.9312416493399075,
+    0.33485474693107181, 0.14304252917261623, 0.93134909314694081,
+    0.3343175197615636, 0.14219661419912452, 0.93167157243890508,
+    0.33500551357631325, 0.14081165480978072, 0.93163479096865087,
+    0.33496199923189962, 0.14010802276956003, 0.93175651380936064,
+    0.33488440728877039, 0.13886022573380474, 0.9319711752323705,
+    0.33559572341209426, 0.13814376398323422, 0.93182176992172572,
+    0.33535100839724868, 0.1380033322860478, 0.93193067416245889,
+    0.33401113783300646, 0.1372359058603434, 0.93252499481042939,
+    0.33307175039999182, 0.13591253546785267, 0.93305465637774154,
+    0.33244898339183637, 0.13549870117062507, 0.93333690349348564,
+    0.33129890075722057, 0.13378215278315095, 0.93399324085014823,
+    0.33120936321651229, 0.13365120723703644, 0.93404374229572096,
+    0.33119786500950255, 0.13363177981662772, 0.93405059907704557,
+    0.33101490037555176, 0.13336183709651847, 0.93415403233920968,
+    0.33080801907965007, 0.13298933642747762, 0.93428041342477963,
+    0.33065664349820068, 0.1328674812871149, 0.9343513346311022,
+    0.33058708856637764, 0.13272562069325852, 0.93439610791398064,
+    0.33032226811851462, 0.13227733252545532, 0.93455331923063134,
+    0.32900802034892784, 0.13055518142810499, 0.93525882361427315,
+    0.32906723571869007, 0.12997545042192726, 0.93531873533254817,
+    0.32906944740538541, 0.12992985067354024, 0.9353242927927542,
+    0.32923486198574609, 0.12827858382645818, 0.93549399281059264,
+    0.32973690612998469, 0.12800113708299352, 0.93535516336912705,
+    0.32987930961706624, 0.12781002561970625, 0.93533108493070927,
+    0.33010934907291761, 0.12769510339994522, 0.93526561907424566,
+    0.330417763884367, 0.12754000924157929, 0.93517786936620384,
+    0.33091392015111093, 0.12729639075019217, 0.93503561769175325,
+    0.3311141876015774, 0.12726663061415222, 0.93496876926508532,
+    0.33138317578469445, 0.12736271664234733, 0.93486037953072509,
+    0.33171330757987161, 0.12747697367244532, 0.93472771583907588,
+    0.33253993350990907, 0.12810381486523426, 0.93434822482744573,
+    0.33262878574640342, 0.12836744129138114, 0.93428041342477963,
+    0.33269763785296824, 0.12856483171394645, 0.93422875454217302,
+    0.33341356591003818, 0.12853459832709188, 0.93397765021441803,
+    0.33363532072156815, 0.12852578908976431, 0.93389967036393673,
+    0.33375472501668313, 0.12851961108795196, 0.9338578548659533,
+    0.33337009121083583, 0.12627335432564157, 0.93430156923416863,
+    0.33333669403979083, 0.1260944185917085, 0.93433765096277799,
+    0.33465109139470478, 0.12544456073779903, 0.93395519657509996,
+    0.33493975742012866, 0.12483055264230031, 0.93393398697464869,
+    0.33500489501524794, 0.12469769873002436, 0.93392837211815061,
+    0.3355838948942505, 0.12343824860508114, 0.9338878135348565,
+    0.33593088428195228, 0.12266671882500621, 0.93386472097314632,
+    0.33631766243503808, 0.12327916422698736, 0.93364483482838767,
+    0.3363666839452305, 0.12335374227630064, 0.93361732428127175,
+    0.33643197662044716, 0.12345962993645442, 0.93357980102571447,
+    0.33643329080086182, 0.12346077845899911, 0.93357917555138337,
+    0.33643639255392277, 0.12347124453663037, 0.93357667362562058,
+    0.33691538711715646, 0.12421715928853823, 0.93330494441098,
+    0.33703557022576952, 0.12442787760522997, 0.93323347972372295,
+    0.33722228055357123, 0.124791825102587, 0.93311742770447381,
+    0.33826931040785274, 0.12527461195021131, 0.93267365419900206,
+    0.33839446107129323, 0.12533976573019404, 0.93261950003362526,
+    0.3388940805188832, 0.12558872615517461, 0.9324045656537624,
+    0.33905339340638696, 0.12566459092696594, 0.93233642372631353,
+    0.33917882334231386, 0.12566327748728195, 0.93229097737094824,
+    0.33939305316882434, 0.12565171166586636, 0.93221456908599187,
+    0.33977827292332319, 0.12565139567787459, 0.93207427387169417,
+    0.33990828663753153, 0.12564687612722397, 0.93202747770363925,
+    0.3399630327995582, 0.12564890391190109, 0.93200723670766872,
+    0.3401340502604151, 0.12564599104508739, 0.93194523057298984,
+    0.34117777499445512, 0.12564054380628595, 0.93156437222657551,
+    0.34142031105707243, 0.12564527820337007, 0.93147487097768222,
+    0.34289425273100749, 0.12516127070867242, 0.93099848966506615,
+    0.34324305177424896, 0.12493025396451959, 0.93090098241062191,
+    0.34329124713259285, 0.12489758684842296, 0.93088759388101727,
+    0.34365184741724686, 0.12465197077926753, 0.93078745906224902,
+    0.34380787603145213, 0.12513583318173307, 0.93066490620021503,
+    0.34387139615967238, 0.12533637742239442, 0.93061445045616431,
+    0.34403979177079597, 0.12676473641538213, 0.93035870677918964,
+    0.34535782555388456, 0.12617937755868722, 0.92994985725446233,
+    0.34596357276625789, 0.1259204426273072, 0.92975977996864823,
+    0.34615612927267397, 0.12583729033479904, 0.92969936567051359,
+    0.34677099955310414, 0.12567449115165868, 0.92949222489632088,
+    0.34663906981684794, 0.12379813934244907, 0.92979318989324611,
+    0.34658284989026206, 0.12309983623416401, 0.92990685473388468,
+    0.34637849254375441, 0.12192000775355678, 0.93013840454659702,
+    0.34641630203861001, 0.12047969514652875, 0.93031198462628328,
+    0.34636302080115122, 0.11987531469393961, 0.93040989179421896,
+    0.34630924386716444, 0.11913499623872743, 0.93052499175645531,
+    0.34692891617882149, 0.11766251493727672, 0.93048152034181919,
+    0.34705782157816195, 0.11736795623453017, 0.93047065044027588,
+    0.34721076979627402, 0.11699102373850861, 0.9304610586704285,
+    0.34715489896529833, 0.11687707511132972, 0.93049622537537147,
+    0.34713779952148421, 0.11683624302466991, 0.93050773261658715,
+    0.34708764959331823, 0.11673574392969462, 0.93053905323149477,
+    0.34705187238637625, 0.11665359461497249, 0.93056269898192034,
+    0.34703085288597518, 0.11661417282195467, 0.93057547885288916,
+    0.3469749424718922, 0.11649497262899677, 0.93061125645932119,
+    0.34691470945748137, 0.11635281700305289, 0.93065149564027749,
+    0.34685911310744566, 0.11623248356271368, 0.93068725435516719,
+    0.34684335585822013, 0.11618747806339354, 0.93069874633969318,
+    0.34678555279316953, 0.11606849377184371, 0.930735131564008,
+    0.34669386807650276, 0.11584068711432512, 0.93079766708293454,
+    0.34666431597025593, 0.1157548149934515, 0.93081935671681559,
+    0.34656560580978418, 0.1155013784684302, 0.93088759388101727,
+    0.34655303645923696, 0.11545686898861815, 0.93089779477890477,
+    0.34649311064480554, 0.1153025463164785, 0.93093922846156985,
+    0.34655009869225595, 0.11523417996747284, 0.93092648091222097,
+    0.34660915182842772, 0.11516984291263843, 0.93091245729781491,
+    0.34671187370955303, 0.11504609129445312, 0.93088950660466641,
+    0.34675461449934053, 0.114999811427549, 0.93087930511696404,
+    0.34680015777449097, 0.11494504698991506, 0.9308691029033429,
+    0.34705285805556801, 0.11465716027022398, 0.93081042608805686,
+    0.34712817229014059, 0.11456378565607531, 0.93079383916023817,
+    0.34729994316717977, 0.11436443281871024, 0.93075427798217958,
+    0.34739943561877323, 0.11424398249903817, 0.93073194024623296,
+    0.34748708481815399, 0.11414378363653413, 0.93071151413406139,
+    0.34753054988026155, 0.11408952085294929, 0.93070193839460091,
+    0.34758898980652536, 0.11402605105081313, 0.93068789282284992,
+    0.34766333714498104, 0.11393485302143437, 0.93067129174171881,
+    0.34769553207217246, 0.11390441222030318, 0.93066299048248191,
+    0.34775010144689278, 0.11383694166818338, 0.93065085701100092,
+    0.34842791921201199, 0.11401102567567527, 0.93037598374956354,
+    0.34962373567407479, 0.11429761540454025, 0.92989208974275106,
+    0.34964861706330241, 0.11430507405865271, 0.92988181756079413,
+    0.34981323397144259, 0.11434469824610943, 0.92981503070312155,
+    0.34983482912027453, 0.11435175712935616, 0.9298060378249956,
+    0.35085484802141048, 0.1147821055569703, 0.9293685726684443,
+    0.35136008364330024, 0.11501121071742094, 0.92914934915302294,
+    0.35201865939073251, 0.11530297253525662, 0.92886386944766308,
+    0.35213613828399964, 0.11535574383898428, 0.92881278656023381,
+    0.35215723258765214, 0.11536946001775696, 0.9288030852831064,
+    0.3529088829427291, 0.11569892237188532, 0.92847675237568528,
+    0.35384560212746358, 0.11561834285087905, 0.92813021104340165,
+    0.35423110558713489, 0.11557531767368313, 0.92798850735294314,
+    0.35429541220306915, 0.11556619551491085, 0.92796509381876358,
+    0.3545587171627535, 0.11553706957162353, 0.92786814884373758,
+    0.35474887515304215, 0.11551274367932955, 0.92779849192878339,
+    0.35515855690819692, 0.11547819700370093, 0.92764604535979212,
+    0.35533141425726117, 0.1154596603548298, 0.92758215424440005,
+    0.35534226452344164, 0.11545770064766971, 0.92757824166185865,
+    0.35535914439176158, 0.11545289988272989, 0.92757237259732106,
+    0.35537120356653507, 0.11544721795367668, 0.92756845976047964,
+    0.35557090596598134, 0.11542976966325535, 0.92749409653432247,
+    0.35640930776196961, 0.11534174257862377, 0.92718320075352967,
+    0.35672803227342081, 0.11530802906604219, 0.92706481403580299,
+    0.35695072654801546, 0.11528712736685069, 0.92698169187980373,
+    0.35681327602320384, 0.1148804133950138, 0.92708509678010664,
+    0.35668508149660988, 0.11448609032627798, 0.92718320075352967,
+    0.35662210440487513, 0.1142956363797635, 0.92723092169878762,
+    0.35649957059875165, 0.1139298583260558, 0.92732305241739277,
+    0.35647926759567089, 0.11386577239133944, 0.92733872864891054,
+    0.35647593050778725, 0.1138496224354001, 0.9273419943256771,
+    0.3564492934207939, 0.11377873075992996, 0.92736093385826646,
+    0.35635747220900166, 0.1134965858241368, 0.92743079364827807,
+    0.35622942660941614, 0.11283021050185563, 0.9275612859620832,
+    0.35612488207242354, 0.11225294426343008, 0.92767146386697352,
+    0.35612306079475692, 0.11222640508209941, 0.92767537402505329,
+    0.35603509886957924, 0.11172888378601502, 0.92776918729868374,
+    0.35603229258475333, 0.11169455721808631, 0.92777439742897638,
+    0.35586402279057772, 0.11071803115807044, 0.92795598756610631,
+    0.35586247571687002, 0.11071210010152303, 0.92795728849326375,
+    0.35711384582180589, 0.11041066369905544, 0.92751236458814579,
+    0.35822814305104256, 0.10956235560922216, 0.92718320075352967,
+    0.35823913113555028, 0.10955409293243745, 0.927179931644876,
+    0.35834898174540991, 0.10946595889751427, 0.92714789064349146,
+    0.35845999581858129, 0.10938496719864463, 0.92711453464428772,
+    0.35856965493166842, 0.10930829970408823, 0.92708117129946366,
+    0.35871414165583809, 0.1092004589569022, 0.92703798430254047,
+    0.35886171447969978, 0.10909894360209045, 0.92699282110790826,
+    0.35927774961429804, 0.10882549999250531, 0.9268638029308659,
+    0.35942308979808008, 0.10872503286742155, 0.92681924329827081,
+    0.35957010585706189, 0.10861882381934625, 0.92677467061095442,
+    0.35980137266114387, 0.10845710289992394, 0.92670385186515336,
+    0.35997414542631634, 0.1083433466667421, 0.92665006008613815,
+    0.3600657302745951, 0.10828593226743612, 0.92662118838001695,
+    0.36038764800907885, 0.10829358675420422, 0.92649513880559242,
+    0.36050882414613683, 0.10830050096719329, 0.92644718640785173,
+    0.36055286765179162, 0.10830001074740524, 0.92643010383956192,
+    0.36063944147569599, 0.10830405629737047, 0.92639593297986478,
+    0.36094451836141411, 0.10831120558736031, 0.92627627488188391,
+    0.36097020246258649, 0.10830998521307288, 0.92626640878165456,
+    0.36148354517349585, 0.10832579990182108, 0.92606434314491981,
+    0.36158339968945186, 0.10832477508249533, 0.92602547922416523,
+    0.36218625949367267, 0.1083338764941664, 0.92578879051203067,
+    0.36253833948061537, 0.10833510244755035, 0.92565082940832333,
+    0.36290202318254206, 0.10834236611975888, 0.92550745716800675,
+    0.36294166364215702, 0.10835075100813264, 0.92549093110015779,
+    0.36310348630160505, 0.1083507473909104, 0.92542745462594267,
+    0.36319289082337164, 0.10835050333983372, 0.92539239919148197,
+    0.36353474410044417, 0.10836266932973018, 0.92525673287340093,
+    0.36401115206871593, 0.10837532914564105, 0.92506792680439431,
+    0.36454184524721683, 0.10836919384469632, 0.92485964388614383,
+    0.3654939245582608, 0.10821843834421835, 0.92450146604174677,
+    0.36555306585560643, 0.10820055918834945, 0.92448017557700779,
+    0.36577063350921191, 0.10814762747892487, 0.92440031065169459,
+    0.36657400341200602, 0.10793865348360361, 0.92410645875171826,
+    0.36657724606130965, 0.10793335088934385, 0.92410579179870078,
+    0.36674222574494098, 0.10755497738615893, 0.92408444781584198,
+    0.36689725467502921, 0.1071860915071301, 0.9240657694663037,
+    0.36720638217241047, 0.10655128033076902, 0.92401639463362528,
+    0.36727291715435223, 0.10640867454665495, 0.92400638434274707,
+    0.36737030896844081, 0.10640283718376743, 0.92396833946173562,
+    0.36760857842014594, 0.10639744212007324, 0.92387418915251929,
+    0.36806544260726909, 0.10637304366448397, 0.92369508255693822,
+    0.36831080145106088, 0.10636594851233987, 0.92359809361623713,
+    0.36835378840253258, 0.10636234316547301, 0.92358136540634705,
+    0.36869823225802639, 0.10634887196652948, 0.92344546723737464,
+    0.36871155392296495, 0.1063666559485035, 0.92343809998615778,
+    0.36877517420897848, 0.10643102589037096, 0.92340527809573447,
+    0.36922657362483335, 0.10690624933966107, 0.92316996873890544,
+    0.36938845753967969, 0.10707122066510925, 0.92308608544476489,
+    0.36948919307411771, 0.10718081682896567, 0.92303304854447821,
+    0.36981672550666261, 0.10752008765127927, 0.92286240593437918,
+    0.36985720783571224, 0.10756546248105574, 0.9228408947880492,
+    0.36989876680212924, 0.1076013563014989, 0.92282005311996873,
+    0.36992968434385071, 0.10763345977400915, 0.92280391577969356,
+    0.37002110205105765, 0.10773431323569313, 0.92275549404409096,
+    0.37020723667900557, 0.10792449721734865, 0.92265860685893852,
+    0.37029215660937165, 0.10801867645181466, 0.92261350753778737,
+    0.37031311878311363, 0.10803881786014558, 0.92260273568449047,
+    0.37032401367690398, 0.10805321817230394, 0.92259667620083952,
+    0.3704191147923343, 0.10814691507251714, 0.92254751864430329,
+    0.37060233170142454, 0.10834081268342448, 0.92245118030417328,
+    0.37092284401929276, 0.10867276972413271, 0.92228329319419267,
+    0.37147573205580653, 0.10921783703434106, 0.92199633652587942,
+    0.37166565623451431, 0.10941605148842516, 0.92189628898941234,
+    0.3735828638040512, 0.10988552833845881, 0.92106515216554663,
+    0.3741580151989165, 0.11003199864593946, 0.92081417177212654,
+    0.37464168383327923, 0.10967924837557726, 0.92065958486855159,
+    0.37473615009690064, 0.10961388806016906, 0.92062892272342056,
+    0.37476884742888289, 0.10958795021742383, 0.92061870074638941,
+    0.37511768992987193, 0.1093332842131591, 0.92050689930322682,
+    0.37512538612243301, 0.10932984470815181, 0.92050417149657016,
+    0.37516213326183778, 0.10931284956143632, 0.92049121380227517,
+    0.37552998293924156, 0.10904326688129315, 0.92037318401912827,
+    0.3756762917754824, 0.10896560838787783, 0.92032267166819393,
+    0.37573453067575657, 0.10893202495876624, 0.92030287210040351,
+    0.37583623091079316, 0.10888116076182974, 0.92026736352319127,
+    0.37587100817132313, 0.10885923811962442, 0.9202557533057254,
+    0.37647443065760849, 0.10854703319096645, 0.92004594703007569,
+    0.37687726926163118, 0.10834336083689372, 0.91990501687753756,
+    0.37746577492204503, 0.10823656924076916, 0.91967626578132822,
+    0.37756811068795759, 0.10821742004885385, 0.91963651068750862,
+    0.37856888806447264, 0.10798035250103798, 0.91925287079420126,
+    0.37874458319635407, 0.10793754670592731, 0.91918552355361094,
+    0.37933937259330036, 0.10778141885300811, 0.91895854430466761,
+    0.37941564471255229, 0.10775943576934045, 0.91892963416685591,
+    0.37955919035893398, 0.10772360837618272, 0.91887455357762804,
+    0.3797785742632695, 0.10766125897313884, 0.91879121014889831,
+    0.37979588125490171, 0.10765900387659938, 0.91878432042896274,
+    0.38004120276936842, 0.10759312030499935, 0.91869059245245654,
+    0.38114938133434662, 0.10732003692486285, 0.91826333847262509,
+    0.38124098097242626, 0.10729627832155166, 0.9182280888131914,
+    0.38126880261826962, 0.10728615495592464, 0.91821771988173062,
+    0.38150790562749398, 0.10722913284842159, 0.918125062838554,
+    0.38160005409552827, 0.10720329302185849, 0.91808978465047708,
+    0.38206032557410796, 0.10709306043368008, 0.91791120705063556,
+    0.38212520401609057, 0.10707528022563614, 0.9178862744481272,
+    0.38215614763265676, 0.10707172193950036, 0.91787380678799058,
+    0.38226037883795666, 0.10704408353271538, 0.91783362705410987,
+    0.38256907725984773, 0.1069692504615803, 0.91771372474221846,
+    0.38328023728115568, 0.10654736118863323, 0.91746603181449715,
+    0.38329704232489314, 0.10653473675584574, 0.91746047719198875,
+    0.38397189378230584, 0.10613200325844584, 0.91722493569984176,
+    0.38440914314813579, 0.10593156075316588, 0.91706494595558186,
+    0.38447850172305159, 0.10590879907360699, 0.9170384986420056,
+    0.38470178582406261, 0.10580923194388034, 0.91695634706305573,
+    0.38471825896084599, 0.10580365125285887, 0.91695007966829845,
+    0.38477202783186831, 0.1058314408898873, 0.91692431133508623,
+    0.38542182245287093, 0.10620193941063982, 0.91660851340281935,
+    0.38572446743224781, 0.1063621154180939, 0.91646262096601461,
+    0.3858305107968491, 0.10643483398789418, 0.91640953893562893,
+    0.38603999037812586, 0.10655352659223885, 0.91630752032252438,
+    0.38655014267387378, 0.10682068157881484, 0.91606131300576454,
+    0.38681730359666544, 0.10696427430932669, 0.91593177565781847,
+    0.38763055898226534, 0.10738727582348019, 0.91553837862446175,
+    0.3876755991582263, 0.10734438567512139, 0.9155243375691009,
+    0.3878409004432703, 0.10719631821819026, 0.91547167367637206,
+    0.38804521340204745, 0.10700861155558845, 0.91540705121203025,
+    0.38809692996635708, 0.10696529479666875, 0.91539018929620952,
+    0.38869915591985987, 0.10641335313301514, 0.91519897533933936,
+    0.38927047171730983, 0.10592150629908174, 0.91501318807562371,
+    0.38931971408470445, 0.10587433422198674, 0.91499769703429035,
+    0.3894767160912968, 0.1057411115829959, 0.91494628527795652,
+    0.38983506238645127, 0.10541991388969507, 0.9148307307309046,
+    0.39044877176286746, 0.10487903342088979, 0.91463115242023552,
+    0.39051283926347929, 0.10470188728734914, 0.9146240961011487,
+    0.39060458190391484, 0.10446419311293909, 0.91461209971929114,
+    0.39071781303173964, 0.10415769255052042, 0.9145986910455568,
+    0.39086570601515241, 0.10377563479850826, 0.914578929061589,
+    0.39107556500983431, 0.10318862488543144, 0.91455563534784068,
+    0.39122081918986962, 0.10278740411092345, 0.91453869255955766,
+    0.39150527925005529, 0.10198386472871464, 0.91450692050652715,
+    0.3917066033137564, 0.10141819559965035, 0.91448361741570339,
+    0.39225569548230454, 0.10165314309162059, 0.91422213266869012,
+    0.39282235646284464, 0.10189584506491361, 0.91395176733867356,
+    0.39305817198276927, 0.10198410516519206, 0.91384053079912075,
+    0.39315341377132484, 0.10202346456487747, 0.91379516628078783,
+    0.39335111926428196, 0.10209968338239356, 0.913701565953978,
+    0.39364323471386192, 0.10220557284241294, 0.91356391382538837,
+    0.39368365451043358, 0.10222120145215115, 0.91354474775184835,
+    0.39370899766307205, 0.10223144928710967, 0.91353267918328807,
+    0.39386281870589446, 0.10230514493158969, 0.91345812020123518,
+    0.39424656856951579, 0.10248268557618628, 0.91327265497673515,
+    0.39430196974445331, 0.10251031137672088, 0.91324563657161373,
+    0.39451944178351461, 0.10258596256429076, 0.91314321458333247,
+    0.39513412852334939, 0.10280543806703296, 0.91285270574169775,
+    0.3957211458211462, 0.10309238833610194, 0.91256601636109458,
+    0.3964619228192402, 0.10345756036204753, 0.91220308975490982,
+    0.39696764939946855, 0.10341712466196112, 0.91198771025541403,
+    0.39744984940140582, 0.10338423897085741, 0.91178139723467511,
+    0.39749576253426067, 0.10337840518908201, 0.91176204357708845,
+    0.39749504080715559, 0.10338118023049028, 0.91176204357708845,
+    0.39759854758374497, 0.10336883473999714, 0.91171831119254798,
+    0.39766348015178415, 0.10336571027378091, 0.91169034572774121,
+    0.39832204474012872, 0.10331723851992271, 0.91140830416375973,
+    0.39834622289589217, 0.10331905776773037, 0.91139753072222252,
+    0.39838543738894366, 0.10332626047813771, 0.91137957359819299,
+    0.39908682836444281, 0.10343458238882043, 0.91106036605268925,
+    0.39929260424490381, 0.10345816713949366, 0.91096752074234744,
+    0.39944025957426543, 0.10349047352996622, 0.9108991167630951,
+    0.40016353418246536, 0.10359514171570525, 0.91056970766850232,
+    0.40026462309172434, 0.1036295114023547, 0.91052136486067647,
+    0.4006871979696589, 0.10367101499420708, 0.91033075858903856,
+    0.40115376495869443, 0.10373869491682333, 0.91011754187929972,
+    0.40148917168902354, 0.10382468378288605, 0.90995982331850533,
+    0.40233944508838215, 0.10405655047846457, 0.90955769758080518,
+    0.4034187573275767, 0.10434545725191202, 0.90904638593812315,
+    0.40439740952484221, 0.10463473457696376, 0.90857817907409888,
+    0.40476613925573446, 0.10443095726737735, 0.9084374208916246,
+    0.40486221709715503, 0.10437586210870133, 0.90840093822950307,
+    0.40497790431577857, 0.1043144823892688, 0.90835642001356443,
+    0.40529380259571701, 0.10413641131709481, 0.9082359502989853,
+    0.40548800773953408, 0.10403015755756827, 0.90816144043775116,
+    0.40558112569651933, 0.10397332355939085, 0.90812636701439209,
+    0.40645181498871441, 0.10402266534950222, 0.90773135188004017,
+    0.40765579518441192, 0.10410264212530333, 0.90718211653178871,
+    0.40806673380176595, 0.10396484763454608, 0.90701314831742341,
+    0.40902418047760208, 0.10363500659860138, 0.90661954820747925,
+    0.40909818859605873, 0.10361348711207351, 0.90658861529135681,
+    0.40915766616404531, 0.1035913157339827, 0.90656430743973915,
+    0.40943697114330574, 0.10350007879708988, 0.90644861980698721,
+    0.40955914892647832, 0.10345567815891576, 0.90639849193789901,
+    0.40960309061421918, 0.10344320251070215, 0.90638005936450827,
+    0.4097585484912879, 0.1033896529370618, 0.90631590055778388,
+    0.40978128401360497, 0.10337713204874904, 0.90630704942725493,
+    0.40978507321776642, 0.10337504506207973, 0.90630557420018265,
+    0.41064547991355577, 0.10309901480613548, 0.90594750563847226,
+    0.4108660407453279, 0.10302557125223594, 0.90585585400239532,
+    0.4111327466314727, 0.10294983886543584, 0.90574344895496872,
+    0.41173012606894244, 0.10276958558841222, 0.90549252650987622,
+    0.41194544123737908, 0.10270953414406857, 0.90540140547695724,
+    0.41225895429674309, 0.10262110957440704, 0.9052687239001872,
+    0.41290356718293825, 0.10243112838591105, 0.9049964133327788,
+    0.41291248383239731, 0.10242798526793481, 0.90499270081548833,
+    0.41373382354905802, 0.10218571679390444, 0.90464490411143805,
+    0.41418560374778207, 0.10205496432566365, 0.90445291193327071,
+    0.41453204913253605, 0.10194849374467216, 0.90430618977488664,
+    0.41485613003869964, 0.1018531431731439, 0.90416830767012868,
+    0.41537771341498858, 0.10169376277098124, 0.90394675385866341,
+    0.41593074804502039, 0.10153066193393723, 0.90371075987727745,
+    0.41605377487004946, 0.10149221757423872, 0.90365844553583718,
+    0.41620301821086647, 0.10145935927584943, 0.90359340748342076,
+    0.41634888823730465, 0.10144026096466351, 0.90352834859730957,
+    0.41657749285881074, 0.10140122607518985, 0.90342735391060403,
+    0.41688933551989182, 0.10135999129348713, 0.90328812352137522,
+    0.4171142978737819, 0.10132216757057118, 0.90318850793622429,
+    0.41730811190454753, 0.10186533948544936, 0.90303786872432756,
+    0.41781304690464122, 0.10333017669156386, 0.90263787446636112,
+    0.41784429759950004, 0.10393708959954215, 0.90255372381324606,
+    0.4178590703763449, 0.10416460174007387, 0.90252065519219482,
+    0.4178606385528531, 0.10418435847715905, 0.90251764868998807,
+    0.41787864501770805, 0.10450884616262489, 0.9024717940810788,
+    0.41788940155849791, 0.10462158936161679, 0.90245375011937856,
+    0.41789014946489955, 0.10470936395129968, 0.90244322374380881,
+    0.41789945977041082, 0.1048535633244551, 0.9024221693762644,
+    0.41792152974049923, 0.10488856384437807, 0.90240788125659943,
+    0.41801307634033841, 0.10501546643745513, 0.90235071885459817,
+    0.41808650024606092, 0.10512390429745687, 0.90230407460969586,
+    0.41843918874246139, 0.10524519751831292, 0.9021264289022255,
+    0.41893057870175221, 0.10540844084189158, 0.90187927730262019,
+    0.41918685760851676, 0.10549937424652933, 0.90174955527678968,
+    0.4194342500923805, 0.1055803193264617, 0.90162503626527857,
+    0.41945450864450706, 0.10559008967942524, 0.90161446757429864,
+    0.42004194701579706, 0.1057894196506665, 0.90131756969292098,
+    0.42019804930489657, 0.10584589273284696, 0.90123817404277007,
+    0.42069536183088768, 0.1060156724541482, 0.9009861762136383,
+    0.42093580281075677, 0.1060911091616305, 0.90086498792489356,
+    0.42112793813875943, 0.10614578783388624, 0.9007687447087187,
+    0.42121528469653152, 0.10617874979732013, 0.90072401823727233,
+    0.42151817443162665, 0.10627622739545566, 0.90057081460283739,
+    0.42208609167105088, 0.1064664265738329, 0.90028230640752671,
+    0.42286908622887126, 0.1063099617109733, 0.89993329083492113,
+    0.42313999239999006, 0.10625009031498796, 0.89981301676503511,
+    0.42357643352788032, 0.10616244296457571, 0.89961799707631152,
+    0.42392924477833405, 0.10608495961568142, 0.89946093676435479,
+    0.42456284492056456, 0.10595143334884284, 0.89917778246811808,
+    0.42476202521706768, 0.10590506743099624, 0.89908917167649804,
+    0.42529251598069751, 0.10578113378905223, 0.89885295103543539,
+    0.42528910406517145, 0.10575585160990125, 0.89885754033312104,
+    0.42526785933537276, 0.10536604311600263, 0.89891336889290185,
+    0.42520575861444909, 0.10439255204348347, 0.89905631520998697,
+    0.42517459053684825, 0.10384688736789298, 0.89913424556393329,
+    0.42516759156303241, 0.10376969374840195, 0.89914646734770265,
+    0.42517677287225941, 0.10333408147125343, 0.89919229279193869,
+    0.42518164275787268, 0.10322760096029475, 0.89920222033850583,
+    0.42518746873495206, 0.10294380139566277, 0.8992320002007127,
+    0.42519197007427073, 0.10285847911055804, 0.89923963539171436,
+    0.42519397021065619, 0.10237520091816758, 0.89929383737100321,
+    0.42523038068601243, 0.1017999672563925, 0.899341920522015,
+    0.42526420518568692, 0.10098128608382258, 0.89941822065635468,
+    0.42528817785757217, 0.10047822079641716, 0.89946322488480457,
+    0.42529901437302986, 0.10018614791834082, 0.89949068040675872,
+    0.42530606926571285, 0.099895612652657492, 0.89951965738303841,
+    0.42531368540987297, 0.099842574583096394, 0.89952194487054649,
+    0.42561831216027224, 0.099284916634635262, 0.89943957978437583,
+    0.42600256667658376, 0.098567397150066821, 0.89933657848662185,
+    0.42618748220125585, 0.098227048645267795, 0.89928620412491289,
+    0.42638047626104231, 0.097864088084509179, 0.89923429078677497,
+    0.42685569171739152, 0.097433744575927267, 0.89905555104586288,
+    0.42697161467493194, 0.097327712402913491, 0.89901198916382485,
+    0.42702174871286586, 0.097284260563236816, 0.89899288026817559,
+    0.42744604976630685, 0.096896849822330197, 0.89883306293977006,
+    0.42755062469704297, 0.096804447203803157, 0.89879328119581225,
+    0.42784606208889209, 0.096543257758402293, 0.8986807812212424,
+    0.42796020498165388, 0.096436364040617187, 0.8986379085275038,
+    0.42807162775144408, 0.096341364517739544, 0.89859502724925489,
+    0.42807705869298024, 0.096338661912739695, 0.89859272979566751,
+    0.4281037086428815, 0.096327389083462195, 0.89858124215820023,
+    0.42850500154693011, 0.096186700805437994, 0.89840502126681732,
+    0.42876618018337631, 0.096089702910540767, 0.8982907835024917,
+    0.4291220047737544, 0.095964170717144373, 0.8981342789124156,
+    0.42975011280087427, 0.095732971329872851, 0.89785858505000082,
+    0.43011249881653391, 0.095604915382189168, 0.897698690272277,
+    0.43080457401337346, 0.095342218292843617, 0.89739471829299033,
+    0.43177370802616127, 0.094932396566238739, 0.89697229898115005,
+    0.43195297679585415, 0.094853266831304531, 0.89689435476461199,
+    0.43200426835640632, 0.094831335971461803, 0.89687196959193338,
+    0.43201935279638526, 0.094828324452076812, 0.89686502200219853,
+    0.43217420650827959, 0.094757957242761717, 0.89679785055948802,
+    0.43231350451461809, 0.094699933409025605, 0.89673683788869485,
+    0.43262518733056526, 0.09456407208709898, 0.89660084963014575,
+    0.43320838526212296, 0.094489553241545815, 0.89632707159094394,
+    0.43333093186374783, 0.094478253548855445, 0.8962690238407518,
+    0.43407988777696271, 0.094066326170315559, 0.89594987432800011,
+    0.43476974841986621, 0.093605065773752036, 0.89566364083868999,
+    0.43486401298288491, 0.093649980059491836, 0.89561318181862315,
+    0.43588528643176355, 0.094177234314775329, 0.8950612636066424,
+    0.43642658658193301, 0.094460031789884435, 0.89476764409465348,
+    0.4375819481356415, 0.094131416302811979, 0.89423784035939979,
+    0.43851766498380929, 0.093883564824267102, 0.89380542275879893,
+    0.43876473020900941, 0.093787504665377594, 0.89369425168412997,
+    0.43894784785243485, 0.093721706101619201, 0.89361122904265111,
+    0.43919772596413764, 0.09362679321805939, 0.89349839457026059,
+    0.43966653433152064, 0.093454006818882746, 0.89328589331658315,
+    0.43972354594772572, 0.093433237913968292, 0.89326000313014697,
+    0.44001461192229552, 0.093323332129936626, 0.8931281526046736,
+    0.44039838399287351, 0.093609566266559294, 0.89290901691037494,
+    0.4411121096246971, 0.094140339004918389, 0.8925008141814148,
+    0.44118751172828541, 0.094197491329629027, 0.89245751278265817,
+    0.44177113822362168, 0.094633332893420352, 0.8921226337999103,
+    0.44282954714166001, 0.09543494759146201, 0.8915122898516471,
+    0.4429593537255998, 0.095526836689815209, 0.89143795881656074,
+    0.44328758547064406, 0.095775762856821225, 0.89124806861883321,
+    0.44341610094374373, 0.095865904051215672, 0.89117444412656421,
+    0.44370247312465289, 0.096079410957122829, 0.8910089012648521,
+    0.44370939107467233, 0.096076855322825436, 0.89100573182411147,
+    0.44404592280916944, 0.095925817545625097, 0.89085434048712842,
+    0.44497908900123528, 0.095491109881279901, 0.89043531954054478,
+    0.44542881110490384, 0.095283516531312742, 0.89023268066000527,
+    0.44649087395133474, 0.095746247725691902, 0.88965080538637387,
+    0.44665591608156974, 0.095820780016526108, 0.88955993094695884,
+    0.44728427039892771, 0.09609604234099936, 0.88921444663258575,
+    0.44755961524876342, 0.096218124133849212, 0.88906268810840439,
+    0.44767054371913756, 0.096270582894577003, 0.88900115812936387,
+    0.44879290749266976, 0.096178453020647897, 0.88844506378212884,
+    0.44944614786592013, 0.096119092417548693, 0.88812120807990624,
+    0.44987042665749927, 0.096084210641935411, 0.88791014392466305,
+    0.45012524165684753, 0.096241321121216653, 0.88776397478846114,
+    0.45049761292156698, 0.09647799129130577, 0.88754937775222664,
+    0.45094412741801976, 0.096752252796315705, 0.88729273384043816,
+    0.45123839044867353, 0.096938143483582845, 0.88712282764183603,
+    0.45134563789361504, 0.097006509649255071, 0.88706079399332871,
+    0.451468827477574, 0.097089044411976716, 0.88698907280258743,
+    0.45147941015623416, 0.097098740056366234, 0.88698262490560942,
+    0.45156897941762936, 0.097153461524899842, 0.8869310355047062,
+    0.45203157834546359, 0.097446163266188324, 0.88666323789994161,
+    0.45214943808111918, 0.097523598822489482, 0.88659462738933759,
+    0.45234734986965469, 0.097648085387367481, 0.88647996395072659,
+    0.45236630702875075, 0.097662919875443954, 0.8864686561557451,
+    0.4524634702004639, 0.097726049359112124, 0.88641210924197911,
+    0.45280505177190988, 0.097939625570447886, 0.886214090856695,
+    0.45301047237883407, 0.098072618370170409, 0.88609439307622551,
+    0.4531030372053928, 0.098127429238587471, 0.88604099527407554,
+    0.45359088629325611, 0.098438642164731513, 0.88575681854584809,
+    0.45378030915720413, 0.098564342472855601, 0.88564581036331103,
+    0.45393958882747787, 0.09866116488400152, 0.88555339999283622,
+    0.45466723473500087, 0.099125176280418809, 0.88512818568035867,
+    0.45577678971185809, 0.099190434679815254, 0.88455004133626147,
+    0.45671344337482334, 0.099255698586020208, 0.88405946459438645,
+    0.45883465512907406, 0.09936955025162561, 0.88294759285892688,
+    0.45883616124712678, 0.099369876430722703, 0.88294677347513062,
+    0.45884085302706001, 0.099370054137986399, 0.88294431530760398,
+    0.46073043224535742, 0.099485511931753104, 0.88194676807542249,
+    0.46195985415655078, 0.099551002801489652, 0.8812960291462093,
+    0.46313240982919857, 0.099605772226508377, 0.88067420826600806,
+    0.46414680380302314, 0.10099163314406973, 0.8799820649049227,
+    0.46441474149320616, 0.10160781974435691, 0.87976974194990176,
+    0.46505017556643408, 0.1024147017517289, 0.87934041364578097,
+    0.46494077376980453, 0.1026186548474699, 0.87937448710070687,
+    0.4646926218358049, 0.10360970834313749, 0.87938944475608505,
+    0.46554804114273551, 0.1046417467572331, 0.87881461425249241,
+    0.46671974152490775, 0.10607809917553067, 0.87802056909062765,
+    0.46731434847333575, 0.1067786498132411, 0.87761929084028401,
+    0.46884612146581151, 0.10681012311761028, 0.87679810217978149,
+    0.46984440486467433, 0.10666324626402508, 0.87628145427926296,
+    0.47080217941712305, 0.10615770523456509, 0.87582866445179697,
+    0.47207141630975669, 0.10623179303987663, 0.87513620885598897,
+    0.47210027806696531, 0.10622876527867857, 0.87512100699072548,
+    0.47216276687791436, 0.10615278620660752, 0.8750965132799734,
+    0.47219142569065392, 0.10613671916423328, 0.87508299854886928,
+    0.47224625292434785, 0.10605293576743427, 0.87506356992736323,
+    0.47226443709973559, 0.10600680264000824, 0.87505934612739966,
+    0.4724212219869367, 0.10569129090694102, 0.87501287992965782,
+    0.47243875548518688, 0.10561988872557126, 0.87501203501506519,
+    0.47244523851865289, 0.10560488829942485, 0.87501034517788367,
+    0.47244224177126731, 0.10559729232961197, 0.87501287992965782,
+    0.47244216051706572, 0.10556264426294856, 0.87501710446263925,
+    0.47257116345997852, 0.10465920893422834, 0.87505596703944821,
+    0.47265957401127429, 0.10433008365135127, 0.87504751913297985,
+    0.47328490694500097, 0.10314693758056177, 0.87484976203106635,
+    0.47342016388201058, 0.1028700624918784, 0.87480917843427275,
+    0.47348647541372568, 0.1027373614948343, 0.87478888433345281,
+    0.47350587854246023, 0.10271993849758224, 0.87478042800509992,
+    0.47361714901225571, 0.10260300603010063, 0.87473391343601736,
+    0.47379723829404558, 0.10274504790175033, 0.87461970713939574,
+    0.47379890944224673, 0.10274454447560123, 0.87461886098565178,
+    0.47408305411259904, 0.1029681792413215, 0.87443856952160892,
+    0.47525898343099715, 0.10390564905696888, 0.87368902634872625,
+    0.47531319402055666, 0.10392184725565401, 0.873657608707753,
+    0.47581704286629417, 0.1040441903442109, 0.87336873551415428,
+    0.47593968837749295, 0.10410408380729204, 0.87329476854140098,
+    0.47630491087269111, 0.10428153570581909, 0.87307444882403573,
+    0.47747198317658485, 0.10493971130128803, 0.87235781779807609,
+    0.4780690401922898, 0.1056396256300289, 0.87194624966586687,
+    0.47861761499275512, 0.106202502464169, 0.87157685093684933,
+    0.47923731457542706, 0.10637950338895993, 0.87121466790754354,
+    0.47955031173718005, 0.10674409977909838, 0.87099781611386562,
+    0.47984553872604913, 0.10709639997762313, 0.87079194993783715,
+    0.48018543846863981, 0.10731744316532237, 0.87057734353424221,
+    0.48036356073806108, 0.10743295768602358, 0.8704648235959247,
+    0.481949526271231, 0.10777882540147321, 0.86954492633906777,
+    0.48227664918839885, 0.10767876331832442, 0.86937593570206806,
+    0.48288829586135912, 0.10747295576643685, 0.86906182605090765,
+    0.48301702185972556, 0.10739720586142988, 0.86899965291530412,
+    0.48336554908036411, 0.10714982632971799, 0.8688363831468785,
+    0.48371630930807957, 0.10725592464729954, 0.8686280554629946,
+    0.48401868497491102, 0.10735576512555169, 0.86844726511715453,
+    0.4840440087893963, 0.1073675866284285, 0.86843168925176706,
+    0.48479406349783494, 0.10769465408260297, 0.86797268244990622,
+    0.48521285032802908, 0.10793965430724978, 0.86770820032115692,
+    0.48661832361237778, 0.10790207052342667, 0.86692545833043611,
+    0.48675163089262591, 0.1078879564274718, 0.86685237421447536,
+    0.48694933733119494, 0.10784885826806098, 0.86674619505538408,
+    0.48710580111803126, 0.10781394845456607, 0.8666626166137531,
+    0.48766638688610892, 0.10765324675850627, 0.86636728560339815,
+    0.48790172998003645, 0.10749178074657458, 0.86625482333688508,
+    0.48811388036470194, 0.10728039408700434, 0.86616150736444675,
+    0.4882054040513728, 0.10724423694787237, 0.86611440185261002,
+    0.48837824455153828, 0.10718302920589257, 0.86602453111849353,
+    0.48868690099894924, 0.10707377037467407, 0.86586391568756049,
+    0.48869355329616437, 0.10707165242072637, 0.86586042305597044,
+    0.48895354770078503, 0.10697926957884622, 0.86572505108215081,
+    0.4897253361846487, 0.10616154077717312, 0.86538940504182815,
+    0.48998656386000411, 0.10601135547068155, 0.86525993767649667,
+    0.49038278484414705, 0.10579339430028559, 0.8650621261221203,
+    0.49046377900805671, 0.10563977037128046, 0.86503498218109032,
+    0.49041274732575285, 0.10536728061332604, 0.86509714682026317,
+    0.4905099633463445, 0.10515174732280212, 0.86506825504865759,
+    0.49066287726507651, 0.1047689843673673, 0.86502797688201205,
+    0.49066014811087966, 0.10469498042958024, 0.86503848476738843,
+    0.49065176928150273, 0.10457501381135655, 0.86505774823839687,
+    0.49064129235460863, 0.10437047567442456, 0.86508839204100629,
+    0.49061650985932304, 0.1042837584342442, 0.86511290475884417,
+    0.49060063885027805, 0.10422042507485009, 0.86512953721215446,
+    0.49059289424484254, 0.10416240328371175, 0.86514091676363924,
+    0.49057525978206384, 0.10412913067190481, 0.86515492175406017,
+    0.49079133503677747, 0.10382323794517188, 0.86506913059905099,
+    0.4908045464412375, 0.10380455412655909, 0.86506387725716383,
+    0.49087658745246832, 0.10373386753613503, 0.8650314795526316,
+    0.49087782587954421, 0.10372070426492962, 0.86503235521369881,
+    0.4908919672178933, 0.10370489701419509, 0.86502622553089215,
+    0.49091276982416765, 0.10369407608747049, 0.86501571720283188,
+    0.4909458431497965, 0.10366167863155265, 0.86500082975522286,
+    0.4909670061585733, 0.10364914031171811, 0.86499032051019453,
+    0.49100170351282446, 0.10365288474114684, 0.86497017673000898,
+    0.49101593171718699, 0.1036585739170357, 0.86496141812995864,
+    0.49103962398399043, 0.10367789922812393, 0.86494565198589457,
+    0.49105846359310024, 0.10368366754919116, 0.86493426479538471,
+    0.49107854031155423, 0.10367626771299616, 0.86492375314739522,
+    0.49110606384057542, 0.10364089325697305, 0.86491236510059988,
+    0.49110696825928896, 0.1036366075441315, 0.86491236510059988,
+    0.49111926690889141, 0.10362219161576391, 0.86490710892882539,
+    0.49112951514958741, 0.10360286588359489, 0.86490360476161565,
+    0.49112812700015773, 0.10358019016056083, 0.86490710892882539,
+    0.4911341785452637, 0.10352953907605812, 0.86490973702656859,
+    0.49114035316586124, 0.10350756330645054, 0.86490886099662212,
+    0.49115318987811296, 0.10349057224171347, 0.86490360476161565,
+    0.49116361350916526, 0.10347038624323483, 0.86490010055225175,
+    0.49115926499269091, 0.10344708842285849, 0.86490535685048975,
+    0.49115934679685058, 0.10342472431451415, 0.86490798496404098,
+    0.49117294866593558, 0.10337476870664872, 0.86490623289097479,
+    0.49121399345577066, 0.10335565303060894, 0.86488520719217443,
+    0.49123979257944511, 0.10335033744318803, 0.86487118921656936,
+    0.49126011172250211, 0.1033564030464261, 0.8648589229346596,
+    0.49127844602840987, 0.10337190061918801, 0.86484665613638556,
+    0.49131619521481856, 0.10339775318957807, 0.86482212099077427,
+    0.49135400766207576, 0.10343795128165445, 0.86479583104283686,
+    0.49136139254603162, 0.10343950591895248, 0.86479144915434247,
+    0.49139894034626708, 0.10342233207052563, 0.86477216806258272,
+    0.49141677830282776, 0.10341085994658923, 0.86476340350848357,
+    0.49145205872894371, 0.10338245552674116, 0.86474675012996971,
+    0.49146672742608899, 0.10336404394004187, 0.86474061443501737,
+    0.49147826109914022, 0.10334586795462969, 0.86473623171674119,
+    0.49149868991296236, 0.10333672736051325, 0.86472571292419698,
+    0.49152805724385973, 0.10330707030679812, 0.86471256390011075,
+    0.49154290303335874, 0.10328779570624844, 0.86470642748604709,
+    0.49156293480367791, 0.10327319288008116, 0.86469678428889085,
+    0.49160339467139308, 0.10321271226477352, 0.86468100382424939,
+    0.49163498705271752, 0.10318709358006797, 0.86466609926848215,
+    0.49163984908406549, 0.10316392571255119, 0.86466609926848215,
+    0.49169247034850094, 0.10310418945580481, 0.864643302593185,
+    0.49170892665419041, 0.10307717899292615, 0.8646371647225467,
+    0.49172002274417431, 0.10308308878674415, 0.8646301498552158,
+    0.49175316743359215, 0.10310885311027768, 0.86460822730836462,
+    0.49175857229546649, 0.10311984257508736, 0.86460384260146206,
+    0.49177247814557618, 0.1031344072392202, 0.86459419601450804,
+    0.49181779409219117, 0.10319768033497005, 0.86456086898943807,
+    0.49184743625101662, 0.10322540985857039, 0.86454069552151924,
+    0.49185056552323841, 0.10326191723695871, 0.86453455549389002,
+    0.49184951890734374, 0.10327424544622023, 0.86453367833655181,
+    0.49183579156890311, 0.10329556239038237, 0.86453894124107855,
+    0.49183546532935252, 0.10330445668909911, 0.86453806409690792,
+    0.49183560160080958, 0.10333316677113726, 0.86453455549389002,
+    0.49183980526841242, 0.10336452499793357, 0.86452841533721825,
+    0.49183806745761105, 0.10338746466124382, 0.86452666098303899,
+    0.49183903568118204, 0.10339752809801525, 0.86452490661832593,
+    0.49183449100271065, 0.10341181074540472, 0.86452578380199929,
+    0.49182843677206528, 0.10341860498413644, 0.86452841533721825,
+    0.49183217701571275, 0.10343014787072263, 0.86452490661832593,
+    0.49183811568722458, 0.10343856782754242, 0.8645205206604567,
+    0.49183890229425997, 0.1034494899755932, 0.8645187662588748,
+    0.49187516504079676, 0.10351897471394651, 0.86448981711195549,
+    0.4919022258606276, 0.10355156690664463, 0.86447051608747116,
+    0.49191226013502204, 0.10356981807957356, 0.86446261984646766,
+    0.49192370977063399, 0.10357402200518011, 0.86445560078651096,
+    0.49194904901950509, 0.10359280737348089, 0.86443892984367932,
+    0.49198035132730794, 0.10362719824917621, 0.86441699294431074,
+    0.49201782236493558, 0.10368352075753595, 0.86438891131167828,
+    0.49202158386211536, 0.10370225103990376, 0.86438452331301729,
+    0.49203145827245159, 0.10372854893475829, 0.86437574711821596,
+    0.49206064699206176, 0.10374367220824389, 0.86435731625208223,
+    0.49210604433624194, 0.1037550376963922, 0.86433010666085031,
+    0.49214046447860088, 0.10378920899189102, 0.86430640592305263,
+    0.49214913949494649, 0.10379193566204113, 0.86430113883177917,
+    0.49216633483340289, 0.10380543129094774, 0.86428972647553504,
+    0.49216913217119346, 0.10381409620839671, 0.86428709279167648,
+    0.49218301227574163, 0.10382868815408759, 0.86427743574813898,
+    0.49218101881732262, 0.10383813737044731, 0.86427743574813898,
+    0.49219044429261283, 0.10384461227593127, 0.86427129019093418,
+    0.49220341687324676, 0.10386350075335177, 0.86426163262611599,
+    0.49220978509083679, 0.10389176448657284, 0.86425460874252724,
+    0.49221516982559521, 0.10390277195141444, 0.8642502187297223,
+    0.49222886532846188, 0.10391822639058847, 0.86424056046987829,
+    0.49224206498054479, 0.10395062816685625, 0.86422914575210041,
+    0.49225208122331349, 0.10396889769671974, 0.86422124299455017,
+    0.49228604797334363, 0.10398325209965621, 0.86420016793192433,
+    0.49230430135614867, 0.10398441497207886, 0.86418962983198822,
+    0.49232330429665455, 0.10398932637106063, 0.86417821312928089,
+    0.49233177181844145, 0.10398572920165042, 0.86417382197131798,
+    0.49236643877637831, 0.10398946053183261, 0.86415362179705368,
+    0.49239540752851824, 0.10399827201414495, 0.86413605529621107,
+    0.49245429709708555, 0.10402597332467856, 0.86409916221720096,
+    0.49247831508725326, 0.10404361742444328, 0.86408334947622745,
+    0.49251134408774994, 0.10405508512093127, 0.86406314306614984,
+    0.49254237410678764, 0.10407600938804992, 0.86404293526369846,
+    0.49255878572833295, 0.10407857916298864, 0.86403327017033527,
+    0.49257186078619952, 0.10407505537245459, 0.86402624081149382,
+    0.49258697836814797, 0.10407645333917177, 0.86401745387606432,
+    0.49259567136084381, 0.10408637316511488, 0.86401130286466277,
+    0.49260011958965283, 0.1040944981923984, 0.86400778794310218,
+    0.49261394314003859, 0.1040947248394944, 0.86399987921562393,
+    0.49262833353515145, 0.10409956207030639, 0.86399109149061837,
+    0.49263462018610277, 0.10410627976400032, 0.86398669752942026,
+    0.49267295731217392, 0.10410719518081464, 0.86396472673649161,
+    0.49268403302371244, 0.10411312877414836, 0.86395769573535663,
+    0.49270482562977369, 0.10410225107011641, 0.86394714891784252,
+    0.49271769630650714, 0.10409239371552706, 0.86394099643261535,
+    0.49273366882929387, 0.10413350000478536, 0.86392693312500524,
+    0.49274989650597811, 0.10413692953452318, 0.86391726421021919,
+    0.49278176371397758, 0.10413198410805147, 0.8638996835493471,
+    0.49285662300432631, 0.10408400345734495, 0.8638627607352124,
+    0.49287137480624343, 0.10408711881895333, 0.86385396890479849,
+    0.49289602353926654, 0.10407255450000412, 0.86384165990013617,
+    0.49291483724064711, 0.10407832422664613, 0.8638302296482796,
+    0.49292795362753516, 0.10408918186304777, 0.86382143684424262,
+    0.49297022940323221, 0.10411518561002125, 0.86379417747951703,
+    0.49301179631912073, 0.10415182918074127, 0.86376603612812863,
+    0.4930399230252614, 0.10419372850161256, 0.86374492834642835,
+    0.49305008575407921, 0.10420396690591963, 0.86373789208241003,
+    0.49306925967303622, 0.10420801922935326, 0.8637264577942364,
+    0.4930919088682183, 0.10420291654412601, 0.86371414344816344,
+    0.49310833430321926, 0.10421268117221705, 0.86370358788394674,
+    0.49311552674654779, 0.10421510030022965, 0.86369918962037229,
+    0.49312269938919756, 0.10421032246540533, 0.86369567096215516,
+    0.49313579118092404, 0.10421398824147658, 0.86368775382725527,
+    0.49316235774905498, 0.10422679592163756, 0.86367103917597143,
+    0.49317304522794803, 0.1042272562636563, 0.863664880907139,
+    0.49318021778476084, 0.10422247767658657, 0.86366136183849818,
+    0.49318262166683813, 0.10422568330733073, 0.86365960228839256,
+    0.49318633780983401, 0.10423725929006868, 0.86365608315661113,
+    0.49319027378705838, 0.1042623706598001, 0.86365080438001385,
+    0.49320063474525699, 0.10427894937920157, 0.86364288603753669,
+    0.4932326583890223, 0.10426593498594525, 0.86362616883695964,
+    0.49324502088810107, 0.10427304506452904, 0.86361824983152569,
+    0.49325994986283817, 0.10427530170640475, 0.86360945068667971,
+    0.49330475448370065, 0.10428927070729509, 0.86358217166585616,
+    0.49335561956980872, 0.10429642586075283, 0.86355224983295753,
+    0.49336816268555334, 0.10430267579830216, 0.86354432883876653,
+    0.49337497118632018, 0.1042996172487716, 0.86354080832851066,
+    0.4934038980349309, 0.10430123421543515, 0.86352408533003433,
+    0.49342381335587338, 0.10430904282489438, 0.86351176251299699,
+    0.49344296397704074, 0.10430589359595974, 0.86350119968804984,
+    0.49345030010703711, 0.104293048966925, 0.86349855892262939,
+    0.49346926837001603, 0.10429075983631608, 0.8634879956242153,
+    0.49347447454857829, 0.10430985514635592, 0.86348271383297004,
+    0.493479098023482, 0.10431713083005474, 0.86347919258619998,
+    0.49348592414279313, 0.10432127316488515, 0.86347479096855562,
+    0.49348889086141373, 0.10432909866746255, 0.86347214996640542,
+    0.49351322794572061, 0.10433784316817887, 0.86345718384040782,
+    0.49351892591729812, 0.10433274886604811, 0.86345454268044164,
+    0.49352538751514641, 0.10433861419708639, 0.86345014069456039,
+    0.4935464108571006, 0.10434845827082684, 0.86343693434238478,
+    0.4935817784320784, 0.10434873614401839, 0.86341668345299694,
+    0.49359137038605022, 0.10435436392835755, 0.86341051986267159,
+    0.49361237535791108, 0.10435700472206375, 0.86339819229539727,
+    0.4936182897998842, 0.10436545541196718, 0.86339378946787093,
+    0.49361794251167862, 0.10437438239948051, 0.86339290889447551,
+    0.49361169784828407, 0.10438206234676493, 0.86339555060677164,
+    0.49360124566965413, 0.10440235279879675, 0.86339907285301243,
+    0.49359337670595899, 0.10442498929172728, 0.86340083396035239,
+    0.49359670598691152, 0.10443109393236559, 0.86339819229539727,
+    0.49360720817319903, 0.10443241582771548, 0.86339202831845008,
+    0.49362064267657002, 0.10442715734290668, 0.86338498361556515,
+    0.49362967048349016, 0.10442816710237902, 0.86337969997794051,
+    0.49363333177289431, 0.10441814037353984, 0.86337881936246463,
+    0.49364159786855716, 0.10440818742349017, 0.8633752968742614,
+    0.49367456151578676, 0.10440525761274434, 0.86335680312082563,
+    0.49368486464292111, 0.10440023515516891, 0.8633515189782468,
+    0.49369385898510526, 0.1043868340363053, 0.86334799616392921,
+    0.4938045013511474, 0.1039646203666638, 0.86333566598244982,
+    0.49398092613476224, 0.10390182686774439, 0.86324229216865167,
+    0.49413620235385436, 0.10391017144030838, 0.8631524140003064,
+    0.49429250638219902, 0.10389889910003765, 0.8630642715929121,
+    0.49444797730566908, 0.10386219566528737, 0.86297963014773305,
+    0.49451817411581139, 0.1038210690829852, 0.86294435572847339,
+    0.4945216412395203, 0.10381188442283198, 0.86294347381410319,
+    0.49453027946738881, 0.10380738973051615, 0.86293906420282251,
+    0.49465720698472398, 0.10343658845239452, 0.86291084113447203,
+    0.49471277663531016, 0.10325897280973184, 0.86290025678989157,
+    0.49474514049488794, 0.10317021374787674, 0.86289231828305846,
+    0.49486120740017864, 0.10303400457754264, 0.86284203612895005,
+    0.49510807903037574, 0.10271941482979384, 0.86273791611118844,
+    0.4951679269981521, 0.10269036630115361, 0.86270702601826976,
+    0.49539330147315486, 0.10257479022785217, 0.86259138024051696,
+    0.49568774623933332, 0.10257079835139217, 0.86242268613118489,
+    0.49600700814766563, 0.10273616992455359, 0.86221941943894698,
+    0.49677843629821977, 0.10313559946557246, 0.86172747046381937,
+    0.49692943083582281, 0.10326646686961348, 0.8616247313009604,
+    0.49703993960823145, 0.10335549549836336, 0.86155031192875409,
+    0.49720338768482403, 0.10344832953360694, 0.86144485278596961,
+    0.49750090493140647, 0.10356820945599202, 0.86125865776926236,
+    0.49793445070187747, 0.10366843766998177, 0.86099601499384693,
+    0.49812255851205828, 0.10382643327842181, 0.86086815973997,
+    0.49851941443183012, 0.10396181038467366, 0.86062206305444344,
+    0.49868491628581263, 0.10410985715104897, 0.86050827533092333,
+    0.49872768280942409, 0.10409607612899328, 0.86048515695164041,
+    0.49895533930534874, 0.10432081801680412, 0.86032594771225468,
+    0.49906622486140434, 0.10440673204679389, 0.8602512060473354,
+    0.49954107777072787, 0.10455612546626743, 0.85995739908854885,
+    0.49964334399236132, 0.10456569710557634, 0.85989682159719361,
+    0.49974158809746294, 0.10459445146187177, 0.85983623199375347,
+    0.50021819074707263, 0.10473430038060128, 0.85954202222434195,
+    0.50026004652287115, 0.10475400081484391, 0.85951526174130177,
+    0.50043864123385384, 0.10483060332086547, 0.85940194959483152,
+    0.50053167592085468, 0.10484735621199612, 0.85934572396400233,
+    0.50062174471969356, 0.1048197074487898, 0.85929662960130371,
+    0.50073395135525345, 0.10471549143521938, 0.85924395593663339,
+    0.50080216294036239, 0.10467501991359829, 0.8592091327496133,
+    0.5008538643589473, 0.10464020989081584, 0.85918323600423863,
+    0.50090337834561904, 0.10462318279771556, 0.85915644395140367,
+    0.50095675334645751, 0.1046169942104415, 0.85912607677741282,
+    0.50097471768789958, 0.1046043209174119, 0.85911714467989542,
+    0.50107208525492786, 0.10457080541001164, 0.85906443997768867,
+    0.5011280018430444, 0.10454505364714041, 0.85903495710402511,
+    0.50115037415155284, 0.10454059357961859, 0.85902244835730557,
+    0.50116394817026322, 0.10454159962210316, 0.85901440674929641,
+    0.50118083024366666, 0.10454877233736244, 0.85900368427557938,
+    0.50122631894662761, 0.10455095854079093, 0.85897687644279186,
+    0.50123750455538751, 0.10454872731869833, 0.85897062094295651,
+    0.5012527356723897, 0.1045564688140857, 0.85896079061274655,
+    0.50126962409225295, 0.10457094698112387, 0.85894917254159009,
+    0.50128631465742268, 0.10457168988454002, 0.85893934152061702,
+    0.50130227499382762, 0.10457593233014385, 0.85892951018304986,
+    0.50131145245330933, 0.10458332501457791, 0.8589232537124889,
+    0.50132979259954846, 0.10458349886434984, 0.85891252803611173,
+    0.50134427037869167, 0.10457282282338862, 0.85890537737588157,
+    0.50143487246834795, 0.10457893567560023, 0.858851742086846,
+    0.50158285559961813, 0.10457417272626648, 0.85876590603443825,
+    0.5016992998742249, 0.10458108997405537, 0.85869704094374932,
+    0.50175413852695616, 0.104597090199367, 0.85866304985884745,
+    0.5017697354636419, 0.1046103935400004, 0.85865231504733797,
+    0.50191112249555836, 0.10464444070025287, 0.85856552816065235,
+    0.50206330489168693, 0.10467068338390051, 0.85847334607498693,
+    0.50213995071337858, 0.10469946553376296, 0.85842500651746512,
+    0.50219953549227714, 0.10471463318159582, 0.85838829916826387,
+    0.50243209552429224, 0.10465607019655315, 0.85825934096756717,
+    0.50249917608850181, 0.10465723196120942, 0.8582199262593444,
+    0.50253674410132931, 0.10465315963713653, 0.85819842519431311,
+    0.50253749462846176, 0.10467893986709897, 0.85819484153707715,
+    0.50254923466608781, 0.10469602814944415, 0.8581858822109929,
+    0.50256573412905614, 0.10470495676386295, 0.85817513067461959,
+    0.50258663624495248, 0.10472212514773009, 0.85816079470721973,
+    0.502689303539125, 0.10481675570012715, 0.85808910483227163,
+    0.50270671868564809, 0.10483595116193326, 0.85807655738417732,
+    0.50272504573146382, 0.10484343546341182, 0.85806490572364458,
+    0.50274447040717551, 0.104845655249884, 0.85805325362137697,
+    0.50275692849703224, 0.10483726571864743, 0.85804697922949869,
+    0.50276168785765385, 0.10482177675160982, 0.85804608287734674,
+    0.50278862534314606, 0.10482464597302622, 0.85802994809166144,
+    0.5028027342529473, 0.10482300899506848, 0.85802188038125216,
+    0.50281812844328366, 0.1048298812429861, 0.85801201955880257,
+    0.50283718621054063, 0.10483385449566993, 0.85800036545181424,
+    0.50285386286682476, 0.10484191029740442, 0.85798960742255126,
+    0.50291836135130641, 0.10484803054073159, 0.85795105472716027,
+    0.50293741587172669, 0.10484467548695146, 0.85794029497296931,
+    0.50294419006204993, 0.10482685285579013, 0.85793850164401597,
+    0.50295243192793404, 0.10481666336688064, 0.85793491495474816,
+    0.50298669094898851, 0.10480639906413761, 0.85791608415007314,
+    0.50299731526711611, 0.10479945274899739, 0.85791070370848277,
+    0.50301728323546158, 0.10479170459071721, 0.85789994254306101,
+    0.50305886399089861, 0.10476830356254835, 0.857878419083271,
+    0.50310300886603732, 0.10474726418235415, 0.85785510030322254,
+    0.50313432893452259, 0.10472904792079281, 0.85783895549759914,
+    0.50317627384428831, 0.10471120765680597, 0.85781653075190323,
+    0.50320960548627247, 0.10469065527174835, 0.85779948685291363,
+    0.50324531922585392, 0.10467334427905355, 0.85778064776183138,
+    0.50328561598258514, 0.10466339798391577, 0.85775821877000413,
+    0.50339844596345784, 0.10464286643240545, 0.85769451152865928,
+    0.50347701259098931, 0.10461794728503303, 0.85765143438247615,
+    0.50349258127342744, 0.10461659881095516, 0.85764245921936999,
+    0.50354769956409817, 0.10459413025714717, 0.85761283932754628,
+    0.5035863297276777, 0.1045700651188706, 0.85759309115246596,
+    0.5036229564281498, 0.10456300054394224, 0.85757244398115862,
+    0.50363632277265713, 0.10455752359007998, 0.85756526203242733,
+    0.5036824534465284, 0.10452675405918638, 0.85754191954442449,
+    0.50371413416865418, 0.10452140754419677, 0.85752396258279739,
+    0.50372749947728335, 0.10451592767008153, 0.85751677950558258,
+    0.5038272371883763, 0.10443298236769122, 0.85746828936172159,
+    0.50383474651588134, 0.10443362175767025, 0.85746379914831006,
+    0.50416674996624022, 0.10443911595606666, 0.85726796235879121,
+    0.50434012996013133, 0.10442821418971322, 0.85716730070211222,
+    0.50434781928976025, 0.10442797035171632, 0.85716280611438367,
+    0.5043816744578945, 0.10441202913653504, 0.85714482711070594,
+    0.50439485178485444, 0.10440741251408543, 0.85713763521680009,
+    0.50441020808485104, 0.10438488513798731, 0.85713134217255549,
+    0.50442815894543847, 0.10439410856225628, 0.85711965475096141,
+    0.50445304763752663, 0.10438456915574279, 0.85710616871621059,
+    0.504494034320489, 0.10436366798862518, 0.85708458983871438,
+    0.50451524762655509, 0.1043423462299133, 0.85707469901727507,
+    0.50454142511721012, 0.10434133240036614, 0.85705941258095464,
+    0.50455608144654884, 0.10435170964305866, 0.85704952095539633,
+    0.50455447934225084, 0.10439637486733376, 0.85704502465753174,
+    0.50456859451405989, 0.10441674397575958, 0.85703423327636508,
+    0.50461106550503665, 0.10441818562144344, 0.85700905192500587,
+    0.5046308491815793, 0.10443330098546134, 0.85699556107342723,
+    0.5046541083312629, 0.10444638108248902, 0.8569802707315668,
+    0.50470604727828416, 0.10439466670059092, 0.85695598452032695,
+    0.50473002837272651, 0.10439687118575317, 0.85694159179345009,
+    0.50474687511821914, 0.10440403027377355, 0.85693079680974571,
+    0.50475842322828879, 0.10442203627718029, 0.8569218007028524,
+    0.50480674112270996, 0.10441733196731488, 0.85689391111262825,
+    0.50502971783025208, 0.10448367543336784, 0.85675442553641401,
+    0.50507250713729379, 0.104439212656143, 0.85673462250209853,
+    0.50510672662297096, 0.10443617662853912, 0.85671481820465778,
+    0.50513454762851306, 0.10444192891671038, 0.8566977134767515,
+    0.50517332867720777, 0.10442420475789396, 0.85667700649303713,
+    0.50520642725543208, 0.10439702817854554, 0.85666080006458212,
+    0.50524393682215285, 0.10439282616853578, 0.8566391901781043,
+    0.50527175615441866, 0.104398574161744, 0.85662208128533823,
+    0.50532191962921014, 0.10442917033852545, 0.8565887612645039,
+    0.50533929432949243, 0.10441896628048972, 0.85657975524027208,
+    0.50536263194601072, 0.10432814506068601, 0.8565770533821212,
+    0.50537981474367388, 0.10431146026538078, 0.85656894766676761,
+    0.50539278650837871, 0.10429298577749803, 0.85656354373911503,
+    0.50542168904075935, 0.10428607448486921, 0.85654733139256367,
+    0.50545666841727943, 0.10431628581975151, 0.85652301128765729,
+    0.50547368333125653, 0.10431519839986508, 0.85651310255146085,
+    0.50548098054734536, 0.10429462922682503, 0.85651130092914318,
+    0.50549725926989164, 0.10428970964127116, 0.85650229266101052,
+    0.50579511463381521, 0.10430330301238444, 0.85632477658495465,
+    0.50579770000324542, 0.1041648747665518, 0.85634009922243837,
+    0.50580273940493592, 0.10410333825346872, 0.85634460573705162,
+    0.50584204128564036, 0.10408289955266288, 0.8563238752298612,
+    0.50587493028458663, 0.10405653650531062, 0.85630765039212609,
+    0.50610559125664489, 0.10383977031789886, 0.85619765977202245,
+    0.5061181799990514, 0.10382302225025172, 0.85619224939570171,
+    0.50613352903885511, 0.10381512442710428, 0.8561841336551731,
+    0.50612246953311713, 0.10377235396702232, 0.85619585632368134,
+    0.50610288044768981, 0.10376373529585352, 0.85620848024298579,
+    0.50609406644874189, 0.10374720140148763, 0.85621569368164208,
+    0.50610207943080554, 0.10373043547002854, 0.85621298866170725,
+    0.50606997338123005, 0.10368612069948943, 0.85623733299606375,
+    0.50607615855095534, 0.10367082180340155, 0.85623552977724282,
+    0.50608895622061645, 0.10366792129402672, 0.8562283167976299,
+    0.5061506075174832, 0.10367226585087037, 0.85619134765718652,
+    0.50620087431737348, 0.10365770707120762, 0.85616339246960704,
+    0.50621126925108462, 0.10364418638816933, 0.8561588833336603,
+    0.5061881398608773, 0.10360815413486307, 0.8561769194862423,
+    0.50616538673121492, 0.10357772498951261, 0.8561940528649078,
+    0.50614852369880881, 0.10356322966864703, 0.85620577516045493,
+    0.50614226982844057, 0.10354906497204347, 0.8562111853020431,
+    0.5061122103653517, 0.10352450930510924, 0.85623192330830222,
+    0.50608989553584971, 0.10345460870347922, 0.8562535614959641,
+    0.50610465832648288, 0.1034346209400463, 0.85624725051308814,
+    0.50612475555228464, 0.1034258448413925, 0.85623643138795735,
+    0.50613865495589938, 0.10342500410118725, 0.8562283167976299,
+    0.50615213263621439, 0.10340383085807003, 0.85622290695337488,
+    0.50616986243818762, 0.1033991702398688, 0.85621298866170725,
+    0.50618889608955564, 0.10340305838869816, 0.85620126663740725,
+    0.50620716690980305, 0.10339574636377304, 0.85619134765718652,
+    0.50624683689815508, 0.10338820196971069, 0.85616880334667833,
+    0.50626366344420981, 0.10338795657574229, 0.8561588833336603,
+    0.5062786030090507, 0.10336707539058713, 0.85615257043379878,
+    0.50629907899908322, 0.10336389204651585, 0.85614084613787478,
+    0.50632404299713585, 0.10333124722796774, 0.85613002331967492,
+    0.50636331521884692, 0.10337792684939918, 0.85610116063517805,
+    0.506382166395835, 0.10338269610189976, 0.85608943440680485,
+    0.50639788854017664, 0.10338038191733498, 0.85608041393123624,
+    0.50642253336692222, 0.1033642369441552, 0.85606778482733548,
+    0.50642062502506369, 0.10333622696233478, 0.85607229528026008,
+    0.5064372058201565, 0.10331475157148401, 0.85606507852428781,
+    0.50644621980467908, 0.10327055619466589, 0.85606507852428781,
+    0.50644759470695633, 0.10324137540907422, 0.85606778482733548,
+    0.50642986591167338, 0.10318620773821752, 0.85608492420161797,
+    0.50640936879853959, 0.10318203140598234, 0.85609755261185017,
+    0.50641294651347357, 0.10315698521215336, 0.85609845462159395,
+    0.50637200991976261, 0.10311090815040508, 0.85612821948013051,
+    0.50636364057576089, 0.10306962665085115, 0.85613814046853198,
+    0.50632541697483002, 0.103017671766368, 0.85616699973142008,
+    0.50633771960975971, 0.10297968190402586, 0.85616429428897234,
+    0.50633830470206964, 0.10293930914549065, 0.85616880334667833,
+    0.50632370397782034, 0.10289861206916508, 0.85618233012858891,
+    0.50632278974839884, 0.10285057686826647, 0.85618864242599224,
+    0.50639024932112653, 0.10266091270404018, 0.85617150875000547,
+    0.5064153476531621, 0.10262735358615994, 0.85616068699586312,
+    0.50640031257741791, 0.10261878587172107, 0.85617060695150438,
+    0.50635715589578678, 0.10262108110562873, 0.85619585632368134,
+    0.50632086744401894, 0.10260452679488088, 0.85621930033837401,
+    0.50627017434185995, 0.10259885345729072, 0.8562499552356847,
+    0.50599918508932196, 0.10254393577100636, 0.85641670110147539,
+    0.50574274041063316, 0.1025599689167089, 0.85656624571468298,
+    0.50563113694671979, 0.10252355506736781, 0.85663648883661025,
+    0.50561609217355685, 0.1025149920630478, 0.85664639364060502,
+    0.5055863936646191, 0.10250345848649164, 0.85666530193507473,
+    0.50546855481333086, 0.10246762755895654, 0.85673912330263158,
+    0.50521089151255183, 0.1024365085979258, 0.85689481081598318,
+    0.50515941098427353, 0.10242698832793122, 0.85692629878892834,
+    0.50505930015078548, 0.10235621523768072, 0.85699376224883705,
+    0.504995221715002, 0.10231845448596767, 0.85703603186599975,
+    0.50498031603904026, 0.10233929062173892, 0.85704232684748449,
+    0.50495089092532097, 0.10234892495229878, 0.85705851335532124,
+    0.50493744978751154, 0.10237005547255583, 0.85706390866996029,
+    0.50489254236947101, 0.10239581359411139, 0.85708728728064332,
+    0.50478381784235915, 0.10229213074071257, 0.85716370503715156,
+    0.50477830996862594, 0.1022891802307194, 0.85716730070211222,
+    0.50471853568823599, 0.10223763392271198, 0.85720864784637374,
+    0.50460758349720636, 0.10213722968012602, 0.85728593420770594,
+    0.50455791451867182, 0.10209600885517357, 0.8573200778428165,
+    0.50435114225519517, 0.10187275418365191, 0.85746828936172159,
+    0.50426298412343684, 0.10180273566374887, 0.85752845192116123,
+    0.50377142215631954, 0.10148389577833108, 0.85785510030322254,
+    0.50371756609966056, 0.10143279465777495, 0.85789276822371441,
+    0.50356193251395687, 0.10129537505415732, 0.85800036545181424,
+    0.50348979045388276, 0.1012287482772888, 0.85805056461196882,
+    0.50329666682728091, 0.10092764943496246, 0.85819932110208663,
+    0.50337835326336466, 0.10080969520163333, 0.85816527476892068,
+    0.50348594093678511, 0.10063840321121723, 0.85812226347886844,
+    0.50360146396360617, 0.10054175697654358, 0.85806580202090699,
+    0.50361595542747717, 0.10052271407165252, 0.85805952788518003,
+    0.50362586480248128, 0.10050366987487395, 0.85805594260726104,
+    0.50366159005310274, 0.10040111623041109, 0.85804697922949869,
+    0.50367541608964594, 0.10037005434583331, 0.8580424974426013,
+    0.50369988161537738, 0.10030089516189482, 0.85803622283116776,
+    0.50371030752739043, 0.10027920746872913, 0.85803263728141788,
+    0.50373797532351905, 0.10023992871248102, 0.85802098395591619,
+    0.50374553042204784, 0.10022497992668222, 0.85801829466422563,
+    0.50380109888002977, 0.10015285480623395, 0.85799408998048221,
+    0.50386336429914147, 0.10005462398935776, 0.85796898681449951,
+    0.50388329013496924, 0.10003115743331221, 0.85796002090150458,
+    0.50389950662099059, 0.10000329665621877, 0.8579537446069051,
+    0.50398708390413982, 0.099784817016343341, 0.85792774145076833,
+    0.50406233707102999, 0.099604997347183338, 0.85790442640771991,
+    0.50414618879821016, 0.099396678162577509, 0.85787931592414812,
+    0.50513986946613265, 0.09926198971361791, 0.8573101945467767,
+    0.50540135390777841, 0.099164963950174254, 0.85716730070211222,
+    0.50541102753684153, 0.099162281681404216, 0.85716190718900476,
+    0.50552020136016262, 0.099118648614245602, 0.85710257234106257,
+    0.50560536339850137, 0.099057457109792441, 0.85705941258095464,
+    0.50577962751011263, 0.098930280516795255, 0.85697127606040568,
+    0.50579732728362048, 0.098909912303252398, 0.85696318063316412,
+    0.50616771008605899, 0.098268022651471068, 0.85681832671249825,
+    0.50624472793951647, 0.098153703063895578, 0.8567859277604235,
+    0.50656017496383476, 0.097719585316848406, 0.85664909489598617,
+    0.50659566525900812, 0.097653984324209006, 0.8566355883842266,
+    0.50776880077180053, 0.095383208526882243, 0.85619675804915596,
+    0.50977074940366773, 0.095329175956901671, 0.85501235737491021,
+    0.51374927795207925, 0.095217800509903777, 0.85264016435409218,
+    0.53997957256923945, 0.071089659374914835, 0.83867056794542394,
+    0.54256651905577469, 0.047468419626102501, 0.83867056794542394,
+    0.50000000000000011, 0, 0.8660254037844386
+};
+
+static const double enor_fir_normals[] = {
+    -0.028217086363333591, -0.00098536236862267756, 0.014377323612700667,
+    -0.0056785540092938215, -0.017953509372229892, 0.003524435858702794,
+    -0.0064894397065281897, -0.020514526275580425, 0.0040276025622758282,
+    -0.0028029954981201172, -0.008842333975496719, 0.0017387116002346679,
+    -0.00075963472069966176, -0.0024076618129557081, 0.00047181600069412521,
+    -0.003525008918493229, -0.0085691507019495794, 0.0020464951657137402,
+    -0.0080397301365990742, -0.019544566250517481, 0.0046676008305973626,
+    -0.022142742281606433, -0.053822638905359599, 0.012854908430170224,
+    -0.01355440501836748, -0.012667453597612344, 0.0059586033338492467,
+    -0.029705628265446607, -0.027755642276394377, 0.013058110405080002,
+    -0.014207139310195682, -0.0070834183631164338, 0.0053612929799981002,
+    -0.012147242075233322, -8.3277576044649138e-05, 0.0036366019741464958,
+    -0.013697422464592629, 0.0046899823148752739, 0.0032770776862056789,
+    -0.0005656998920630929, 0.0071544388743104426, -0.0011701081343218761,
+    -0.00032030597579904563, 0.003986866006188361, -0.00065047364706849464,
+    -4.0831069586522162e-07, 1.7887119661552653e-06, -2.0820271957877612e-07,
+    -3.307618415271385e-07, 3.8672514973692174e-06, -6.2461704493366188e-07,
+    -4.7562836320180768e-05, 3.6659301888786189e-05, 8.1213308176439347e-06,
+    -2.4222151414732274e-05, 3.8389865478716256e-05, 4.1659305392849344e-07,
+    -1.7787426277504625e-05, 1.9872943002041676e-05, 1.8750331699790568e-06,
+    -1.8021049796229649e-05, 1.3636224037327782e-05, 3.1254552878626218e-06,
+    -2.2064990467085543e-05, 7.1578848238607051e-06, 5.6264062191294095e-06,
+    -2.4263186801598557e-05, 1.194272348908898e-05, 5.418611480227653e-06,
+    -1.4057954365875869e-05, 1.8032911105081428e-05, 1.0421690845169307e-06,
+    -1.8742973198954127e-05, 7.106340429385849e-06, 4.5860220954097031e-06,
+    -4.4038788666961315e-05, 4.2008613497235281e-06, 1.3134193309394249e-05,
+    -2.2556037645449223e-05, 6.860245215067895e-06, 5.8381108288263484e-06,
+    -1.5188926588471929e-05, 1.329133005600891e-05, 2.2937717679138991e-06,
+    -7.4122521436237321e-06, 1.7934822573950626e-05, -1.0427322154893393e-06,
+    -1.5787300957914585e-06, 2.1417862018480172e-05, -3.545659076426011e-06,
+    -2.1064881973537064e-05, 3.4176270441999002e-05, 2.0860177731701901e-07,
+    -9.5886718060878007e-06, 1.0536965449003954e-05, 1.0431620619255622e-06,
+    -1.2174882012772059e-05, 4.9271345762824659e-06, 2.9210474714325141e-06,
+    -2.481553533073555e-05, -2.621775234856738e-06, 8.3463242870132626e-06,
+    -5.115477745704089e-06, 3.0436364490404877e-06, 1.0433350104421812e-06,
+    -3.2482945400980068e-06, 2.12583978193015e-06, 6.2601583104837655e-07,
+    -4.7283149764154597e-06, 1.3439306006390872e-05, -1.0434091345240537e-06,
+    -9.6676305958720565e-06, 8.4565517932122525e-06, 1.4608765658563616e-06,
+    -8.5965538287047227e-06, -1.0684240108749243e-06, 2.9218776682465863e-06,
+    -1.1977772413324095e-05, -1.5286196529906704e-05, 6.6785142673331244e-06,
+    -4.3754814563756739e-06, -2.6136903782947307e-06, 1.8782965570465771e-06,
+    -4.2209364832235252e-06, 1.5446061122359467e-06, 1.0435079710463535e-06,
+    -5.7792899769149031e-06, 1.0778824217017036e-05, -2.0871048966863981e-07,
+    -8.9167907038611993e-06, 4.1432689299958358e-05, -5.0097634047979733e-06,
+    -5.4475031788514539e-06, 6.9110203578803819e-06, 4.175356405552999e-07,
+    -1.923904209732985e-05, 6.8047140347471391e-06, 4.8019781704045084e-06,
+    -3.6577168999185616e-06, 3.914070731303454e-06, 4.1758704485972409e-07,
+    -9.28201472069623e-06, 1.885154722341964e-05, -6.2642505304494334e-07,
+    -3.1355732495741417e-06, 3.0655044086891348e-05, -4.8032287451385547e-06,
+    -8.6190635880667443e-06, 1.1115531987682115e-05, 6.2657928314585609e-07,
+    -1.2256613144995265e-05, 2.8436350243965514e-06, 3.3419618304803e-06,
+    -1.3053487546654807e-05, -5.7649701813433651e-06, 5.2219636705944095e-06,
+    3.3126295564955832e-07, -3.868246908900197e-06, 6.2663267441642745e-07,
+    1.3835748797708103e-05, -2.4263420128067814e-05, 2.0885976078494073e-07,
+    2.1740752975674127e-08, -1.2185565601952053e-05, 2.2972181105626599e-06,
+    -3.5586300514978131e-06, -6.1923976736322217e-06, 2.2971311096076086e-06,
+    -7.2939297211249698e-06, -4.3581113937096738e-06, 3.132421853735412e-06,
+    -1.0874860448623069e-05, 1.6346022179147823e-06, 3.1324811721050727e-06,
+    -6.9849253253873034e-06, 3.9588817734581561e-06, 1.4618799118598647e-06,
+    -3.1444890004977966e-05, 2.3906464505007996e-05, 5.4304823046205652e-06,
+    -2.8915257133277361e-05, 1.5251036093844039e-05, 6.26703864265582e-06,
+    -4.963472536062552e-06, 7.1999503246100716e-06, 2.089220535184122e-07,
+    -2.5467109274202038e-07, 5.9477480293113061e-06, -1.0446498213412259e-06,
+    6.5099077847796671e-06, 3.438968970109757e-05, -8.5668582996412113e-06,
+    -1.5650291498275903e-05, 3.9444891500151069e-05, -2.5078359738375799e-06,
+    -9.5168856749927588e-06, 1.2611861836098193e-05, 6.2705690619113685e-07,
+    -1.1695682693074749e-05, 5.210138745326276e-06, 2.7174394579693173e-06,
+    -4.864496778944627e-06, -2.9070994066460187e-06, 2.0903973891733818e-06,
+    -9.8063140997750597e-06, -7.8940606159094706e-06, 4.5988524956172561e-06,
+    -7.1875586302172501e-07, -6.5295304995105496e-06, 1.4632435549818967e-06,
+    5.1404152094092215e-06, -1.5227497437042548e-05, 1.2541375491934015e-06,
+    1.9854255877527205e-05, -2.8799575777060937e-05, -8.3597697268789073e-07,
+    1.0726856116416439e-06, -9.5255060728050012e-06, 1.4627866386160426e-06,
+    -1.2722152030048006e-05, -9.6380440806065337e-06, 5.8509804140779997e-06,
+    -7.6270962090785321e-06, -4.9264009538418918e-07, 2.5075749023814597e-06,
+    -6.9866040195709633e-06, 3.9569914304093956e-06, 1.4627935612451792e-06,
+    -5.7826480070188868e-06, 1.0777039752218887e-05, -2.0898138709118941e-07,
+    4.4005374325029045e-07, 2.4664015489894719e-05, -4.8070040796974189e-06,
+    -3.5820362906668901e-06, 5.9923120060978441e-06, 0,
+    -1.0646254684082423e-05, 7.8696381630161127e-06, 1.8812419296659888e-06,
+    -4.2054918403006125e-05, 7.3924962861182664e-06, 1.191582885710224e-05,
+    -8.3697522610948205e-06, 5.1630923195156164e-06, 1.6725632089459319e-06,
+    -1.1506857454102182e-06, 7.4461171901685219e-06, -1.0453965171922097e-06,
+    6.3235666724059669e-06, 3.7809873930094717e-06, -2.7180823809688781e-06,
+    4.7871053619197301e-06, 8.2868868195307144e-07, -1.6726581673828789e-06,
+    1.9503004407755986e-05, -1.2741500084956225e-05, -3.7632494123904237e-06,
+    9.0874459210688041e-06, 1.3658330931809459e-06, -3.135833464847082e-06,
+    1.0214984254297566e-05, 6.1063403932193339e-06, -4.3901253080694258e-06,
+    2.2553712754058708e-06, 9.481584818948896e-06, -2.5086905103693935e-06,
+    -4.477310043604632e-06, 7.4905306701733565e-06, -6.9388939039072284e-18,
+    -1.9657060553818217e-05, 8.5836196477284687e-06, 4.5997881949547126e-06,
+    -1.1056014108529189e-05, 9.6580566089632391e-06, 1.6727926947929239e-06,
+    -1.3510585087389559e-05, 2.0391156075161287e-05, 4.1824169889209672e-07,
+    -2.1440216527168765e-06, 1.9052359297389021e-05, -2.9280242860585393e-06,
+    -4.0685767422055097e-06, 5.7014711744018953e-06, 2.0915844221175428e-07,
+    -2.1119007163283854e-05, 7.7091424197650582e-06, 5.2293073162720805e-06,
+    -1.0239036324605211e-05, 6.0793629714228636e-06, 2.0918812254980268e-06,
+    -8.5470022199718443e-06, 1.319129353910542e-05, 2.0920296339016486e-07,
+    -1.4019168902118517e-05, 3.2287802612995797e-05, -1.6738532526150429e-06,
+    -1.38013186920527e-05, -1.1744509420541505e-07, 4.3943635006302162e-06,
+    -1.537399682366436e-06, -2.9527053276856563e-06, 1.0462918670350874e-06,
+    2.045293537783488e-06, -8.9446534134451916e-06, 1.0462621814824602e-06,
+    -2.997055107728519e-06, -3.8255340741866206e-06, 1.6739719944924847e-06,
+    -5.7615686216427875e-06, -1.4115576791318141e-06, 2.0924649930947892e-06,
+    -2.1785623622455619e-05, 1.5442682833710641e-05, 3.9759654919119258e-06,
+    -1.1334808388885342e-05, 2.779282646581116e-05, -1.674336142849786e-06,
+    -1.0572539955150395e-05, 9.9463909133401529e-06, 1.4652173094750753e-06,
+    -5.6847702152307278e-06, 6.6765760725617795e-07, 1.6746132405140446e-06,
+    -7.7863926098153957e-06, -4.6565536096498938e-06, 3.3492581499455776e-06,
+    2.0681932672850234e-06, -2.1133323414579408e-05, 3.3490839686095564e-06,
+    -1.2242506248982821e-05, -9.356269411620044e-06, 5.6512585602519483e-06,
+    -1.4698401147539286e-05, 1.3764474049438036e-06, 4.3955064527798071e-06,
+    -1.3571101030257493e-05, 6.1179808526490298e-06, 3.139825600753654e-06,
+    -8.7824975519845694e-06, 6.9487632389786391e-06, 1.4653420065194322e-06,
+    -1.6376948235030664e-06, 7.1555252453281426e-06, -8.3737787698323629e-07,
+    -6.8730455565768622e-07, 1.9926822904248187e-05, -3.5590915256344946e-06,
+    -3.5839709370544259e-06, 5.991155104634327e-06, 0,
+    -6.5812982901203299e-06, 2.1643050845399081e-06, 1.6750328786022117e-06,
+    -6.7359491191798515e-06, -1.995927287112842e-06, 2.5125968269243404e-06,
+    -1.4877856180817162e-05, 9.4035046397933364e-06, 2.9315015329448024e-06,
+    -1.1262342613144183e-05, 2.9871140742210311e-05, -2.0941969151311302e-06,
+    1.0285534645659844e-06, 1.485204306844734e-05, -3.1416665808373101e-06,
+    1.4270521230791422e-05, 1.2604049660358552e-05, -6.9119604796386014e-06,
+    2.327714357652777e-07, 6.240402086188368e-06, -1.2567497855303644e-06,
+    -5.9398862242987516e-06, 6.6157017286627706e-06, 6.2839865116320892e-07,
+    -8.4514475038599546e-06, 3.0796340689254187e-06, 2.0947512663557766e-06,
+    -2.1516856036213339e-05, -2.702721500436045e-06, 7.3319412685693419e-06,
+    -8.7616739630480556e-06, -5.2418846204216329e-06, 3.7708017534068827e-06,
+    -8.9387238174365446e-06, 2.7873599116601255e-06, 2.3044224090745802e-06,
+    -3.916377546958616e-06, 9.8600252566583002e-06, -6.2850853903284598e-07,
+    6.416682920562522e-07, 4.4516537716088322e-06, -1.0475538330459444e-06,
+    4.5360196309907064e-06, 6.7815430573325841e-06, -2.7236914476730378e-06,
+    -1.7665005544453827e-07, 8.0296313887395776e-06, -1.4666446692609969e-06,
+    -1.4378058553476958e-05, 4.8344964777846666e-05, -4.6101516728361269e-06,
+    -1.262159496093207e-05, 1.8888787626347714e-05, 4.1918589248346461e-07,
+    -2.7736254796129067e-05, 2.2049468687723728e-05, 4.6117419358476797e-06,
+    -2.6881428913660965e-06, 4.4932678057718611e-06, 0,
+    1.6942522498841761e-06, 7.1150332669467353e-06, -1.886871260091405e-06,
+    -1.1141645702900105e-05, 7.5712224021362573e-06, 2.0966226551427658e-06,
+    -6.7593105150254296e-06, 1.0192950841148019e-05, 2.0967613053451961e-07,
+    2.181499355408123e-06, 7.4065458885441693e-06, -2.096860344018292e-06,
+    9.4864360713209361e-06, 1.1776241265359921e-05, -5.2422994183953797e-06,
+    6.4303693853018373e-07, 4.4521494624860658e-06, -1.0484846442795903e-06,
+    -5.2384368701141604e-07, 2.409133548425535e-05, -4.403926687157611e-06,
+    2.5915189671987804e-06, 5.6173937547088215e-06, -1.8875219512104469e-06,
+    6.2532672826520752e-06, 1.7063217334079006e-06, -2.3069821689161718e-06,
+    1.4550354572290258e-05, -5.5335983676352285e-06, -3.5652013746084732e-06,
+    1.1532282570114738e-05, 2.8292069223501137e-06, -4.1941762786920633e-06,
+    3.0006116758241053e-06, 3.8278637294886231e-06, -1.6776625882883311e-06,
+    -7.4175941034704262e-06, 1.7933699151706506e-05, -1.0485985438360435e-06,
+    3.1381322646018006e-07, 8.3218155873532318e-06, -1.6778765283692598e-06,
+    5.0121687383830604e-06, 1.9264869988933064e-05, -5.2436612991008102e-06,
+    -7.9033150868212942e-06, 1.7643084097462847e-05, -8.3906108846315552e-07,
+    -5.5310277705666877e-06, 4.8270655784166117e-06, 8.3912052316337249e-07,
+    -1.1219565856507296e-05, 5.492894717740171e-06, 2.5174804402991469e-06,
+    -2.6164301250242161e-05, 6.2342095930034702e-07, 8.1823523015028821e-06,
+    -1.3656134944028953e-05, 4.0350435112634919e-06, 3.5669021646450583e-06,
+    -6.8362889609485666e-06, 8.113394148245856e-06, 6.2948898749137783e-07,
+    -5.7049507721507187e-06, 1.2857238858354769e-05, -6.2953059676296164e-07,
+    -1.7256085719896674e-05, 2.2218210046887066e-05, 1.2592038581699105e-06,
+    -8.8639949044899691e-06, 4.8670204391143557e-06, 1.8889930479895622e-06,
+    -2.1217560241343358e-05, 5.6128512891384652e-06, 5.6673536694487603e-06,
+    -1.7823874779332449e-05, 1.9844562565707324e-05, 1.8893319137791575e-06,
+    -9.1004427249519182e-06, -1.3761660116462515e-06, 3.1491392061891443e-06,
+    -1.3642344408176799e-05, -8.1612178169931937e-06, 5.8784486747023856e-06,
+    -2.7414114655122113e-05, 1.8173901187412689e-05, 5.2490360269927261e-06,
+    -1.0327552141031759e-05, 3.9901353636739856e-06, 2.5197989154124301e-06,
+    -2.5179650147033605e-05, -1.099971063400762e-05, 1.0079528629657053e-05,
+    -9.606363422315356e-06, 1.0522994441097833e-05, 1.0500004508501304e-06,
+    2.8273731020322934e-06, 1.1862061042644534e-05, -3.1501946069004139e-06,
+    8.5184214000666447e-06, 1.1199394877314806e-05, -4.8304807532817406e-06,
+    5.7689100694258144e-06, 1.4180260932694644e-06, -2.1002288452531825e-06,
+    1.4713443571207074e-05, -1.365897103589031e-06, -4.4103556984392833e-06,
+    4.5424892620715696e-06, 6.7854587966209579e-06, -2.7301815435434862e-06,
+    -2.9399016315267978e-06, 1.0444158821010241e-05, -1.0501094670420374e-06,
+    -1.1397169890459136e-05, 1.351975101782088e-05, 1.0501887540634303e-06,
+    -3.2368898353812847e-05, 1.3175054610514714e-05, 7.7723502392920696e-06,
+    -9.1023153723224226e-06, -1.3788108277901223e-06, 3.1512204251085696e-06,
+    -4.0554337532305862e-06, -6.4947699848771911e-06, 2.5209763401673468e-06,
+    8.979713054219074e-06, -2.71699880403653e-05, 2.3106987212528907e-06,
+    -2.1056613171699379e-06, -5.3281879506261731e-06, 1.6803654389885292e-06,
+    -1.274707794512997e-05, -9.6632892527259706e-06, 5.8811957801413461e-06,
+    -2.5608865324405761e-05, 2.9779699929899373e-06, 7.5618228704693591e-06,
+    -8.7705202026777673e-06, -5.2504619032500699e-06, 3.7810720044453849e-06,
+    -8.0492564859813154e-06, 1.283659269435411e-06, 2.3106878220893745e-06,
+    -7.4061840386607791e-06, 5.7370065024708872e-06, 1.260422751656054e-06,
+    -9.7059366628571286e-06, 2.063392380113882e-05, -8.4035319963121635e-07,
+    -9.1995135661493421e-06, 8.731765765934707e-06, 1.2606487482733075e-06,
+    -2.3097427822860173e-05, 6.5130662841861309e-06, 6.0936243081108343e-06,
+    -2.1792249837615518e-05, 3.2249900345782123e-06, 6.3042845901764566e-06,
+    -1.6354678861824068e-05, 8.5149792748429043e-06, 3.572714432471813e-06,
+    -1.3333220330785656e-05, 1.521439170759642e-07, 4.2034512077737674e-06,
+    -7.4078919020947875e-06, 5.7352627977347304e-06, 1.2610888976763435e-06,
+    -6.6093443900350213e-06, 1.4351333699758051e-05, -6.3058608809618555e-07,
+    3.391444694966772e-06, 1.4237782061887749e-05, -3.7837842192592341e-06,
+    -5.0688003533361226e-07, 1.1902801893670656e-05, -2.1022213209861973e-06,
+    -8.4018992023704442e-06, 1.7346463331235906e-05, -6.3071696255329046e-07,
+    -9.5137261149347285e-06, 4.054739163872334e-07, 2.9435401675687034e-06,
+    -2.0703584003439746e-05, -1.8504131576890792e-05, 1.0092137706536886e-05,
+    -9.9233279006738506e-06, 2.1936350365625579e-06, 2.7333001885107566e-06,
+    -9.2805326110390052e-06, 6.647644699320221e-06, 1.682110209844101e-06,
+    -1.2381181159704102e-05, 1.2928281681978682e-05, 1.4719574905827648e-06,
+    -1.7742912418683421e-05, 9.7159069571417511e-06, 3.7853905304821578e-06,
+    -1.3844270414758997e-05, 1.2051465439755216e-05, 2.103193071839593e-06,
+    -1.3942979482928219e-05, 2.2165409821917059e-05, 2.1034409971448786e-07,
+    -1.6360121134262329e-05, 8.5092040497114496e-06, 3.5762543346695708e-06,
+    -4.8744778977927172e-06, -2.9208401994273991e-06, 2.103768282794849e-06,
+    -1.7733308115830404e-06, -9.2014443581756034e-06, 2.314101471813379e-06,
+    1.7596752226456402e-06, -2.9466529224364546e-05, 5.0484964099137275e-06,
+    -7.0559540338854809e-06, -1.0333194315537142e-05, 4.2067233232134793e-06,
+    -6.3582882832424747e-06, 8.3979708996317903e-06, 4.206782826601807e-07,
+    -1.8165992016205834e-06, 1.5189615864219519e-05, -2.3138832814934007e-06,
+    -8.5406038601298917e-06, 9.8562013595149267e-07, 2.5243672205146894e-06,
+    -1.5109333431934102e-05, -9.056490623604585e-06, 6.5213742191372326e-06,
+    -6.2586251315666086e-06, -1.7168238545806069e-06, 2.3140469237875605e-06,
+    -3.8829159041436911e-05, 1.9455431213177832e-05, 8.6259785644637876e-06,
+    -1.9729043751470776e-06, 1.1027034825639159e-05, -1.4729155127374272e-06,
+    3.7216976674636637e-06, 1.0371074107784484e-05, -3.1563963109326743e-06,
+    -7.0243480654874624e-06, 1.6138277294630576e-05, -8.4176122976120649e-07,
+    -2.2047604691932676e-06, 4.7830553658312347e-06, -2.1045320280216329e-07,
+    -3.6671653558251194e-06, 3.9063507124570407e-06, 4.2091830913804085e-07,
+    -2.4418711528223502e-05, 9.7798053402819995e-06, 5.8932729528130001e-06,
+    -1.5899844621553028e-05, 2.0991931816927156e-05, 1.0525040932685137e-06,
+    -2.5374079119511173e-06, 8.6536500232825553e-06, -8.4208264141544253e-07,
+    4.1329637021358945e-06, 8.5828658883957409e-06, -2.9474003601509535e-06,
+    3.468928385208514e-06, 1.6324279411672471e-05, -4.2107703651789175e-06,
+    -5.3843924606722382e-06, 8.9816807419818012e-06, 0,
+    -8.3876217463474401e-06, 5.1463247782157495e-06, 1.6844986398603656e-06,
+    -1.6344348760966021e-05, -3.6941474612084413e-06, 5.8959674872419154e-06,
+    -7.9004977325269898e-06, 5.4380659640917983e-06, 1.4740474354457689e-06,
+    4.2890459625577471e-06, 1.2746555443421403e-05, -3.7905862900131093e-06,
+    1.8041252566131094e-05, 1.0815757768845025e-05, -7.7919442676294137e-06,
+    9.0309968487356507e-06, -6.9109594402760877e-07, -2.7376714524032786e-06,
+    1.1411283482809509e-05, -1.3508501922998573e-05, -1.0528860637792903e-06,
+    8.3872804107210097e-06, -5.1468810549626376e-06, -1.6844986398673045e-06,
+    1.8470564573408454e-05, -3.1730880977187681e-06, -5.2637605979094504e-06,
+    5.9290704347014778e-06, 5.5881863053053316e-06, -2.9476225961028168e-06,
+    -1.4822872407560528e-06, 1.1320188737451442e-05, -1.6844113291739071e-06,
+    -7.3335606612379145e-06, 7.8135654953959133e-06, 8.4225328860626503e-07,
+    -9.1087197907624429e-06, -1.3894255670998668e-06, 3.1585688949273272e-06,
+    -1.3029417243987096e-05, 8.4692774119377034e-06, 2.5269741796424272e-06,
+    2.8283662254213748e-06, 1.1869123029584205e-05, -3.158911209652504e-06,
+    5.4422509848106593e-06, 5.2963429610919377e-06, -2.7378004441303005e-06,
+    3.3685242726955167e-05, -4.2310002237866406e-06, -9.8976885973683926e-06,
+    4.9548587435221947e-06, 5.0034194721271241e-06, -2.5269384610476786e-06,
+    -6.7668909231877183e-06, 1.0187979120113155e-05, 2.1058614276675547e-07,
+    -4.6149520541993727e-06, 4.1996168226365871e-05, -6.5290624412517317e-06,
+    -1.4870743734962666e-05, 4.8058678688678302e-05, -4.4239552099284429e-06,
+    -1.7937941226564558e-06, 2.9944948548576988e-06, -1.3877787807814457e-17,
+    -1.0668655279821859e-05, 7.8507155495954883e-06, 1.8963291540524674e-06,
+    -1.1329645013685719e-05, 1.5592837800559867e-05, 6.3216331171178641e-07,
+    -2.0929415767978465e-05, 1.3910877387723897e-05, 4.0041535629767311e-06,
+    -5.8697333282509145e-06, 8.6909109185961952e-06, 2.107637833356768e-07,
+    -3.7606649324894992e-06, 1.4023607228408341e-05, -1.4754437579339585e-06,
+    -4.721236325194722e-06, 1.2406729256175808e-06, 1.2647256361839054e-06,
+    -7.3969217852243307e-06, -6.4662759032274586e-06, 3.5834061768644232e-06,
+    -8.1364033427677729e-06, -8.0574213762174551e-07, 2.7402646867250025e-06,
+    -1.3031072775532282e-05, 8.4691877637599333e-06, 2.5295942122915971e-06,
+    -1.1079869276287013e-05, 9.6382358973357007e-06, 1.6865232039670053e-06,
+    -1.6320786626028427e-05, 3.4983333531413141e-05, -1.4759162709626628e-06,
+    -5.949299647395323e-06, 6.6085062703780117e-06, 6.326159615738236e-07,
+    -6.3733890564021678e-06, 2.0597094554319906e-05, -1.8979997851165109e-06,
+    -7.176598015551372e-06, 1.197712776807025e-05, 6.9388939039072284e-18,
+    -5.4613778014134251e-06, 6.9008888183841322e-06, 4.2184325997618455e-07,
+    -9.8534946059714024e-06, 4.2690747965035136e-06, 2.3202471506195144e-06,
+    -9.0500272641735879e-06, 1.2889212610223133e-05, 4.2189092050448629e-07,
+    -1.5473507837260314e-05, 7.0052240808138322e-06, 3.5863597930632651e-06,
+    -1.8086679577589138e-05, 1.3577852840174209e-05, 3.1647330127546058e-06,
+    -7.5077714152826935e-06, 1.5848171112220477e-05, -6.330121441952552e-07,
+    -2.5119998464662174e-07, 5.9537059197145581e-06, -1.055084791569405e-06,
+    -8.5626844952280123e-06, 1.3181211094948075e-05, 2.110288755616252e-07,
+    -6.8611825276010396e-06, 2.0305099180273345e-05, -1.6883978521883836e-06,
+    -2.9593239918607184e-05, 3.7203336735402992e-05, 2.3219731233800611e-06,
+    -1.1162117072277544e-05, 7.5538202259362031e-06, 2.11122238161221e-06,
+    -1.4816976393078329e-05, -7.412866748213176e-07, 4.8560627888133423e-06,
+    -9.3541808372787916e-06, -7.6417138530349149e-06, 4.4338590403092404e-06,
+    -1.9569300538146983e-05, 2.489731447885557e-05, 1.4780712204315316e-06,
+    -5.4768397216298226e-06, 1.9100628642909623e-05, -1.9006365645640733e-06,
+    -1.0754455362749216e-05, 5.7627022669315409e-06, 2.3231860222031053e-06,
+    -1.8975535438031654e-05, 2.8690553095511717e-06, 5.49150275640925e-06,
+    -1.3619469666437123e-05, 1.8289294190176886e-05, 8.4492605877117821e-07,
+    -2.0204408089030679e-05, 8.2363610369173834e-06, 4.8588504310276281e-06,
+    -1.3103800165142898e-05, -5.8219964758077225e-06, 5.2816324051657704e-06,
+    -2.8505433795622537e-06, 3.2577648151344007e-07, 8.4506913393400662e-07,
+    -7.6687913336814795e-06, 1.1681990287171207e-05, 2.1127622593097861e-07,
+    -5.6223035826696854e-06, 2.7338091196926761e-06, 1.2677229361823805e-06,
+    -1.5797002735656873e-05, -1.3328022360203917e-06, 5.2823527884951482e-06,
+    -6.5990592210685151e-06, 2.1478035079347535e-06, 1.6904085383406819e-06,
+    -6.7719697672830037e-06, 1.0184651004996326e-05, 2.1131100410437531e-07,
+    -1.7479456206836996e-05, 4.2430730887277335e-05, -2.5361255560282792e-06,
+    -5.4648940515378275e-06, 6.8982783490434407e-06, 4.2274920965951202e-07,
+    -2.0129687777675764e-05, 1.0314138189138067e-05, 4.4392006285295937e-06,
+    -1.0600192297788302e-05, 9.9237613808700331e-06, 1.4798657292439121e-06,
+    -1.5921639462651571e-05, 3.3189453926829593e-05, -1.2686292792940534e-06,
+    -1.6805490736765405e-05, 2.2483446598886569e-05, 1.0573749557388212e-06,
+    4.7128010887687033e-06, 1.0967194072342146e-05, -3.5954128310769495e-06,
+    3.9631819140351077e-07, 1.0413370277240208e-05, -2.1150381912665717e-06,
+    -1.6963549538173694e-05, 1.8318497689573388e-05, 1.9037043622813221e-06,
+    -4.830353856427605e-06, 2.3559866727862477e-05, -2.9616936868814836e-06,
+    -1.7861525136497747e-05, 1.9815150726409936e-05, 1.9041964814114909e-06,
+    1.6130615297649253e-06, 1.7248284376103484e-05, -3.8088045895487421e-06,
+    -7.6694764276075134e-06, 1.168155976116747e-05, 2.1161616379355985e-07,
+    -2.3348277792906158e-05, 5.1121602458681359e-05, -2.3282153036457975e-06,
+    -5.7944136218901487e-06, 1.0770885237487704e-05, -2.1169472096821407e-07,
+    -9.2152029666503488e-06, 8.7195800685946345e-06, 1.2702518626603321e-06,
+    -3.0658772790514988e-05, 2.231630578058974e-05, 5.5051228836713872e-06,
+    -1.59885033523266e-05, 1.8903205784515098e-05, 1.4823851835835122e-06,
+    -6.3733163367662993e-06, 2.0599473965488002e-05, -1.9061565563818772e-06,
+    -1.7055539926147389e-05, 2.8439012690895105e-05, 0,
+    2.6752640397975647e-06, 1.9920377794357957e-05, -4.6607849732913098e-06,
+    -4.6643911025268103e-06, 2.7729075410043436e-05, -3.813799282721686e-06,
+    -2.6518044862450241e-05, 4.3115551219996551e-05, 2.1192151224841416e-07,
+    -1.745536892847066e-05, 1.8023931332877829e-05, 2.1196429705050424e-06,
+    -2.2111439091254681e-05, 3.354751878414941e-05, 6.3600334113123047e-07,
+    -5.5528000967586255e-06, 1.7020994488525787e-05, -1.4842376742651986e-06,
+    5.6348048657617333e-07, 1.4583247125776744e-05, -2.9687122013871692e-06,
+    1.6043771654233874e-05, 4.4213299199125089e-05, -1.3572784386205183e-05,
+    -7.1859952213981781e-06, 3.6390030944633001e-05, -4.6664547958957803e-06,
+    -2.4224756712515338e-05, 2.8211368390540503e-05, 2.3336763043946274e-06,
+    -2.0714374709046579e-05, 7.9315478577757226e-06, 5.0923980016021053e-06,
+    -2.8623343986483585e-05, 1.153906352746592e-06, 8.9124908923959856e-06,
+    -2.1945107994275626e-05, 2.550721644301035e-05, 2.1223003870626811e-06,
+    -1.8280998824532491e-05, 4.6019454876533583e-05, -2.9718756411750702e-06,
+    -1.5338701776390629e-05, 2.3363364050343893e-05, 4.246412856692694e-07,
+    -4.1628401806215187e-06, 1.5819111721770973e-05, -1.6987642974114481e-06,
+    -1.5094720593189503e-05, 2.9614645707831677e-05, -8.494936788450147e-07,
+    -7.2634748470579158e-06, 3.4309684298627907e-05, -4.2482252655615116e-06,
+    -1.6886827451684239e-05, 8.1905085753675166e-06, 3.8239047050331321e-06,
+    -2.088677874795275e-05, 4.0386860825858406e-05, -1.0623700500630995e-06,
+    -1.6561749784316238e-05, 4.3151185271095294e-06, 4.462644512079339e-06,
+    -1.2728247217347333e-05, 1.678847735347988e-05, 8.501032320515356e-07,
+    -1.7136993155641989e-06, 1.7287611212224441e-05, -2.763107460779235e-06,
+    6.2828123354730092e-06, 1.3941695895303141e-05, -4.6763348441683505e-06,
+    3.1836297633147659e-06, 2.0222905253997059e-05, -4.8892163058145144e-06,
+    -3.6679778055714873e-06, 2.8324506241128589e-05, -4.2519706490440345e-06,
+    -8.8092064317868424e-06, 1.9137952750769571e-05, -8.5050173381090444e-07,
+    -2.0151199761564431e-05, 2.2513695537074163e-05, 2.1265432839090437e-06,
+    -1.1583268966552929e-05, 2.1544881193102938e-05, -4.2537043661028395e-07,
+    -8.398033778944658e-06, 2.95586810705184e-05, -2.9780255381556264e-06,
+    -3.8262936638472356e-05, 4.8284808461807049e-05, 2.9787510384057803e-06,
+    -1.5414881205710884e-05, 3.3492174947302722e-05, -1.4897662325291661e-06,
+    2.2622489414564351e-05, 2.7802055285242044e-05, -1.2558247797209154e-05,
+    -1.7880711404016925e-06, 1.520622818895756e-05, -2.3415327135220543e-06,
+    1.5525240468494683e-06, 2.9650282387105875e-06, -1.0643779103230999e-06,
+    5.8792172508703722e-06, 3.5229188442009729e-06, -2.554518946977502e-06,
+    2.2082172879966944e-06, 7.4271170084627691e-06, -2.1287956950347131e-06,
+    -7.9001281289292624e-06, 2.9855307137560683e-05, -3.1934926030749433e-06,
+    5.0742140949855408e-06, 1.9316741828867556e-05, -5.3231107612072837e-06,
+    9.227308828074765e-06, 3.4931910516955433e-06, -3.6198339585027939e-06,
+    -7.2144106402771691e-07, 1.7878437232499156e-05, -3.1940907759958614e-06,
+    1.0291183514921087e-05, 6.1642337588763141e-06, -4.4719155206443539e-06,
+    9.3215993367812278e-06, 1.7789416974223204e-05, -6.3886302030108366e-06,
+    -6.360630337792772e-06, 8.3970244443842823e-06, 4.2593260913409425e-07,
+    -1.3760160411102618e-06, 1.3416593945714261e-05, -2.1297926625640784e-06,
+    1.8804251593812493e-05, 2.7534569171705492e-05, -1.128869377646502e-05,
+    1.8136333270524219e-05, 1.0858176678285592e-05, -7.8810813737908991e-06,
+    2.5420264402831183e-05, 2.5386661385184972e-05, -1.2993438260791579e-05,
+    3.59987667267192e-06, 6.2225852985875463e-06, -2.3431558143910403e-06,
+    -5.5950775001978315e-07, 9.8352327768669312e-06, -1.7041691595318098e-06,
+    3.9531470829579085e-06, 2.6773390980394662e-05, -6.3911428975424456e-06,
+    1.7921140557097814e-05, 2.902774977026068e-05, -1.1292129005212315e-05,
+    1.0214486617643459e-07, 1.4297834745935489e-05, -2.7699749231488435e-06,
+    -1.3016447201141812e-05, 3.2889114302048217e-05, -2.1310192041962273e-06,
+    1.8549134783718557e-08, 1.2213724124687797e-05, -2.3444063696823059e-06,
+    1.9249951754229944e-05, 8.4724004026259792e-05, -2.2382822716708606e-05,
+    9.0006503419004513e-06, 9.4486216521416644e-06, -4.6905682484083e-06,
+    9.6628005994692234e-06, 1.3910787105275713e-05, -5.7567680861667081e-06,
+    -1.5489605250940119e-06, 4.3808723634852775e-05, -7.8898640480523641e-06,
+    1.5577313590697806e-06, 2.964448910347528e-06, -1.0663125741203205e-06,
+    1.1517853701487057e-05, 7.8425800070780483e-07, -3.8386893511030418e-06,
+    3.5204299736191214e-06, 4.1373476454831248e-06, -1.919326718481662e-06,
+    -5.5540021437205933e-06, 3.9379195878708195e-05, -5.7585727437636791e-06,
+    1.8166445120426644e-06, 9.2184628068814334e-06, -2.3463595664394155e-06,
+    3.9257714921359099e-06, 2.3458793173003478e-06, -1.7064752486153911e-06,
+    6.7244456733173141e-06, 1.2150687215606304e-05, -4.4795813362585868e-06,
+    2.3324791684598001e-05, 2.0034354103859453e-05, -1.1305980190792764e-05,
+    4.2723362303209722e-06, 1.0684162085827786e-05, -3.4132378490259185e-06,
+    1.4146516823854149e-05, 6.4168046456369865e-06, -5.7599196889648874e-06,
+    9.7021867260238537e-06, 2.6123416258350129e-05, -8.1068948707754829e-06,
+    1.5303292669549551e-05, 1.1171082531624688e-05, -7.0405603860013155e-06,
+    9.0966657855795496e-06, 1.1529693293321763e-05, -5.1205033452378368e-06,
+    1.6785712771971717e-06, 1.7263914814491521e-05, -3.8405750794404114e-06,
+    -2.6839853590199247e-06, 4.495752481126214e-06, -1.3877787807814457e-17,
+    4.0144899273730772e-06, 4.4293126952865691e-06, -2.1338025021147566e-06,
+    -9.4941241562951362e-07, 1.1629253363121261e-05, -1.9204851181911509e-06,
+    9.9193859890711611e-06, 4.2507743247099938e-05, -1.1310792784685608e-05,
+    1.0398635150454805e-05, 8.238503294233368e-06, -4.9088933691265879e-06,
+    8.4154272314562739e-07, 8.6321697967961519e-06, -1.9209162277974978e-06,
+    1.3661095479816643e-05, 6.1195010335746147e-06, -5.5493913889842483e-06,
+    7.5932630365094234e-06, -1.566459578439261e-06, -2.1343413844077119e-06,
+    2.5429660896469919e-06, 3.549696563298621e-06, -1.4940249974740305e-06,
+    -5.944535071078505e-06, 6.6150989053159748e-06, 6.4031439116207789e-07,
+    -1.2096908073855328e-06, 5.3754057019461676e-06, -6.4033834323157235e-07,
+    4.1920799744299408e-06, 8.5982895588476715e-06, -2.9883294347041178e-06,
+    5.4017761674240994e-06, 3.2227569063403294e-06, -2.3480060622818599e-06,
+    -5.1274991641481193e-08, 1.0131048945150045e-05, -1.9211407803129688e-06,
+    3.2106087446692744e-06, 8.0122441474261841e-06, -2.5616168528586059e-06,
+    1.7610825903124905e-07, 4.1696334566743154e-06, -8.5389224555726395e-07,
+    -4.6468865582405261e-06, 3.3247975655403827e-06, 8.5391220687458524e-07,
+    2.05252484242191e-06, 3.2567013067419381e-06, -1.2808922642132403e-06,
+    4.5081782360789635e-06, 4.7214900472103416e-06, -2.3483244420696714e-06,
+    9.0668828399143031e-06, -6.884038757926092e-07, -2.7752665720873204e-06,
+    1.2051896256748407e-05, 1.3284842871053026e-05, -6.4044613178673715e-06,
+    2.1345595580729571e-05, 6.6333024693054909e-06, -8.1123176670430674e-06,
+    1.5049127460198264e-05, 4.9094407737482193e-06, -5.7638804464923976e-06,
+    2.3188406882146406e-06, 9.5106438429692908e-06, -2.561748597210145e-06,
+    1.1611243694531481e-05, 2.8586604466918075e-06, -4.26962091819999e-06,
+    3.1934052532628376e-05, -3.3144162515652553e-06, -9.6060631824476661e-06,
+    1.9250890948729893e-05, -8.8440349175211708e-06, -4.4823893573242568e-06,
+    1.0941918218265734e-05, -1.6058105115623889e-06, -3.201497106551654e-06,
+    2.6570774498663186e-05, 5.6756539235647274e-06, -9.6040871310279496e-06,
+    1.5362228592247229e-05, 1.0269074176005866e-06, -5.1219642489067074e-06,
+    1.8933427434308925e-05, 1.7374752234844415e-05, -9.3902238739729249e-06,
+    2.1433834115069939e-06, 5.3399156225153455e-06, -1.707353351289298e-06,
+    2.6929213238796601e-05, 1.4008530606568481e-05, -1.1311268828348431e-05,
+    1.5989237902414022e-05, 1.5616191001377455e-05, -8.1100421798346867e-06,
+    1.2683896688014951e-05, 5.521374747352592e-06, -5.1221798077413783e-06,
+    1.536266497537131e-05, 1.0218427491937021e-06, -5.1220600521262316e-06,
+    3.0011910392119256e-05, 7.7104189870058626e-06, -1.1097329728565475e-05,
+    9.8679653620648011e-06, -4.2818460672666703e-06, -2.3474022891600832e-06,
+    9.9577274147444328e-06, -2.1974787088319125e-06, -2.7740859503133652e-06,
+    3.4391833393931925e-06, 2.0469403196332614e-06, -1.4937106478027373e-06,
+    1.0186694540698094e-05, 1.4186659759163334e-05, -5.9749543526305127e-06,
+    5.8960674466090879e-06, 3.5087111543985472e-06, -2.5607426229548591e-06,
+    2.7826663670349472e-05, 1.2495478135421401e-05, -1.1309840791236259e-05,
+    1.8271323612650825e-05, 1.2900583545139011e-05, -8.3222967640350642e-06,
+    3.0388395465263951e-06, 3.8384394831503243e-06, -1.7071537654483881e-06,
+    0.00046890926484569051, 0.00012623129879946182, -0.00017449600648833385,
+    0.00023096588651244643, 0.00012261794146667393, -9.745001707168327e-05,
+    0.00017721770669160142, 9.6698925146299075e-05, -7.5269337567421268e-05,
+    8.7698616865888868e-05, 4.3703767502789592e-05, -3.6460554167519477e-05,
+    3.3167726491811766e-05, 2.3639928391994136e-05, -1.5138451200956415e-05,
+    3.9861543421476631e-05, 3.3665103919056083e-05, -1.9190214457204258e-05,
+    7.9056175693231756e-05, 5.2724634669820691e-05, -3.5396608871252067e-05,
+    3.6431411611775877e-05, 3.1615925354222529e-05, -1.7698967017261424e-05,
+    4.4610850866155793e-05, 3.2377208608047603e-05, -2.0471860518345153e-05,
+    0.0001053564122701911, -8.9850914658295977e-05, -1.6840960653928538e-05,
+    0.00023387598799196052, -0.00010330119277340843, -5.5588622621317862e-05,
+    6.9176000388693204e-05, -3.4218988260892313e-05, -1.5749252221086696e-05,
+    0.0005105083102075747, -0.00023440156753690156, -0.00011965308028018262,
+    0.0002871924470616849, -8.0401827429077422e-05, -7.7007692547266526e-05,
+    0.00061852337833775972, -0.00017791480863355025, -0.00016495654756142064,
+    0.00060523456544278598, -0.00013585862608189725, -0.00016857611081505519,
+    0.00049961463760014868, -3.6467244498794571e-05, -0.00015328582444118499,
+    0.00014609017362093857, 0.00019578282357340937, -8.3242668827886168e-05,
+    8.0411852526857119e-05, 0.00015958107737129579, -5.5453846449261823e-05,
+    -0.00016193874665779151, 0.00021479252091127776, 1.2030342413836548e-05,
+    -0.00022272398881528765, -0.00014128802269514074, 9.7787760897909137e-05,
+    -0.00013354635802143022, 0.00014042419824705776, 1.6693175544112149e-05,
+    -1.3748330879470583e-05, 2.0271958937834178e-05, 6.3428184050862146e-07,
+    -3.3349097497054059e-05, 2.9071604740027457e-05, 5.2866262618203597e-06,
+    -4.1633198787416337e-05, 6.2608445367207111e-05, 1.6922532154808878e-06,
+    -4.5409743247765144e-05, 5.4359571884710078e-05, 4.4438976345012593e-06,
+    -1.8134318797324855e-05, 2.781612962798885e-05, 6.3501852780312174e-07,
+    -7.5634441884797621e-06, 1.982754816909349e-05, -1.2702220269916742e-06,
+    -1.6547148439988169e-05, 3.075646959771472e-05, -4.2347099119682818e-07,
+    -3.6098463950001713e-05, 3.1509948860086734e-05, 5.7180936655354397e-06,
+    -9.4257663120211888e-06, 2.0764287045338392e-05, -8.4728016182256116e-07,
+    -4.3311863737460765e-06, 1.7668383070823523e-05, -1.9065862782718934e-06,
+    -1.4410428835931466e-05, 2.5942412713531038e-05, -2.1186977919307459e-07,
+    -1.3804869788996976e-05, 1.0146689031598211e-05, 2.5427477479203486e-06,
+    -1.0132735959511585e-05, -1.8495141952956651e-06, 3.6024120224006917e-06,
+    -1.97205621912111e-05, 6.7092973156657187e-06, 5.0860208032771359e-06,
+    -1.457410127067571e-05, 1.3736118904428274e-05, 2.1193743236641582e-06,
+    -6.6362174404949181e-05, 9.2647194870010274e-05, 4.0282479505313051e-06,
+    -3.5784660721654982e-05, 3.7745286957935331e-05, 4.4542386942944545e-06,
+    -4.9707361161305252e-05, 4.5802567329833455e-05, 7.4260304422715806e-06,
+    -5.8699734792999614e-05, 3.8554972567661494e-05, 1.1673473389720024e-05,
+    -4.6752518739645588e-05, 1.1176496435061356e-05, 1.2950283664298068e-05,
+    -1.8637605676552482e-05, 9.3518464502340137e-06, 4.2465721794907041e-06,
+    -1.2719667041805049e-05, 1.2793012413581106e-05, 1.6987881962249318e-06,
+    -1.4038499104224167e-05, 2.4140031842478926e-05, -6.9388939039072284e-18,
+    -2.5063884582149365e-05, 6.0127206238658193e-05, -3.1864079546375934e-06,
+    -1.6614075062565403e-05, 2.0623310343914625e-05, 1.487352936188624e-06,
+    -7.0022827331012172e-05, 6.0227620465702625e-05, 1.1264817990623566e-05,
+    -3.5043458839645325e-05, 3.4132246790996579e-05, 4.8902703700184902e-06,
+    -4.3768562596108174e-05, 5.934353795811198e-05, 2.9776488296093251e-06,
+    -2.2598943532736726e-05, 4.3390153370126416e-05, -8.5103584886170314e-07,
+    -3.3461110298116381e-06, 1.8245033426012025e-05, -2.3407651992407574e-06,
+    6.6094299672192491e-07, 4.8842713040619934e-05, -9.364551875883087e-06,
+    -6.7433278589934531e-06, 2.6363742189505768e-05, -2.7673048082349494e-06,
+    -9.5416487143062945e-06, 1.8679160115109283e-05, -4.2579303274198343e-07,
+    -1.4369330391755808e-05, 1.7890554843968953e-05, 1.277528637044778e-06,
+    -5.3097562203008319e-05, 4.5841942861335472e-05, 8.5188913923547882e-06,
+    -1.3383628872543074e-05, 1.8463601601015345e-05, 8.5209255627771707e-07,
+    -8.5551129347105626e-06, 1.9253111952777235e-05, -8.5219227461547087e-07,
+    -6.4688467416584849e-06, 2.2485677769190637e-05, -2.1307299941583646e-06,
+    -4.8693948557498867e-06, 4.3606310058286191e-05, -6.6063759438725334e-06,
+    -4.9844501364137983e-06, 2.3348452537153008e-05, -2.7708824929875697e-06,
+    -4.1066927300131839e-05, 8.3124828550606988e-05, -2.34531700216839e-06,
+    -7.946762608956881e-06, 2.1625521815560322e-05, -1.4929353721881977e-06,
+    -6.8468699626900165e-06, 2.4283979545236534e-05, -2.3463376138885272e-06,
+    -7.2167340801621016e-06, 4.4257821693149957e-05, -5.9735573445726664e-06,
+    -3.5570234954707125e-07, 3.8151392563523512e-05, -7.0416799579434142e-06,
+    3.3933042388217816e-05, 7.6115861271097707e-06, -1.2377038411906516e-05,
+    2.0650416675788152e-05, 9.982373243677678e-06, -8.5356091565555459e-06,
+    5.8383408229611966e-06, 1.954124112946154e-05, -5.548327570568945e-06,
+    1.6782909134538393e-05, 3.5991080266806197e-05, -1.2164835712390187e-05,
+    6.9434800189505097e-06, 2.2199057248983856e-05, -6.4032037861150304e-06,
+    3.9782033641189152e-06, 2.0475849598577955e-05, -5.1229941720673522e-06,
+    -6.7636430456929908e-06, 3.4419948750863405e-05, -4.2697207171191187e-06,
+    -1.5029775524699751e-06, 2.5364782575476585e-05, -4.2703595197202127e-06,
+    2.7242827715379114e-06, 2.3782417377438136e-05, -5.3385483070114703e-06,
+    2.5593326202916211e-05, 3.9075725342896384e-05, -1.5590237036004762e-05,
+    5.3578813647980894e-06, 1.9254132947343905e-05, -5.3396214218515148e-06,
+    -3.069403791411407e-06, 6.682894794862726e-05, -1.1535846391685922e-05,
+    -1.436742050303641e-05, 7.0359804968278539e-05, -8.5479868479690357e-06,
+    -2.441181331036546e-05, 7.0584341247459381e-05, -5.3445139393815122e-06,
+    -2.6844660650199303e-05, 6.1101478822711552e-05, -2.7801859666179429e-06,
+    -3.3926035126335963e-05, 6.3046688667522943e-05, -8.5575749372152066e-07,
+    -4.5302375067668432e-06, 1.3513856737090713e-05, -1.0699416450321575e-06,
+    -1.9647010190720904e-05, 3.5010696512238759e-05, -2.1401930139913761e-07,
+    -7.9179624742353738e-06, 2.163724556897284e-05, -1.4983869107976222e-06,
+    -4.9766177836474412e-05, 8.0088501761887976e-05, 1.0706111121944195e-06,
+    -7.5564501550717811e-05, 0.00015995563050774653, -5.5712056071313687e-06,
+    -2.5345053763420333e-05, 6.1970447914450055e-05, -3.430658001339626e-06,
+    -1.2258830696942891e-05, 2.1136963182954993e-05, -6.9388939039072284e-18,
+    -1.5233077034104703e-05, 1.94119650426261e-05, 1.2869767784876029e-06,
+    -2.483328849289812e-05, 2.7967317624222332e-05, 2.7889047517701271e-06,
+    -4.7390495770099905e-05, 4.5148034914843649e-05, 6.8668207191605046e-06,
+    -1.0489442789446413e-05, 4.435806898722694e-05, -4.9369309230370972e-06,
+    -3.2800855051806632e-06, 4.4503423363373429e-05, -7.299704572125143e-06,
+    2.2709824052391525e-06, 2.3510465936793512e-05, -5.1535491061224792e-06,
+    5.7487478790141378e-05, 0.00027134868710293469, -6.9614729300816747e-05,
+    -1.2524284562775989e-05, 0.00011779041670623158, -1.8063400708909216e-05,
+    -1.1780213483303381e-06, 2.1501849328864342e-05, -3.6569309248835058e-06,
+    1.4246626719172095e-06, 2.5024765500980539e-05, -5.1632787702177163e-06,
+    -1.2945969889710529e-06, 1.9416952944995014e-05, -3.2273797020976325e-06,
+    -6.4613926643031228e-06, 4.6674865392948295e-05, -6.6710046317253191e-06,
+    -2.4448390731707237e-05, 0.00013507167758425309, -1.743872088677545e-05,
+    -5.7435457775922849e-06, 6.7249154077686502e-05, -1.07701027548604e-05,
+    2.5495386262452957e-06, 9.4219643805737441e-05, -1.8531556604355071e-05,
+    6.2269121503533142e-06, 6.6097508879869871e-05, -1.4442545812780316e-05,
+    1.8901918759056668e-05, 8.5511859831466364e-05, -2.2209739771926473e-05,
+    1.621415752220412e-05, 6.3791247690347941e-05, -1.7255415952162345e-05,
+    1.7371414219369274e-05, 4.228211505746815e-05, -1.359135603801187e-05,
+    2.3478878298149874e-05, 3.9757697283759885e-05, -1.5103542041115803e-05,
+    3.2300064225221359e-06, 5.8954524411181097e-06, -2.1577992710131166e-06,
+    5.5804567176964692e-06, 2.1359137168663889e-05, -5.826355827874552e-06,
+    2.1744828576752973e-05, 4.2778536011756074e-05, -1.5107051504335833e-05,
+    6.4164742638955774e-05, 0.00010955236618132025, -4.1446302659717271e-05,
+    3.857518825689521e-05, 5.0444702004437403e-05, -2.2023463560345846e-05,
+    4.319293961238535e-05, 4.7050371233869903e-05, -2.288978670221542e-05,
+    2.2906379211207195e-05, 1.3196767326528747e-05, -9.9338112439159576e-06,
+    1.7304618942115546e-05, 7.953728215659428e-06, -7.1263967091547697e-06,
+    2.3154203753705804e-05, 1.2509132701898906e-06, -7.7739981918234502e-06,
+    2.315168267441603e-05, -6.8080611822507464e-06, -6.2619220404860898e-06,
+    1.9912762914908733e-05, -1.2701869895659357e-05, -4.1022193411274777e-06,
+    2.1149560666566813e-05, -4.0185585695184933e-05, 6.476045108158579e-07,
+    1.1944544558023518e-05, -1.7290111245849005e-05, -6.4749019106774552e-07,
+    1.2194127736037119e-05, -1.3118488170760223e-05, -1.5106560206507025e-06,
+    3.1856913631750361e-05, -1.3881668922244295e-05, -7.7681495523201916e-06,
+    6.1473791248128906e-05, -8.9197149260034081e-06, -1.8338225576286504e-05,
+    2.1026710143506877e-05, -1.0050413549345105e-05, -4.9613471666959397e-06,
+    1.9535450423852074e-05, -2.8545983193350999e-06, -5.8237029250327033e-06,
+    1.767623188095313e-05, 1.4196873763694384e-05, -8.4118198463850602e-06,
+    3.1125868072939822e-05, 2.9984467711852147e-05, -1.5745786682765106e-05,
+    2.190398811979799e-05, 4.5430439559179803e-06, -7.9808153988156216e-06,
+    4.2925835554097347e-05, -5.5180273754729114e-06, -1.294071992510859e-05,
+    8.6595066662142894e-05, -6.5954935714596097e-06, -2.6954444804237754e-05,
+    6.3588311716322732e-05, 1.0363444105154773e-05, -2.2637418631468731e-05,
+    1.9539021775982768e-05, 5.1835656259546781e-06, -7.3296665406286099e-06,
+    3.1628172816461353e-05, 2.2186158337156314e-05, -1.444368747668956e-05,
+    3.3391073241684222e-05, 3.5267040025099838e-05, -1.7462583257923936e-05,
+    2.2207953189634644e-05, 4.091625619107031e-05, -1.4877055414232176e-05,
+    1.0998535893508299e-05, 3.0456291577773964e-05, -9.272329114108635e-06,
+    1.1175576555833011e-07, 6.4450610317179358e-05, -1.2078061345892344e-05,
+    1.6263408626593368e-05, 4.5541857485564829e-05, -1.3806706846447581e-05,
+    1.0659414488467522e-05, 4.0312771971862116e-05, -1.1004009206096177e-05,
+    3.5976526306047418e-05, 6.0853826050311088e-05, -2.3090812383295967e-05,
+    3.4741492860868028e-06, 4.825574874417482e-05, -1.0144719932221602e-05,
+    7.0195863456079532e-06, 2.0113075351879672e-05, -6.0445334306089005e-06,
+    2.0894857595654681e-05, 4.2138484602605164e-05, -1.4681149681658456e-05,
+    5.7883110608225596e-06, 2.3427358602778892e-05, -6.2618056951013745e-06,
+    -1.7930751602862616e-05, 4.403536712427325e-05, -2.3755758943588834e-06,
+    -3.9230356854713655e-06, 2.1888024947125384e-05, -2.8080073590786014e-06,
+    -5.8482273123661166e-06, 4.4919255716036055e-05, -6.4811003771883535e-06,
+    7.0619726316722975e-08, 2.4173622900969249e-05, -4.537528721593187e-06,
+    3.4336637377840873e-06, 2.4087106120118662e-05, -5.6184926719438089e-06,
+    2.1560087450966936e-05, 6.3070699028444643e-06, -8.2119481486786494e-06,
+    2.1454498101064479e-05, 1.2277586044440181e-05, -9.2923382111545494e-06,
+    -2.4713535676790244e-06, 4.4835014227084802e-05, -7.5643387754051328e-06,
+    6.1726713114496068e-06, 2.162826055962519e-05, -6.0523700877931907e-06,
+    2.8869111498602829e-05, 3.05873598057671e-05, -1.51320490564405e-05,
+    2.0595235894177444e-05, 1.3788019862626122e-05, -9.2957467759183232e-06,
+    2.1330589574708458e-05, 1.0185437515353168e-05, -8.8633864615064728e-06,
+    2.2509412405363749e-05, 5.9104503992768453e-05, -1.8377189839560715e-05,
+    1.5772398839430934e-05, 2.1074645996210783e-05, -9.0817161874784391e-06,
+    1.5110711597210447e-05, 1.0644070403409422e-05, -6.9196276182778571e-06,
+    3.6448553073525902e-05, 2.0821474038479337e-05, -1.5785473732654598e-05,
+    3.1158893106619789e-05, 3.5883237797351697e-05, -1.6867375083259861e-05,
+    8.6913366844632023e-06, 2.3050309000571811e-05, -7.1367933293237096e-06,
+    -1.2375759658372898e-05, 4.7197203945192889e-05, -4.7586571256183485e-06,
+    4.6017620682348159e-06, 2.6742817955172082e-05, -6.4902523271639923e-06,
+    1.4326943159892469e-05, 2.8272885081614962e-05, -9.9527361047888063e-06,
+    8.0433262886203671e-07, 1.2516205538493086e-05, -2.5965586861603773e-06,
+    -1.4839979604636122e-05, 2.3683729675094689e-05, 4.3280395222583534e-07,
+    -1.5742340088137352e-05, 1.7140162097750711e-05, 1.9478798180053158e-06,
+    -1.0112463189021481e-05, 2.2362540501918993e-05, -8.6583279655660927e-07,
+    -3.8712909719573751e-07, 2.3893254062323788e-05, -4.329686096121721e-06,
+    1.3645222925545708e-05, 3.9936539364293644e-05, -1.1908183080784618e-05,
+    -1.7641007998558944e-06, 4.7217959579515245e-05, -8.2289982985678245e-06,
+    -7.3525358317005907e-06, 5.0056728012337626e-05, -6.9313217512592673e-06,
+    -8.3358087822060778e-06, 2.7393579550949454e-05, -2.3831169270252528e-06,
+    -2.7345476763612764e-05, 3.8653399829224888e-05, 1.7335214747768446e-06,
+    -7.5114508882034858e-06, 1.7817571159373102e-05, -8.6691343025024903e-07,
+    -8.1988589897552533e-06, 2.9480798777847816e-05, -2.817834320614776e-06,
+    -1.5099594969369967e-06, 2.123997482955664e-05, -3.4685538697690199e-06,
+    6.7139742266075775e-06, 4.4010808133598811e-05, -1.0407156600555911e-05,
+    1.45835450212628e-05, 6.8583255248444441e-05, -1.7566146105964242e-05,
+    1.1458676950348856e-05, 4.2689754702951443e-05, -1.1713368825355674e-05,
+    7.2325392695693491e-06, 2.2200089939528045e-05, -6.5082411683514696e-06,
+    2.25783130342605e-05, 8.7181089725552052e-05, -2.3651648552044935e-05,
+    1.320715057415156e-05, 3.9656424771550292e-05, -1.1720207328251575e-05,
+    2.8280532400837277e-05, 5.6266246367953077e-05, -1.9754012825827505e-05,
+    1.1253471022987238e-05, 2.4478552444695545e-05, -8.2500363147372524e-06,
+    1.3883104405948421e-05, 6.4125983697815858e-05, -1.65028996024566e-05,
+    1.8852592626183995e-06, 2.1152417346126384e-05, -4.560814103014843e-06,
+    -9.5313954689424385e-06, 6.6863763046542957e-05, -9.3407986766075313e-06,
+    -1.980658274891578e-07, 2.5989564082173899e-05, -4.7800973671796587e-06,
+    1.8675867469702956e-05, 8.4905471168739144e-05, -2.1950071050998166e-05,
+    3.5715818308051928e-05, 0.00010862746735251783, -3.1959109426167587e-05,
+    1.7956345451736189e-05, 0.00013063140098018566, -3.0234381071136962e-05,
+    1.1422617754774933e-05, 4.0604649367781409e-05, -1.1314732904138536e-05,
+    9.8864514005148063e-06, 8.1873116988206984e-05, -1.8499940958205396e-05,
+    1.1372163366663024e-05, 3.2540976091566254e-05, -9.7963962915198488e-06,
+    2.1626055962481461e-05, 3.4342251558350245e-05, -1.3498754811214209e-05,
+    4.9732275735347997e-05, 3.6230959825689357e-05, -2.3080116652571259e-05,
+    4.2645754703474203e-05, 2.4176615222748499e-05, -1.850798298910078e-05,
+    2.1647990484569002e-05, 6.2510454983955022e-06, -8.2740423744745439e-06,
+    2.0717281972920665e-05, -2.9619871955155475e-07, -6.7495958413071877e-06,
+    2.2437675696346249e-05, -3.3345695747977189e-06, -6.7491589985577138e-06,
+    2.1004008658842555e-05, -1.0165752909352399e-05, -5.007000699802644e-06,
+    1.7992743640449227e-05, -1.1872215032404654e-05, -3.7004501835316561e-06,
+    3.963944603804781e-05, -3.3710933247554919e-05, -6.7466629637552566e-06,
+    4.9244076139071113e-05, -7.6412029245964685e-05, -1.9579840485825506e-06,
+    2.6084456953900936e-05, 7.32481609255764e-07, -8.6997769347604836e-06,
+    1.1895205614703697e-05, 4.7303490146033411e-06, -4.7847002466669397e-06,
+    2.7225367631722452e-06, 2.5609985293661985e-05, -5.6549334827432629e-06,
+    1.1395243713213654e-05, 1.8485418590008518e-05, -7.1780132130036534e-06,
+    7.5250804011384176e-06, 4.2600086627153644e-06, -3.2628238337689686e-06,
+    6.0201446186181062e-06, 3.4078650849034275e-06, -2.6102590671428505e-06,
+    2.7015797462004443e-05, -6.7691697854810329e-06, -7.6128682389986491e-06,
+    2.0997408725187405e-05, 3.8615131883745768e-06, -7.6123400343033887e-06,
+    3.9470011461428811e-06, 2.228742002430284e-05, -5.4375366533299108e-06,
+    -3.0661507166573898e-06, 4.6393138759592834e-05, -7.6137486020380618e-06,
+    4.3085825515154497e-06, 2.0484986198110455e-05, -5.221653121056935e-06,
+    2.7769494045870591e-05, 5.9819938279803697e-05, -2.0236806802451102e-05,
+    9.4686347588968101e-06, 1.1369322001575366e-05, -5.2230055906030137e-06,
+    5.2559354634551525e-05, 2.7707944320942701e-05, -2.2415606189686577e-05,
+    5.7955666213277413e-05, 4.2771818246856164e-05, -2.6986277412661963e-05,
+    1.2275758589391783e-05, 1.6956992034800056e-05, -7.1821640488800575e-06,
+    1.4706053812679754e-05, 1.0310517037148692e-05, -6.7470685699150268e-06,
+    2.1444108854878907e-05, 1.0105545915961578e-05, -8.9235422988803714e-06,
+    4.0086918587561859e-05, 1.4615523300121058e-05, -1.5887890874505262e-05,
+    1.958352009806541e-05, 1.105414084207057e-05, -8.4878943101690529e-06,
+    5.1747372036725636e-05, 4.3228417148821752e-05, -2.5029216285998857e-05,
+    2.8972629113832582e-05, 4.8403415287834317e-05, -1.8501823097372139e-05,
+    1.364926767308261e-05, 1.5711908968207844e-05, -7.4014136665356833e-06,
+    1.8881236647227961e-05, 1.4653103885209351e-05, -8.9254817215028703e-06,
+    2.0360666829671858e-05, 1.4604298092524282e-06, -6.9661330146381095e-06,
+    3.6524576716823187e-05, -1.5475381292984203e-05, -9.1420773167191771e-06,
+    5.4901391055156568e-05, -1.1159556952966554e-06, -1.7846011715928756e-05,
+    1.2410732311174399e-05, 4.9889208350584191e-06, -5.005195190012357e-06,
+    1.7022417832301961e-05, 1.5598815577444469e-05, -8.4871485947837777e-06,
+    1.0286678347043443e-05, 1.5809665402377604e-05, -6.3111901226348133e-06,
+    6.2111811233722669e-06, 1.9522740580868447e-05, -5.6586485389364949e-06,
+    -2.5347524732766136e-06, 1.8603063041688905e-05, -2.611901324410526e-06,
+    2.0804187652878614e-06, 2.9213609860412326e-05, -6.0951127495781354e-06,
+    2.3710922504888154e-05, 2.136101323751971e-05, -1.1755838608892843e-05,
+    6.9070320434239107e-06, 3.5933285128908476e-05, -8.9265546575761912e-06,
+    2.2777393844930494e-06, 4.5342488051269836e-05, -9.145881996838745e-06,
+    4.5101414264947515e-06, 2.2564812380887478e-05, -5.6625740260732305e-06,
+    2.5712844801489831e-05, 6.2527329022232792e-05, -2.0039949279619662e-05,
+    2.3571517164672207e-05, 3.9287956975608829e-05, -1.5032532359723905e-05,
+    5.4657405054170383e-05, 6.8767995681395799e-05, -3.0723195757330346e-05,
+    2.9168879510932388e-06, 1.3651537298542404e-05, -3.4867228937696115e-06,
+    1.5143187170885142e-07, 2.2107289874395697e-05, -4.1408086812327882e-06,
+    1.4438271730365937e-05, 2.6129959537268821e-05, -9.5901273061485548e-06,
+    1.1184965925198354e-05, 7.4345207511816724e-05, -1.7440059224674287e-05,
+    2.370457416631111e-05, 2.7323493568542911e-05, -1.2864480057786509e-05,
+    4.665859402125383e-05, 4.4206597315965546e-05, -2.3550280101966581e-05,
+    1.0979593621507355e-05, 1.8170244221404896e-05, -6.9783442802756612e-06,
+    7.9154930293368064e-06, 2.2453700945002097e-05, -6.7607393950813721e-06,
+    9.5979544712521125e-06, 4.540990804324796e-05, -1.156023167234177e-05,
+    4.7439624118461587e-06, 6.4696276269593511e-05, -1.3526475169799157e-05,
+    -1.8519266142186241e-05, 4.364277101437386e-05, -1.9640465058687329e-06,
+    -2.5918600324525976e-05, 4.1494095654792673e-05, 8.7313123064286513e-07,
+    -4.1541554825358373e-05, 0.00010477041766343564, -5.677763420704196e-06,
+    -1.0424916568385623e-05, 6.8190711615845334e-05, -9.176047517794883e-06,
+    -1.5487561882826517e-05, 4.5341718927227603e-05, -3.2781276254958969e-06,
+    -1.1095653686260532e-05, 1.9791157333859388e-05, 0,
+    -1.7151583410784932e-05, 4.240771222147055e-05, -2.1862149346685289e-06,
+    -3.4294037484644546e-05, 5.8808888513839364e-05, 4.3737407575544784e-07,
+    -2.893879069659766e-05, 3.9801274932360631e-05, 2.1875460995204876e-06,
+    -5.2489849224041096e-05, 8.0622039601907503e-05, 2.4072215955087128e-06,
+    -2.6964206821522563e-05, 4.6910970145086495e-05, 2.1892509002863214e-07,
+    -3.0920660662597799e-05, 3.2686893303768283e-05, 4.1606502760443975e-06,
+    -1.4742830884595381e-05, 9.7421393501773146e-06, 3.0662226376543256e-06,
+    -1.0049365569919644e-05, 1.4374855792420593e-05, 6.5710522820922046e-07,
+    -2.9293422037252048e-05, 1.5589187785436387e-05, 6.7909007397462529e-06,
+    -5.9760892611726568e-06, 1.0655932283387681e-05, 0,
+    -2.9374503384582695e-05, 2.7549297910378634e-05, 4.601389691494262e-06,
+    -1.2378756338526919e-05, 9.0658991452330362e-06, 2.4105848284855513e-06,
+    -2.9064275878537549e-05, 5.7094897473741746e-06, 8.5473668776162026e-06,
+    -6.2127293037450571e-05, 3.1655759709092735e-06, 1.9946611686333382e-05,
+    -4.6844546903929141e-05, 1.3736744217451857e-05, 1.2934741444148301e-05,
+    -1.9990477018200226e-05, 1.0794978002992561e-05, 4.604548264529329e-06,
+    -1.7819112530931269e-05, 1.4015088794783193e-05, 3.2893113645973693e-06,
+    -1.8633206985474438e-05, 9.5545455298107207e-06, 4.3861927390836941e-06,
+    -1.7511727243624264e-05, 1.8190342239210455e-05, 2.412672568806451e-06,
+    -2.4234910731113501e-05, 3.8434866230452336e-05, 8.774970408145788e-07,
+    -4.2260781601022313e-05, 8.2357662527621223e-05, -1.3167242329387152e-06,
+    -5.4021913301893765e-06, 2.498945106205186e-05, -2.8537822919505462e-06,
+    -3.7365444270354153e-06, 0.00010598446829451769, -1.844559377135041e-05,
+    -6.4059017265138962e-06, 2.4424679611390054e-05, -2.4162501800970015e-06,
+    -2.3719949790973471e-05, 6.4742575994758411e-05, -4.1745405044285588e-06,
+    -3.6809519234404231e-05, 5.1392447972919975e-05, 2.6374614003066288e-06,
+    -1.3436155737178712e-05, 1.4474796247276878e-05, 1.7586876268071983e-06,
+    -2.3032128719374656e-05, 9.0887551786877907e-06, 5.9361711205463408e-06,
+    -1.0057879367059153e-05, 1.4369245546264064e-05, 6.5963824885661992e-07,
+    2.2569010672546241e-06, 1.727841743126568e-05, -3.9581570009245004e-06,
+    2.0092427116397138e-05, 2.928830206466726e-05, -1.2095313750709602e-05,
+    7.503754477611313e-06, 1.6218247978816436e-05, -5.4982489795518674e-06,
+    4.5940760227680677e-06, 2.259007122623613e-05, -5.7185994804045959e-06,
+    -8.0701874665134454e-06, 2.1488477904285652e-05, -1.3198163157993048e-06,
+    -1.0403750409671009e-05, 1.6176875838824767e-05, 4.3998730048927515e-07,
+    -4.5117795599125543e-05, 5.6738491752195142e-05, 4.4009244901527245e-06,
+    -2.0738450671214936e-05, 2.0384700796405308e-05, 3.0814541016194186e-06,
+    -8.1916280648408613e-06, 1.3415404602479253e-05, 2.2012914651509119e-07,
+    -5.3515132006354271e-06, 1.9011509607869126e-05, -1.7611949825954709e-06,
+    -1.0453213391270477e-06, 6.3452802661179142e-05, -1.1450028758068498e-05,
+    -1.0909048967777668e-05, 1.5893478430895058e-05, 6.6070906594439816e-07,
+    -1.922265873086082e-05, 2.1235721951395892e-05, 2.4229003326159404e-06,
+    -1.9694701185596353e-05, 1.4967068050097954e-05, 3.7449810487977242e-06,
+    -2.7224447652046679e-05, 3.0754774008379115e-05, 3.3049413306132647e-06,
+    -2.2024368890233292e-05, 6.7693360995102481e-05, -5.2894358675142916e-06,
+    -1.7119789288644327e-05, 6.8442691941339451e-05, -7.0551392318193851e-06,
+    -1.1865078084261071e-05, 6.7386420094073252e-05, -8.6014506609638497e-06,
+    -6.5624704726485739e-06, 0.00015639721537780149, -2.6921549808343881e-05,
+    1.1217880800384883e-06, 4.6647181894676759e-05, -9.051682083358048e-06,
+    5.4798028646663166e-06, 2.1077686165327236e-05, -5.7409335741248624e-06,
+    2.4022488777281081e-05, 3.5467602846561697e-05, -1.4574475734677184e-05,
+    2.4270300016920876e-05, 1.9597640528501437e-05, -1.1704497091105659e-05,
+    2.1048021272368489e-05, 2.1790609609384504e-05, -1.1042383469127282e-05,
+    -8.0822234405086846e-08, 1.7958015828378748e-05, -3.312927715347358e-06,
+    -1.1885087798063632e-05, 9.3472856922960368e-06, 2.2087906454693051e-06,
+    -3.7149298839023182e-05, 2.1203068797270852e-05, 8.3945205334029493e-06,
+    -4.565491986074921e-05, 3.0440317669688799e-05, 9.501196819632074e-06,
+    -6.6370890087485979e-06, 8.2851145801754456e-06, 6.6297752219363071e-07,
+    -9.0634603024386529e-06, 2.0929581936779407e-05, -8.8404701781286121e-07,
+    3.1981970018413186e-06, 4.1801175345357322e-05, -8.8418074030843785e-06,
+    -3.3300651762491196e-06, 2.6140929326512463e-05, -3.7583537427499092e-06,
+    -4.0136415933034186e-06, 6.7765099684036212e-05, -1.1277593163799837e-05,
+    -1.353254590685804e-05, 3.8429700668085598e-05, -2.6542566170031923e-06,
+    -1.0748832277335252e-05, 6.1990704084524673e-05, -7.9648493808773257e-06,
+    -1.0833018031675135e-05, 4.1940408341545332e-05, -4.2047874521250472e-06,
+    -9.7470318622949748e-06, 2.4546451276530323e-05, -1.3280648120048144e-06,
+    -9.6999424725741079e-06, 1.2571751500323192e-05, 8.8547385787562938e-07,
+    -9.1698611993096257e-06, 6.8678980318370719e-06, 1.7710693655317855e-06,
+    -5.6614044627312232e-05, 5.831535065919935e-05, 7.9716733998175249e-06,
+    -1.8734915633034088e-05, 2.7515632545327406e-05, 1.1075013285621882e-06,
+    -3.4337723491539851e-06, 1.207935489361267e-05, -1.1076331523571237e-06,
+    -3.9635395590320588e-06, 1.7783480649458117e-05, -1.9938948241371435e-06,
+    9.2297522333306681e-07, 2.4519432139602504e-05, -4.8744559451724401e-06,
+    -2.4186509356149966e-06, 1.2647410666366543e-05, -1.5510981364943999e-06,
+    2.3289593430453337e-06, 1.1304603006523362e-05, -2.8807690350893256e-06,
+    1.4866415079833883e-05, 1.0321348524466867e-05, -6.8697147969781769e-06,
+    1.1112382474282034e-05, 1.8219600282753934e-05, -7.0915456784753639e-06,
+    -1.471537116023991e-05, 4.1765898645518273e-05, -2.8813491594475993e-06,
+    -8.685070063602085e-06, 1.314004190383633e-05, 4.4335345988910646e-07,
+    -3.2381968038452946e-05, 7.8783559543382786e-06, 9.3113599076155573e-06,
+    -9.2462002842214064e-05, 8.4253847500714851e-05, 1.5081122290663829e-05,
+    2.8540166503221442e-05, 0.00093768649144787553, -0.0001843014761950465,
+    5.5354247937733358e-05, 0.00010881351031910569, -3.8771762090980544e-05,
+    4.2923229155056308e-05, 0.00049539308776241908, -0.00010664455209925816,
+    -1.5265465357294783e-05, 0.00047877690340225598, -8.4071422050510658e-05,
+    4.0775327560083063e-05, 0.00011049261520867937, -3.4254800260806462e-05,
+    0.00023301516513052345, -0.00016011257107817478, -4.8337491527522536e-05,
+    0.00068820594331814311, -0.0001535918630266031, -0.0002021444935848063,
+    0.00057491957176150632, -0.00018706040174537586, -0.00015798945849200552,
+    0.00026088935939969082, -0.00015518989873458677, -5.8720145551575953e-05,
+    0.00018729225957761497, -0.00017383980171364888, -3.0654122461032385e-05,
+    0.00023246855164585356, -0.00029840503911732208, -2.2842622968387294e-05,
+    0.00010689593857596269, -0.0002678778921994529, 1.350477274744688e-05,
+    0.00010635045021517575, -0.00024029363472505283, 8.6217883788486382e-06,
+    5.2050535694903033e-06, -1.3072620945853153e-05, 6.6273442275027739e-07,
+    0.00012189321618907845, -0.00032138904079742625, 1.8318586256983738e-05,
+    0.00011291031948584829, -0.0002147740618243521, 1.7629427426363309e-06,
+    0.00013610949873302247, -0.00027372565653754899, 4.8411050729210703e-06,
+    0.00015085978133266842, -0.00024767707040745934, -4.8335221044040755e-06,
+    3.1026991092031331e-05, -2.2768190693300827e-05, -6.1464948727801838e-06,
+    -0.00015290734428458075, -0.0010969185210556454, 0.00025139378347491942,
+    -8.7047010076085618e-05, -0.00071255765632105561, 0.00015923965435556825,
+    -0.00020134374281310929, -0.0018059928246815238, 0.00039723010799964931,
+    -3.3992745382072087e-05, -0.00026895408026139656, 6.0472005197272083e-05,
+    2.4674711142286254e-05, -0.0010525472835967165, 0.00018495252102614101,
+    4.080574994436148e-05, -0.00038745061774247969, 5.7720158860290194e-05,
+    6.9491841030611123e-05, -8.5074595687684162e-05, -7.072102575639283e-06,
+    0.00024143112111643661, -0.00021470431825504344, -3.9388736162798699e-05,
+    0.00017556613475283589, -0.00017365105009886639, -2.5437269040598509e-05,
+    0.00019387650448024485, -0.00015739339612824699, -3.4371890391092508e-05,
+    0.00064100808789963049, -0.0005691310274807404, -0.0001047439515375892,
+    0.0013083633502747882, -0.0011743624109711304, -0.0002114826233218306,
+    0.00018257367717974815, -0.00030185958036582639, -4.6274162802395491e-06,
+    0.00065563004985430551, 9.1876188625938937e-06, -0.00021352962328319985,
+    0.00052113401710654483, 5.4392615632670172e-06, -0.00016939182932962371,
+    0.0033539691053832976, 1.1176932940171191e-05, -0.0010859292289553055,
+    2.0554139161771401e-05, 1.2041705064746999e-06, -6.8536254900150584e-06,
+    0.00011198906515288987, -8.2276955585325329e-05, -2.1799015771734043e-05,
+    0.00023653943728707549, -7.0506523566049584e-05, -6.4098982296173501e-05,
+    9.694187935332943e-05, -3.0943478505518485e-05, -2.5912516146996134e-05,
+    0.00015241793371123524, -4.4650730544437689e-05, -4.1439134245008225e-05,
+    0.00028030606892248677, -0.00049328959453887045, -4.5498731396850789e-06,
+    0.00071235795475776964, -0.00011198026594877453, -0.00021016529600859785,
+    0.00045506473248713153, -0.00013015360331469772, -0.00012410658242741068,
+    0.00058856664385564805, -0.00023929198888977821, -0.0001482660297324398,
+    0.00051485113671637106, -0.00036816102925302241, -0.00010238058689061857,
+    0.00024877259540609375, -0.00014825547430752373, -5.4549100164578979e-05,
+    1.3494983423872897e-05, -8.6319292608716403e-06, -2.858196688652892e-06,
+    0.00018691832247441642, -0.00011600902214764508, -4.0196344319995414e-05,
+    0.00017565525581889063, -0.00010820394513927356, -3.791347458682176e-05,
+    2.38259569710908e-05, -2.0935388731047055e-05, -4.0743898833267567e-06,
+    0.0002338539296664055, -0.00022752973865614035, -3.6228119189719854e-05,
+    0.00013422869564963524, -0.00021328242862272973, -6.7060641244995334e-06,
+    0.00014417412896519655, -0.00024159741858609252, -5.0729038742203247e-06,
+    3.6336759694444165e-05, -7.5559795467361468e-05, 1.2162729569192843e-06,
+    6.5488698230087294e-05, -0.00012924448810108791, 1.0129215796336744e-06,
+    2.4563074651207106e-06, -4.624080602200209e-06, 0,
+    3.2088959197623668e-05, -6.3982253860395133e-05, 6.0737248762376961e-07,
+    2.3901704760437292e-05, -4.8568429634465726e-05, 6.0716180713682455e-07,
+    0.00010102211230905711, -1.7494218056191002e-05, -2.9336679138160238e-05,
+    3.686809622618914e-05, 2.9449205494747055e-05, -1.6790210997819077e-05,
+    9.4190079361067269e-05, 8.355043997898548e-05, -4.4306579229047571e-05,
+    8.7594608558672071e-05, 0.00011753013417586944, -4.7960464990594309e-05,
+    8.1753510284249264e-05, 0.00012030116283046066, -4.6560735830529498e-05,
+    0.00047702461662729734, 0.00059711968823805694, -0.00025391615650041666,
+    0.00012327056492447697, 9.245839361843311e-05, -5.5170097526410777e-05,
+    0.00015003057001053421, -4.1425071065692709e-05, -4.1165427778933061e-05,
+    3.5069071540938523e-05, 6.5912884057994781e-06, -1.2365918177555113e-05,
+    0.00029067946299499159, 4.4096534946191923e-05, -0.00010072222297333178,
+    6.9327552930376068e-06, 3.6331588286753203e-06, -2.8364947418924036e-06,
+    0.00019520990940544158, 0.00012978872912305928, -8.44927110345145e-05,
+    1.4862735405907213e-05, 7.774410788363717e-06, -6.0790226884543941e-06,
+    1.238592377852954e-05, 6.478081182925699e-06, -5.065852241081803e-06,
+    0.00010899059447119774, 0.00011014229197137126, -5.350235343880988e-05,
+    3.9196542515884669e-05, 0.0002173578288856004, -4.9073818082147336e-05,
+    -9.1483045503715221e-06, 4.0505740299234816e-05, -3.8551849654983039e-06,
+    -4.4176133599249656e-06, 1.9350078239332991e-05, -1.8264390391833918e-06,
+    -0.00010394814919229001, 0.0004438056465318474, -4.1045478750563469e-05,
+    -1.7903903775096097e-06, 6.4018749549754617e-05, -1.0173751645400908e-05,
+    1.6241520789911368e-05, 0.00010096468535597536, -2.2187303572410166e-05,
+    3.2649115604493906e-05, 7.8011061372007529e-05, -2.3621023837322452e-05,
+    3.5663430352855796e-05, 2.250410918341883e-05, -1.5274634247539054e-05,
+    0.00016082084771168459, 0.00013283870901259487, -7.4142498274941404e-05,
+    5.9392850562833832e-05, 4.8564032019748904e-05, -2.7298674141987278e-05,
+    1.3998336063220096e-05, 1.3171524095689779e-05, -6.7231952037422049e-06,
+    2.351234642616884e-05, 4.9576622730862496e-05, -1.5892867084491002e-05,
+    0.00014086245749064807, 0.00030310662194343863, -9.6235001837530199e-05,
+    2.8324558637410346e-05, 0.00016602097837431495, -3.6938046038222094e-05,
+    3.1550365716948026e-06, 1.3425973929948043e-05, -3.2665418300617532e-06,
+    3.1192726486023448e-05, 0.00013012896999492485, -3.1858556842949415e-05,
+    8.2076217487736525e-06, 3.1757342012717071e-05, -7.9673890970854977e-06,
+    6.5707638590067896e-05, 7.3277658447556959e-05, -3.3509352830189687e-05,
+    0.00018739579373386328, 0.00014589838985279435, -8.5017661966210745e-05,
+    7.0862757571149571e-05, 0.00010135908893310619, -3.9863109872063929e-05,
+    -5.9300468959466723e-06, 5.1924542694647968e-05, -6.7480368770231336e-06,
+    -2.406219037714985e-06, 1.4468360243435896e-05, -1.6361698973385574e-06,
+    -0.00023213973128213827, 0.00023572277077144044, 3.5823620350428076e-05,
+    3.6689373572179607e-05, 0.00015441877658534109, -3.771108322166844e-05,
+    0.00018081312229389912, 0.00023446008630029214, -9.7827839940833883e-05,
+    6.6628102781435272e-05, 7.9403182371540204e-05, -3.4881116252473421e-05,
+    0.00018464377820848199, 0.00036554385390896726, -0.0001209458302758315,
+    2.4120653133119507e-05, 5.1592771906472379e-05, -1.6439690001313068e-05,
+    0.00012104563669548818, 0.00031297900218696384, -9.1510427483308676e-05,
+    7.1095288891237507e-05, 7.3605843513291358e-05, -3.5395164030595228e-05,
+    7.7348543089744703e-05, 7.872747169562766e-05, -3.8283292144510039e-05,
+    2.9537498601184264e-05, 5.2321276737821165e-05, -1.832175998544433e-05,
+    5.5153514801897785e-06, 2.8162104912521357e-06, -2.264692558776038e-06,
+    9.1946289180189211e-06, 2.0371709940625315e-05, -6.3825590695398837e-06,
+    5.6422105596254379e-06, 8.7592747947673466e-06, -3.2943969772297743e-06,
+    2.3365692435384222e-05, 3.3481465143314626e-05, -1.3178468313286562e-05,
+    0.00012115443312893381, -2.4401802699414166e-05, -3.5411555401161643e-05,
+    9.3994125971719189e-06, -1.084174120036252e-06, -2.8816894769995161e-06,
+    2.4395910169727753e-05, -3.2333857165056656e-06, -7.4096695886691211e-06,
+    3.7111617034096822e-05, -4.1810422482302378e-05, -5.1446459903847774e-06,
+    2.746734526115624e-05, -2.9096253573168696e-05, -4.1146755359600107e-06,
+    0.00010962094836944325, -8.125656698498851e-05, -2.2209488168681291e-05,
+    0.00015728343152482394, -6.0917135703886238e-05, -4.1100793898032895e-05,
+    2.2003319211788552e-05, 1.4085803928809426e-06, -7.3954219600505522e-06,
+    0.00010273041612954281, -8.4333694941318704e-06, -3.2041315217910815e-05,
+    0.00013722214853498227, 6.3886569072135746e-05, -5.5241751309872966e-05,
+    4.9968355767843198e-05, 4.6914902659511704e-05, -2.4028000816155026e-05,
+    5.4769753051908676e-05, 6.108033498025689e-05, -2.7933721484622864e-05,
+    8.6641673600895697e-06, 1.0268745870956053e-05, -4.519122191522229e-06,
+    0.00013699461681154768, 0.00010665788679886656, -6.2247178025803818e-05,
+    5.1751341446387711e-05, 2.230928875640581e-05, -2.0545292863202724e-05,
+    2.2579474177525372e-05, 1.1437462399011e-05, -9.2452934737641268e-06,
+    2.3584274106924763e-05, -1.5445116409440462e-05, -5.1359305624706919e-06,
+    4.7307678016306198e-05, -2.4952958318003038e-05, -1.1296941611914357e-05,
+    8.1126426624555936e-05, -0.00010173489240411504, -9.6492291026401e-06,
+    2.6728278927745652e-05, -3.5375167391327178e-05, -2.8728922247880928e-06,
+    2.8766872675473065e-05, -0.00018497567857644892, 2.1123443875108172e-05,
+    3.08639925766796e-06, -1.6044347057542208e-05, 1.639784991222526e-06,
+    1.246417065733918e-05, -3.4698617690787081e-06, -3.4843097038994575e-06,
+    3.5239919881330239e-05, -3.676254783480104e-06, -1.0862016283627596e-05,
+    1.8264150807023594e-05, -2.4912923824449429e-06, -5.5330298968578329e-06,
+    4.6118817752932584e-05, 2.334136883302973e-05, -1.8852745695803474e-05,
+    0.0002099573521086584, 0.0001276532579722045, -8.9350315572958583e-05,
+    6.3344361167616547e-05, 3.7849019774272019e-05, -2.6847881905871229e-05,
+    1.4925310449914742e-05, 2.9038471125342191e-05, -9.6330915188985733e-06,
+    0.00011829979571348348, 0.00018475968252024133, -6.8891065601088541e-05,
+    1.946974975747251e-05, 3.1308286585651768e-05, -1.1485964986013286e-05,
+    1.4351778473309373e-05, 5.0223420746176028e-05, -1.2923750094512299e-05,
+    2.1630958356444463e-06, 6.9520806118550382e-06, -1.8464707634835431e-06,
+    -2.3552572420981743e-06, 4.6763587442377741e-06, -6.9388939039072284e-18,
+    1.340040815223098e-05, 8.862873088766321e-07, -4.5137247040583084e-06,
+    7.4654985355637749e-05, 3.1722671716194473e-05, -2.9543531906026099e-05,
+    0.00010741522065488285, -2.2154512536065596e-05, -3.1383698057919907e-05,
+    8.5978351419546684e-06, 4.1691198732207724e-07, -2.8711479198792467e-06,
+    0.00010107251362748149, -8.5926625745025298e-05, -1.8861045625123696e-05,
+    7.7684117439330569e-05, -6.4483048546171151e-05, -1.4752133861664629e-05,
+    3.0115267636576792e-06, 1.5134681017325846e-06, -1.2290327228228759e-06,
+    4.0770276906743064e-06, -1.8577624945614879e-06, -1.0241841314415079e-06,
+    0.00031172606288995541, 0.00029699961063306413, -0.00015019565654403322,
+    0.00028934268264133034, 0.00036131608671480242, -0.00015340347711895186,
+    8.6831725006980554e-05, 9.7952465582973325e-05, -4.4327800892467184e-05,
+    0.0001826906822340324, 0.00019439699570511504, -9.1358841333127883e-05,
+    1.1029788054561784e-05, 9.3903761111402417e-06, -5.1338692575106371e-06,
+    -0.00010811414684119836, 0.00021717841001178684, -6.9388939039072284e-18,
+    1.2754662341574186e-06, 8.8365586941530072e-05, -1.4808517862494042e-05,
+    7.8066715539226728e-07, 0.00013489837017638395, -2.2224870008406838e-05,
+    6.7520421835109978e-05, 0.00013102803259029683, -4.3445480462346586e-05,
+    4.1988719891555837e-05, 8.1275466813579555e-05, -2.6983688533918637e-05,
+    -4.4402922660391475e-05, 5.3946943483762499e-05, 5.7694323805715375e-06,
+    -0.00013277286616206196, 0.00016595014740700131, 1.6496517411958289e-05,
+    -6.4850458468906913e-05, 0.00016851463139350153, -6.192744152214158e-06,
+    -1.4731812373464104e-05, 0.00029083614675867731, -4.2575395720063913e-05,
+    -1.2443738617862188e-06, 5.1991874416734696e-05, -8.0673023206065397e-06,
+    5.8598453491820468e-05, 0.00026284984149749224, -6.2099590356863577e-05,
+    0.00011878526151248847, 0.00036068872356381787, -9.7831217246824309e-05,
+    4.3559395505543552e-05, 0.00012473053997780204, -3.4648257008995653e-05,
+    7.9116914847160436e-05, 0.00017534932538304515, -5.4597711828932582e-05,
+    3.4381582831422008e-05, 0.00015126250914826445, -3.5937801429700156e-05,
+    -5.9214752274910909e-05, 0.00012258798973563412, -4.1575595941673038e-07,
+    -3.0137054967321886e-05, 6.4924991807879806e-05, -6.2398624930959379e-07,
+    -2.2415006506182333e-05, 4.9272908989983488e-05, -6.2419944577701836e-07,
+    9.2486815156611613e-05, 0.00052031469743307746, -0.00011521085612931081,
+    9.6428999006858973e-06, 6.5044682751647098e-05, -1.3768238995723325e-05,
+    3.0483929286673206e-06, 6.1796466501062852e-05, -1.1059560550870373e-05,
+    1.408727108959118e-05, 0.00031420242214391658, -5.5765017377071291e-05,
+    1.760181609411493e-06, 6.6984111468104679e-06, -1.6721359261187563e-06,
+    1.0576960916997002e-05, 3.6307817530778497e-05, -9.406610194280518e-06,
+    2.6054869057240415e-05, 5.7516104770616305e-05, -1.7980394635755403e-05,
+    0.00013802793857481399, 0.00032624224768063037, -9.8755918813725474e-05,
+    0.00017245998613357738, 0.00022432246662268396, -9.3615899342633369e-05,
+    0.00025531948154902673, 0.00026064115715296321, -0.00012700069688473259,
+    4.5166389316259048e-05, 0.00014434199034313311, -3.8375805094019444e-05,
+    1.1123863031453629e-05, 0.0002325554554196696, -4.134678342498227e-05,
+    -2.4282747887016676e-05, 0.00019393651416294011, -2.3321449904939451e-05,
+    7.9388954301040648e-06, 0.00018630373421396618, -3.2807025112650823e-05,
+    7.0276402565100371e-05, 0.00015835126323393567, -4.9036749268274726e-05,
+    -8.4302589115348159e-06, 0.00010844295362333334, -1.474054346221193e-05,
+    -0.00012151026605056181, 0.00014083328048514199, 1.7702072180075801e-05,
+    -0.00012918042720275191, 4.9770786609781847e-05, 3.5009198524615925e-05,
+    -1.4812268451763755e-05, 4.4425700360672948e-06, 4.2192468158661067e-06,
+    -6.6725899545566625e-05, -1.1101991215567431e-05, 2.4051631129645701e-05,
+    -2.480283406985917e-05, -6.2437758450717418e-06, 9.2836974688939589e-06,
+    -0.00012412012865481437, 5.2171582158977436e-05, 3.2924376782685061e-05,
+    -2.5290586004395044e-05, 9.0391437744807845e-06, 6.9670338527227926e-06,
+    -0.00013590882582173447, 0.00020365215879203369, 1.225373144972397e-05,
+    -3.6975324074900451e-05, 5.7702913934587485e-05, 2.9602741197093385e-06,
+    -0.0001020442686919254, 0.00014442993611341048, 1.0579316088880908e-05,
+    -8.4970391741517881e-05, 0.00011974139789161509, 8.894268945965067e-06,
+    -9.4430352123586747e-06, 1.2872109784400898e-05, 1.0592991564264964e-06,
+    -1.4450658137349359e-05, 0.00027834403908938432, -4.0494867535406653e-05,
+    -1.9694526635721799e-05, 0.00010300035943716646, -1.018651600688536e-05,
+    -3.1829981048780986e-05, 0.00015144117252707812, -1.4015922076698883e-05,
+    3.5839804846116152e-08, 1.1663614365442498e-05, -1.9120868124875012e-06,
+    6.9943947216266622e-06, 2.4754488082201487e-05, -6.3741306756195937e-06,
+    6.5460447392834409e-05, 0.00025307334189256236, -6.3140868580877085e-05,
+    0.00012898256183949131, 0.00025081738752641414, -8.4058282098661841e-05,
+    8.1476955989784328e-05, 9.3816196260976259e-05, -4.2586081403894749e-05,
+    -2.7714461418887337e-05, 0.00014366565348594706, -1.4060579601425649e-05,
+    -9.4619976224452618e-06, 5.1124953122649863e-06, 2.3443734568015517e-06,
+    -3.5998451050817115e-05, 3.1042346000820231e-05, 7.0341077587424139e-06,
+    -7.8920845630520153e-05, 6.4543405096317841e-05, 1.5992443666068556e-05,
+    -4.2923746967793441e-05, 3.3499654344515406e-05, 8.9591626236604216e-06,
+    -3.3729232309875901e-05, 2.6318121171209352e-05, 7.0409884334182715e-06,
+    -0.00014357478319670935, 0.0001243387026810816, 2.7966538031151678e-05,
+    -1.249789409812907e-05, 1.5275101357570264e-05, 1.7087667051607358e-06,
+    1.8312591933411504e-06, 6.7083706730697301e-06, -1.7088785186289424e-06,
+    3.6734982483882517e-05, 0.0001943342623361155, -4.4022952286122685e-05,
+    -5.8641218953353613e-05, 0.00016165225615177858, -6.6306647720365541e-06,
+    -5.0300562112720604e-05, 0.00013660096245809994, -5.3518312624206699e-06,
+    -0.00015060853617673842, 0.00016362042837131385, 2.3999150660772295e-05,
+    -2.0542781120014286e-05, 8.7022647635548456e-05, -7.2913041916158883e-06,
+    7.1497860386793288e-05, 0.00012580155089392253, -4.4625803240896933e-05,
+    5.6739950499151703e-06, 2.7482144976387346e-06, -2.3605356625697183e-06,
+    -7.2942851000179498e-06, 6.2401503790388002e-05, -7.7266138072060175e-06,
+    -1.6087793696273334e-05, 0.0001647933960862713, -2.1475121353295434e-05,
+    -1.5605895015119442e-05, 8.3580320714815581e-05, -8.380605717020484e-06,
+    -1.90097162121039e-05, 0.00010907633727813559, -1.1394757945738798e-05,
+    -9.1914871128973008e-06, 4.4024886800941854e-05, -4.0865492759306621e-06,
+    -3.7129291159954114e-06, 1.9531114823057028e-05, -1.9360583034394585e-06,
+    -4.3026442911126006e-05, 0.00022735087297276468, -2.2601961387445912e-05,
+    -1.0212932875314218e-05, 1.0570787948305238e-05, 1.7231443168938543e-06,
+    -6.4566272076571618e-05, 7.1526399677945829e-05, 1.0126345337896359e-05,
+    4.2255238891231173e-08, 6.9814511905852417e-05, -1.1423797396034607e-05,
+    -8.2161194651236835e-05, 3.0055778732829275e-05, 2.2855244133423991e-05,
+    -6.9582945153412457e-05, 2.6436144092367719e-05, 1.9195757978485162e-05,
+    -2.892383548594446e-05, 5.5805228739491675e-05, 6.4724953720979306e-07,
+    -3.5736625811910727e-05, 7.3836930892134944e-05, 6.9388939039072284e-18,
+    -5.6977776517280754e-05, 5.9677254067469487e-05, 9.5007147228390321e-06,
+    -5.7777992001517564e-05, 5.7348491941389135e-05, 1.0152686549178003e-05,
+    -3.885318392271575e-05, 7.2327905803470927e-05, 1.2966354152807447e-06,
+    -2.1603060355535053e-05, 3.8018822735186308e-05, 1.0808907499326725e-06,
+    -4.1603547433488597e-06, 0.00012208839775346148, -1.859900174509127e-05,
+    -4.9332014109559896e-06, 0.00014885048398238787, -2.2723049854719846e-05,
+    -7.9845680231088734e-05, 0.00016107299299600308, 6.49775219789539e-07,
+    1.7234476538618981e-05, 2.3847973736834671e-05, -9.7516459652072229e-06,
+    1.785960341252335e-05, 3.5780281023078953e-05, -1.1919893887914201e-05,
+    2.14923029805969e-05, 3.7533197642214411e-05, -1.3438715266302081e-05,
+    3.5831709370187648e-05, 0.00010842672446126356, -2.9920435985347771e-05,
+    3.1103698383827538e-06, 1.502794547747488e-06, -1.3011719030564528e-06,
+    -4.822342138466329e-05, 8.5249165705625352e-05, 2.3861007925549127e-06,
+    -3.796544529421908e-06, 7.8575189835783377e-06, 6.9388939039072284e-18,
+    2.5800163840128398e-05, 0.00018496383368077352, -3.9073326402676301e-05,
+    1.6386966584458484e-05, 0.00016488392841751409, -3.2586744279132496e-05,
+    -0.00011413443649302413, 0.0003693162925830773, -2.1754667847519171e-05,
+    -1.0390122061887386e-06, -5.0106388005399793e-07, 4.3553429807108301e-07,
+    -0.0001039531936260496, 8.9376445800315452e-05, 2.069476429878564e-05,
+    9.8974607515289748e-06, 0.00010166225669261397, -2.0052547234007678e-05,
+    -7.1513890828600601e-07, 5.4681761931796302e-06, -6.5404754778092267e-07,
+    -2.3608665611074553e-05, 1.5741875406261041e-05, 5.4508242610940005e-06,
+    -6.0565933150208418e-05, 4.0544437556022661e-05, 1.395733307385516e-05,
+    -1.5276460674534809e-05, 0.00013796348885025678, -1.7455611343981936e-05,
+    -5.1237172051049606e-05, 6.636104063079129e-05, 6.5495422479147636e-06,
+    -6.1097915328711672e-06, 8.6794996931316426e-06, 6.5511447089328101e-07,
+    3.766755714812442e-06, 8.1262161613970818e-05, -1.4634063485979842e-05,
+    1.2822629260889062e-06, 6.6496623467748872e-05, -1.1361711870522262e-05,
+    1.806811202320624e-07, 1.558748189400827e-05, -2.6224416211917401e-06,
+    -3.8347082718381831e-06, 3.964045140802952e-06, 6.5564367521947498e-07,
+    -6.2695236620613493e-05, 8.215341827955136e-05, 7.869938038897184e-06,
+    -1.2330827935114197e-06, 5.2182772690145818e-06, -4.3734180962817781e-07,
+    6.0277922801776906e-06, 7.2657480336191238e-05, -1.3997454896684525e-05,
+    4.14833902634415e-06, 6.5935048836451848e-05, -1.2251670177640395e-05,
+    4.3182495833793411e-05, 0.00016609342555345963, -4.2026641847520141e-05,
+    -4.1892439262836145e-05, 4.5690579488832928e-05, 6.7889611462118582e-06,
+    -3.4227315635154687e-05, 3.7757884547739984e-05, 5.4765328380279588e-06,
+    -2.8123206844199444e-05, 2.9073855319861064e-05, 4.8204590771330769e-06,
+    -5.0359596128146666e-05, 0.00011522451282069968, -1.7536532210121747e-06,
+    -3.0243940778218459e-05, 6.6796463239593429e-05, -6.5796525346856205e-07,
+    -5.7982219682201075e-05, 2.4376436650763722e-05, 1.5796182720240193e-05,
+    -1.618391384919371e-05, 5.225979102135847e-05, -3.07230001952985e-06,
+    -4.8624188579204919e-05, 0.00017030367892179044, -1.1418280185540586e-05,
+    -2.929047311472921e-06, 1.4086942001667602e-05, -1.3181486427718547e-06,
+    -2.0648805012513094e-05, 8.6914586398312288e-05, -7.2517515132819454e-06,
+    -3.2812956165778617e-05, 0.00014691739884059585, -1.2973242820582542e-05,
+    -0.00014512738621244581, 0.00014513814326277963, 2.5749665494324836e-05,
+    -7.192199311459313e-05, 9.3214343060532556e-05, 9.2509887895664278e-06,
+    -7.1125044383807401e-05, 9.5533742773046271e-05, 8.5954515138125798e-06,
+    -0.00014453274550799144, 0.00017833701426500648, 2.0074010271764475e-05,
+    -6.9247100356883973e-06, 6.3496104729110492e-06, 1.324369102592704e-06,
+    -0.00016377583270077434, 0.00018067283022282776, 2.6283400477847274e-05,
+    -1.4091160023682603e-05, 1.4518638652816218e-05, 2.4311738731214172e-06,
+    -5.3755445785702571e-05, 5.9331919070981787e-05, 8.6217894448292753e-06,
+    -1.9324925713243291e-05, 5.0749315895326497e-05, -1.7691801390620765e-06,
+    -3.8228529771727748e-05, 9.3950567036149568e-05, -2.4336147602596614e-06,
+    -9.0467297116647583e-06, 2.2764937041785949e-05, -6.6393205487569329e-07,
+    -5.4319611271586021e-05, 0.00022764165877314779, -1.904535848704092e-05,
+    -9.9432628231366227e-05, 0.00030663837781447212, -1.6633207426397512e-05,
+    -6.1185083993220424e-06, 8.6757917370783311e-06, 6.6590377532926848e-07,
+    -6.6607120361217298e-05, 8.9956105788990826e-05, 7.9933662961578777e-06,
+    -0.00036707878651087711, 0.00050115820453117133, 4.3156691146760406e-05,
+    -0.0003998459553309075, 0.00054537545049526681, 4.7095254889190086e-05,
+    -2.0725595377413253e-05, 2.6816361374470965e-05, 2.6832904479606734e-06,
+    -5.4417672556816843e-05, 7.6443085182675841e-05, 6.0393827328794614e-06,
+    1.3255272794693296e-05, 0.00013626043426245849, -2.7303970978047321e-05,
+    3.3360919741015627e-05, 0.00033390330818366953, -6.7211496832031425e-05,
+    1.1897712006547767e-05, 9.0986985616381411e-05, -1.9285529729455575e-05,
+    1.6622643347896648e-06, 2.2113077473961962e-05, -4.2618218980480793e-06,
+    -9.1119125739391738e-06, 4.9856620034205434e-05, -5.1599620216058462e-06,
+    -4.8178646893104471e-06, 2.4801884521807871e-05, -2.4682789733013188e-06,
+    -2.2857956400751389e-05, 0.00011878868788883779, -1.1896994083132606e-05,
+    -8.1880898965047688e-05, 0.00042742183642680009, -4.2934067607934556e-05,
+    -1.3869303874869399e-05, 7.4676924489480712e-05, -7.6525370540092563e-06,
+    -7.0676995759799688e-06, 2.9526328328255413e-05, -2.4764834601204155e-06,
+    -2.4912697225709657e-05, 0.00010035123510826471, -8.1076118513406792e-06,
+    -1.8524734453601033e-05, 0.00012085363792974091, -1.3745685348329206e-05,
+    -1.7097083256867318e-05, 0.00014090232585584062, -1.75879244397395e-05,
+    3.4072100339177513e-06, 0.00011589452806393119, -2.053189205956929e-05,
+    -3.6833952512166368e-05, 8.8801591426657112e-05, -2.0316753878424354e-06,
+    -1.5447916915822812e-05, 0.00015523323140853584, -2.0555426860663362e-05,
+    -5.0234663481474318e-06, 6.7292817771236191e-05, -9.4922744283687521e-06,
+    -5.0030699502989773e-06, 4.0193894256301821e-05, -4.9734488571789859e-06,
+    4.3979987298853329e-05, 9.6625137570416353e-05, -3.143182689444024e-05,
+    -3.6314775993806503e-06, 5.6335671179075231e-05, -8.1431583649621553e-06,
+    -1.5870153529384812e-06, 2.6341148944120096e-05, -3.8461456716223918e-06,
+    -4.1525827908228674e-06, 4.2532518589710744e-05, -5.6570430495839208e-06,
+    5.3646776549121089e-06, 3.3547308559034317e-05, -7.4686138261254031e-06,
+    7.7918845738100817e-06, 6.3746289672872436e-05, -1.3355814016000056e-05,
+    6.9812049219186711e-05, 6.0571708031920135e-05, -3.4415199220920456e-05,
+    1.5980172558688333e-05, 6.5720438579552898e-05, -1.6531640030424677e-05,
+    5.6161062759102487e-05, 4.4320229285077506e-05, -2.6953588612821378e-05,
+    3.097317548206302e-05, 3.2208800546107419e-06, -1.132519085557393e-05,
+    3.0892998158033036e-05, -6.9032394639512162e-07, -1.0645005824191922e-05,
+    3.9965803554309343e-05, 7.518991369026562e-06, -1.5173835337764507e-05,
+    6.7925220089026794e-05, 1.7018974243498963e-05, -2.6495916230717675e-05,
+    0.00011139699283560511, 4.1650107280744031e-05, -4.5742190793215953e-05,
+    8.9912335268227395e-05, -2.0876521982793328e-05, -2.7848008412399705e-05,
+    2.8380567078767349e-05, -7.7220135241695687e-06, -8.6017386351153191e-06,
+    3.1443493529792477e-05, -2.3667768345392304e-05, -7.0162243489824139e-06,
+    6.5413002895753358e-05, -2.6793655296564189e-05, -1.8328570733014415e-05,
+    0.00010927898638102285, -5.6152212355886633e-05, -2.8726213060679961e-05,
+    9.0336546077762758e-05, -1.1062480550216858e-05, -2.961971891009274e-05,
+    4.9986421624015343e-05, 3.5425181707293696e-05, -2.3286468908208235e-05,
+    2.2320679622739314e-05, 7.4432137054492031e-05, -2.0124868247865801e-05,
+    5.2025600224381296e-05, 7.8899870655957383e-05, -3.121346352737836e-05,
+    4.8832755427830055e-05, 8.7023192113511172e-05, -3.1448323165240988e-05,
+    8.7375582172588562e-06, 1.5752917625899698e-05, -5.6571709746017218e-06,
+    4.6031407543001279e-05, 5.4745234532083131e-05, -2.5120451417261214e-05,
+    7.0961818795511888e-05, 3.3727634818403462e-05, -3.0327921123507462e-05,
+    1.5887877035658526e-06, 7.5490636136654743e-07, -6.7898331491261787e-07,
+    -1.1557016868501968e-06, 5.1622924626237854e-05, -8.1487944636193799e-06,
+    -1.5398320477061356e-05, 5.8381676156959994e-05, -4.3019388219767141e-06,
+    -6.5737522292330652e-07, 5.4844365097173053e-06, -6.7936711833221919e-07,
+    5.2617101502505648e-06, 1.2160409566142061e-05, -3.8498862135055711e-06,
+    3.2316792915570991e-05, 1.5347802717391446e-05, -1.3814609771581332e-05,
+    5.0458645587725393e-05, 1.8159375792303756e-05, -2.0608400653557291e-05,
+    1.3378947217590476e-06, 1.2226743520638017e-05, -2.4911591431642233e-06,
+    1.2555955935272811e-05, 5.4256113041883935e-05, -1.3363543963897107e-05,
+    2.3134958480747203e-05, 6.8929017001451154e-05, -1.9483906301270837e-05,
+    7.9572570326202907e-06, 3.6612561583271308e-05, -8.837601707334386e-06,
+    5.954025636839555e-05, 0.00016342664975493859, -4.7832486002652441e-05,
+    0.00016195669256871548, 0.00019831807445724881, -8.9371198083304515e-05,
+    3.3122873523472318e-05, 7.5510225184538537e-05, -2.405423732956824e-05,
+    7.7139535738512954e-06, 0.0001059593656446145, -2.0204141911492335e-05,
+    2.1699557714249806e-05, 6.816101925971596e-05, -1.8849124658097682e-05,
+    3.482121764736279e-06, 2.2877175050228793e-05, -4.9970779981353686e-06,
+    3.2849658598121945e-05, 0.000102365556251649, -2.8399662868577868e-05,
+    4.6383873204269843e-05, 9.7153921129078391e-05, -3.2274244501688532e-05,
+    1.6141529266239241e-05, 3.4630089785325779e-05, -1.1366887676458881e-05,
+    1.0501818295538534e-07, 3.9089294605609837e-06, -6.8206247701846356e-07,
+    -1.809184948733944e-05, 8.7951591769552806e-05, -8.1866691016771465e-06,
+    -7.514807047193095e-07, 5.9463494757272528e-05, -9.5546028065426891e-06,
+    2.2441264530825844e-06, 0.00013998106785323428, -2.3897599115946244e-05,
+    2.1955189291600341e-07, 2.7114932607485986e-05, -4.5536882987348704e-06,
+    -3.6673066859949088e-06, 0.0001333235739298666, -2.0727124152249143e-05,
+    4.12381660229999e-05, 0.00010429825965718731, -3.1676374787507899e-05,
+    8.1846964289949975e-05, 0.00021016351588865056, -6.3390698436319171e-05,
+    4.951593548938038e-05, 8.6909706228099903e-05, -3.1712762645588755e-05,
+    4.4200273245115218e-05, 7.4751187906840766e-05, -2.7841865678925048e-05,
+    7.3821865202439163e-06, 1.8891227938744315e-05, -5.7062247107442232e-06,
+    2.0785995670014046e-05, 6.3742857819792942e-05, -1.7806304992561139e-05,
+    -1.4069537072003424e-05, 8.4011607261347265e-05, -8.9061569481588276e-06,
+    -2.8474925671623241e-05, 6.7611340046180857e-05, -1.1422721644602229e-06,
+    -2.8191419012779662e-05, 9.4734960349507347e-05, -5.7138782127708065e-06,
+    -4.6662811878428467e-05, 0.0001535432383150126, -8.919541923724239e-06,
+    -4.9536675109929096e-06, 1.888226992358133e-05, -1.372866427415409e-06,
+    -4.0042684295860109e-06, 1.5471958830282073e-05, -1.1441581694165981e-06,
+    -1.0439182457605556e-05, 3.7514883506450936e-05, -2.5174985760767488e-06,
+    -4.8737674945287246e-05, 0.00019690478751904772, -1.5343224082316198e-05,
+    -1.6923587729422707e-05, 4.0256401983906898e-05, -6.8743901616291625e-07,
+    -5.7230151147280584e-05, 0.00013316173710870016, -1.8340595740601318e-06,
+    -6.7626735147707784e-05, 8.5877179718474306e-05, 9.6350369429357152e-06,
+    -5.4341107145500223e-05, 0.00016728766534235273, -8.4941405706570605e-06,
+    -0.0001322082694949489, 0.00016932470001324029, 1.861363076334499e-05,
+    -1.5065765906902007e-05, 2.3777875231667522e-05, 1.379628161581048e-06,
+    -7.739814289947633e-06, 1.371966841728911e-05, 4.5992756833590498e-07,
+    1.1898498300244587e-06, 4.4137623191331521e-06, -1.1498755887323631e-06,
+    5.9371195262142296e-05, 0.00014735174745256208, -4.5318087444748412e-05,
+    -8.7677270741881586e-05, 0.00026923410848472829, -1.3585981165582794e-05,
+    -5.8586892410700253e-05, 0.00010554075187241274, 3.2271127247129883e-06,
+    -6.3034848382798048e-05, 0.00011502092862392121, 3.2291921703911375e-06,
+    -8.7715696540785482e-05, 9.3815727495394352e-05, 1.5464014696334183e-05,
+    -6.8134572934586135e-05, 7.9859660689240997e-05, 1.0854099698504038e-05,
+    -6.0535976994180452e-05, 0.00015281531620997546, -3.9286183038458877e-06,
+    -0.00010690206072447306, 0.00013878678005058154, 1.4802781403894238e-05,
+    -5.3127681214903966e-06, 7.1471502939846054e-06, 6.9419959223410155e-07,
+    3.5071422218091453e-05, 6.4633444956940789e-05, -2.314308538009513e-05,
+    6.4930902285181835e-05, 0.00010559198030030137, -4.0511970042747536e-05,
+    3.1481680577011284e-05, 2.6305759005806895e-05, -1.5513412702970741e-05,
+    9.1793531790618221e-05, 0.00013352418073536709, -5.4657182714051844e-05,
+    0.00010503011939330675, 0.000295674788061695, -8.6221817214890417e-05,
+    0.00012859629438968789, 0.00012934035891370987, -6.703316426444339e-05,
+    0.00012096207601372533, 4.4824131326726135e-05, -5.0339593605751298e-05,
+    3.1027378325110266e-05, 2.6004022593728582e-05, -1.5310660138524723e-05,
+    0.00017758772294892977, 0.00015770689654170944, -8.9098067606735443e-05,
+    5.7872688338955758e-05, 0.00011734919524702958, -3.9923810959768824e-05,
+    -2.8644450709963687e-05, 7.7142785398165437e-05, -2.5543366599864448e-06,
+    -4.0119755394363299e-05, 0.00011030081207769049, -3.9496163456789746e-06,
+    -3.1926823335637344e-06, 1.3912307609220687e-05, -1.1620399673409332e-06,
+    -1.5117527866009839e-05, 5.6483417783026457e-05, -3.9516572394732163e-06,
+    -2.7339904600381937e-05, 0.0001912807365756497, -2.1863863881053935e-05,
+    -3.1993016320341905e-06, 3.5074792051725812e-05, -4.6544747488302951e-06,
+    -0.00019443247725439705, 0.00036385664127469575, 9.0865236532719496e-06,
+    0.00022242653758045017, 4.545736713740256e-05, -8.6750885258758681e-05,
+    0.00018116556881123125, -0.0001834374888931567, -3.4254846416094387e-05,
+    0.00016428990551028977, -0.00020088995779887764, -2.5367900139815214e-05,
+    0.00030394230815949941, -0.00036321843241088336, -4.8321039913368224e-05,
+    0.00019579616936676869, -0.00020751712703259706, -3.5477859113029753e-05,
+    0.00022967003712870415, -0.00013999834478983786, -5.8591994604811903e-05,
+    0.00057000240744539687, -0.00018508588735571818, -0.00017202461404862424,
+    0.00011325389943142583, -3.8204349520454262e-05, -3.3946259760504749e-05,
+    6.9836584015936509e-05, -2.1684323419979279e-05, -2.1238157327602147e-05,
+    0.00021524660608177038, -7.207953673282752e-05, -6.4604061079179265e-05,
+    0.0002506892802974503, 2.4706064771395919e-05, -9.292716005880608e-05,
+    0.00093976029048531418, 3.956721267084351e-05, -0.00033973732185100386,
+    0.0009996130192221897, 9.0953092868550911e-05, -0.00036926171170011818,
+    0.00020008002728780228, 9.0281167495487313e-05, -8.5460303662743264e-05,
+    0.00018646564968491375, -2.3188674936502895e-05, -6.2471418604576057e-05,
+    0.00021378639376851138, -0.00012006657816082678, -5.6686579349068955e-05,
+    0.00021983626509214371, -4.4712601269591978e-05, -7.0855810384684581e-05,
+    0.00023038492623866924, -9.4860548772168762e-06, -8.0209133770568763e-05,
+    5.4105081146060829e-05, 3.2144938187927963e-06, -1.9702338629579152e-05,
+    0.00020861706520411416, -0.00062947284207603982, 2.6071431987545468e-05,
+    0.00057870114703034714, 0.00016328828264794426, -0.00023076791108918304,
+    0.00019506239076960696, -0.00015569487187788722, -4.4474707199017305e-05,
+    0.00025715500863721097, -0.00015674157821105039, -6.6289595758224629e-05,
+    1.7164934385194286e-05, 1.911259228937201e-06, -6.3742156697840779e-06,
+    0.00026448916248131282, -4.6073238117450011e-06, -9.2853376319791681e-05,
+    0.00020379833852987583, 6.3751362916752985e-05, -8.2128153677217541e-05,
+    0.00028339639655161619, 7.4032178463134812e-05, -0.00011191019645493544,
+    0.0004513450268676944, 0.00052169029944459933, -0.00024148917486285087,
+    -0.00016590933358123783, 0.00070118145923103725, -5.0659370035045781e-05,
+    -3.1954139104978241e-05, 0.0005617185727887497, -7.6460286301864577e-05,
+    -1.1023320402064885e-05, 0.00072703409616980963, -0.00010976257403021161,
+    0.00064642454434360452, 0.00046143004311488545, -0.00030283953838200484,
+    0.00042515219050087705, 0.00030656201254425364, -0.00019965641046690991,
+    0.00049218501131809145, 0.00080984911789844238, -0.00030172132714015309,
+    1.6294471228694984e-06, 7.022616230201173e-07, -6.9299449314413897e-07,
+    4.7182697089781511e-05, 7.7341554990173478e-05, -2.8878641281024353e-05,
+    0.00053732378450291329, 0.00087452158983086781, -0.00032790769487203025,
+    0.00027763536664093813, -0.00020209665587400671, -6.8780980314986362e-05,
+    0.00083397039696928021, -0.00060832975883662321, -0.0002064123113070665,
+    0.0012850970914985438, 0.00065328096912464773, -0.00056084657906325247,
+    0.00067266808333835137, -8.13172999278855e-05, -0.00022959328615803493,
+    0.0011927188035198155, -0.00014420021783911885, -0.00040709333599753955,
+    0.00064697524452628219, 0.00071295963231698956, -0.0003387053861377276,
+    0.00014590175435397201, -0.00026457857571132726, -1.3322423753278634e-05,
+    0.00079720645614314578, -0.0014479725068329286, -7.2450623033251671e-05,
+    0.0013067645533791639, -0.0010529151238612977, -0.00031310276524675745,
+    0.00042449093912627633, -0.00067508419768408379, -5.3194670669012845e-05,
+    0.0016910508160193627, -0.0012916132519385504, -0.00041483006312934001,
+    0.00012905844709776293, -0.00010035853122875027, -3.1403590535925008e-05,
+    1.9062477563516755e-05, -1.3010858481321552e-05, -4.8977942945990782e-06,
+    0.00026596213034975336, -0.00020515510155133532, -6.4954562896700485e-05,
+    0.0003648274157794229, -0.00023509301923141379, -9.5713202170027989e-05,
+    0.00012327863508349024, -0.00016488854459328905, -2.0179319469786072e-05,
+    0.00013849654852628179, -7.9793326814014964e-05, -3.7665559206784271e-05,
+    0.00043974468880167428, -0.00029941922724047165, -0.0001130498219179335,
+    0.0017027642621985778, -0.0014612784235309428, -0.00039501966728108795,
+    0.00055002032409956492, 3.567026123835193e-05, -0.0001984670240200645,
+    4.337263238630984e-05, 2.3985393521330778e-07, -1.5292848125604552e-05,
+    0.0015665190939361945, 9.8873184298686745e-05, -0.00056487376061361422,
+    0.00024174091769142703, 0.00051536677306146528, -0.00015574665213427541,
+    0.00017567502646810562, 0.00014113738671184262, -8.1244310901333605e-05,
+    9.9123131699907496e-05, 0.00023675888535207301, -6.731181126033714e-05,
+    0.00013384902599719584, 0.0003174167685648932, -9.0581092901290128e-05,
+    0.00020968384183955857, 0.00051099684058708572, -0.00014377565201080522,
+    1.9317223742543188e-05, 0.00020937827417505384, -3.5341366910329741e-05,
+    -0.00010363183181033575, 0.00028738492935287407, -2.417772574647703e-06,
+    -0.00012371077868970903, 0.00035258965078449611, -4.1836247941795524e-06,
+    -0.00063430220202795318, 0.00089855238610192512, 0.00010255579346698379,
+    -0.00025500578266082763, 0.00010556892877428004, 7.6284003768106734e-05,
+    -0.00019104932418058385, 8.1510405980977918e-05, 5.6819367828614409e-05,
+    -4.0382862937227149e-06, 0.0007523823937969909, -0.00010210174656729437,
+    -1.7954779798351472e-06, 0.00023311357781463649, -3.1440284857436884e-05,
+    3.9526398155909082e-07, 0.00012546275892877379, -1.7407730866440818e-05,
+    0.0021547105195664912, -0.00050728506778713323, -0.00070026582088299205,
+    0.00017173609790711863, -4.3231598472859289e-05, -5.5434649129312841e-05,
+    0.00055896129702938391, 0.0013555770182316351, -0.00038235963888432617,
+    0.00057079542251817217, 0.00027669895045834281, -0.00024169006204306093,
+    0.00012337587833739783, 6.2714852585132874e-05, -5.2629219146553552e-05,
+    0.0011711786429517007, 0.00055433173839186667, -0.00049412190936012901,
+    0.00071767175401789285, 0.00033179865240240414, -0.0003017447309269089,
+    -0.00059891386632504595, 0.00043506501906009909, 0.00015829451850971066,
+    -7.3020887788807776e-05, 5.5020962685004005e-05, 1.9038584408340165e-05,
+    -0.00010348718794256362, 7.3579945773560862e-05, 2.7562985285438379e-05,
+    -1.1494582781990115e-06, 1.4373218555352452e-06, 2.2415148224347314e-07,
+    -1.0079801828571933e-05, 3.7374631831621485e-06, 3.1381920917727957e-06,
+    -0.00072991935720304046, 0.0005385977477536108, 0.00019181081343588868,
+    -0.00020554158728687544, 0.00013624504227571776, 5.6065438894491171e-05,
+    -0.00035408809584221157, 0.00021335798739824385, 9.943128248862676e-05,
+    -0.00050587612706473606, 0.0011266521179214006, 3.2145715324456703e-05,
+    -6.755135611442864e-05, 0.00013504341877418335, 6.3613234273993124e-06,
+    -0.00025912517189291551, 0.00053868744305785032, 2.1624644324209907e-05,
+    -7.9294517456585112e-05, 0.00017163695952354674, 5.7022194782999081e-06,
+    -4.4864299983543576e-06, 0.00013235163889485646, -1.6207427770136007e-05,
+    1.1809954368474651e-06, 0.00022564060652457973, -3.0843703833563496e-05,
+    -1.7333765205448937e-05, 0.00040672268856900562, -4.8510765649580068e-05,
+    -1.6674469375671519e-06, 0.00013708275942519998, -1.7872049762002185e-05,
+    -4.433168951337163e-06, 5.7905009567871257e-05, -6.1894234233417222e-06,
+    -5.076189908290174e-06, 0.00018046930471965483, -2.2478423542589276e-05,
+    -4.2776796162227737e-05, 0.0011022371798610764, -0.00013299261998300088,
+    -1.5655381229842669e-05, 0.00025647379187104802, -2.8857091736771145e-05,
+    0.00039098575612118991, 0.0015355858864923855, -0.00035044380107073642,
+    0.00020287210802405475, 0.00035816605960298231, -0.00012287044532870856,
+    2.8737218063165648e-05, 4.9460626190267476e-05, -1.7233818979486837e-05,
+    0.00021613435441096562, 0.00037005373815074405, -0.00012935595206631234,
+    -0.0004656495119038373, 0.00018734499480138611, 0.00014683093424439075,
+    -0.00019295330849466996, 7.6463036367602211e-05, 6.100004526347208e-05,
+    -0.0013613055053340595, 0.00024465432436526768, 0.000470065705263846,
+    0.00049276600668081427, 0.0013669047112783717, -0.00036846694426830723,
+    0.00021681266886297568, 0.00062895921179478842, -0.00016585801107651954,
+    6.9704262024142261e-05, 0.00019993244146576661, -5.3014464718510734e-05,
+    0.00012528826355499845, 0.00064334755829470458, -0.00013372754508134826,
+    0.0017818780406735207, -0.00022699359689698495, -0.00063408418992112053,
+    0.00066334897034445173, -9.1673579505680003e-05, -0.00023509921760084262,
+    0.0011256343355518644, -0.00027028449131405452, -0.00038375196130221306,
+    0.001360852955010608, -2.4956343115667412e-05, -0.00050350304352009267,
+    0.00057405820406307428, -8.3484812822942622e-05, -0.00020294793416428952,
+    0.00070259725800157768, -8.9900961945943436e-05, -0.00024997240961718847,
+    0.0013650016840748014, 0.0005916751254288477, -0.00058375854463244004,
+    0.00027280244960882494, 0.0001237151751199983, -0.00011735826497029367,
+    0.00034959885832158699, 0.00014564272673872614, -0.0001487685907207853,
+    0.00011013894909170374, -6.4195891232854407e-05, -3.3027804847041153e-05,
+    3.9339035207031081e-05, -1.9905763086636163e-05, -1.217652593989843e-05,
+    9.7174567970523262e-05, -5.7537465287305078e-05, -2.9027705488758604e-05,
+    7.9203449811854343e-05, -4.149923621316054e-05, -2.4336533694505058e-05,
+    3.8175267996598539e-05, -2.3995241173080384e-05, -1.1229406800865316e-05,
+    0.0001150969526207829, -6.4444793632434383e-05, -3.4846197935929635e-05,
+    0.00013697928795651515, -7.0015508718601627e-05, -4.2307596768785538e-05,
+    0.0001161491234370482, -6.4146050499425122e-05, -3.5276648551546552e-05,
+    4.3221786495670211e-05, -1.8651170578420917e-05, -1.3779063367538869e-05,
+    0.00011496603843144659, -6.6417213482217186e-05, -3.4552918622997308e-05,
+    0.00021928606284576935, -0.00010702060132944391, -6.8358350692139525e-05,
+    8.2442111868669121e-05, -3.5026694619300081e-05, -2.6348001452299041e-05,
+    0.00024380240350671545, -0.00011553671792341458, -7.6431223225009726e-05,
+    4.2611540334747122e-05, -1.5235932843749023e-05, -1.3973677520685845e-05,
+    0.00014844243845035798, -7.0143777043840672e-05, -4.6562143718655025e-05,
+    6.2175091296842733e-05, 5.7469346951999345e-05, -3.0259335911032859e-05,
+    5.8277068342993399e-05, 5.9834013199644431e-05, -2.910095242369265e-05,
+    0.00011255869525482465, 0.00010357999906274173, -5.472390632950408e-05,
+    4.1907801182544668e-05, 4.3323929633076741e-05, -2.0962940173237243e-05,
+    4.9805829007223967e-05, 4.5932956976080241e-05, -2.4227289514122674e-05,
+    0.00026124024320635375, 0.00025558001274850195, -0.00012888580549281353,
+    8.5012254340238735e-05, 7.5859815478807047e-05, -4.1041242974146352e-05,
+    0.00018102411451510758, 0.00017361607352833763, -8.8879708014466541e-05,
+    0.00010955500781711924, 0.00010036091937232205, -5.3210786972804347e-05,
+    9.0924721307394929e-05, 8.8673929241001037e-05, -4.482242188365293e-05,
+    4.9409986338233569e-05, 4.3780879556143404e-05, -2.381688312696334e-05,
+    5.7469015326466755e-05, 5.927141792733126e-05, -2.8725078423295913e-05,
+    8.2983946067566317e-05, 7.4964520784370769e-05, -4.0176964314353469e-05,
+    2.7384576959374463e-05, 3.2848937965568314e-05, -1.4251274804227831e-05,
+    6.1410289868071843e-05, 5.5004451288476197e-05, -2.9674902071237519e-05,
+    -0.00019330216219262675, 0.00072639888855535739, -1.662297012395425e-05,
+    -0.00032180545296028873, 0.0012811610991884104, -3.6480398463677177e-05,
+    -8.1098293619741302e-06, 2.6728405653875242e-05, -2.3616094276673882e-07,
+    -4.447988816402848e-05, 0.00017642620216584692, -4.9620055297752708e-06,
+    -7.5917436784533887e-06, 2.3225321754138939e-05, -6.9388939039072284e-18,
+    -0.00045016547569863563, 0.0011014602812600138, 3.3909914986515743e-05,
+    -0.00023808607264665105, 0.00054646574196282049, 2.2390647767940586e-05,
+    -0.00030392366969841933, 0.00071222140024840286, 2.6769862657351207e-05,
+    -5.4907366142553649e-05, 0.00012710402892923689, 5.0308179886590643e-06,
+    -1.3858860266030559e-05, 2.3008829220128035e-05, 2.3966131364253074e-06,
+    -0.0003436545023142723, 0.00081305566242934058, 2.9305055284277459e-05,
+    3.4721753269364997e-05, 0.00099201950099997438, -0.00013681462898523788,
+    2.3549420924348641e-05, 0.0004079386350566705, -5.9795540902005118e-05,
+    5.7592318522536878e-06, 6.7969602631889892e-05, -1.0663609952367425e-05,
+    1.5824296757130374e-05, 0.00027868497150429494, -4.0748340533705574e-05,
+    1.4523264822582926e-05, 0.00020113900884466407, -3.0595254119171467e-05,
+    1.4442832100711178e-05, 0.00043418236347392281, -5.9578857892823855e-05,
+    9.8174182095039919e-06, 0.00018304191261270253, -2.6544704471762048e-05,
+    1.3660439379115097e-06, 1.1454776765618124e-05, -1.9491135646865221e-06,
+    3.7754564050501704e-06, 1.7742925259078834e-05, -3.654825468615841e-06,
+    4.818652052693273e-06, 1.2576219708293479e-05, -3.4113921446310425e-06,
+    7.5994562936526622e-06, 0.00021166419624540911, -2.9255706401956627e-05,
+    4.5757972964730054e-05, 0.00088815821074039736, -0.00012807639642818669,
+    1.7603672183272301e-05, 0.00033771014079908568, -4.8778050234725423e-05,
+    9.7925778940050057e-06, 0.00023610402941187658, -3.3134659911553122e-05,
+    0.00038893765963610161, -0.00016432457433140923, -0.00012933057158381195,
+    0.00037684126536412232, -0.00015385203524204139, -0.00012597266575706256,
+    0.00018204908417468468, -7.5412650737238796e-05, -6.0722080421030111e-05,
+    0.00034969086098968205, -0.00014647298474040893, -0.00011643945990944676,
+    6.1214355434116574e-05, -2.4416012594785652e-05, -2.0533489943221073e-05,
+    1.5348328415917822e-05, -4.2587568973573298e-06, -5.3771443755470938e-06,
+    6.789708634596936e-05, -3.1453176878637468e-05, -2.2238553681504236e-05,
+    0.00026959874937920736, -0.00011005287750381898, -9.0123062071165161e-05,
+    0.00063282742610402953, -0.00016525534313704959, -0.00022293508700781811,
+    0.00054788121065792172, -0.00013622007705726968, -0.00019384343899961354,
+    2.5058567951846689e-05, -3.0820519041352412e-06, -9.2468190412767215e-06,
+    0.0004720665808790464, -0.00011500918198759091, -0.00016730715612535418,
+    3.2429254071944524e-05, -4.4585738461222491e-06, -1.1907919935161271e-05,
+    0.00092627850686681501, -0.00022076835972995035, -0.00032887999176258592,
+    5.6477955293204873e-06, -1.8985694818507426e-06, -1.9393606873890912e-06,
+    0.00023046164676601699, 0.0013195497318587157, -0.0002458117167750129,
+    0.00075047304485484356, 0.0011510734208285411, -0.00042597286104015947,
+    7.3028438632022352e-06, 1.1359054086501619e-05, -4.1638037835134423e-06,
+    7.820588563232922e-05, 0.00011332962143750791, -4.3607644015591918e-05,
+    7.1439936328798748e-05, 0.00011487955212236001, -4.1175554790592872e-05,
+    6.7430100158777373e-05, 0.00011362598204545105, -3.9477288266177857e-05,
+    9.5256429012036126e-05, 0.0001494364680647009, -5.44620176548688e-05,
+    8.9176748318639532e-05, 0.00015300628976749886, -5.2530013461449254e-05,
+    0.00023940451624246406, 0.00043196126731370743, -0.00014351743623526592,
+    8.8270117328023701e-05, 0.00015071983998127259, -5.1912320779397281e-05,
+    9.3590422675107754e-05, 0.00015227776553411454, -5.4158310068573579e-05,
+    0.00014218660295524377, 0.00023979652010069907, -8.3269936363823682e-05,
+    9.9584238951455628e-05, 0.00017946354291026312, -5.9668082418203039e-05,
+    5.0074999301555345e-05, 9.5260172898459228e-05, -3.0590308291819635e-05,
+    -2.0742205303972416e-05, 0.00034368192575390255, -3.2103043623957217e-05,
+    -1.15989218678475e-05, 0.00012955055376162594, -1.0630801554063762e-05,
+    -1.3958879602204988e-06, 4.6962398500993707e-05, -4.9466622861343845e-06,
+    -7.4486237468252003e-06, 9.2524998123455493e-05, -7.9173114180958182e-06,
+    -1.9582530550427135e-05, 0.00032577541579931202, -3.0462748256965266e-05,
+    6.1794538638859642e-08, 2.7351688352994508e-05, -3.2223633718089784e-06,
+    -3.6534341079599852e-05, 0.00054843178311109186, -4.9891510028515773e-05,
+    -3.2609166673164269e-06, 0.00010652037458258601, -1.118727563777927e-05,
+    -3.4067390610861836e-05, 0.00064384624831032022, -6.2013733324497999e-05,
+    -1.6080835070583777e-05, 0.00037591932138253403, -3.769816635107448e-05,
+    -2.2255870547202572e-05, 0.00038862205426271057, -3.6766351445720324e-05,
+    -9.550750010856035e-06, 4.2684884436872128e-05, -1.251848233761732e-06,
+    -6.8743759461670217e-06, 0.00017280366091942945, -1.7534919521985937e-05,
+    -3.5724309572354729e-06, 9.546614947703036e-05, -9.7756625503167549e-06,
+    -2.5957828429165608e-05, 0.00036562146649282701, -3.2621373598953896e-05,
+    -3.2173109531685729e-05, 0.0005094372462189356, -4.702255619436907e-05,
+    -1.6897159695550279e-05, 0.00056674454343363934, -5.9747365860562951e-05,
+    0.00010061223423558918, 0.0010111105448866731, -0.00015813275573945546,
+    1.4225284966709606e-05, 6.2457751612787771e-05, -1.2934901686710576e-05,
+    4.0292886443998865e-05, 0.00023033185090765018, -4.2890290442541834e-05,
+    0.0001613962403804875, 0.00085011778332333421, -0.00016331909963077096,
+    4.8281715929465729e-06, 3.2410408026817272e-06, -2.2938004058253858e-06,
+    0.00034735341816506671, 0.00016028289962916054, -0.00015650992686309234,
+    0.00033887275436722541, 0.0001501099627389535, -0.00015196016139075452,
+    0.00058131498281630001, 0.00030376962929057338, -0.00026604464606558298,
+    0.00013070347318143438, 6.5155256828708374e-05, -5.9455141574064896e-05,
+    1.3454552140884646e-06, 0.00010396351243247004, -1.2507239145052862e-05,
+    -5.032991979528334e-06, 0.00025474145782272695, -2.7334531891888558e-05,
+    3.4846197374538423e-06, 0.00048792615141846074, -5.7578262480983966e-05,
+    -3.7632516786678671e-06, 0.0002623350348595066, -2.8711047318413785e-05,
+    1.5505795811776579e-06, 4.5863846821092569e-05, -5.9002360609863858e-06,
+    -2.0126993698771356e-06, 0.00036818053174075827, -4.1598022724444184e-05,
+    -1.7206036399750047e-05, 1.5018123603827149e-05, 5.1401786773930258e-06,
+    -6.2932811540530875e-05, 7.0851206257549482e-05, 1.696686421812782e-05,
+    -0.00046386805759826566, 0.00050360085218731365, 0.00012720770738440523,
+    -0.00016126422171564014, 0.00018041830988790863, 4.3605395076931619e-05,
+    -0.0001068454195279761, 0.00011257878893916606, 2.9697681282553345e-05,
+    -0.00033144779573855698, 0.00036537386001866956, 9.0251708712102419e-05,
+    -4.4187604915257861e-05, 4.5314801282225758e-05, 1.2427707400612664e-05,
+    -3.5366129041092265e-05, 4.6060754917587321e-05, 8.805278764789648e-06,
+    -3.136212790794124e-05, 3.450050976100405e-05, 8.548265468866223e-06,
+    -9.8279768293074721e-05, 0.00010227325554901245, 2.7469085134450288e-05,
+    -0.00018593138830554079, 0.00020760705359557097, 5.0319000173285056e-05,
+    -9.1762602827533124e-05, 9.504819970562739e-05, 2.570089335571929e-05,
+    -1.9746296723008316e-05, 2.3328717429715873e-05, 5.1938992648367655e-06,
+    -1.3940426842509734e-05, 1.2295565105013839e-05, 4.1555530609915792e-06,
+    -9.1756080888252822e-05, 0.00010594419663806365, 2.4422230582014925e-05,
+    -0.0001892984541018855, 0.00020471186752640813, 5.2009037885415721e-05,
+    -0.00032440318994596262, 0.00035787632034101069, 8.8299488318288599e-05,
+    -0.00053389084980785817, 0.00061635818260463715, 0.00014209404260913383,
+    -0.00019367997604556597, 0.00021227462883571802, 5.2888751435949122e-05,
+    -0.00052374867532647973, 0.0020763715566411434, -3.5284860587778133e-05,
+    -0.00016248780918096117, 0.00062351388116238526, -8.482017968498845e-06,
+    0.00030780794208111473, 0.00050320886198018666, -0.00018520336754088845,
+    5.6811599819045489e-05, 9.8458588731642482e-05, -3.4847687411250494e-05,
+    2.2758657578253461e-05, 3.3932653837775995e-05, -1.3303929019929661e-05,
+    0.00022219819498292548, 0.00036305062802055588, -0.00013366981952971785,
+    2.8678480289284769e-06, 8.1076468824714532e-06, -2.1316691814834976e-06,
+    1.4227440741754194e-05, 3.8686655188302499e-05, -1.0392870018451073e-05,
+    0.00023524631653613903, 0.00038288270128400415, -0.00014134790982021223,
+    6.5966763087052516e-05, 0.00015362763174575633, -4.5117086184646993e-05,
+    2.8750119253670436e-05, 6.1036808501613304e-05, -1.8962535313964135e-05,
+    4.2942445308599697e-05, 0.00010693681699130986, -3.0189847705454353e-05,
+    1.8910558189380589e-05, 3.636791823091734e-05, -1.2025911712676418e-05,
+    0.00026446903048794879, 0.00063416311102726386, -0.00018303689341200163,
+    0.00017209037394153026, 0.00042368662387759493, -0.00012040436886167488,
+    7.345446247690457e-05, 0.00062758039795551834, -0.00010400800624828926,
+    1.3308102348522088e-05, 0.00010912196234608151, -1.8304636778446182e-05,
+    0.00017649945298908731, 0.0010652016042139167, -0.00019781069186398936,
+    3.2077171263189541e-05, 0.00018700382435105078, -3.5176564531030907e-05,
+    0.00011901087894274076, 0.00063268896427148835, -0.00012333268689230376,
+    1.7085566893976223e-05, 8.1057669217898809e-05, -1.6559766398055453e-05,
+    2.6987400070552225e-05, 0.00015280678558882155, -2.9061871334543077e-05,
+    4.831322501057389e-05, 0.00023322005148879166, -4.7298114733369812e-05,
+    1.3302069562654006e-06, 1.8518079799967335e-05, -2.7197298567427364e-06,
+    5.0442131973943427e-05, 0.00026099506039128917, -5.1433379013039737e-05,
+    0.00020490954343371781, 0.0011804473387860837, -0.00022301532590452561,
+    1.8033659641980559e-05, 9.7547975351275351e-05, -1.8886053494440724e-05,
+    8.1830109161379339e-06, 2.9499678292133069e-05, -6.8446008981565276e-06,
+    4.2417891642290706e-05, 0.00025487585985295436, -4.7393193148531632e-05,
+    1.9941342871032663e-05, 9.806272565199281e-05, -1.9739098434494451e-05,
+    8.2059306379222985e-05, 0.00049071576440978815, -9.1407379799755828e-05,
+    1.3650543520024594e-05, 6.9078407223588378e-05, -1.3741142982123811e-05,
+    1.9311238017155619e-06, 3.3166928101235893e-05, -4.6730072306017112e-06,
+    2.1066456355606222e-05, 0.00011102602550749907, -2.1722401694936055e-05,
+    5.5849476013641874e-05, 0.00032916769539731439, -6.1650057781026391e-05,
+    0.0003606780492820677, 0.0007474009668443915, -0.00023747404429474289,
+    1.0990657882778421e-05, 1.7547033825282554e-05, -6.6292286592106731e-06,
+    0.00034439871584475423, 0.00070943189743627455, -0.00022626168076329833,
+    0.00016687083195780772, 0.00046248758654737765, -0.00012337043946582943,
+    1.8072333229673943e-05, 7.3772906907132452e-05, -1.6097059828287796e-05,
+    8.2606316090041987e-05, 0.00023634563275060083, -6.1929171848475184e-05,
+    4.4541018275751076e-06, 1.7516225285174603e-05, -3.8899117528468086e-06,
+    -2.8208093627732356e-05, 5.921691885729663e-05, 5.0022378968242465e-06,
+    -0.00037314045119352102, 0.00071732269615548683, 7.3788766115447102e-05,
+    -0.00016231275180929317, 0.00033363709351086346, 2.9593844943456848e-05,
+    -7.2289768114575104e-05, 0.0001176598177592969, 1.6770335023598426e-05,
+    -0.00011962936897202958, 0.00023133098009914255, 2.3499303705071251e-05,
+    -0.00027103038116481348, 0.00056250225529663744, 4.8773982236197111e-05,
+    -0.00014537701304828676, 0.00029480846604651445, 2.6967478602452077e-05,
+    -0.0004295199561530072, 0.00089705922908178692, 7.663503297331703e-05,
+    3.775974620248701e-05, 4.6678751810469432e-05, -2.1462273982211788e-05,
+    0.00012990618721019087, 0.0001717538556568754, -7.5146304975973188e-05,
+    0.00016491284232066084, 0.00021210596108467428, -9.4701917987854989e-05,
+    3.7848096350601157e-05, 5.3884893356503927e-05, -2.2342978700080895e-05,
+    0.00048478872670648654, 0.00062548127920403207, -0.00027862414183511819,
+    0.00043036747273834941, 0.00059508298500832169, -0.00025197607889628632,
+    4.1522238218683061e-05, 5.1087620545342549e-05, -2.3578522430831028e-05,
+    0.00011645522239642214, 0.00016367208473827555, -6.8488682640997778e-05,
+    0.0002816597700717044, 0.00037287341710989796, -0.00016299095838418626,
+    0.00047377454619022819, 0.00063924282047389536, -0.00027555136091540755,
+    0.00016128331234173399, 6.1353263037910999e-05, -7.5885827801346062e-05,
+    0.00021614477559719902, 8.8594770722372207e-05, -0.00010242825452358439,
+    0.00027892839667650882, 0.00010880004897134699, -0.00013154912244034422,
+    0.00034737115724381429, 0.00014298408820123676, -0.0001646809612146985,
+    0.00053444957771929535, 0.00020103732848003597, -0.00025122029450395933,
+    0.00036519041732026303, 0.00013946893940974814, -0.00017189622018110029,
+    0.00073160208917108505, 0.00027257962014154424, -0.00034360024651877707,
+    0.00051493179398386102, 0.00019323553259947834, -0.00024199425641657779,
+    -0.00024137494357860667, 0.0006045610946594504, 3.6342547084691756e-05,
+    -0.00024936700120603561, 0.0006241063506894351, 3.7598361589702423e-05,
+    -9.2000015834800553e-05, 0.00025922021079294311, 1.0641918890885727e-05,
+    -4.059467450888421e-05, 0.00010486670125670061, 5.7573851105149898e-06,
+    -7.9197816651374597e-05, 0.00021746161182678581, 9.7950889450734713e-06,
+    -0.00011080560418365304, 0.00032105196257042889, 1.1826842703691054e-05,
+    -1.6236613405384848e-05, 4.4470662737050581e-05, 2.0209680286487064e-06,
+    -1.0595519380221519e-05, 2.7903302159848486e-05, 1.4437976060058255e-06,
+    -7.4945652338606616e-05, 0.00016987509145516277, 1.3289290181774105e-05,
+    -0.0001811499901447633, 0.00042358728514452215, 3.0667073300419401e-05,
+    -2.7998806916909591e-05, 6.1248291631343932e-05, 5.2137158730800048e-06,
+    -7.9587426860178168e-05, 0.00023899058247350835, 7.5362858324087845e-06,
+    -0.00023021469524885096, 0.00067590841160941606, 2.3529121945552178e-05,
+    -0.00029141655689500501, 0.00064914108717251118, 5.3035274045182268e-05,
+    -0.00037065855162597694, 0.00081962564661097748, 6.8137822571062712e-05,
+    1.4602932985385841e-05, 0.00054671511956144725, -6.835245360746478e-05,
+    8.6550467446877555e-06, 0.00052166007053516816, -6.2922293208665658e-05,
+    3.3182705374418253e-06, 4.9554848718991185e-05, -7.065329987038238e-06,
+    -2.5301774254082865e-06, -6.580433802305663e-07, 1.1776781977529405e-06,
+    6.7350441129016003e-06, 0.00011175695612469783, -1.5607923973016968e-05,
+    -4.2124447999225545e-08, 7.0319239463767502e-05, -7.9542871244328572e-06,
+    1.5037803445347442e-05, 0.00071256460711222047, -8.7348442763708622e-05,
+    -2.7711597882229544e-06, 2.6327471204179442e-05, -1.7733737793443338e-06,
+    -8.4198456146988843e-06, 4.2893144666933392e-05, -1.1824319875383682e-06,
+    -0.0001317048987626579, 0.00076640104580938395, -2.9318234865301218e-05,
+    -3.1090547483583753e-05, 0.00022452758941049478, -1.1871978917235571e-05,
+    -3.6507022751430807e-05, 0.00016182241232931549, -2.3764469585865755e-06,
+    -0.00012943286112736263, 0.00079040945603675583, -3.3043344414049325e-05,
+    -3.6304075552703874e-05, 0.00011139352738437358, 3.2811753978151392e-06,
+    -5.754234190012697e-05, 0.00046105640208887744, -2.7178808581523883e-05,
+    -8.3715508008855299e-05, 0.00051016348704685521, -2.1250994764195064e-05,
+    -9.4621493070962126e-05, 0.00036852894340344555, -2.9989910507038919e-07,
+    -0.00025273995489975831, 0.00093516376159685777, 4.8126007326856901e-06,
+    -0.00031598270542933238, 0.0011874175978365265, 3.9290824113483169e-06,
+    -0.00031182176618722857, 0.0010785236742715254, 1.4581987981161781e-05,
+    0.00017041942181791891, 0.00039194203182657539, -0.00012098895363923251,
+    4.6240584522239114e-05, 0.00010204765276161654, -3.233415562070574e-05,
+    5.1110767552625669e-05, 0.00012311412154492052, -3.6925282473045107e-05,
+    0.00014918526570803503, 0.00033573580319706808, -0.0001050676151877275,
+    8.8744294699766302e-05, 0.00020658247833810206, -6.3287816975031441e-05,
+    4.7965751892517505e-05, 9.8787990508775181e-05, -3.2732580429448155e-05,
+    -8.5879616970666039e-05, 0.00095090658657709382, -7.0516360719849458e-05,
+    -0.00012973035164623448, 0.0013161282748300751, -9.2734523303161787e-05,
+    0.00010741466022096136, 0.00044167703644382161, -9.8952518519553057e-05,
+    0.00025824958099719686, 0.0010290318350851257, -0.00023413795198325149,
+    1.6304254187096689e-05, 7.9749517585603336e-05, -1.6471822185969154e-05,
+    1.7581697692142795e-05, 6.3865984067323911e-05, -1.5232948839663529e-05,
+    7.0727916416241099e-05, 0.00030054240690852163, -6.6263862459663148e-05,
+    3.5058658790915187e-05, 0.00013127208581720229, -3.0824672996455915e-05,
+    9.400954346414081e-06, 4.7377908571955007e-05, -9.6555329693534531e-06,
+    4.1899473298245837e-05, 0.00016718356537065437, -3.8015131523662371e-05,
+    1.0432764853463006e-05, 2.4232391781509044e-05, -7.4811587825601711e-06,
+    1.7389459866096191e-06, 4.0387028871213815e-06, -1.2469251360266997e-06,
+    0.0002131524059080514, 0.00092652253625052916, -0.00020205765959136618,
+    5.7086811075607313e-05, 0.00023745286546716926, -5.289886789815873e-05,
+    5.7022031697676057e-05, 0.00028778050505712249, -5.8593392197152372e-05,
+    0.0001374307995268137, 0.0006442349460709651, -0.00013560814170107682,
+    4.5011663267827129e-05, 0.00023248355023486322, -4.6852839381369971e-05,
+    6.6432066710683801e-05, 0.00033851273527013559, -6.8626878640801192e-05,
+    0.00014403921549852039, 0.00069581035465926533, -0.00014447233573271906,
+    2.464233159957252e-06, 9.6024474118272529e-06, -2.211147089981047e-06,
+    0.00018362708495649194, 0.00088691604940593916, -0.00018416384976426003,
+    9.8665695749164395e-05, 0.00048813431251887307, -0.00010026220206364733,
+    8.132390237330922e-05, 0.00037411374282009247, -7.945505325119423e-05,
+    7.2169239137165331e-05, 0.00035022492085556856, -7.2565428036353019e-05,
+    0.00012154075641945816, 0.00056351211546784574, -0.00011924484314709827,
+    0.0001234353562391266, 0.00059794049895650625, -0.0001239886252180078,
+    2.9431071801061526e-05, 0.00013293980870104916, -2.8481186268344838e-05,
+    2.3091822678969476e-05, 0.00016192433258727101, -2.8817856698379329e-05,
+    1.0656275181625263e-05, 0.00015888489899984481, -2.2748654178277039e-05,
+    2.5024201848355965e-05, 0.00024859978167879326, -3.9441845298124334e-05,
+    2.3134497548038535e-05, 0.00033972743661164762, -4.8798710156471026e-05,
+    2.4068684853745248e-05, 0.00024473449760931132, -3.8570488944983383e-05,
+    -0.00050584972282217977, 0.00023788437436689236, 0.00020692711419640492,
+    -0.0013635490195177263, 0.00062289627489353627, 0.00055985307352854341,
+    -0.00055651787909881401, 6.3367301559980049e-05, 0.00025034699146667116,
+    -0.00020877898587876031, 2.7150759488114851e-05, 9.3529211125278899e-05,
+    -1.8144034403574927e-05, 2.6716059068343512e-06, 8.0921833106456509e-06,
+    -0.00029763319592791826, 3.5411988481504064e-05, 0.00013371463946193485,
+    -0.0001036333106821663, 1.7247660930808095e-05, 4.5988821563043569e-05,
+    -8.0313793766842445e-05, 5.0738117243764869e-06, 3.6601823598193806e-05,
+    -0.00013233633660618416, 1.7200434919650842e-05, 5.9284621432384443e-05,
+    -3.3083405378261932e-05, 2.5887427774373695e-05, 1.2312583361255569e-05,
+    -0.00012051358239645316, 0.0001065017716851413, 4.3433134444832711e-05,
+    -0.00010274734805866548, 8.5752018414986253e-05, 3.7617797743985659e-05,
+    -0.0001281181777519208, 0.00039250353949016326, 1.3635066468863088e-05,
+    -0.00017327763545957331, 0.00054671378400866777, 1.6590970561794482e-05,
+    -9.5684749743016329e-05, 0.00028547715857224487, 1.1080823845502352e-05,
+    -8.612886762707217e-05, 0.00027528279545080414, 7.8313614547964594e-06,
+    -9.925040613603664e-06, 2.2698488771399905e-05, 1.9591162657914274e-06,
+    -0.0002110682598125968, 0.00065417808931422794, 2.1582184839483154e-05,
+    -5.9299400936213553e-05, 0.00017404723930863897, 7.207092823084682e-06,
+    -0.00017968490120620628, 0.00055408602908307847, 1.8702619421551159e-05,
+    -8.0815288545477149e-05, 0.00026761735004043885, 6.2453607832455016e-06,
+    -5.9468650974697779e-05, 0.00021360020540672764, 2.6323607456579801e-06,
+    -3.4438632974184702e-05, 9.7514615899463308e-05, 4.6097345086232311e-06,
+    -0.00010406738424945106, 0.00033735177177279807, 8.8986008513480819e-06,
+    -0.00020194939157827663, 0.00063306113873123904, 1.9816308769127211e-05,
+    0.00010370410677303099, 0.00085223076539248099, -0.00014940427504615134,
+    4.1093930651575628e-05, 0.00029465766811215266, -5.4117787190471889e-05,
+    5.8145367245826529e-05, 0.00047523603753163446, -8.3459008442830773e-05,
+    5.3031508728942911e-05, 0.0003839223972665895, -7.027542483599436e-05,
+    9.0063248971997134e-05, 0.00068993596442407101, -0.000123821134959963,
+    3.2302762809091612e-05, 0.00021671934710187912, -4.0788683897653721e-05,
+    8.6410432557956773e-05, 0.00057729605914980109, -0.00010882396483840456,
+    2.3210422450944956e-05, -5.0186042985789214e-06, -1.0391405287850375e-05,
+    0.00035628650091044933, -4.2839263742322498e-05, -0.00016353455063505828,
+    0.00089014582739463388, -0.00011661364252280038, -0.00040745115725394215,
+    0.00049871862110674459, -6.1158292268825853e-05, -0.0002287660471705158,
+    7.067662102594463e-05, -1.1489408951403934e-05, -3.2093943913610867e-05,
+    0.00039643453244563032, -1.1228152001052649e-05, -0.00018616096437722163,
+    9.6772308692372189e-05, 1.5800139829824644e-07, -4.5776265179917064e-05,
+    0.00025826730238072415, -7.4231192087603759e-06, -0.00012126776674135226,
+    7.751052468250863e-05, 8.0136082380999341e-07, -3.6741351411198608e-05,
+    0.00044015803867239467, -2.1247644441779734e-05, -0.00020569173770305232,
+    0.00052222660932829679, 1.2299050224706676e-05, -0.00024831341417908687,
+    0.00074404164921167137, -2.0253446736950842e-06, -0.00035157143963170101,
+    0.00045701067054024214, 2.4227704497059577e-06, -0.00021635645084280841,
+    0.00026546749481293208, -1.9294617639165068e-06, -0.00012530397591152542,
+    0.00026423685544343933, -5.978069231693528e-06, -0.00012427116465761612,
+    4.7937296125913353e-05, 5.8779890649285349e-06, -2.33182322733963e-05,
+    0.00049340202011323442, 0.00030904944532705869, -0.00026759427630485694,
+    0.0006351389484265807, 0.00038945295918185741, -0.00034354010958259629,
+    0.00030112259008224784, 0.00018776090265038015, -0.0001632159785684914,
+    0.0003213061309410431, 0.00019568171031769666, -0.00017364648442696334,
+    0.00036948743798552452, 0.00050354116971801366, -0.0002299965974242868,
+    9.1084416449754846e-05, 0.00012281581576023548, -5.6555244391569282e-05,
+    3.720389972046434e-05, 5.323005719781726e-05, -2.3432133372976172e-05,
+    0.00033273178719535335, 0.000449689101184092, -0.00020671062629230158,
+    7.9199802964363686e-05, 0.00011099995460783774, -4.9630115636169203e-05,
+    0.00022386482079687908, 0.0003136365772137828, -0.00014027136394670348,
+    9.192426028435674e-05, 0.00012092093722521069, -5.6753782933592622e-05,
+    8.1234857990122866e-05, 0.0001184802054358669, -5.1401222073782504e-05,
+    2.2072075999551855e-06, 5.8636917544818701e-06, -1.6801328396667814e-06,
+    9.0229788108492359e-06, 2.8865045289039326e-05, -7.3930601137903174e-06,
+    0.00010944494925520243, 0.0004360350933306778, -9.8884671289461989e-05,
+    7.6155242170111714e-05, 0.00028359565180996471, -6.6685994463605569e-05,
+    9.7725932796291493e-05, 0.00038673782534826007, -8.8015038230304654e-05,
+    0.00018119136209365783, 0.00068243165295966968, -0.00015948861051176544,
+    9.9668929822882557e-05, 0.000394086194025145, -8.9724348009377619e-05,
+    0.00020676161768558299, 0.00075201714535400033, -0.00017915509216220871,
+    0.00032749745865634505, 0.0010516759160862366, -0.00026895246095367392,
+    6.35777489872702e-05, 0.00019445338388074385, -5.1184553004096633e-05,
+    1.7546357630918163e-05, 5.5672453080912732e-05, -1.4338272272006181e-05,
+    2.0420981059338095e-06, 1.6530199814346336e-05, -2.7314668241407158e-06,
+    5.6740133367344514e-05, 0.00016790224093143902, -4.5084514260523845e-05,
+    4.6254213325491733e-05, 0.00015129025525856266, -3.8275998832097702e-05,
+    0.00010895377318684285, 0.00033828702342292294, -8.825102612502328e-05,
+    4.092409400148489e-05, 0.00064133903643387447, -8.7388300757967885e-05,
+    4.6433144767071832e-06, 0.00013498860869665119, -1.6474495263159306e-05,
+    0.00033904506087147068, 0.00080956334100140692, -0.00024926092146850681,
+    0.00038634126156725235, 0.00074232875723095892, -0.00026511651742367609,
+    -4.4951312583613179e-05, 0.00010636739717539978, 1.0703732090049101e-05,
+    -0.00052390299074833724, 0.0011546753315573866, 0.00013364166319210918,
+    -0.00028077333899589885, 0.00061248122148638284, 7.2289107362982774e-05,
+    0.00024398922750637486, 0.0012650005712244172, -0.00025255202441309965,
+    0.00018093408972502667, 0.001025971549572513, -0.00019653568500640345,
+    7.54219541312523e-05, 0.00026957871813659828, -6.531944066009987e-05,
+    5.1017311824927414e-05, 0.00020007859220100288, -4.6044235912666431e-05,
+    7.4240179270351758e-05, 0.00027282233532899269, -6.5080808918288602e-05,
+    0.00013448855933127779, 0.0005122095909975144, -0.00011978041766777525,
+    1.6133028119966197e-05, 6.2310721054781304e-05, -1.4459356415183477e-05,
+    8.5855219472519284e-05, 0.00031797537395156228, -7.5523397525215086e-05,
+    -0.00027609423883476203, 0.00043918054790170746, 9.0132314140192737e-05,
+    -0.00051214344441782855, 0.00081706387443086781, 0.00016693990941248765,
+    -5.5084904694940873e-05, 8.639721019881863e-05, 1.8112202929576604e-05,
+    -0.00042051483806238021, 0.00066860627555054286, 0.00013731170330268105,
+    -0.00077289749774513139, 0.0012138628923297756, 0.00025396947409256354,
+    -8.9014038923140859e-05, 0.00014864014349186272, 2.8303123275674746e-05,
+    -0.00024004184411918761, 0.00037671187608528944, 7.8909233757119834e-05,
+    -8.7389607319049434e-05, 0.00014717599059710373, 2.7649804939529343e-05,
+    -0.00020614181428625644, 0.00032861193941446931, 6.7219071723939594e-05,
+    1.9725749079296806e-06, 7.5702437408731171e-06, -1.7986138210607239e-06,
+    0.00012003032162702376, 0.00036702546232436628, -9.9349790917656333e-05,
+    0.00034706628275515961, 0.0010173796954998093, -0.00028254489584623316,
+    0.00016549823930467333, 0.00049061850954329467, -0.00013531916256855764,
+    -0.00046738155385138425, 0.0012046670661525205, 0.00010491672298826998,
+    -7.5008599156115019e-05, 0.00018740447196047283, 1.7475822985502099e-05,
+    -0.00027796691083743774, 0.00071327143608729271, 6.2738144884347258e-05,
+    -0.00012314028743823369, 0.00031271981904507085, 2.8145715295649354e-05,
+    -5.2559425988765729e-05, 0.00012616069780418959, 1.2805093435319659e-05,
+    2.8368037668591306e-05, 0.0012467297532984256, -0.00014929444545231513,
+    2.1590694364928553e-05, 0.00072571232728602109, -8.9468266205261493e-05,
+    1.0691949653793276e-05, 0.00047167296446654072, -5.6458772058710915e-05,
+    -0.0001535445343428532, 0.00029200999441275632, 4.6195660274507555e-05,
+    -0.00023076035318808641, 0.00042717333685821091, 7.0693715040155702e-05,
+    -0.00026818111719946469, 0.00051192113311554488, 8.0475331623038049e-05,
+    -0.00018137826357955689, 0.00033771565140855442, 5.5355702634395099e-05,
+    -6.6662612925982856e-05, 0.00012313362031995956, 2.0453070353095015e-05,
+    -8.0170774533608324e-05, 0.00014164769674396283, 2.5301513563995293e-05,
+    -9.2259507833425403e-06, 1.2297744820921608e-05, 3.3498190457406651e-06,
+    -5.3546257626588267e-05, 0.00010273793087323124, 1.6008553907188861e-05,
+    -0.00028562372278598258, 0.00053122243716141604, 8.7231939450600759e-05,
+    -7.5345092096668065e-05, 0.00013551601223388277, 2.3518337691673386e-05,
+    -0.00012155151078968585, 0.00022731253774899152, 3.6985460490857047e-05,
+    -1.4254660985160705e-05, 2.1920192804836258e-05, 4.8592110779566156e-06,
+    -6.1484845259460186e-05, 0.00011171202481058407, 1.9068412337737428e-05,
+    -0.00020866809446831724, 0.00039237812699277619, 6.3254016221953036e-05,
+    -0.00012958324889737749, 0.00023624639609104436, 4.0100994237041165e-05,
+    -5.3804465456053219e-05, 0.00010621093738572007, 1.57518224835132e-05,
+    -0.00030363294261322171, 0.00056101563001692556, 9.3140145205027058e-05,
+    -0.00012226739977234946, 0.00021813489323324609, 3.8369984647339261e-05,
+    -9.4858730184180229e-05, 0.00018299937913734965, 2.8236807693322874e-05,
+    -0.00045285900912712951, 0.00083739091756745987, 0.00013884274964162668,
+    -0.00011507070868232994, 0.001244961673786571, -8.0313976676973931e-05,
+    -0.00010638971120174867, 0.0010521105288127663, -6.3161310319817532e-05,
+    -0.00021101124837938356, 0.002383084096647059, -0.00015854476828442571,
+    -3.6942084792601637e-07, 1.7057849907575751e-06, 0,
+    -4.0117385846638598e-07, 5.2704881055021247e-06, -3.8468307349964759e-07,
+    -0.00020106912513133401, 0.0021261086520680261, -0.00013479083663969077,
+    -0.0001224985564092923, 0.0013840999093133743, -9.2136031493342263e-05,
+    -0.00011017096897456002, 0.0013206249413866278, -9.1427817458772376e-05,
+    -0.0012894334403125152, 0.0012139046325345126, 0.00054079761133357662,
+    -0.00056367599886900099, 0.00033432938282007552, 0.00025894157615712066,
+    -0.00075349348834592711, 0.0007584220640038386, 0.00031016282809721851,
+    -0.00017585457684934913, -0.00011204728729724556, 0.0001060527753545884,
+    -0.00086997222496745796, -0.00022517290354928665, 0.00048624619678779707,
+    -0.00096712170876246673, 0.0010193662031810491, 0.00039095089157919344,
+    -0.0013453777691584679, 0.0013993735890631687, 0.0005460822800624418,
+    -0.00065766470363624874, 0.00070936161252393992, 0.00026388603771151237,
+    -0.00011530699547128431, 0.0017280667712413211, -0.00014885272523136595,
+    7.3598120614790097e-05, 0.001117521353882045, -0.00017548941587532119,
+    0.00039470019562018455, 0.0010520208447059587, -0.00033968496707455914,
+    -0.0001383977206059761, 0.0014376436562042461, -9.9858575712132025e-05,
+    1.0347820517120354e-06, 3.2434334849951174e-05, -4.4953557355661977e-06,
+    6.3888945410747744e-05, 6.6248758820386389e-05, -4.2507850282862136e-05,
+    1.2625586398876121e-05, 3.1460379934844518e-05, -1.0628472004642342e-05,
+    7.1255335954950594e-05, 5.7152408551197631e-05, -4.5380984288856396e-05,
+    3.9921472791110135e-05, 1.7906983136917187e-05, -2.3714681747000199e-05,
+    0.00027116575777988428, 0.00015914041359760267, -0.00016562523560981895,
+    6.2388528239601393e-05, 1.574119238345606e-05, -3.558504383940897e-05,
+    1.2947072993388375e-05, 6.4710768811759856e-06, -7.7715199336414464e-06,
+    6.9142343459144273e-06, -3.8197163708120208e-06, -3.2722085971104153e-06,
+    3.0763603839342735e-05, -2.0669463051126158e-06, -1.6360630063820547e-05,
+    0.00079462380177684755, 9.4519461823816542e-05, -0.00044043883035960185,
+    0.00028711889147699232, 8.1356417449218732e-05, -0.00016478809621336271,
+    0.0010146770190310045, 0.00064066781983784793, -0.00062446635509812165,
+    0.00023803803172171845, 0.00013753710298786137, -0.00014499213942197053,
+    0.00011400039478198787, 6.7617573116407481e-05, -6.9644799179389982e-05,
+    1.437266346497601e-05, 2.0977598444993362e-05, -1.0242979810955177e-05,
+    9.7512260275850471e-05, 0.0001193621510904852, -6.6797906559001863e-05,
+    -0.00013596675160088001, 0.00021162026283311208, 4.8795764625658711e-05,
+    3.5336832412968811e-07, 1.8625244573300392e-06, -4.1022412110292006e-07,
+    -0.00021411914841698576, 0.00033394018698390537, 7.6763593391114548e-05,
+    -0.00089693886033886949, 0.0013836236676280089, 0.00032335525250854619,
+    -1.7416658814981001e-05, 6.2294713320809603e-05, 2.0655529465729572e-06,
+    -0.00013690620609195514, 0.00057749661803352392, 5.7903814016449506e-06,
+    -6.000491190906454e-05, 0.0001423095012774156, 1.5737777578260503e-05,
+    -0.00017790399697240056, 0.00042380579203643576, 4.6435248038538546e-05,
+    -0.00064936767916498606, 0.0013602758854081576, 0.00019178817620864319,
+    -0.00065376557744084574, 0.00071735960761959428, 0.00027153449173912547,
+    -0.00052982148799388118, 0.00065492583575660346, 0.00021114275129260895,
+    -0.00019273465270452927, 0.00071346298846924894, 1.890211401918418e-05,
+    -0.00034071030907521782, 0.00037661118959569917, 0.00014143171228440249,
+    -0.00032882770316666754, 0.0003558652514534244, 0.00013743193087029093,
+    -0.00021546620167425812, 0.00039895988498095392, 6.9664548698479545e-05,
+    -0.00011263967665704755, 0.00020909964805448933, 3.6352764247314651e-05,
+    -0.00039989296298778565, 0.0018224123298769546, -4.2427206788098193e-06,
+    6.8794864361274022e-05, 0.00036589303035883258, -8.3481797345533182e-05,
+    0.00014510119421350109, 0.00068323864866326467, -0.00016511753383412903,
+    5.9149420115964246e-05, 0.0001418935307004876, -5.0413306068898545e-05,
+    0.00019743801026542163, 0.00038173211107112026, -0.00015691937433976594,
+    -0.00011450435365335798, 0.00040545167290922945, 1.3700374051225928e-05,
+    -0.00010611507619104343, 0.0003501032263474313, 1.5862885922833525e-05,
+    -1.1938510789108459e-05, 2.9531407314264957e-05, 3.0031707968988797e-06,
+    -0.00033331819428983334, 0.00087355076991491032, 7.7783477778800569e-05,
+    -0.00024113681355419914, 0.00049171489429722381, 7.3673551652296554e-05,
+    -5.1877142467751658e-05, 0.0015993371665507516, -0.00016994243532559433,
+    4.3499416700620852e-06, 0.00015113154501944503, -2.1252309267479064e-05,
+    2.2436879823145572e-05, 0.00022306517452552743, -4.0361236487887475e-05,
+    2.1244108511078719e-05, 0.0001763128586717011, -3.3873751318289069e-05,
+    0.00010743335007401544, 0.00062969617699254465, -0.00013871769350412566,
+    0.00012778194234651374, 0.00025873762464295735, -0.00010407699480713406,
+    0.00017308401339229118, 0.00022930531837667134, -0.00012594033953278877,
+    2.6264424259014874e-05, 0.0001022671485755855, -2.7467498658936829e-05,
+    4.3374788529323971e-05, 0.00019357502447842068, -4.8418097958261019e-05,
+    7.7405579651940171e-05, 0.0003457451373527487, -8.6442369209675796e-05,
+    1.4598906655227673e-06, 7.4667874230827103e-06, -1.7473028956355163e-06,
+    6.5496145625135171e-05, 0.00029127427607966716, -7.2984929784886132e-05,
+    0.00067202114036904459, 0.0008322719468049633, -0.00048239676690827599,
+    0.00011622431804680922, 0.00028946711156818683, -0.00010128188222095075,
+    0.00016762279770550503, 0.00043975914786631431, -0.00014880196853214039,
+    0.00013002259299216279, 8.3375905029103858e-05, -8.3903177642750959e-05,
+    0.00024228023112407571, -7.4633694241765802e-05, -0.00012825538122707841,
+    0.00018341298727084232, 9.8270195127314608e-05, -0.0001159436608677844,
+    0.00032688076235352914, 0.00015203781889511214, -0.00020382820898531828,
+    6.5116377063967334e-05, -7.5166240062762846e-06, -3.6025054330160455e-05,
+    0.00010579253037112935, -1.6699827406485568e-05, -5.7985617288355829e-05,
+    0.00018014187624437739, -2.40985827553164e-05, -9.9261373996573088e-05,
+    7.7576481890676008e-05, -3.3466000556481301e-05, -3.9960497970156772e-05,
+    5.6525001256760299e-05, -2.1890370929866787e-05, -2.9417303270246054e-05,
+    5.1382347008646634e-05, -1.2282902144555852e-05, -2.7658381729182835e-05,
+    3.0244291341990914e-05, -2.2127044079445213e-05, -1.4486458901806498e-05,
+    0.00025571123967131626, 0.00022902558824039465, -0.00017256313231548553,
+    1.5617375758877894e-05, 1.4007072848432056e-05, -1.0541507069403155e-05,
+    5.7785386708641973e-05, 7.8221017175528207e-05, -4.2171485002198694e-05,
+    1.1477479675725544e-05, 6.4143688932594145e-07, -6.5900084792666624e-06,
+    1.3038008314703031e-05, 1.5241640587471128e-05, -9.2261784465086372e-06,
+    8.2706203220483943e-06, 2.3153253820351605e-05, -7.469238148274937e-06,
+    2.6480568441192287e-05, 3.5917384630490545e-05, -1.9333832764104053e-05,
+    9.7562510798371305e-06, 2.3465490313345772e-05, -8.3494290175484265e-06,
+    -5.3267807105378262e-06, 3.9902807024982945e-05, -1.7579596328295977e-06,
+    -5.8288216355506517e-06, 1.6607459987161288e-05, 1.3186006261531324e-06,
+    -1.8349944494525094e-05, 2.8234324610187933e-05, 7.0331290400044155e-06,
+    -6.1698842165336387e-06, 2.1886799730863604e-05, 8.7922311308580303e-07,
+    5.3104856633928721e-06, 2.2526875427086868e-05, -5.7153799944142936e-06,
+    2.9415537080773602e-05, 2.9398179418105297e-05, -2.0225172991356066e-05,
+    3.7067660299261451e-06, 7.8224292854311983e-07, -2.1984743277109198e-06,
+    1.19237828881541e-05, 1.3218596700004248e-05, -8.3543531974178409e-06,
+    1.6351853652174508e-05, 1.058474026316425e-05, -1.0553184576447827e-05,
+    1.997535635819836e-05, -2.9216153883959706e-06, -1.0992900600199917e-05,
+    4.4080701925353072e-05, 3.943291659980197e-06, -2.550299245518417e-05,
+    1.8916362135676379e-05, 5.7707377253968239e-06, -1.1432307178552148e-05,
+    1.4151662371175711e-05, 1.3684135289959709e-05, -9.6736943416761423e-06,
+    1.7096290217566423e-05, 1.0736539678923851e-05, -1.0993165086098378e-05,
+    2.0694158395048734e-05, -6.3427347721800587e-06, -1.0993098963747727e-05,
+    1.9614707803122799e-05, -1.2200694641806287e-06, -1.0992801418766018e-05,
+    4.3025796462689558e-05, 1.2624912244796338e-05, -2.5942933288308767e-05,
+    1.4359740602348792e-05, 4.5827149033617065e-05, -1.3632098622012867e-05,
+    3.1485359050509309e-06, 2.9199106201638347e-05, -5.2775761995790815e-06,
+    -6.5136898603768145e-06, 2.3599127200624181e-05, 8.7967538503486153e-07,
+    -1.467106623347092e-05, 2.1882776750747901e-05, 5.7183714154626641e-06,
+    -2.4894753688178839e-05, 4.4700845846401549e-05, 8.7986054611716158e-06,
+    -3.7482520797479935e-05, 4.5617718029855592e-05, 1.5840251564869234e-05,
+    -1.7976974227285059e-06, 8.5394753306378135e-06, 0,
+    1.2857370663407752e-05, 4.1945000675058797e-05, -1.2322491983088324e-05,
+    9.0143228642786122e-06, 1.9732660965721127e-05, -7.4822326127516048e-06,
+    2.2840962589365521e-05, 3.8692970982412422e-05, -1.7606787695231829e-05,
+    1.5287036552416589e-05, 1.5700108101091015e-05, -1.0564898118091415e-05,
+    1.5264497308820069e-05, 1.2127595729438667e-05, -1.0125059156325389e-05,
+    6.8171291665863887e-06, 2.2835293351453068e-05, -6.6036367974905974e-06,
+    2.4286439799986459e-05, 3.1857414258928962e-05, -1.7611126913910646e-05,
+    1.603305430035451e-05, 1.5853560383971566e-05, -1.100768198186719e-05,
+    1.1631133068470967e-05, 2.2061645673587815e-05, -9.2469529671193595e-06,
+    5.0667694599673685e-05, 4.2742609017820676e-05, -3.3908448481806408e-05,
+    2.0613650382014792e-05, 3.4644462208022198e-05, -1.585496773166134e-05,
+    2.0032469634112537e-05, 4.2040336801774103e-06, -1.1891833130349416e-05,
+    4.9300121588949364e-05, 5.6707577460679559e-05, -3.4797340466755089e-05,
+    2.2721575650835879e-05, 1.724677927666951e-05, -1.4977555277614907e-05,
+    -5.8329001063756047e-06, 1.3043364669063084e-05, 1.76214472160513e-06,
+    -2.4536454761206472e-05, 3.9437653014506857e-05, 9.2521767918254949e-06,
+    -9.9536837881164519e-06, 6.8292815516013405e-06, 4.8468150194783122e-06,
+    -1.3587419103539e-05, 1.6766843267512765e-05, 5.7283293657464651e-06,
+    -5.8142714324832534e-05, 5.5569218138151744e-05, 2.6442333804228835e-05,
+    -2.6055716114109506e-05, 3.5549121083888746e-05, 1.0578871097434439e-05,
+    -3.2195921172081809e-05, 5.7253400310708358e-06, 1.7633040056891369e-05,
+    -1.0748739862398438e-05, -4.7340527442596425e-07, 6.1717122610618902e-06,
+    -1.7885693653546531e-05, -1.4456303455367969e-05, 1.190240925016961e-05,
+    -7.7800726960564059e-06, 1.4936410180910187e-07, 4.4082335476508527e-06,
+    -2.5183413073823213e-05, 1.8434672596767676e-06, 1.4106559110035888e-05,
+    -2.7744752497782521e-05, 6.6541635530548149e-06, 1.4988714056043961e-05,
+    -2.0013328756396387e-05, -6.3952560036550921e-07, 1.1462267523458525e-05,
+    -8.8814887097971029e-06, 1.6999184410115831e-06, 4.8494791134168214e-06,
+    -1.2257005777130403e-05, -4.360420903126716e-06, 7.4946720389559851e-06,
+    -5.6016627428406851e-06, -6.5283182790198957e-06, 3.9677199020760057e-06,
+    -1.0342020261899787e-05, 4.9592346413884769e-06, 5.2903090851999512e-06,
+    -7.7329026543226931e-06, 7.2912846413308863e-06, 3.5269680204244591e-06,
+    -9.6238939066156659e-06, 1.5429194920035805e-06, 5.2905632113645074e-06,
+    -6.3065634759065792e-05, 4.5588141540264804e-05, 3.0423934803555652e-05,
+    -3.0173640970423965e-05, 3.288749779017941e-05, 1.3229981838620841e-05,
+    -1.6595269009656022e-05, 1.255851288989307e-05, 7.9387277519965549e-06,
+    -4.3610993062798142e-06, 1.3350543644707891e-05, 8.8212586914909741e-07,
+    -1.7965793440141709e-05, 3.0105487649478846e-05, 6.6164801437659793e-06,
+    -3.2001316773111466e-05, 3.7850770241543152e-05, 1.3675864650695979e-05,
+    -5.159615422337116e-05, 4.6206213156929632e-05, 2.3826548805616632e-05,
+    -1.6645211534715987e-05, 5.4103699978491626e-06, 8.8256274719672456e-06,
+    -2.3641604464441635e-05, 1.2853364737885897e-05, 1.191513329900501e-05,
+    -1.4983997817644146e-05, 3.4298587261449853e-05, 4.4134227765446621e-06,
+    -1.2646665747448327e-05, 5.2628295646506285e-05, 8.8282225788050006e-07,
+    -3.1994350426861606e-05, 4.1413641641840915e-05, 1.324463788980601e-05,
+    -2.9033457145527519e-06, 1.0090020944764078e-05, 4.4153162965382409e-07,
+    -1.2848797978276538e-05, 2.0478531915613107e-05, 4.8571246905743104e-06,
+    -7.7623898207257458e-06, 3.7139208456937745e-06, 3.9742018066724061e-06,
+    -1.3614167566233792e-05, 1.6749293944795518e-05, 5.7407547384286106e-06,
+    -8.1667444851996063e-06, -1.7229011306518771e-06, 4.857721944105664e-06,
+    -6.2342579216362326e-06, 1.1170952220751484e-05, 2.2081017798727953e-06,
+    -1.7327654824025873e-05, 1.5965190120259543e-05, 7.9495954874581054e-06,
+    -2.515678535615351e-05, 8.9609856334105231e-06, 1.3250080692542299e-05,
+    -9.9693383963511684e-06, 6.8145890911308626e-06, 4.8585523087368854e-06,
+    -1.436002240651213e-05, 1.6590283357431623e-05, 6.1839086914830532e-06,
+    -2.9189126508122332e-05, 1.7026328294034165e-05, 1.4577405133490984e-05,
+    -1.6610556798801746e-05, 1.2546398627188982e-05, 7.9518363785488488e-06,
+    -1.4596530978294719e-05, 3.9729030370971863e-05, 3.5344991612187848e-06,
+    -2.1007404452516587e-06, 2.0962336056140618e-05, -1.3255802366468616e-06,
+    -5.4315392199466572e-06, 2.2042635971608604e-05, 4.4189319315518505e-07,
+    2.6519618746834173e-06, 9.4793172454310515e-06, -2.6515022168022151e-06,
+    -5.3250477154570541e-06, 3.9903465123003468e-05, -1.7678165004295088e-06,
+    -9.4412052996650786e-06, 3.3682607542329102e-05, 1.326033259155257e-06,
+    -2.7774517677381372e-05, 6.9054582154060018e-05, 7.5155847186134106e-06,
+    -1.6891187595471924e-05, 2.8540977423330283e-05, 6.1904179430513628e-06,
+    -1.2011393591748742e-05, 3.8491028168052832e-05, 2.2111351527451251e-06,
+    -2.0182612617089535e-05, 3.6764467725547423e-05, 7.0766076503830933e-06,
+    -3.2263002286286868e-06, 1.8940813683532287e-05, -4.4233302878143865e-07,
+    2.3130665778858805e-06, 1.4759657461504982e-05, -3.0965074318406449e-06,
+    -2.122380718810879e-06, 1.7390184636201234e-05, -8.8476411118365572e-07,
+    -9.2110782053816953e-06, 1.0540805535863562e-05, 3.9816412385623723e-06,
+    -7.385970846235379e-06, 5.5747551146456686e-06, 3.5393532658092863e-06,
+    -1.0190798742509832e-06, 1.5839495291880556e-05, -1.3273091540449977e-06,
+    -5.0941226537176698e-06, 1.6762255505620161e-05, 8.8492312456250888e-07,
+    -6.2614369433916517e-06, 7.5962001998552964e-06, 2.6548886387159354e-06,
+    -3.0782054655370539e-06, 4.3946340176570509e-05, -3.5401695574754921e-06,
+    -5.8583931506067666e-06, 1.3033008214813346e-05, 1.7702597123053776e-06,
+    8.299813940321199e-06, 2.3160180609382852e-05, -7.5240543649032765e-06,
+    7.875745831512071e-06, 1.4150943629498425e-05, -6.1966325948653589e-06,
+    -3.6977291854145555e-05, 2.0728557780014256e-05, 1.8591178016509613e-05,
+    -3.9697210463679466e-06, 1.8783726805693401e-05, 0,
+    2.4416432653773246e-06, 3.619349997818766e-05, -5.7554115760194424e-06,
+    3.7605623067163418e-05, 8.2865806713572354e-05, -3.1439236112242031e-05,
+    -3.6063337869041145e-06, 1.7076644177771438e-05, 0,
+    1.1300235897834798e-05, 2.7359661900872023e-05, -9.7439515065189664e-06,
+    -6.1737057489019698e-06, 2.1885984717584517e-05, 8.8588535648165267e-07,
+    -1.0294294855689445e-05, 1.5664435068452054e-05, 3.9867585125141769e-06,
+    -2.5299999046365929e-05, 4.9955624177699942e-05, 8.4175228773561428e-06,
+    -3.4582445053138455e-05, 4.9778108369924468e-05, 1.3736442301029439e-05,
+    -3.838962437947846e-05, 3.4701278844806449e-05, 1.7727411553924988e-05,
+    -9.5765043773843317e-06, 1.2247164544565425e-05, 3.9890494641786622e-06,
+    -4.6916434870286627e-06, 2.2198917107418836e-05, 6.9388939039072284e-18,
+    3.1240706242080529e-06, 2.5634534628060646e-05, -4.8762049944042762e-06,
+    -9.533767964892137e-06, 1.9391743831420616e-05, 3.1032808721839777e-06,
+    -2.5477643836313568e-06, 8.3809595335382348e-06, 4.4334838131959708e-07,
+    3.7599147468814209e-06, 7.9301106442053459e-06, -3.1035222092593018e-06,
+    -3.9911621043664525e-06, 1.5211442772555817e-05, 4.433775541434759e-07,
+    -1.2803736982328062e-05, 3.1187812341071375e-05, 3.5473174705563659e-06,
+    -1.0394406985275717e-06, 1.2267492378814637e-05, -8.8689832616895004e-07,
+    3.7603149634496402e-06, 7.9301952234933637e-06, -3.1042462540556426e-06,
+    -2.9519640856595641e-06, 2.9439153728105794e-06, 1.3304151224025063e-06,
+    -1.0364492562114913e-05, 4.9450572198184162e-06, 5.3217559720514229e-06,
+    -2.2237832429841675e-05, 6.0027511710747383e-06, 1.197430899673585e-05,
+    -1.5143809505041572e-05, 1.2853499376630495e-05, 7.0962050965558965e-06,
+    9.4965360391829901e-06, 3.5901926058679035e-05, -9.7580989419851494e-06,
+    -6.966132433186556e-06, 1.4582489818615318e-05, 2.2179354360329917e-06,
+    -2.8663907342546535e-06, 1.7233069417588176e-05, -4.4361228641182082e-07,
+    -1.4908289312179357e-05, 5.2149342455010128e-05, 2.2183333205222366e-06,
+    -9.2995890928621039e-06, 5.8686763954929333e-05, -1.7750115149095524e-06,
+    -6.2232790154354012e-06, 1.4739502817884276e-05, 1.7752396705983386e-06,
+    2.2739944617183872e-06, 7.6163499017622982e-06, -2.2191358105272396e-06,
+    -3.1405190400179972e-06, 3.3230223123070779e-05, -2.219288357273308e-06,
+    -8.0282073669918352e-06, 2.3277485261874453e-05, 1.7756057913223544e-06,
+    1.6175980681459867e-06, 2.1748736002691338e-05, -3.5514875135339574e-06,
+    1.0815905184091701e-05, 7.6378241691266169e-06, -7.1032934168963058e-06,
+    8.7498238324212885e-07, 2.159153052011531e-05, -3.1078301656259355e-06,
+    -1.7039413014383054e-05, 7.1018743530437689e-06, 8.8799923565613392e-06,
+    -6.6497278457672282e-06, 5.7299360567975022e-06, 3.1080901927785232e-06,
+    -4.0359840584591744e-06, 8.0663182963069957e-06, 1.3320744745790036e-06,
+    -7.0326369089740437e-06, 3.8649841275772978e-06, 3.5522835076656767e-06,
+    -9.1120352697787732e-06, 2.8400011429452476e-05, 1.7762478897037637e-06,
+    4.1231388371310018e-06, 6.2234018723961171e-06, -3.1086195535143246e-06,
+    -5.5237180167783118e-06, 7.7517593590759049e-06, 2.2204956085791761e-06,
+    -9.8777993408072362e-06, 2.4670277643357164e-05, 2.6647539421928434e-06,
+    -2.3530750628830699e-06, 4.0532424287975655e-05, -3.5534086053473635e-06,
+    -5.5022857498587818e-06, 1.1324088960484868e-05, 1.7768635286463663e-06,
+    -3.5665245084054442e-06, 2.4220694498533479e-05, -8.8848749352221645e-07,
+    -7.7557762792335172e-06, 7.279808661608822e-06, 3.5541516677298213e-06,
+    -7.7994070211140354e-06, 1.3482065364112117e-07, 4.4427692011336783e-06,
+    -6.3550849366683648e-06, -6.6955946816382728e-06, 4.4427426622306587e-06,
+    -1.7151026677375558e-05, -1.0762986470347347e-05, 1.1106624438941837e-05,
+    -1.9360463259024407e-05, -7.6633407354309568e-06, 1.1994939431957119e-05,
+    -5.5466076527982411e-06, 4.1784122762345e-06, 2.6655500584282787e-06,
+    -1.7850329110669083e-06, 1.2110087372674272e-05, -4.4427161231819223e-07,
+    3.8044385238938938e-06, 1.5076559238380582e-05, -3.9986236481728832e-06,
+    -1.4235664230616285e-06, 1.040258552981177e-05, -4.4431009402212673e-07,
+    8.564913076866687e-06, 3.595780874443566e-06, -5.3318325946155598e-06,
+    8.2253545953814289e-06, 8.8755895020220521e-06, -5.7762382312531724e-06,
+    5.9862694758161528e-07, 3.7589284709538262e-05, -4.8879511161392664e-06,
+    3.784480648916233e-06, 1.1503921675481976e-05, -3.5551601839586833e-06,
+    1.1202093683743142e-05, 9.5044390964749148e-06, -7.5549409913402976e-06,
+    0.00036323021703028868, 0.00010161019988985664, -0.00021999390218299664,
+    4.4504294105240927e-05, 0.00019842221761978696, -4.9349648073786223e-05,
+    -1.6541893833904586e-05, 0.00017843910012688147, -1.2011423149424494e-05,
+    5.7085505260345837e-07, 0.00017846855383979454, -2.1811649795124011e-05,
+    2.2883270205359407e-05, 0.00017601903139990993, -3.4295490546155938e-05,
+    3.1827724149238734e-05, 7.8019782507765534e-05, -2.7625750262882942e-05,
+    7.8342893457539198e-06, 3.4280575192946472e-06, -4.9019418589466013e-06,
+    3.4208953441361434e-06, 9.6349505721571305e-06, -3.1194733339928726e-06,
+    0.00031704914489183444, 0.00012348787490962243, -0.00019654847395589314,
+    0.00015217165511428876, 5.3187276256805305e-05, -9.3606792794444227e-05,
+    7.5770495205962352e-05, 3.185406349814901e-05, -4.7252100838036937e-05,
+    0.00011234622617393997, 0.0001250300923810177, -7.9363472541532643e-05,
+    0.00026071335610620971, 0.00026453617776578398, -0.00018111443508248004,
+    2.1888254796528783e-05, 6.692704556893192e-05, -2.0529709442461408e-05,
+    8.7832583198138581e-05, 0.00025169622310600159, -8.0373352020220168e-05,
+    -1.3860404652038527e-05, 0.00033755544902358547, -3.2180158983034779e-05,
+    -0.00016346942323670899, 0.00037609552112422007, 4.9225713571604546e-05,
+    -0.00039493686046697396, 0.00090915047142403616, 0.0001188662780466504,
+    -0.00012336810220048289, 0.00018115474161423117, 4.9439192190185721e-05,
+    -8.4394293959108579e-05, 0.00013219826760663134, 3.2829095328028302e-05,
+    -9.0880973979037827e-05, 0.00019323614733324224, 2.9248966326576864e-05,
+    -0.00012253150553685754, 0.00034887149376033877, 2.8827041358862882e-05,
+    -0.00011352385902774209, 0.00050406006680026039, 4.9620679946557611e-06,
+    -0.00014928814367072551, 0.00022562361056344127, 5.9170613706936714e-05,
+    -0.00014209318142981153, 0.00046422693597170106, 2.6230255854790829e-05,
+    -0.00013924189124314701, 0.00019915993631253182, 5.6598314919900639e-05,
+    9.4518323567327478e-06, 4.8329734512131406e-05, -1.1324804494207419e-05,
+    -0.0002099601157100478, 0.0002752970906674812, 8.8386853007084432e-05,
+    -8.1711180897045543e-05, 0.00013269047388120292, 3.1299592070668791e-05,
+    -0.0001591912936971529, 0.0005551219177002964, 2.4979369410413343e-05,
+    -1.4564949831680218e-05, 0.00011820553929076105, -5.9111328836597421e-06,
+    -3.1061373706578466e-05, 0.00011475298579155524, 4.0939593973290944e-06,
+    -0.0001510198767750992, 0.00055682908379817153, 2.0038328038395059e-05,
+    -1.9736091556671331e-05, 4.9362878581482583e-05, 5.4707801786374466e-06,
+    -7.7710923696835965e-05, 0.00021019041942071937, 1.9612662726299634e-05,
+    -2.0291634100944034e-05, 0.00010809166968311912, -1.3690882939079718e-06,
+    1.8612432300377235e-05, 0.00010197352078455957, -2.3282557220248579e-05,
+    8.4031231090547776e-05, 0.00012278836566353979, -6.3934269254550813e-05,
+    3.1128383198339438e-05, 7.6047544265045453e-05, -2.7408274594950544e-05,
+    2.7198347148107982e-05, 5.7391477121027101e-05, -2.2844781721390039e-05,
+    1.1825866917600236e-05, 5.5960490492557025e-05, -1.3709239335933654e-05,
+    2.1398542399547749e-06, 6.1068495959104574e-05, -8.6841467423146024e-06,
+    9.9535073261047824e-06, 1.9908228757914426e-05, -8.2281471349629487e-06,
+    2.3280607436726442e-05, 0.00011005386947859908, -2.6975490086379728e-05,
+    1.9039375904611466e-05, 6.280899744171009e-05, -1.8750732176005258e-05,
+    2.5236263154343463e-06, 2.5487078329000656e-05, -4.5739789185164637e-06,
+    -1.7048875528696827e-06, 1.5690441649229836e-05, -9.1485740568580942e-07,
+    -7.2824102975155292e-06, 1.9875661531554289e-05, 1.82982733990672e-06,
+    -4.6806828065959483e-06, 5.2510535329897134e-05, -3.6601048004208936e-06,
+    1.2625496798174263e-06, 1.2743600429299118e-05, -2.2878133539364076e-06,
+    -7.677465612504486e-06, 1.8010412212443594e-05, 2.287933931276187e-06,
+    -1.3650922300295631e-05, 2.03300804283435e-05, 5.4914272906575468e-06,
+    -1.66615544752724e-06, 1.9264339329416735e-05, -1.3729532893011487e-06,
+    -4.6720830166185889e-06, 1.8637275819299859e-05, 4.5768057288508857e-07,
+    -7.0040710618834989e-06, 1.101917370294192e-05, 2.7462281433840441e-06,
+    -1.2710505103152858e-06, 2.112968248446645e-05, -1.8309205932695582e-06,
+    8.4219442653549192e-06, 1.6019984894422024e-05, -6.8663541994556931e-06,
+    -1.0859155213066574e-05, 0.0001047083668553328, -6.4098728370931557e-06,
+    -4.8859756706376434e-06, 0.00017013676008309497, -1.7864227257920196e-05,
+    -1.3141806453190186e-05, 0.00013453992182410612, -8.7074907868800455e-06,
+    -1.7294170837969802e-05, 6.4143092326884865e-05, 2.2922157613264327e-06,
+    -1.2545917089323844e-05, 1.8778749324210864e-05, 5.0436120256971972e-06,
+    -3.8313483341878563e-05, 0.00016494933544675128, 2.2932815429421716e-06,
+    -3.217740634332833e-05, 0.00017692577339917248, -2.7535469204198471e-06,
+    -2.9768443019939639e-05, 9.0067913016689261e-05, 6.4278907468406921e-06,
+    -1.6863528032318165e-05, 6.9581290733089496e-05, 1.3777874306106219e-06,
+    3.6765970443275453e-05, 0.00026438955882379656, -5.376274233062639e-05,
+    -5.1220838387794343e-06, 7.7375735277052105e-05, -6.4366803859822186e-06,
+    1.2447077151478414e-06, 4.3045884661807587e-05, -5.9781037242065405e-06,
+    -2.2499593807720486e-05, 2.44502064244978e-06, 1.2876967791702887e-05,
+    -1.56029285157816e-05, 1.4577637014068223e-05, 7.3585679045556907e-06,
+    -8.7880539967055693e-06, 1.9562782559379155e-05, 2.7596401034127305e-06,
+    -1.6234526915431813e-05, 2.5142442021452993e-05, 6.4396863007978866e-06,
+    -8.8715746104792159e-05, 0.00012413541986056043, 3.680851378632527e-05,
+    -1.7786599439600925e-05, 2.1251215434281434e-05, 7.8239541678321034e-06,
+    -7.6436165617199681e-06, 2.1583376414224809e-05, 1.841075357861266e-06,
+    -3.1263673020837102e-06, 2.252543617864422e-05, -9.2060747863831338e-07,
+    6.5408218461321388e-06, 1.3844120357431322e-05, -5.52396703268343e-06,
+    1.3196290269273936e-05, 4.5344022591708999e-06, -8.2861438475551052e-06,
+    -4.1532011002959335e-06, 3.1225555993497078e-05, -1.3811004883693134e-06,
+    5.5888122463265688e-07, 1.6162220170756747e-05, -2.3020153720673675e-06,
+    -6.9301801610549552e-06, 1.8166600629032637e-05, 1.8417196913506073e-06,
+    -4.6307972110387619e-06, 2.2211689636952858e-05, 6.9388939039072284e-18,
+    -8.0396865066167944e-06, 1.9718114350031346e-05, 2.3024785184774799e-06,
+    -9.2930434015259245e-06, 7.4725401181030549e-05, -3.6845563255935576e-06,
+    1.7503328933049511e-06, 2.1759123838172023e-05, -3.6851470883100812e-06,
+    1.5102732443594835e-05, 6.7137830737085125e-06, -9.6739058464412331e-06,
+    8.3659734994162571e-06, 8.8749185961911614e-06, -5.9887131090216594e-06,
+    6.8323215863669295e-06, 3.8863009321266073e-05, -8.753372303799134e-06,
+    5.3954507758940951e-06, 1.1821063916173102e-05, -4.6074005921256656e-06,
+    5.5194636754546389e-06, 2.2543571091160342e-05, -5.9899349683159575e-06,
+    1.7820260681422617e-05, 4.6498799969707516e-05, -1.6128439854837251e-05,
+    1.5606161192657786e-05, 4.9601654695474728e-05, -1.5209030378833532e-05,
+    1.3935788669053317e-05, 3.4990580778604397e-05, -1.2445347489641045e-05,
+    1.2955551157670109e-05, 4.7264636959087891e-05, -1.3368899713921134e-05,
+    1.5845488402416175e-05, 3.7168519076480333e-05, -1.3831669017250192e-05,
+    1.2877083860399208e-05, 4.011523907782033e-05, -1.2449952603514614e-05,
+    6.1840219027498033e-06, 4.5853063243617154e-05, -9.2234227623833043e-06,
+    1.0943290696757701e-05, 0.00012884378162003607, -2.214240374154991e-05,
+    1.6865299878973672e-05, 8.9071133668183755e-05, -2.0765697172832331e-05,
+    2.1755758639052658e-07, 1.787129113273167e-05, -2.3076892988957431e-06,
+    1.6171253403238217e-05, 6.218518215017621e-05, -1.7079038256505308e-05,
+    1.8573028369495148e-05, 4.3073872403431857e-05, -1.6158433380153436e-05,
+    3.8994546023574106e-06, 4.1808438494495004e-05, -7.3876798127175958e-06,
+    3.9459186001317148e-06, 1.5079602979195528e-05, -4.1559447843259045e-06,
+    2.3946248083370203e-05, 5.1316188248273775e-05, -2.0319962414215575e-05,
+    2.7078778154082661e-06, 3.6212153753101273e-05, -6.0044288374139221e-06,
+    3.948338024764575e-06, 1.5079289936770213e-05, -4.1572509154944037e-06,
+    6.6058996212370324e-05, 0.0001099525797280676, -5.2206009165028933e-05,
+    -1.0171830095856427e-06, 8.7013020275139574e-06, -4.6207938030756734e-07,
+    -2.5163021433100008e-05, 0.00038335031908076633, -3.1904154700661269e-05,
+    -1.1672794063138925e-06, 0.00019938337437086506, -2.3603961397757056e-05,
+    -2.6035181240058325e-07, 8.857842881349054e-06, -9.2596024851149261e-07,
+    1.1786705874650139e-05, 3.8087062217306844e-05, -1.1575343607683752e-05,
+    3.2061938153582492e-06, 1.4922337129630314e-05, -3.7044112079567815e-06,
+    1.8652021409965025e-05, 1.6336641783798456e-05, -1.2966004076547799e-05,
+    -9.1256761837466005e-06, 2.1281499986647301e-05, 2.7785908342167764e-06,
+    6.7685502415232301e-06, 2.8135322850619815e-05, -7.4101780888624624e-06,
+    1.5662017439563303e-05, 4.6015469319815594e-05, -1.4822034693814934e-05,
+    1.7242308415377217e-05, 2.3171458139459311e-05, -1.2970598502581865e-05,
+    -7.260949771853431e-07, 3.0148305129706898e-05, -3.242913258399982e-06,
+    -9.9260189166255897e-06, 1.7552079869531667e-05, 3.7064878855713745e-06,
+    -3.8749505437585263e-05, 8.9555171045585524e-07, 2.2703292859693747e-05,
+    -1.8583824106660485e-05, 1.7542177477070098e-05, 8.803752128958009e-06,
+    -3.8648944211544523e-06, 4.9104812251565821e-05, -3.7072734547227704e-06,
+    -1.4362694030822798e-05, 2.3762422867057431e-05, 5.5616043330708465e-06,
+    -1.2806405964807532e-05, 2.7648966230475747e-05, 4.1715906908823541e-06,
+    4.1781598125553709e-05, 5.6766789157780551e-05, -3.1522710338294235e-05,
+    -3.3916706777964434e-06, 2.781483868929957e-05, -1.3908813688984223e-06,
+    -7.26188280721074e-06, 1.9885229330385279e-05, 1.8546591805598811e-06,
+    -1.6369128663124011e-05, 1.4436688006269627e-05, 7.8828047196041751e-06,
+    1.1189378787829218e-06, 5.548216267958761e-05, -7.4199929541232668e-06,
+    -7.1414023819105221e-05, 0.0002614806421750715, 1.0207996000578812e-05,
+    3.6024587348998383e-05, 4.666104900613588e-05, -2.692580790477489e-05,
+    5.3272473120313801e-07, 3.9319624304312573e-05, -5.1072702152502036e-06,
+    -6.7144228997062516e-06, 3.2474380827762772e-05, -6.9388939039072284e-18,
+    1.3021569010146505e-05, 4.3683448594289409e-05, -1.300345247691459e-05,
+    2.1589207239533503e-05, 3.6541846320958804e-05, -1.7185175761186278e-05,
+    1.3436893292889662e-06, 4.3050428977953192e-05, -6.0387697582431343e-06,
+    -6.7100019155025281e-06, 3.2475294599265681e-05, 0,
+    -2.9687923300034114e-05, 5.9806805622453219e-05, 1.0222388730746212e-05,
+    7.8001897941132325e-06, 1.9433914445199374e-05, -6.9707597299822899e-06,
+    7.7513492994923938e-05, 2.1355884936513636e-05, -4.833242091804163e-05,
+    1.3446158551602694e-05, 1.8814715836090734e-05, -1.0224521476080717e-05,
+    1.5260981059805889e-05, 1.3842246798512203e-05, -1.0689736982247289e-05,
+    4.2291272776551203e-06, 3.2950458558389517e-05, -6.5072488385567451e-06,
+    -2.8413686542994032e-05, 4.225340011149159e-05, 1.162160203917878e-05,
+    -1.0224240151734953e-07, 1.9582102142534641e-05, -2.3245762625981325e-06,
+    1.7429829627949034e-05, 7.1608338610973377e-06, -1.1158386203705128e-05,
+    3.2741666379093592e-06, 1.8496418034308348e-05, -4.1845402619089533e-06,
+    -3.0155853552052414e-05, 0.00034484769200449072, -2.4191837576681419e-05,
+    0.00012013773838609465, -5.5361992828406592e-06, -7.0285993040555828e-05,
+    5.3165604249699738e-05, 2.0360570172628378e-06, -3.1649955429625953e-05,
+    1.5344456181135002e-05, 4.4141500862793226e-05, -1.4429407838446873e-05,
+    2.0886578715323401e-05, 3.6370840069577248e-05, -1.6758720060891519e-05,
+    0.00017417330165096778, 0.00025315825229721423, -0.00013365836180431051,
+    1.3777844090706592e-05, 1.3516673494640141e-05, -9.7835027990378354e-06,
+    5.9194542564589003e-06, 1.7249252741269316e-05, -5.5908155784031854e-06,
+    3.7836379601099979e-05, -1.5402208920767269e-05, -2.0499419935600394e-05,
+    8.68928436426053e-06, -2.3161342985578148e-05, -2.3292976291944267e-06,
+    1.4904953906810792e-05, -1.1197362725923199e-05, -7.4532781098590739e-06,
+    1.4074615386494571e-05, 8.2298355347232288e-06, -9.316462893912969e-06,
+    4.0468130529172641e-05, -3.981033490135788e-05, -1.9097423015659865e-05,
+    1.2912517219756947e-05, 6.2085281303803086e-06, -8.3836281906390919e-06,
+    1.7357436570691887e-06, 1.4608136476412792e-05, -2.7946235731934888e-06,
+    -7.5524465352611037e-06, 7.1497259843955607e-05, -4.1925295530056972e-06,
+    9.5669235410378306e-06, 5.7187534317049149e-05, -1.2580208212716049e-05,
+    1.1108507165458192e-05, 1.118229026930706e-05, -7.9216965690048768e-06,
+    3.2718676114609768e-05, -2.8932536583037294e-05, -1.5842705850449557e-05,
+    2.7827889666390271e-05, -2.8153417539200642e-05, -1.3045462717395373e-05,
+    1.3624976223911012e-05, -2.0371448318401431e-05, -5.5903951586694367e-06,
+    1.2688186771206422e-05, -8.0929351042313691e-06, -6.5217692612751232e-06,
+    2.3172237849158894e-05, -3.6233630080595436e-05, -9.3160317028231909e-06,
+    6.2091209334036446e-05, -3.0058020368650684e-05, -3.3067416222422319e-05,
+    1.6461693361807805e-05, 1.5834616721721595e-05, -1.1642883836086859e-05,
+    6.395438235731743e-06, 2.268380396341918e-05, -6.5203733433730204e-06,
+    -1.1938596708449545e-07, 1.6008170795389631e-05, -1.8630769925073731e-06,
+    1.756961715114469e-05, 1.4278102825227013e-05, -1.2110525934264094e-05,
+    2.9649387104646596e-06, 2.0200827064886795e-05, -4.1923112863440082e-06,
+    -4.5411311156984269e-06, 2.2230194950401128e-05, 1.3877787807814457e-17,
+    5.2349121116568309e-06, 2.0664377086587749e-05, -5.5905245178802798e-06,
+    4.128459108243554e-06, 4.5377192340934069e-05, -7.9207343982520828e-06,
+    -8.1551364917997748e-07, 1.9428339012472762e-05, -1.8638962622566368e-06,
+    1.7224934348372689e-05, 1.5986632962539105e-05, -1.2115956374736392e-05,
+    1.5135220285400486e-06, 2.3466331660226825e-05, -3.7282021946999366e-06,
+    2.6829873961728423e-05, 2.6852281302502945e-05, -1.9108417564757396e-05,
+    -4.2946242572061699e-05, 4.8235999195511692e-05, 1.9576966997926493e-05,
+    -5.2951957800889682e-06, 2.2076246372904063e-05, 4.6617891161226943e-07,
+    1.048587870783324e-06, 1.8027369617423794e-05, -2.797259463900581e-06,
+    1.2515793738121506e-05, 2.7493305031101034e-05, -1.0723571930021381e-05,
+    2.4444662614878099e-05, -3.9178649842153135e-06, -1.3987631653021582e-05,
+    1.7638734804592548e-05, 1.7849073382814051e-05, -1.2588977662229828e-05,
+    3.7834118726209898e-05, 7.7165573681425847e-06, -2.3313460717558354e-05,
+    2.5260132929916246e-05, -1.9359112218841901e-07, -1.4920485476722922e-05,
+    4.8996758358940684e-05, -2.3857245385672243e-05, -2.6109189001602418e-05,
+    4.8783728266166282e-06, -2.3942673644028467e-05, -6.9388939039072284e-18,
+    2.1535056436941535e-05, 2.606086813905506e-06, -1.3052783102415755e-05,
+    4.2516954428098441e-05, -5.0119064327502905e-05, -1.9111125014549535e-05,
+    3.6365218834405466e-05, -1.218894241566959e-05, -2.0040825240985605e-05,
+    4.7455071640958857e-05, -4.7337964043325798e-05, -2.2368372175382567e-05,
+    3.2246958079615307e-05, 1.1902944312025543e-05, -2.050262169824707e-05,
+    3.5030055648047065e-05, -1.7821708517828938e-06, -2.0502503111030634e-05,
+    3.6236004722217663e-05, -1.9349812429181323e-05, -1.9103500165776333e-05,
+    4.1776416875333178e-05, -3.9788128782247689e-06, -2.422728790171802e-05,
+    0.00016062609482664358, 6.6433290616618734e-05, -0.00010296954471668285,
+    2.7621389430521059e-05, 2.6968507584268497e-05, -1.9570627744491809e-05,
+    8.3533990751227805e-06, -1.7896058562949513e-05, -2.7958120515647611e-06,
+    6.2594810901206444e-07, -4.9735772268966194e-05, 5.5909934395179106e-06,
+    1.657958239981161e-05, -4.2941066638602088e-05, -4.658433556029018e-06,
+    8.0029523745472897e-06, -5.8925626660322195e-05, 2.3288125488366007e-06,
+    6.413120107150172e-05, -0.00031645299389959636, 6.9388939039072284e-18,
+    1.6038394608092199e-06, -0.00029529295815522438, 3.4409605320188941e-05,
+    3.8395006623601069e-05, -0.0001311207090715083, -6.9699921647140006e-06,
+    8.3508576723678729e-06, -1.7896078962742479e-05, -2.787277980156877e-06,
+    1.1818580420097646e-05, -3.5001458537464725e-05, -2.7870194990731179e-06,
+    3.8262057840257602e-05, -0.000138271534116996, -6.0367396330085477e-06,
+    4.2613761525256422e-05, -0.00029944537279297245, 1.0672490880332675e-05,
+    1.138338796725924e-05, -6.0021464423298809e-05, 4.6374148620492717e-07,
+    6.755740130284793e-05, -0.0001198674076799966, -2.5497641411305338e-05,
+    3.6687286708234068e-05, -7.6263483022920298e-05, -1.2512592668212363e-05,
+    -1.7213226344278687e-05, -1.5953636949117556e-05, 1.2047274730961344e-05,
+    -6.6005133509822178e-06, -3.3392435772661155e-05, 7.8764925554378196e-06,
+    -1.7557887624849999e-05, -1.4244210522595946e-05, 1.2045561034450258e-05,
+    -1.9683086667901528e-05, -5.0293263291978363e-05, 1.7603415085519492e-05,
+    9.669011390779636e-05, -0.00013176916536883354, -4.1215763041398124e-05,
+    2.8968783077482074e-06, -6.5361829425514273e-06, -9.2595755891294873e-07,
+    4.8413175187264623e-05, -7.2107700175572109e-05, -1.9905196101135947e-05,
+    9.3968959742243841e-05, -0.00013411703676835529, -3.93323928054648e-05,
+    3.8825369729572623e-05, -5.9809653869091761e-05, -1.5727289000455613e-05,
+    0.00020653251691429841, -0.00025205130790595387, -9.1534288626606009e-05,
+    6.6167586113760612e-05, -0.00010593585800650063, -2.6333008806209146e-05,
+    0.00030666797224701559, -0.00058624506058274628, -0.00011073679907754735,
+    4.7660044217662234e-05, -6.5176714762971155e-05, -2.0277761735333633e-05,
+    0.00012880517169931716, -0.00018771554152546832, -5.3434318728111385e-05,
+    6.2250741657332576e-05, -8.7176300006042151e-05, -2.6243051484707569e-05,
+    0.00027341646495486482, -0.00024060721088370318, -0.00013205053004511358,
+    9.7792026585871716e-05, 8.7238649990439843e-05, -6.7610392457374824e-05,
+    0.00014266088298076074, 0.00011397895768089361, -9.7070560627826596e-05,
+    7.7252094682636607e-05, 0.00012756043154799057, -6.0286073356050074e-05,
+    1.5709252828663423e-05, 1.5594293506115964e-05, -1.1047032020011782e-05,
+    1.5980652629643544e-05, 1.0308436802330956e-05, -1.0587078626153601e-05,
+    8.7095911707801843e-05, 3.5168452473977041e-05, -5.5239186675909435e-05,
+    2.6202579823941807e-05, 1.4120692805597024e-05, -1.7032827678474527e-05,
+    5.8711735817090771e-05, 2.4152828324464082e-05, -3.728938689390171e-05,
+    1.8249192476241238e-05, 1.0751851147794422e-05, -1.1969816787853194e-05,
+    3.2533868567011237e-05, 2.9609772252192634e-05, -2.2559619057213598e-05,
+    1.2556797492679905e-05, 7.8371314248260049e-06, -8.2875936297729935e-06,
+    5.9458758907171561e-05, 5.9871754805818078e-05, -4.1902054642765918e-05,
+    8.1767306595884048e-05, 6.607036421546475e-05, -5.5724852965857719e-05,
+    1.9236496260996439e-05, 2.1613344262261247e-05, -1.3817609889041349e-05,
+    2.3275607884246097e-05, 1.7075616658479564e-05, -1.5660733893786694e-05,
+    0.00018484502381434231, 8.8240235568304293e-05, -0.00011884979976707621,
+    0.00015194579532654129, 7.6312260064159698e-05, -9.813591417659473e-05,
+    0.00017621682092944235, 8.4594016943995154e-05, -0.00011335790611248509,
+    5.8977660074316374e-05, 0.0011393784650097771, -0.00016667122576399102,
+    6.8997248794708255e-05, 0.0002963546555796448, -7.4967047437694834e-05,
+    1.7643055485044856e-06, 1.1017807338864483e-05, -2.3149073452369273e-06,
+    3.1516824157015733e-05, 0.00012356812908020931, -3.2878558727626739e-05,
+    4.8169458775809693e-05, 9.4810732746364312e-05, -3.9374687806063846e-05,
+    0.00010026731648413167, 0.00019391699463233714, -8.1563327279834952e-05,
+    1.6654091062981435e-05, 1.9262699663791238e-05, -1.2052871016965394e-05,
+    0.00053574830901620407, 0.00039067115034890909, -0.00036130060078983645,
+    9.4767336780529621e-05, 8.238961170731196e-05, -6.5433276029196186e-05,
+    0.00035851532431571687, 0.00033954148762010972, -0.00025073211430493708,
+    5.4877180240595069e-05, 3.7244590197882399e-05, -3.6698947236325774e-05,
+    0.0019023738305697091, 0.0012272591757863105, -0.0012649265326772074,
+    -6.6709425244532161e-05, 0.0023154636383806992, -0.00021838833707514549,
+    -0.00013091182239394206, 0.0046109656870132465, -0.00043604579312236241,
+    0.019242467978851263, 0.029541872781667033, -0.014893406046599195,
+    0.01981043855571147, 0.0021695958791069225, -0.012938892087668134,
+    0.041108857273704585, -0.05054110477248247, -0.023734209813051257,
+    0, -0.052335956242943904, 0
+};
+
+static const mgp::math::PreparedPolygon::Geometry enor_fir_geometry = {
+    2258, enor_fir_points, enor_fir_vertices, enor_fir_normals,
+    { 0.37045225066340404, 0.14040538387062082, 0.91817833679441718 }, 0.2115389049318214, 0.97770895678274905,
+    { 0.38259283405706662, -1.5550883635269477 }, { 0.014571674811775804, 0.0058639671140004873, -0.99987663248166059 }
+};
+
+// ENOB_FIR
+
+static const double enob_fir_points[] = {
+    0, 1.0995574287564276,
+    0.069813170079773182, 1.0995574287564276,
+    0.087523375065610032, 1.1170107212763709,
+    0.10937402463595305, 1.1367905376892227,
+    0.11939029468022332, 1.1452553845613951,
+    0.12217304763960307, 1.1475539831862716,
+    0.13452613901936852, 1.1556016963672175,
+    0.16445364876916568, 1.1737339219661866,
+    0.26179938779914941, 1.2217304763960306,
+    0.31395157117799199, 1.2300312623185157,
+    0.43633231299858238, 1.245000951312871,
+    0.48869219055841229, 1.245000951312871,
+    0.52359877559829882, 1.2391837689159739,
+    0.52359877559829882, 1.4311699866353502,
+    0, 1.4311699866353502
+};
+
+static const double enob_fir_vertices[] = {
+    0.4539904997395468, 0, 0.89100652418836779,
+    0.45288460169966399, 0.031668776375164021, 0.89100652418836779,
+    0.43669318207342195, 0.0383187560831518, 0.89879404629916704,
+    0.41799587537443827, 0.045901070539595239, 0.90728856484212128,
+    0.40987490296198803, 0.04916892640409886, 0.91081555794692548,
+    0.40765741656804633, 0.050054036892120034, 0.91176204357708845,
+    0.39972360086692199, 0.054100021571609036, 0.91503783013377815,
+    0.3814934370719234, 0.063309756918858609, 0.92220097167045179,
+    0.3303660895493522, 0.088521326901376887, 0.93969262078590832,
+    0.31787238889798236, 0.10321001477760781, 0.94249925051741867,
+    0.29007506623922402, 0.13526422482716866, 0.94739645630971991,
+    0.28259834589058808, 0.1502602058819586, 0.94739645630971991,
+    0.2819502924231137, 0.16278407722857835, 0.94551857559931674,
+    0.12052744095487315, 0.069586550480032719, 0.99026806874157036,
+    0.13917310096006547, 0, 0.99026806874157036
+};
+
+static const double enob_fir_normals[] = {
+    -0.028217086363333591, -0.00098536236862267756, 0.014377323612700667,
+    -0.0056785540092938215, -0.017953509372229892, 0.003524435858702794,
+    -0.0064894397065281897, -0.020514526275580425, 0.0040276025622758282,
+    -0.0028029954981201172, -0.008842333975496719, 0.0017387116002346679,
+    -0.00075963472069966176, -0.0024076618129557081, 0.00047181600069412521,
+    -0.003525008918493229, -0.0085691507019495794, 0.0020464951657137402,
+    -0.0080397301365990742, -0.019544566250517481, 0.0046676008305973626,
+    -0.022142742281606433, -0.053822638905359599, 0.012854908430170224,
+    -0.01355440501836748, -0.012667453597612344, 0.0059586033338492467,
+    -0.029705628265446607, -0.027755642276394377, 0.013058110405080002,
+    -0.014207139310195682, -0.0070834183631164338, 0.0053612929799981002,
+    -0.012147242075233322, -8.3277576044649138e-05, 0.0036366019741464958,
+    0.09540449768827243, -0.1652454372666754, 0,
+    0.068909338954249791, 0.018464201723753723, -0.0096845760154202851,
+    0, 0.3255681544571567, 0
+};
+
+static const mgp::math::PreparedPolygon::Geometry enob_fir_geometry = {
+    15, enob_fir_points, enob_fir_vertices, enob_fir_normals,
+    { 0.34385670862937356, 0.069950839447079249, 0.93641307337692747 }, 0.23023947462191699, 0.9736117722556864,
+    { 0.22368178090802868, -1.5550883635269477 }, { 0.015316006618948181, 0.0034842156050617903, -0.99987663248166059 }
+};
+
+#endif // FIR_TABLES_H
@@ -10,6 +10,9 @@
 #include <QXmlSchemaValidator>
 #include <QAbstractMessageHandler>
 #include <QPointF>
+#include <QBuffer>
+#include <QLocale>
+#include <QXmlStreamReader>
 
 KML_BEGIN_NAMESPACE
 
@@ -303,10 +306,191 @@ mgp::Polygons kml2polygons(const QByteArray &kml, const QUrl &docUri, QString *e
     return createFromDomDocument(doc, error);
 }
 
+// Builds a polygon from the text of a <coordinates> element as it arrives in one or more chunks. The coordinates are parsed
+// directly from the chunks; a QString is only created for a coordinate that is split between two chunks.
+class CoordinatesParser
+{
+public:
+    CoordinatesParser();
+    void reset();
+    // Parses the complete coordinates in \a text. Returns false and a failure reason in \a error upon failure.
+    bool addText(const QStringRef &text, QString *error);
+    // Parses the last coordinate (if any). Returns false and a failure reason in \a error upon failure.
+    bool finish(QString *error);
+    mgp::Polygon polygon() const { return polygon_; }
+
+private:
+    bool addCoordinate(const QStringRef &coord, QString *error);
+    const QLocale cLocale_;
+    mgp::Polygon polygon_;
+    QString partial_; // last coordinate of the previous chunk if not followed by whitespace
+};
+
+CoordinatesParser::CoordinatesParser()
+    : cLocale_(QLocale::c())
+{
+    reset();
+}
+
+void CoordinatesParser::reset()
+{
+    polygon_ = mgp::Polygon(new QVector<mgp::Point>());
+    partial_.clear();
+}
+
+bool CoordinatesParser::addText(const QStringRef &text, QString *error)
+{
+    const int size = text.size();
+    const QChar *chars = text.unicode();
+    int i = 0;
+
+    // complete a coordinate that was split from the previous chunk
+    if (!partial_.isEmpty()) {
+        while ((i < size) && (!chars[i].isSpace()))
+            ++i;
+        partial_.append(text.mid(0, i));
+        if (i == size)
+            return true;
+        const QString coord = partial_;
+        partial_.clear();
+        if (!addCoordinate(QStringRef(&coord), error))
+            return false;
+    }
+
+    while (true) {
+        while ((i < size) && chars[i].isSpace())
+            ++i;
+        if (i == size)
+            return true;
+        const int start = i;
+        while ((i < size) && (!chars[i].isSpace()))
+            ++i;
+        if (i == size) {
+            // the coordinate may continue in the next chunk
+            partial_ = text.mid(start).toString();
+            return true;
+        }
+        if (!addCoordinate(text.mid(start, i - start), error))
+            return false;
+    }
+}
+
+bool CoordinatesParser::finish(QString *error)
+{
+    if (partial_.isEmpty())
+        return true;
+    const QString coord = partial_;
+    partial_.clear();
+    return addCoordinate(QStringRef(&coord), error);
+}
+
+// Parses a coordinate of the form lon,lat[,alt] (empty components are skipped as in QString::split()).
+bool CoordinatesParser::addCoordinate(const QStringRef &coord, QString *error)
+{
+    QStringRef comps[2];
+    int ncomps = 0;
+    int start = 0;
+    for (int i = 0; i <= coord.size(); ++i) {
+        if ((i < coord.size()) && (coord.at(i) != QLatin1Char(',')))
+            continue;
+        if (i > start) {
+            if (ncomps < 2)
+                comps[ncomps] = coord.mid(start, i - start);
+            ncomps++;
+        }
+        start = i + 1;
+    }
+
+    if (ncomps < 2) {
+        *error = QString("expected at least two components (i.e. lon, lat) in coordinate, found %1: %2")
+                .arg(ncomps).arg(coord.toString());
+        return false;
+    }
+    bool ok;
+    const double lon = cLocale_.toDouble(comps[0], &ok);
+    if (!ok) {
+        *error = QString("failed to convert longitude string to double value: %1").arg(comps[0].toString());
+        return false;
+    }
+    const double lat = cLocale_.toDouble(comps[1], &ok);
+    if (!ok) {
+        *error = QString("failed to convert latitude string to double value: %1").arg(comps[1].toString());
+        return false;
+    }
+    polygon_->append(qMakePair(DEG2RAD(lon), DEG2RAD(lat)));
+    return true;
+}
+
+bool readPolygons(QIODevice *device, PolygonHandler *handler, QString *error)
+{
+    *error = QString();
+
+    QXmlStreamReader reader(device);
+    CoordinatesParser parser;
+    bool inCoords = false;
+
+    while (!reader.atEnd()) {
+        switch (reader.readNext()) {
+        case QXmlStreamReader::StartElement:
+            if ((!inCoords) && (reader.qualifiedName() == QLatin1String("coordinates"))) {
+                inCoords = true;
+                parser.reset();
+            }
+            break;
+        case QXmlStreamReader::Characters:
+            if (inCoords && (!parser.addText(reader.text(), error)))
+                return false;
+            break;
+        case QXmlStreamReader::EndElement:
+            if (inCoords && (reader.qualifiedName() == QLatin1String("coordinates"))) {
+                inCoords = false;
+                if (!parser.finish(error))
+                    return false;
+                if (!handler->handlePolygon(parser.polygon()))
+                    return true;
+            }
+            break;
+        default:
+            break;
+        }
+    }
+
+    if (reader.hasError()) {
+        *error = QString("failed to read KML structure: %1 (line %2, column %3)")
+                .arg(reader.errorString()).arg(reader.lineNumber()).arg(reader.columnNumber());
+        return false;
+    }
+
+    return true;
+}
+
+// Collects the polygons read from a KML structure.
+class PolygonCollector : public PolygonHandler
+{
+public:
+    PolygonCollector() : polygons_(new QVector<mgp::Polygon>) {}
+    virtual bool handlePolygon(const mgp::Polygon &polygon) { polygons_->append(polygon); return true; }
+    mgp::Polygons polygons() const { return polygons_; }
+private:
+    mgp::Polygons polygons_;
+};
+
+// Returns the polygons found in a KML structure read from \a device. Sets \a error to a non-empty string iff the operation fails.
+mgp::Polygons kml2polygons(QIODevice *device, QString *error)
+{
+    PolygonCollector collector;
+    if (!readPolygons(device, &collector, error))
+        return mgp::Polygons(new QVector<mgp::Polygon>);
+    return collector.polygons();
+}
+
 // Returns the polygons found in a KML structure. Sets \a error to a non-empty string iff the operation fails.
 mgp::Polygons kml2polygons(const QByteArray &kml, QString *error)
 {
-    return kml2polygons(kml, QUrl(), error);
+    QBuffer buffer;
+    buffer.setData(kml);
+    buffer.open(QIODevice::ReadOnly);
+    return kml2polygons(&buffer, error);
 }
 
 KML_END_NAMESPACE
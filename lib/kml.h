@@ -5,12 +5,29 @@
 #include <QString>
 #include <QByteArray>
 
+class QIODevice;
+
 #define KML_BEGIN_NAMESPACE namespace kml {
 #define KML_END_NAMESPACE }
 
 KML_BEGIN_NAMESPACE
 
 mgp::Polygons kml2polygons(const QByteArray &, QString *);
+mgp::Polygons kml2polygons(QIODevice *, QString *);
+
+// Interface for receiving polygons one by one as they are read from a KML structure.
+class PolygonHandler
+{
+public:
+    virtual ~PolygonHandler() {}
+    // Handles a polygon read from a <coordinates> element. Returns false to stop reading.
+    virtual bool handlePolygon(const mgp::Polygon &) = 0;
+};
+
+// Reads the polygons of a KML structure from \a device without loading the whole structure into memory, and passes each
+// polygon to \a handler as soon as its <coordinates> element has been read.
+// Returns true upon success (or if the handler stopped the reading), otherwise false and a failure reason in \a error.
+bool readPolygons(QIODevice *device, PolygonHandler *handler, QString *error);
 
 KML_END_NAMESPACE
 
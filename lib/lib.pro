@@ -2,11 +2,33 @@ TEMPLATE = lib
 CONFIG += staticlib debug
 QT += xml xmlpatterns widgets
 TARGET = mgp 
-SOURCES += mgpmath.cpp mgp.cpp xmetareaedit.cpp xmetareaeditdialog.cpp polygonintersector.cpp kml.cpp
-HEADERS += mgpmath.h mgp.h xmetareaedit.h xmetareaeditdialog.h data/enor_fir.h data/enob_fir.h data/norway_municipalities.kml polygoninterse
+SOURCES += mgpmath.cpp mgp.cpp xmetareaedit.cpp xmetareaeditdialog.cpp polygonintersector.cpp kml.cpp polybin.cpp polygonstore.cpp polygongenerator.cpp tracing.cpp
+HEADERS += mgpmath.h mgp.h xmetareaedit.h xmetareaeditdialog.h data/enor_fir.h data/enob_fir.h data/fir_tables.h data/norway_municipalities.kml polygonintersector.h kml.h polybin.h polygonstore.h polygongenerator.h tracing.h parallel.h
 
 RESOURCES = mgp.qrc
 
+# 'qmake CONFIG+=mgp_stats' makes math::polygonIntersection() record per-phase wall time and counters (see math::intersectionStats()).
+mgp_stats {
+    DEFINES += MGP_INTERSECTION_STATS
+}
+
+# The municipality polygons are embedded in the binary format of polybin.h (converted from the KML file by
+# ../tools/kml2polybin) so that they can be loaded without parsing any XML at run time. The converted file is committed and
+# is only regenerated when the KML file is newer (the tool itself is not a dependency, so a clean build leaves the source tree alone).
+KML2POLYBIN = ../tools/kml2polybin/kml2polybin
+polybin.target = $$PWD/data/norway_municipalities.polybin
+polybin.depends = $$PWD/data/norway_municipalities.kml
+polybin.commands = $$KML2POLYBIN $$PWD/data/norway_municipalities.kml $$PWD/data/norway_municipalities.polybin
+QMAKE_EXTRA_TARGETS += polybin
+PRE_TARGETDEPS += $$PWD/data/norway_municipalities.polybin
+
+# The prepared FIR geometry in data/fir_tables.h is generated from the FIR tables by ../tools/firtables so that FIR::instance()
+# doesn't have to compute it at run time. The generated file is committed; run 'make firtables' after changing a FIR table or
+# the preparation code in mgpmath.cpp.
+FIRTABLES = ../tools/firtables/firtables
+firtables.commands = $$FIRTABLES $$PWD/data/fir_tables.h
+QMAKE_EXTRA_TARGETS += firtables
+
 target.path = /usr/lib
 INSTALLS += target
 
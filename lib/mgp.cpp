@@ -1,15 +1,20 @@
 #include "mgp.h"
 #include "mgpmath.h"
-#include "data/enor_fir.h"
-#include "data/enob_fir.h"
+#include "data/fir_tables.h"
+#include "parallel.h"
 #include "polygonintersector.h"
-#include "kml.h"
+#include "polygonstore.h"
+#include "polybin.h"
+#include "tracing.h"
 #include <QBitArray>
-#include <QRegExp>
+#include <QVarLengthArray>
 #include <QStack>
-#include <QFile>
+#include <QResource>
 #include <QStringList>
+#include <QMutex>
+#include <QThread>
 #include <algorithm>
+#include <cstring>
 
 #include <QDebug>
 
@@ -64,6 +69,24 @@ QString xmetFormatLat(double val)
             .arg(QString("%1").arg(fpart, 2, 10, QLatin1Char('0')));
 }
 
+QString jsonString(const QString &s)
+{
+    QString result("\"");
+    for (int i = 0; i < s.size(); ++i) {
+        const QChar c = s.at(i);
+        if (c == QLatin1Char('"'))
+            result += "\\\"";
+        else if (c == QLatin1Char('\\'))
+            result += "\\\\";
+        else if (c.unicode() < 0x20)
+            result += QString("\\u%1").arg(c.unicode(), 4, 16, QLatin1Char('0'));
+        else
+            result += c;
+    }
+    result += "\"";
+    return result;
+}
+
 // Returns the longitude value in radians ([-M_PI, M_PI]) corresponding to a SIGMET/AIRMET longitude degrees expression.
 // Examples:
 //   E00000 -> 0
@@ -125,6 +148,122 @@ static double xmetExtractLat(const QString &s, bool &success)
     return lat;
 }
 
+// Returns the lower-case Latin-1 form of the character at a given position in a SIGMET/AIRMET expression, or 0 if the position is
+// outside the expression or the character has no such form.
+static char xmetLowerAt(const QString &expr, int pos)
+{
+    return ((pos >= 0) && (pos < expr.size())) ? expr.at(pos).toLower().toLatin1() : 0;
+}
+
+// Returns true iff a lower-case literal occurs (ignoring case) at a given position in a SIGMET/AIRMET expression.
+static bool xmetLiteralAt(const QString &expr, int pos, const char *literal)
+{
+    for (int i = 0; literal[i] != 0; ++i)
+        if (xmetLowerAt(expr, pos + i) != literal[i])
+            return false;
+    return true;
+}
+
+// Returns true iff n digits occur at a given position in a SIGMET/AIRMET expression.
+static bool xmetDigitsAt(const QString &expr, int pos, int n)
+{
+    if ((pos + n) > expr.size())
+        return false;
+    for (int i = pos; i < (pos + n); ++i)
+        if (!expr.at(i).isDigit())
+            return false;
+    return true;
+}
+
+// Returns true iff a latitude degrees expression (e.g. N6030) occurs at a given position in a SIGMET/AIRMET expression.
+static bool xmetLatAt(const QString &expr, int pos)
+{
+    const char c = xmetLowerAt(expr, pos);
+    return ((c == 'n') || (c == 's')) && xmetDigitsAt(expr, pos + 1, 4);
+}
+
+// Returns true iff a longitude degrees expression (e.g. E01015) occurs at a given position in a SIGMET/AIRMET expression.
+static bool xmetLonAt(const QString &expr, int pos)
+{
+    const char c = xmetLowerAt(expr, pos);
+    return ((c == 'e') || (c == 'w')) && xmetDigitsAt(expr, pos + 1, 5);
+}
+
+// Length of a coordinate in a SIGMET/AIRMET expression (e.g. N6030 E01015).
+static const int xmetCoordinateLength = 12;
+
+// Returns true iff a coordinate (e.g. N6030 E01015) occurs at a given position in a SIGMET/AIRMET expression.
+static bool xmetCoordinateAt(const QString &expr, int pos)
+{
+    return xmetLatAt(expr, pos) && (xmetLowerAt(expr, pos + 5) == ' ') && xmetLonAt(expr, pos + 6);
+}
+
+// Returns the point corresponding to a coordinate known to occur at a given position in a SIGMET/AIRMET expression.
+static Point xmetExtractCoordinate(const QString &expr, int pos, bool &success)
+{
+    bool ok1 = false;
+    bool ok2 = false;
+    const double lon = xmetExtractLon(expr.mid(pos + 6, 6), ok1);
+    const double lat = xmetExtractLat(expr.mid(pos, 5), ok2);
+    success = ok1 && ok2;
+    return qMakePair(lon, lat);
+}
+
+// Finds in a single pass the first occurrence in a SIGMET/AIRMET expression of the keyword of each line filter type (e.g. 'E OF' or
+// 'NE OF LINE') that is either at the beginning of the expression or preceded by whitespace. The position of each keyword is
+// stored in keywordPos (indexed by filter type, -1 if not found).
+static void findXmetKeywords(const QString &expr, int *keywordPos)
+{
+    for (int type = 0; type <= FilterBase::SW_OF_LINE; ++type)
+        keywordPos[type] = -1;
+
+    for (int pos = 0; pos < expr.size(); ++pos) {
+        if ((pos > 0) && (!expr.at(pos - 1).isSpace()))
+            continue; // not at beginning of a word
+
+        const char dir1 = xmetLowerAt(expr, pos);
+        const char dir2 = xmetLowerAt(expr, pos + 1);
+        FilterBase::Type lolType = FilterBase::Unsupported;
+        FilterBase::Type lineType = FilterBase::Unsupported;
+        if (dir1 == 'e') {
+            lolType = FilterBase::E_OF;
+            lineType = FilterBase::E_OF_LINE;
+        } else if (dir1 == 'w') {
+            lolType = FilterBase::W_OF;
+            lineType = FilterBase::W_OF_LINE;
+        } else if ((dir1 == 'n') || (dir1 == 's')) {
+            if ((dir2 == 'e') || (dir2 == 'w')) {
+                // the keyword can only be one of 'NE OF LINE', 'NW OF LINE', 'SE OF LINE' and 'SW OF LINE'
+                lineType = (dir1 == 'n') ? ((dir2 == 'e') ? FilterBase::NE_OF_LINE : FilterBase::NW_OF_LINE)
+                                         : ((dir2 == 'e') ? FilterBase::SE_OF_LINE : FilterBase::SW_OF_LINE);
+            } else {
+                lolType = (dir1 == 'n') ? FilterBase::N_OF : FilterBase::S_OF;
+                lineType = (dir1 == 'n') ? FilterBase::N_OF_LINE : FilterBase::S_OF_LINE;
+            }
+        } else {
+            continue;
+        }
+
+        const int ofPos = pos + ((lolType == FilterBase::Unsupported) ? 2 : 1);
+        if (!xmetLiteralAt(expr, ofPos, " of"))
+            continue;
+        if ((lolType != FilterBase::Unsupported) && (keywordPos[lolType] < 0))
+            keywordPos[lolType] = pos;
+        if (xmetLiteralAt(expr, ofPos + 3, " line") && (keywordPos[lineType] < 0))
+            keywordPos[lineType] = pos;
+    }
+}
+
+Polygons FilterBase::apply(const math::PreparedPolygon &inPoly) const
+{
+    return apply(inPoly.polygon());
+}
+
+Polygons FilterBase::apply(const Polygon &inPoly, const QBitArray &) const
+{
+    return apply(inPoly);
+}
+
 void PointFilter::setPoint(const Point &point)
 {
     point_ = point;
@@ -171,6 +310,7 @@ bool PointFilter::isValid() const
 Polygons PointFilter::apply(const Polygon &polygons) const
 {
     Polygons outPolys = Polygons(new QVector<Polygon>());
+    TraceScope trace("PointFilter::apply", polygons->size(), &outPolys);
     Polygon copy(new QVector<Point>(*polygons.data()));
     outPolys->append(copy);
     return outPolys;
@@ -186,26 +326,17 @@ bool PointFilter::rejected(const Point &) const
     return false; // n/a
 }
 
-bool PointFilter::setFromXmetExpr(const QString &expr, QPair<int, int> *matchedRange, QPair<int, int> *incompleteRange, QString *incompleteReason)
+bool PointFilter::setFromXmetExpr(const QString &expr, QPair<int, int> *matchedRange, QPair<int, int> *, QString *)
 {
-    QRegExp rx;
-    rx.setCaseSensitivity(Qt::CaseInsensitive);
-
-    // look for coordinate
-    rx.setPattern("^([NS]\\d\\d\\d\\d) ([EW]\\d\\d\\d\\d\\d)$");
-    int rxpos = expr.indexOf(rx);
-    int matchedLen = rx.matchedLength();
-
-    if (rxpos >= 0) { // match
-        bool ok1 = false;
-        bool ok2 = false;
-        const double lon = xmetExtractLon(rx.cap(2), ok1);
-        const double lat = xmetExtractLat(rx.cap(1), ok2);
-        if (!(ok1 && ok2))
+    // look for coordinate making up the entire expression
+    if ((expr.size() == xmetCoordinateLength) && xmetCoordinateAt(expr, 0)) { // match
+        bool ok = false;
+        const Point point = xmetExtractCoordinate(expr, 0, ok);
+        if (!ok)
             return false;
-        setPoint(qMakePair(lon, lat));
-        matchedRange->first = rxpos;
-        matchedRange->second = rxpos + matchedLen - 1;
+        setPoint(point);
+        matchedRange->first = 0;
+        matchedRange->second = xmetCoordinateLength - 1;
         return true; // success
     }
 
@@ -222,6 +353,7 @@ QString PointFilter::xmetExpr() const
 void PolygonFilter::setPolygon(const Polygon &polygon)
 {
     polygon_ = polygon;
+    updatePrepared();
 }
 
 Polygon PolygonFilter::polygon() const
@@ -229,13 +361,26 @@ Polygon PolygonFilter::polygon() const
     return polygon_;
 }
 
+const math::PreparedPolygon &PolygonFilter::preparedPolygon() const
+{
+    return *prepared_;
+}
+
+// Prepares the current polygon. This must be called whenever polygon_ has been set or modified.
+void PolygonFilter::updatePrepared()
+{
+    prepared_ = QSharedPointer<math::PreparedPolygon>(new math::PreparedPolygon(polygon_));
+}
+
 PolygonFilter::PolygonFilter()
 {
+    updatePrepared();
 }
 
 PolygonFilter::PolygonFilter(const Polygon &polygon)
     : polygon_(polygon)
 {
+    updatePrepared();
 }
 
 void PolygonFilter::setFromVariant(const QVariant &var)
@@ -251,6 +396,7 @@ void PolygonFilter::setFromVariant(const QVariant &var)
         Q_ASSERT(ok1 && ok2);
         polygon_->append(qMakePair(lon, lat));
     }
+    updatePrepared();
 }
 
 QVariant PolygonFilter::toVariant() const
@@ -300,7 +446,18 @@ WithinFilter::WithinFilter(const Polygon &polygon, bool keywordImplicit)
 
 Polygons WithinFilter::apply(const Polygon &inPoly) const
 {
-    return math::polygonIntersection(inPoly, polygon_);
+    Polygons outPolys;
+    TraceScope trace("WithinFilter::apply", inPoly->size(), &outPolys);
+    outPolys = math::polygonIntersection(math::PreparedPolygon(inPoly), preparedPolygon());
+    return outPolys;
+}
+
+Polygons WithinFilter::apply(const math::PreparedPolygon &inPoly) const
+{
+    Polygons outPolys;
+    TraceScope trace("WithinFilter::apply", inPoly.size(), &outPolys);
+    outPolys = math::polygonIntersection(inPoly, preparedPolygon());
+    return outPolys;
 }
 
 QVector<Point> WithinFilter::intersections(const Polygon &inPoly) const
@@ -323,20 +480,18 @@ QVector<Point> WithinFilter::intersections(const Polygon &inPoly) const
 
 bool WithinFilter::rejected(const Point &point) const
 {
-    return !math::pointInPolygon(point, polygon_);
+    return !math::pointInPolygon(point, preparedPolygon());
 }
 
 bool WithinFilter::setFromXmetExpr(const QString &expr, QPair<int, int> *matchedRange, QPair<int, int> *incompleteRange, QString *incompleteReason)
 {
     int firstPos = -1;
-    int lastPos = -1;
-    QString s;
+    int lastPos = -1; // position of the last character parsed so far
     if (keywordImplicit_) {
         if (expr.isEmpty())
             return false; // nothing to parse
         firstPos = 0;
         lastPos = -1;
-        s = expr;
     } else {
         // get first "WI"
         firstPos = expr.indexOf("WI", 0, Qt::CaseInsensitive);
@@ -345,44 +500,27 @@ bool WithinFilter::setFromXmetExpr(const QString &expr, QPair<int, int> *matched
         if ((firstPos > 0) && (!expr[firstPos - 1].isSpace()))
             return false; // not at beginning or after space
         lastPos = firstPos + 1;
-        s = expr.mid(lastPos + 1); // move to first position after "WI"
     }
 
     // get as many coordinates as possible after the "WI"
     Polygon polygon(new QVector<Point>());
-    const QString basePattern(
-                "([NS]\\d\\d\\d\\d)"
-                " "
-                "([EW]\\d\\d\\d\\d\\d)"
-                );
-    QRegExp rx;
-    rx.setCaseSensitivity(Qt::CaseInsensitive);
-    bool first = true;
-    while (true) {
-        rx.setPattern(QString("%1%2").arg(first ? (keywordImplicit_ ? "^" : "^ ") : "^ - ").arg(basePattern));
-        first = false;
+    for (bool first = true; ; first = false) {
+        const char *separator = first ? (keywordImplicit_ ? "" : " ") : " - ";
+        const int pos = lastPos + 1 + int(strlen(separator));
 
         // read next coordinate
-        const int rxpos = s.indexOf(rx);
-        if (rxpos >= 0) { // match
-            bool ok1 = false;
-            bool ok2 = false;
-            const double lon = xmetExtractLon(rx.cap(2), ok1);
-            const double lat = xmetExtractLat(rx.cap(1), ok2);
-            if (ok1 && ok2)
-                polygon->append(qMakePair(lon, lat));
-            if (!(ok1 && ok2))
-                break;
-            const int nextPos = rxpos + rx.matchedLength();
-            lastPos += nextPos;
-            s = s.mid(nextPos);
-        } else { // no match
+        if (!(xmetLiteralAt(expr, lastPos + 1, separator) && xmetCoordinateAt(expr, pos)))
+            break; // no match
+        bool ok = false;
+        const Point point = xmetExtractCoordinate(expr, pos, ok);
+        if (!ok)
             break;
-        }
+        polygon->append(point);
+        lastPos = pos + xmetCoordinateLength - 1;
     }
 
     if (polygon->size() >= 3) {
-        polygon_ = polygon;
+        setPolygon(polygon);
         matchedRange->first = firstPos;
         matchedRange->second = lastPos;
         return true; // success
@@ -415,8 +553,9 @@ UnionFilter::UnionFilter(const Polygon &polygon)
     qFatal("UnionFilter is not yet supported");
 }
 
-Polygons UnionFilter::apply(const Polygon &) const
+Polygons UnionFilter::apply(const Polygon &inPoly) const
 {
+    TraceScope trace("UnionFilter::apply", inPoly->size());
     return Polygons(); // ### TBD when filter is supported
 }
 
@@ -469,16 +608,35 @@ QString LineFilter::directionName() const
     return QString();
 }
 
-Polygons LineFilter::apply(const Polygon &inPoly) const
+bool LineFilter::setFromXmetExpr(const QString &expr, QPair<int, int> *matchedRange, QPair<int, int> *incompleteRange, QString *incompleteReason)
 {
-    Polygons outPolys = Polygons(new QVector<Polygon>());
+    // look for keyword
+    int keywordPos[SW_OF_LINE + 1];
+    findXmetKeywords(expr, keywordPos);
+    if (keywordPos[type()] < 0)
+        return false; // no match
+
+    return setFromXmetExprAt(expr, keywordPos[type()], matchedRange, incompleteRange, incompleteReason);
+}
 
+Polygons LineFilter::apply(const Polygon &inPoly) const
+{
     // get rejection status for all points
     const int n = inPoly->size();
     QBitArray rej(n);
     for (int i = 0; i < n; ++i)
         rej[i] = rejected(inPoly->at(i));
 
+    return apply(inPoly, rej);
+}
+
+Polygons LineFilter::apply(const Polygon &inPoly, const QBitArray &rej) const
+{
+    Polygons outPolys = Polygons(new QVector<Polygon>());
+    TraceScope trace("LineFilter::apply", inPoly->size(), &outPolys);
+    const int n = inPoly->size();
+    Q_ASSERT(rej.size() == n);
+
     if (rej.count(true) == n) {
         // all points rejected, so return an empty list
         return outPolys;
@@ -589,47 +747,32 @@ QVariant LonOrLatFilter::toVariant() const
     return value_;
 }
 
-bool LonOrLatFilter::setFromXmetExpr(const QString &expr, QPair<int, int> *matchedRange, QPair<int, int> *incompleteRange, QString *incompleteReason)
-{
-    QRegExp rx;
-    rx.setCaseSensitivity(Qt::CaseInsensitive);
-
-    // look for keyword
-    rx.setPattern(QString("(?:^|\\s+)%1 OF").arg(directionName()));
-    int rxpos1 = expr.indexOf(rx);
-    if (rxpos1 < 0)
-        return false; // no match
-
-    int matchedLen1 = rx.matchedLength();
-
-    // strip off leading whitespace
-    while (expr.at(rxpos1).isSpace()) {
-        rxpos1++;
-        matchedLen1--;
-    }
-
-    // look for value
-    if (isLonFilter()) {
-        rx.setPattern("^\\s+([EW]\\d\\d\\d\\d\\d)");
-    } else {
-        rx.setPattern("^\\s+([NS]\\d\\d\\d\\d)");
-    }
-
-    const int rxpos2 = expr.mid(rxpos1 + matchedLen1).indexOf(rx);
-    if (rxpos2 >= 0) { // match
-        bool ok = false;
-        const double val = isLonFilter() ? xmetExtractLon(rx.cap(1), ok) : xmetExtractLat(rx.cap(1), ok);
-        if (ok) {
-            value_ = val;
-            matchedRange->first = rxpos1;
-            matchedRange->second = rxpos1 + matchedLen1 + rxpos2 + rx.matchedLength() - 1;
-            return true; // success
+bool LonOrLatFilter::setFromXmetExprAt(
+        const QString &expr, int keywordPos, QPair<int, int> *matchedRange, QPair<int, int> *incompleteRange, QString *incompleteReason)
+{
+    const int keywordLen = directionName().size() + 3; // e.g. 'E OF'
+
+    // look for value after one or more whitespace characters
+    int pos = keywordPos + keywordLen;
+    if ((pos < expr.size()) && expr.at(pos).isSpace()) {
+        while ((pos < expr.size()) && expr.at(pos).isSpace())
+            pos++;
+        if (isLonFilter() ? xmetLonAt(expr, pos) : xmetLatAt(expr, pos)) { // match
+            bool ok = false;
+            const int valueLen = isLonFilter() ? 6 : 5;
+            const double val = isLonFilter() ? xmetExtractLon(expr.mid(pos, valueLen), ok) : xmetExtractLat(expr.mid(pos, valueLen), ok);
+            if (ok) {
+                value_ = val;
+                matchedRange->first = keywordPos;
+                matchedRange->second = pos + valueLen - 1;
+                return true; // success
+            }
         }
     }
 
     // error
-    incompleteRange->first = rxpos1;
-    incompleteRange->second = rxpos1 + matchedLen1 - 1;
+    incompleteRange->first = keywordPos;
+    incompleteRange->second = keywordPos + keywordLen - 1;
     *incompleteReason = QString("failed to extract a valid %1 value after '%2 OF'")
             .arg(isLonFilter() ? "longitude" : "latitude")
             .arg(directionName());
@@ -746,6 +889,7 @@ Polygons LatFilter::apply(const Polygon &inPoly) const
     Q_ASSERT(!inPoly->isEmpty());
     const double lat = value_;
     Polygons outPolys = Polygons(new QVector<Polygon>());
+    TraceScope trace("LatFilter::apply", inPoly->size(), &outPolys);
 
     // get clockwise version of input polygon
     const Polygon inPolyCW(math::isClockwise(inPoly) ? inPoly : math::reversed(inPoly));
@@ -1070,53 +1214,31 @@ bool FreeLineFilter::intersects(const Point &p1, const Point &p2, Point *isctPoi
     return false; // either zero, two or infinitely many intersections
 }
 
-bool FreeLineFilter::setFromXmetExpr(const QString &expr, QPair<int, int> *matchedRange, QPair<int, int> *incompleteRange, QString *incompleteReason)
+bool FreeLineFilter::setFromXmetExprAt(
+        const QString &expr, int keywordPos, QPair<int, int> *matchedRange, QPair<int, int> *incompleteRange, QString *incompleteReason)
 {
-    QRegExp rx;
-    rx.setCaseSensitivity(Qt::CaseInsensitive);
-
-    // look for keyword
-    rx.setPattern(QString("(?:^|\\s+)%1 OF LINE").arg(directionName()));
-    int rxpos1 = expr.indexOf(rx);
-    if (rxpos1 < 0)
-        return false; // no match
-
-    int matchedLen1 = rx.matchedLength();
-
-    // strip off leading whitespace
-    while (expr.at(rxpos1).isSpace()) {
-        rxpos1++;
-        matchedLen1--;
-    }
+    const int keywordLen = directionName().size() + 8; // e.g. 'E OF LINE'
 
     // look for values
-    rx.setPattern(
-                "^ ([NS]\\d\\d\\d\\d) ([EW]\\d\\d\\d\\d\\d)"
-                " - "
-                "([NS]\\d\\d\\d\\d) ([EW]\\d\\d\\d\\d\\d)"
-                );
-
-    const int rxpos2 = expr.mid(rxpos1 + matchedLen1).indexOf(rx);
-    if (rxpos2 >= 0) { // match
+    const int pos1 = keywordPos + keywordLen + 1;
+    const int pos2 = pos1 + xmetCoordinateLength + 3;
+    if (xmetLiteralAt(expr, pos1 - 1, " ") && xmetCoordinateAt(expr, pos1)
+            && xmetLiteralAt(expr, pos2 - 3, " - ") && xmetCoordinateAt(expr, pos2)) { // match
         bool ok1 = false;
         bool ok2 = false;
-        bool ok3 = false;
-        bool ok4 = false;
-        const double lon1 = xmetExtractLon(rx.cap(2), ok1);
-        const double lat1 = xmetExtractLat(rx.cap(1), ok2);
-        const double lon2 = xmetExtractLon(rx.cap(4), ok3);
-        const double lat2 = xmetExtractLat(rx.cap(3), ok4);
-        if (!(ok1 && ok2 && ok3 && ok4))
+        const Point point1 = xmetExtractCoordinate(expr, pos1, ok1);
+        const Point point2 = xmetExtractCoordinate(expr, pos2, ok2);
+        if (!(ok1 && ok2))
             return false;
-        setLine(qMakePair(qMakePair(lon1, lat1), qMakePair(lon2, lat2)));
-        matchedRange->first = rxpos1;
-        matchedRange->second = rxpos1 + matchedLen1 + rxpos2 + rx.matchedLength() - 1;
+        setLine(qMakePair(point1, point2));
+        matchedRange->first = keywordPos;
+        matchedRange->second = pos2 + xmetCoordinateLength - 1;
         return true; // success
     }
 
     // error
-    incompleteRange->first = rxpos1;
-    incompleteRange->second = rxpos1 + matchedLen1 - 1;
+    incompleteRange->first = keywordPos;
+    incompleteRange->second = keywordPos + keywordLen - 1;
     *incompleteReason = QString("failed to extract two valid coordinates after '%1 OF LINE'").arg(directionName());
     return false;
 }
@@ -1213,36 +1335,19 @@ FIR &FIR::instance()
     return fir;
 }
 
-static Polygon createENORFIR()
+FIR::FIRInfo::FIRInfo(const QSharedPointer<math::PreparedPolygon> &prepared, const QString &name)
+    : polygon_(prepared->polygon())
+    , prepared_(prepared)
+    , name_(name)
 {
-    Polygon points = Polygon(new QVector<Point>);
-
-    const int npoints = sizeof(enor_fir) / sizeof(float) / 2;
-    for (int i = 0; i < npoints; ++i) {
-        const double lon = DEG2RAD(enor_fir[2 * i + 1]);
-        const double lat = DEG2RAD(enor_fir[2 * i]);
-        points->append(qMakePair(lon, lat));
-    }
-    return points;
-}
-
-static Polygon createENOBFIR()
-{
-    Polygon points = Polygon(new QVector<Point>);
-
-    const int npoints = sizeof(enob_fir) / sizeof(float) / 2;
-    for (int i = 0; i < npoints; ++i) {
-        const double lon = DEG2RAD(enob_fir[2 * i + 1]);
-        const double lat = DEG2RAD(enob_fir[2 * i]);
-        points->append(qMakePair(lon, lat));
-    }
-    return points;
 }
 
 FIR::FIR()
 {
-    fir_.insert(ENOR, FIRInfo(createENORFIR(), "ENOR NORWAY FIR"));
-    fir_.insert(ENOB, FIRInfo(createENOBFIR(), "ENOB BODO OCEANIC FIR"));
+    // the geometry is pregenerated (see tools/firtables), so no conversion is needed here
+    typedef QSharedPointer<math::PreparedPolygon> PreparedPolygonPtr;
+    fir_.insert(ENOR, FIRInfo(PreparedPolygonPtr(new math::PreparedPolygon(enor_fir_geometry)), "ENOR NORWAY FIR"));
+    fir_.insert(ENOB, FIRInfo(PreparedPolygonPtr(new math::PreparedPolygon(enob_fir_geometry)), "ENOB BODO OCEANIC FIR"));
 }
 
 QStringList FIR::supportedNames() const
@@ -1259,6 +1364,31 @@ Polygon FIR::polygon(Code code) const
     return fir_.value(code).polygon_;
 }
 
+const math::PreparedPolygon &FIR::preparedPolygon(Code code) const
+{
+    static const math::PreparedPolygon empty;
+    return fir_.contains(code) ? *fir_.value(code).prepared_ : empty;
+}
+
+Polygon FIR::polygon(Code code, double toleranceKm) const
+{
+    return fir_.contains(code) ? preparedPolygon(code, toleranceKm).polygon() : Polygon();
+}
+
+const math::PreparedPolygon &FIR::preparedPolygon(Code code, double toleranceKm) const
+{
+    if ((toleranceKm <= 0) || (!fir_.contains(code)))
+        return preparedPolygon(code);
+
+    // the simplified versions are never removed, so a reference to one remains valid for the lifetime of the FIR object
+    QMutexLocker locker(&lodMutex_);
+    const QPair<int, double> key(code, toleranceKm);
+    if (!lods_.contains(key))
+        lods_.insert(key, QSharedPointer<math::PreparedPolygon>(
+                         new math::PreparedPolygon(simplifiedPolygon(polygon(code), toleranceKm))));
+    return *lods_.value(key);
+}
+
 FIR::Code FIR::firFromText(const QString &text)
 {
     foreach (Code code, fir_.keys()) {
@@ -1270,48 +1400,338 @@ FIR::Code FIR::firFromText(const QString &text)
 
 //------------------------------------------------------------------------------------------------
 
-Polygons applyFilters(const Polygons &inPolys, const Filters &filters)
+FilterChain::FilterChain(const Filters &filters)
+{
+    for (int i = 0; filters && (i < filters->size()); ++i) {
+        const Filter filter = filters->at(i);
+        if (filter->isValid()) {
+            filter->prepare();
+            filters_.append(filter);
+            trivial_.append(filter->isTrivialForUniformRejection());
+        }
+    }
+}
+
+Polygons FilterChain::apply(const Polygons &inPolys) const
 {
-    // initialize final output
     Polygons outPolys(new QVector<Polygon>());
-    if (inPolys && (!inPolys->isEmpty()))
-        *outPolys += *inPolys;
-    else
+    if ((!inPolys) || inPolys->isEmpty())
         return outPolys; // empty input, so return empty output
 
-    // apply valid filters
-    for (int i = 0; filters && (i < filters->size()); ++i) {
-        const Filter filter = filters->at(i);
-        if (!filter->isValid())
-            continue;
+    // apply the filters to each input polygon in turn (note that this gives the same order of output polygons as applying
+    // each filter in turn to all polygons)
+    for (int i = 0; i < inPolys->size(); ++i) {
+        if (inPolys->at(i))
+            apply(inPolys->at(i), 0, outPolys.data());
+    }
 
-        // set the input polygons for this filter to be the output polygons from the previous filter
-        Polygons inPolys2(outPolys);
+    return math::removeInvalidVertices(outPolys);
+}
 
-        // create an empty list of output polygons to be filled in by this filter
-        outPolys = Polygons(new QVector<Polygon>());
+Polygons FilterChain::apply(const Polygon &polygon) const
+{
+    Polygons outPolys(new QVector<Polygon>());
+    if (polygon)
+        apply(polygon, 0, outPolys.data());
+    return math::removeInvalidVertices(outPolys);
+}
 
-        // loop over input polygons
-        for (int j = 0; j < inPolys2->size(); ++j) {
-            if (inPolys2->at(j)) {
-                // apply the filter to the input polygon and add the resulting polygons to the final output
-                Polygons outPolys2 = filter->apply(inPolys2->at(j));
-                if (outPolys2) {
-                    for (int k = 0; k < outPolys2->size(); ++k)
-                        outPolys->append(outPolys2->at(k));
-                }
+// Applies a filter chain to input polygon i (see parallelFor()).
+class FilterChainWork
+{
+public:
+    FilterChainWork(const FilterChain *chain, const QVector<Polygon> *inPolys, Polygons *results)
+        : chain_(chain), inPolys_(inPolys), results_(results) {}
+
+    void operator()(int i) const
+    {
+        results_[i] = chain_->apply(inPolys_->at(i));
+    }
+
+private:
+    const FilterChain *chain_;
+    const QVector<Polygon> *inPolys_;
+    Polygons *results_;
+};
+
+Polygons FilterChain::apply(const Polygons &inPolys, int threadCount) const
+{
+    if (threadCount <= 0)
+        threadCount = QThread::idealThreadCount();
+    if ((!inPolys) || (threadCount <= 1) || (inPolys->size() <= 1))
+        return apply(inPolys);
+
+    QVector<Polygons> results(inPolys->size());
+    parallelFor(inPolys->size(), threadCount, FilterChainWork(this, inPolys.data(), results.data()));
+
+    // concatenate the results in input order
+    Polygons outPolys(new QVector<Polygon>());
+    for (int i = 0; i < results.size(); ++i)
+        *outPolys += *results.at(i);
+    return outPolys;
+}
+
+// Applies filters_[first, filters_.size()) to a polygon, appending the resulting polygons to outPolys.
+void FilterChain::apply(const Polygon &polygon, int first, QVector<Polygon> *outPolys) const
+{
+    // evaluate the rejection status of each point for each filter in the run of filters that are trivial for uniform rejection
+    // (the polygon is replaced by the output of the first filter that is not, so there's no point in looking beyond that)
+    int last = first;
+    for (; (last < filters_.size()) && trivial_.at(last); ++last) ;
+    const int n = polygon->size();
+    QVarLengthArray<QBitArray, 8> rej(last - first);
+    QVarLengthArray<int, 8> nrejected(last - first);
+    for (int j = 0; j < (last - first); ++j) {
+        rej[j] = QBitArray(n);
+        nrejected[j] = 0;
+    }
+    for (int i = 0; i < n; ++i) {
+        const Point &point = polygon->at(i);
+        for (int j = first; j < last; ++j) {
+            if (filters_.at(j)->rejected(point)) {
+                rej[j - first].setBit(i);
+                nrejected[j - first]++;
             }
         }
     }
 
-    return math::removeInvalidVertices(outPolys);
+    for (int j = first; j < filters_.size(); ++j) {
+        if (j < last) {
+            if (nrejected[j - first] == n)
+                return; // all points rejected, so the filter would remove the polygon
+            if (nrejected[j - first] == 0)
+                continue; // no points rejected, so the filter would leave the polygon unchanged
+        }
+
+        // apply the filter and then the remaining filters to each resulting polygon
+        const Polygons outPolys2 = (j < last) ? filters_.at(j)->apply(polygon, rej[j - first]) : filters_.at(j)->apply(polygon);
+        for (int k = 0; outPolys2 && (k < outPolys2->size()); ++k) {
+            if (outPolys2->at(k))
+                apply(outPolys2->at(k), j + 1, outPolys);
+        }
+        return;
+    }
+
+    // the polygon passed all the filters unchanged
+    outPolys->append(polygon);
+}
+
+//------------------------------------------------------------------------------------------------
+
+Polygon PolygonView::toPolygon() const
+{
+    Polygon polygon = Polygon(new QVector<Point>(size_));
+    std::copy(points_, points_ + size_, polygon->begin());
+    return polygon;
+}
+
+//------------------------------------------------------------------------------------------------
+
+IntersectionLayer::IntersectionLayer()
+    : intersector_(new PolygonIntersector(Polygons()))
+    , lods_(new LevelsOfDetail)
+{
+}
+
+IntersectionLayer::IntersectionLayer(const Polygons &polygons)
+    : intersector_(new PolygonIntersector(polygons))
+    , lods_(new LevelsOfDetail)
+{
+}
+
+IntersectionLayer::IntersectionLayer(const PolygonStore &store)
+    : intersector_(new PolygonIntersector(store))
+    , lods_(new LevelsOfDetail)
+{
 }
 
-Polygons applyFilters(const Polygon &polygon, const Filters &filters)
+Polygons IntersectionLayer::polygons() const
+{
+    return intersector_->polygons();
+}
+
+QList<QPair<int, Polygons> > IntersectionLayer::intersection(const Polygons &intersectors, int threadCount) const
+{
+    return intersector_->intersection(intersectors, threadCount);
+}
+
+QList<QPair<int, Polygons> > IntersectionLayer::intersection(const Polygons &intersectors, int threadCount, double toleranceKm) const
+{
+    if (toleranceKm <= 0)
+        return intersection(intersectors, threadCount);
+
+    QSharedPointer<const PolygonIntersector> intersector;
+    {
+        QMutexLocker locker(&lods_->mutex_);
+        intersector = lods_->intersectors_.value(toleranceKm);
+        if (!intersector) {
+            intersector = QSharedPointer<const PolygonIntersector>(
+                        new PolygonIntersector(intersector_->simplified(toleranceKm)));
+            lods_->intersectors_.insert(toleranceKm, intersector);
+        }
+    }
+    return intersector->intersection(simplifiedPolygons(intersectors, toleranceKm), threadCount);
+}
+
+//------------------------------------------------------------------------------------------------
+
+FilterResultCache::FilterResultCache(int maxBytes)
+    : cache_(maxBytes)
+    , hits_(0)
+    , misses_(0)
+{
+}
+
+// Returns the exact values of the valid filters in a filter sequence.
+static QVariantList filterValues(const Filters &filters)
+{
+    QVariantList values;
+    for (int i = 0; filters && (i < filters->size()); ++i) {
+        if (filters->at(i)->isValid()) {
+            values.append(int(filters->at(i)->type()));
+            values.append(filters->at(i)->toVariant());
+        }
+    }
+    return values;
+}
+
+// Returns a copy of a list of polygons that can be modified without affecting the original. Null polygons (like those that
+// removeInvalidVertices() returns for degenerate pieces) are copied as null.
+static Polygons copied(const Polygons &polygons)
+{
+    Polygons copy(new QVector<Polygon>());
+    copy->reserve(polygons->size());
+    for (int i = 0; i < polygons->size(); ++i) {
+        const Polygon &polygon = polygons->at(i);
+        // note that the points are implicitly shared until modified
+        copy->append(polygon ? Polygon(new QVector<Point>(*polygon)) : Polygon());
+    }
+    return copy;
+}
+
+template <typename BasePolygon>
+Polygons FilterResultCache::cachedApplyFilters(const QString &polygonKey, const BasePolygon &polygon, const Filters &filters)
+{
+    const QString key = QString("%1\n%2").arg(polygonKey).arg(filters ? xmetExprFromFilters(filters) : QString());
+    const QVariantList values = filterValues(filters);
+
+    {
+        QMutexLocker locker(&mutex_);
+        const Entry *entry = cache_.object(key);
+        if (entry && (entry->filterValues_ == values)) {
+            hits_++;
+            return copied(entry->polygons_);
+        }
+        misses_++;
+    }
+
+    // compute the result without holding the lock so that other requests are not blocked
+    const Polygons result = mgp::applyFilters(polygon, filters);
+
+    int cost = key.size() * int(sizeof(QChar));
+    for (int i = 0; i < result->size(); ++i) {
+        cost += int(sizeof(Polygon));
+        if (result->at(i))
+            cost += int(sizeof(QVector<Point>)) + result->at(i)->size() * int(sizeof(Point));
+    }
+    Entry *entry = new Entry;
+    entry->polygons_ = copied(result);
+    entry->filterValues_ = values;
+
+    QMutexLocker locker(&mutex_);
+    cache_.insert(key, entry, cost); // note that the entry is deleted right away if it is too large
+    return result;
+}
+
+Polygons FilterResultCache::applyFilters(const QString &polygonKey, const Polygon &polygon, const Filters &filters)
+{
+    return cachedApplyFilters<Polygon>(polygonKey, polygon, filters);
+}
+
+Polygons FilterResultCache::applyFilters(FIR::Code fir, const Filters &filters)
+{
+    return cachedApplyFilters<math::PreparedPolygon>(QString("FIR %1").arg(int(fir)), FIR::instance().preparedPolygon(fir), filters);
+}
+
+int FilterResultCache::maxBytes() const
+{
+    QMutexLocker locker(&mutex_);
+    return cache_.maxCost();
+}
+
+void FilterResultCache::setMaxBytes(int maxBytes)
+{
+    QMutexLocker locker(&mutex_);
+    cache_.setMaxCost(maxBytes);
+}
+
+int FilterResultCache::bytes() const
+{
+    QMutexLocker locker(&mutex_);
+    return cache_.totalCost();
+}
+
+int FilterResultCache::count() const
+{
+    QMutexLocker locker(&mutex_);
+    return cache_.count();
+}
+
+qint64 FilterResultCache::hits() const
+{
+    QMutexLocker locker(&mutex_);
+    return hits_;
+}
+
+qint64 FilterResultCache::misses() const
+{
+    QMutexLocker locker(&mutex_);
+    return misses_;
+}
+
+void FilterResultCache::clear()
+{
+    QMutexLocker locker(&mutex_);
+    cache_.clear();
+    hits_ = misses_ = 0;
+}
+
+//------------------------------------------------------------------------------------------------
+
+Polygons applyFilters(const Polygons &inPolys, const Filters &filters, double toleranceKm)
+{
+    Polygons outPolys;
+    TraceScope trace("applyFilters", inPolys, &outPolys);
+    outPolys = FilterChain(filters).apply((toleranceKm > 0) ? simplifiedPolygons(inPolys, toleranceKm) : inPolys);
+    return outPolys;
+}
+
+Polygons applyFiltersInParallel(const Polygons &inPolys, const Filters &filters, int threadCount)
+{
+    Polygons outPolys;
+    TraceScope trace("applyFiltersInParallel", inPolys, &outPolys);
+    outPolys = FilterChain(filters).apply(inPolys, threadCount);
+    return outPolys;
+}
+
+Polygons applyFilters(const Polygon &polygon, const Filters &filters, double toleranceKm)
 {
     Polygons polygons = Polygons(new QVector<Polygon>());
     polygons->append(polygon ? polygon : Polygon(new QVector<Point>()));
-    return applyFilters(polygons, filters);
+    return applyFilters(polygons, filters, toleranceKm);
+}
+
+Polygons applyFilters(const math::PreparedPolygon &polygon, const Filters &filters)
+{
+    // find the first valid filter
+    int i = 0;
+    for (; filters && (i < filters->size()) && (!filters->at(i)->isValid()); ++i) ;
+    if ((!filters) || (i == filters->size()))
+        return applyFilters(polygon.polygon(), filters);
+
+    // apply the first valid filter directly to the prepared polygon and the remaining filters as usual
+    const Filters remaining(new QList<Filter>(filters->mid(i + 1)));
+    return applyFilters(filters->at(i)->apply(polygon), remaining);
 }
 
 QString xmetExprFromFilters(const Filters &filters)
@@ -1367,10 +1787,72 @@ static bool parseIncompleteInfoLessThan(const ParseIncompleteInfo &pii1, const P
     return pii1.loPos_ < pii2.loPos_;
 }
 
+// Returns a new line filter of a given type.
+static LineFilter *createLineFilter(FilterBase::Type type)
+{
+    switch (type) {
+    case FilterBase::E_OF:
+        return new EOfFilter;
+    case FilterBase::W_OF:
+        return new WOfFilter;
+    case FilterBase::N_OF:
+        return new NOfFilter;
+    case FilterBase::S_OF:
+        return new SOfFilter;
+    case FilterBase::E_OF_LINE:
+        return new EOfLineFilter;
+    case FilterBase::W_OF_LINE:
+        return new WOfLineFilter;
+    case FilterBase::N_OF_LINE:
+        return new NOfLineFilter;
+    case FilterBase::S_OF_LINE:
+        return new SOfLineFilter;
+    case FilterBase::NE_OF_LINE:
+        return new NEOfLineFilter;
+    case FilterBase::NW_OF_LINE:
+        return new NWOfLineFilter;
+    case FilterBase::SE_OF_LINE:
+        return new SEOfLineFilter;
+    case FilterBase::SW_OF_LINE:
+        return new SWOfLineFilter;
+    default:
+        ;
+    }
+    return 0;
+}
+
+// Returns true iff the range [lo, hi] of a SIGMET/AIRMET expression consists of the single word 'AND' surrounded by whitespace.
+static bool isXmetAnd(const QString &expr, int lo, int hi)
+{
+    int pos = lo;
+    if (!((pos <= hi) && expr.at(pos).isSpace()))
+        return false;
+    while ((pos <= hi) && expr.at(pos).isSpace())
+        pos++;
+    if (!(((pos + 2) <= hi) && xmetLiteralAt(expr, pos, "and")))
+        return false;
+    pos += 3;
+    if (!((pos <= hi) && expr.at(pos).isSpace()))
+        return false;
+    while ((pos <= hi) && expr.at(pos).isSpace())
+        pos++;
+    return pos > hi;
+}
+
 Filters filtersFromXmetExpr(
         const QString &expr, QList<QPair<int, int> > *matchedRanges, QList<QPair<QPair<int, int>, QString> > *incompleteRanges,
         bool wiExclusive, bool wiOnly, bool wiKeywordImplicit)
 {
+    TraceScope trace("filtersFromXmetExpr", expr);
+
+    // allow the caller to ignore the ranges
+    QList<QPair<int, int> > ignoredMatchedRanges;
+    if (!matchedRanges)
+        matchedRanges = &ignoredMatchedRanges;
+    QList<QPair<QPair<int, int>, QString> > ignoredIncompleteRanges;
+    if (!incompleteRanges)
+        incompleteRanges = &ignoredIncompleteRanges;
+
     // handle PointFilter as a special case
     {
         QPair<int, int> matchedRange(-1, -1);
@@ -1381,6 +1863,7 @@ Filters filtersFromXmetExpr(
             matchedRanges->append(matchedRange);
             Filters resultFilters(new QList<Filter>());
             resultFilters->append(filter);
+            trace.setOutputSize(resultFilters->size());
             return resultFilters;
             //pmInfos.append(ParseMatchInfo(filter, matchedRange.first, matchedRange.second));
         }
@@ -1392,39 +1875,35 @@ Filters filtersFromXmetExpr(
     // - 'WI' and 'S OF LINE' could both match more than once.
     // and so on ...
 
-    // candidate filters (the result will consist of a subset of these, ordered according to their appearance in the)
-    QList<Filter> candFilters;
-    candFilters.append(Filter(new WithinFilter(wiOnly && wiKeywordImplicit)));
-
-    if (!wiOnly) {
-        candFilters.append(Filter(new EOfFilter));
-        candFilters.append(Filter(new WOfFilter));
-        candFilters.append(Filter(new NOfFilter));
-        candFilters.append(Filter(new SOfFilter));
-        //
-        candFilters.append(Filter(new EOfLineFilter));
-        candFilters.append(Filter(new WOfLineFilter));
-        candFilters.append(Filter(new NOfLineFilter));
-        candFilters.append(Filter(new SOfLineFilter));
-        //
-        candFilters.append(Filter(new NEOfLineFilter));
-        candFilters.append(Filter(new NWOfLineFilter));
-        candFilters.append(Filter(new SEOfLineFilter));
-        candFilters.append(Filter(new SWOfLineFilter));
-    }
+    // find the first occurrence of each line filter keyword in a single pass, so that only the filters whose keywords occur need
+    // to be created and parsed (from their keyword position and onwards)
+    int keywordPos[FilterBase::SW_OF_LINE + 1];
+    findXmetKeywords(expr, keywordPos);
 
-    // find initial matched and incomplete ranges
+    // find initial matched and incomplete ranges (in the order WI, E OF, ..., SW OF LINE)
     QList<ParseMatchInfo> pmInfos;
     QList<ParseIncompleteInfo> piInfos;
-    foreach (Filter filter, candFilters) {
+    for (int type = FilterBase::WI; type <= FilterBase::SW_OF_LINE; ++type) {
+        if ((type != FilterBase::WI) && (wiOnly || (keywordPos[type] < 0)))
+            continue;
+
         QPair<int, int> matchedRange(-1, -1);
         QPair<int, int> incompleteRange(-1, -1);
         QString incompleteReason;
-        if (filter->setFromXmetExpr(expr, &matchedRange, &incompleteRange, &incompleteReason)) {
-            //matchedRanges->append(matchedRange);
+        Filter filter;
+        bool matched = false;
+        if (type == FilterBase::WI) {
+            filter = Filter(new WithinFilter(wiOnly && wiKeywordImplicit));
+            matched = filter->setFromXmetExpr(expr, &matchedRange, &incompleteRange, &incompleteReason);
+        } else {
+            LineFilter *lineFilter = createLineFilter(FilterBase::Type(type));
+            filter = Filter(lineFilter);
+            matched = lineFilter->setFromXmetExprAt(expr, keywordPos[type], &matchedRange, &incompleteRange, &incompleteReason);
+        }
+
+        if (matched) {
             pmInfos.append(ParseMatchInfo(filter, matchedRange.first, matchedRange.second));
         } else if (incompleteRange.first >= 0) {
-            //initIncompleteRanges.append(qMakePair(incompleteRange, incompleteReason));
             piInfos.append(ParseIncompleteInfo(filter, incompleteRange.first, incompleteRange.second, incompleteReason));
         }
     }
@@ -1453,20 +1932,16 @@ Filters filtersFromXmetExpr(
 
     // require the single word 'AND' between adjacent lon/lat filters
     QList<QPair<int, int> > extraMatchedRanges;
-    {
-        QRegExp rx("^\\s+and\\s+$");
-        for (int i = 1; i < pmInfos.size(); ++i) {
-            const LineFilter *lf1 = dynamic_cast<LineFilter *>(pmInfos.at(i - 1).filter_.data());
-            const LineFilter *lf2 = dynamic_cast<LineFilter *>(pmInfos.at(i).filter_.data());
-            if (lf1 && lf2) {
-                const int lo = pmInfos.at(i - 1).hiPos_ + 1;
-                const int hi = pmInfos.at(i).loPos_ - 1;
-                const QString text = expr.mid(lo, (hi - lo) + 1);
-                if (!text.toLower().contains(rx))
-                    pmInfos[i - 1].missingAnd_ = true;
-                else
-                    extraMatchedRanges.append(qMakePair(lo, hi));
-            }
+    for (int i = 1; i < pmInfos.size(); ++i) {
+        const LineFilter *lf1 = dynamic_cast<LineFilter *>(pmInfos.at(i - 1).filter_.data());
+        const LineFilter *lf2 = dynamic_cast<LineFilter *>(pmInfos.at(i).filter_.data());
+        if (lf1 && lf2) {
+            const int lo = pmInfos.at(i - 1).hiPos_ + 1;
+            const int hi = pmInfos.at(i).loPos_ - 1;
+            if (!isXmetAnd(expr, lo, hi))
+                pmInfos[i - 1].missingAnd_ = true;
+            else
+                extraMatchedRanges.append(qMakePair(lo, hi));
         }
     }
 
@@ -1571,48 +2046,101 @@ Filters filtersFromXmetExpr(
         }
     }
 
+    trace.setOutputSize(resultFilters->size());
     return resultFilters;
 }
 
+// Layer used by setIntersectablePolygons() and intersectedPolygons(). The layer is replaced rather than modified, so the mutex only
+// needs to be held while accessing the layer object itself.
+struct GlobalIntersectionLayer
+{
+    QMutex mutex_;
+    IntersectionLayer layer_;
+};
+
+static GlobalIntersectionLayer &globalIntersectionLayer()
+{
+    static GlobalIntersectionLayer global;
+    return global;
+}
+
 void setIntersectablePolygons(const Polygons &polygons)
 {
-    PolygonIntersector::instance().setPolygons(polygons); // creates new quadtree based on lat/lon bounding boxes ...
+    const IntersectionLayer layer(polygons); // creates new bounding volume hierarchy based on lat/lon bounding boxes
+    GlobalIntersectionLayer &global = globalIntersectionLayer();
+    QMutexLocker locker(&global.mutex_);
+    global.layer_ = layer;
 }
 
 QList<QPair<int, Polygons> > intersectedPolygons(const Polygons &intersectors)
 {
-    return PolygonIntersector::instance().intersection(intersectors);
+    GlobalIntersectionLayer &global = globalIntersectionLayer();
+    global.mutex_.lock();
+    const IntersectionLayer layer = global.layer_;
+    global.mutex_.unlock();
+    return layer.intersection(intersectors, 1); // (serial as before; use an IntersectionLayer directly for concurrency)
+}
+
+Polygon simplifiedPolygon(const Polygon &polygon, double toleranceKm)
+{
+    return math::simplified(polygon, toleranceKm / earthRadius);
+}
+
+Polygons simplifiedPolygons(const Polygons &polygons, double toleranceKm)
+{
+    if ((!polygons) || (toleranceKm <= 0))
+        return polygons;
+
+    Polygons result = Polygons(new QVector<Polygon>());
+    result->reserve(polygons->size());
+    for (int i = 0; i < polygons->size(); ++i)
+        result->append(simplifiedPolygon(polygons->at(i), toleranceKm));
+    return result;
 }
 
 double area(const Polygon &polygon)
 {
-    Q_UNUSED(polygon);
-    return -1; // ### TBD
+    return polygon ? (earthRadius * earthRadius * math::sphericalArea(*polygon)) : 0;
 }
 
 double area(const Polygons &polygons)
 {
-    Q_UNUSED(polygons);
-    return -1; // ### TBD
+    double sum = 0;
+    for (int i = 0; polygons && (i < polygons->size()); ++i)
+        sum += area(polygons->at(i));
+    return sum;
+}
+
+QVector<double> areas(const Polygons &polygons)
+{
+    QVector<double> result(polygons ? polygons->size() : 0);
+    for (int i = 0; i < result.size(); ++i)
+        result[i] = area(polygons->at(i));
+    return result;
 }
 
 Polygons norwegianMunicipalities()
 {
     const Polygons emptyPolygons = Polygons(new QVector<Polygon>);
 
+    // the polygons are loaded directly from the resource data (converted from KML at build time; see polybin.h)
     initResource();
-    const QString fname(":data/norway_municipalities.kml");
-    QFile file(fname);
-    if (!file.open(QIODevice::ReadOnly)) {
-        qWarning("failed to open %s for reading", fname.toLatin1().constData());
+    const QString fname(":data/norway_municipalities.polybin");
+    const QResource resource(fname);
+    if (!resource.isValid()) {
+        qWarning("failed to find resource %s", fname.toLatin1().constData());
         return emptyPolygons;
     }
 
-    QByteArray data = file.readAll();
     QString error;
-    const Polygons polygons = kml::kml2polygons(data, &error);
+    Polygons polygons;
+    if (resource.isCompressed()) {
+        polygons = polybin::polybin2polygons(qUncompress(resource.data(), resource.size()), &error);
+    } else {
+        polygons = polybin::polybin2polygons(reinterpret_cast<const char *>(resource.data()), resource.size(), &error);
+    }
     if (!error.isEmpty()) {
-        qWarning("failed to extract polygons from KML file: %s", error.toLatin1().constData());
+        qWarning("failed to extract polygons from binary polygon resource: %s", error.toLatin1().constData());
         return emptyPolygons;
     }
 
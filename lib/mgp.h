@@ -2,11 +2,15 @@
 #define MGP_H
 
 #include <QSharedPointer>
+#include <QBitArray>
 #include <QVector>
 #include <QPair>
 #include <QList>
+#include <QMap>
 #include <QString>
 #include <QVariant>
+#include <QCache>
+#include <QMutex>
 #include <math.h>
 
 #define MGP_BEGIN_NAMESPACE namespace mgp {
@@ -43,13 +47,50 @@ typedef QPair<double, double> Point;
 typedef QSharedPointer<QVector<Point> > Polygon;
 typedef QSharedPointer<QVector<Polygon> > Polygons;
 
+namespace math { class PreparedPolygon; }
+class PolygonIntersector;
+class PolygonStore;
+
 
 #define DEG2RAD(d) ((d) / 180.0) * M_PI
 #define RAD2DEG(r) ((r) / M_PI) * 180
 
+/** Mean radius of the Earth in kilometers, for converting between angles and areas on the unit sphere and kilometers. */
+const double earthRadius = 6371.0;
+
 
 // --- BEGIN classes --------------------------------------------------
 
+/**
+ * Read-only view of the vertices of a polygon stored elsewhere, typically in a memory-mapped PolygonStore.
+ * \note The view doesn't own the vertices, so it must not outlive their storage.
+ */
+class PolygonView
+{
+public:
+    /** Constructs an empty view. */
+    PolygonView() : points_(0), size_(0) {}
+
+    /** Constructs a view of n consecutive points. */
+    PolygonView(const Point *points, int n) : points_(points), size_(n) {}
+
+    /** Constructs a view of the vertices of a polygon. */
+    explicit PolygonView(const Polygon &polygon)
+        : points_(polygon ? polygon->constData() : 0), size_(polygon ? polygon->size() : 0) {}
+
+    int size() const { return size_; }
+    bool isEmpty() const { return size_ == 0; }
+    const Point *constData() const { return points_; }
+    const Point &at(int i) const { Q_ASSERT((i >= 0) && (i < size_)); return points_[i]; }
+
+    /** Returns a copy of the vertices as a regular polygon. */
+    Polygon toPolygon() const;
+
+private:
+    const Point *points_;
+    int size_;
+};
+
 //! Abstract interface for filters.
 class FilterBase
 {
@@ -80,6 +121,16 @@ public:
      */
     virtual Polygons apply(const Polygon &inPoly) const = 0;
 
+    /** Applies the filter to a prepared polygon.
+     * \note This is an overloaded function. The default implementation applies the filter to the polygon in its current state.
+     */
+    virtual Polygons apply(const math::PreparedPolygon &inPoly) const;
+
+    /** Applies the filter given the result of rejected() for each point of the input polygon.
+     * \note This is an overloaded function. The default implementation ignores \c rej.
+     */
+    virtual Polygons apply(const Polygon &inPoly, const QBitArray &rej) const;
+
     /** Returns all intersection points between the filter and the given polygon. */
     virtual QVector<Point> intersections(const Polygon &) const = 0;
 
@@ -95,6 +146,19 @@ public:
      * those polygons.
      */
     virtual bool rejected(const Point &) const = 0;
+
+    /**
+     * Returns true iff the result of apply() is trivial whenever rejected() is the same for all points of the input polygon:
+     * the input polygon itself if no point is rejected, and no polygons if all points are rejected. This allows FilterChain to
+     * avoid applying the filter in those cases.
+     */
+    virtual bool isTrivialForUniformRejection() const { return false; }
+
+    /**
+     * Computes any data that the filter would otherwise compute lazily on first use. Afterwards, the const functions of the
+     * filter may be called concurrently from several threads as long as the filter isn't modified.
+     */
+    virtual void prepare() const {}
 };
 
 //! This filter represent a single point.
@@ -131,7 +195,15 @@ protected:
     PolygonFilter();
     PolygonFilter(const Polygon &);
     Polygon polygon_;
+
+    /**
+     * Returns the polygon prepared for repeated use. The preparation is done whenever the polygon is set, so this only reads
+     * data and may be called concurrently.
+     */
+    const math::PreparedPolygon &preparedPolygon() const;
 private:
+    QSharedPointer<math::PreparedPolygon> prepared_;
+    void updatePrepared();
     virtual void setFromVariant(const QVariant &);
     virtual QVariant toVariant() const;
 
@@ -152,6 +224,7 @@ public:
 private:
     virtual Type type() const { return WI; }
     virtual Polygons apply(const Polygon &) const;
+    virtual Polygons apply(const math::PreparedPolygon &) const;
     virtual QVector<Point> intersections(const Polygon &inPoly) const;
     virtual bool rejected(const Point &) const;
     virtual bool setFromXmetExpr(const QString &, QPair<int, int> *, QPair<int, int> *, QString *);
@@ -180,6 +253,13 @@ class LineFilter : public FilterBase
 public:
     QString directionName() const;
 
+    /**
+     * Sets the filter state from a SIGMET/AIRMET expression in which the first occurrence of the filter keyword (e.g. 'E OF' or
+     * 'E OF LINE') is known to be at a given position. This avoids searching for the keyword again when the positions of all keywords
+     * have already been found in a single pass (see filtersFromXmetExpr()).
+     */
+    virtual bool setFromXmetExprAt(const QString &, int, QPair<int, int> *, QPair<int, int> *, QString *) = 0;
+
 protected:
     // Returns true and intersection point iff filter intersects great circle arc between given two points. If the filter intersects
     // the arc twice, the intersection closest to the first endpoint is returned.
@@ -187,7 +267,10 @@ protected:
 
 private:
     virtual Polygons apply(const Polygon &) const;
+    virtual Polygons apply(const Polygon &, const QBitArray &) const;
     virtual QVector<Point> intersections(const Polygon &inPoly) const;
+    virtual bool isTrivialForUniformRejection() const { return true; }
+    virtual bool setFromXmetExpr(const QString &, QPair<int, int> *, QPair<int, int> *, QString *);
 };
 
 //! This filter clips away regions on one or the other side of a specific longitude or latitude.
@@ -203,7 +286,7 @@ protected:
 private:
     virtual void setFromVariant(const QVariant &);
     virtual QVariant toVariant() const;
-    virtual bool setFromXmetExpr(const QString &, QPair<int, int> *, QPair<int, int> *, QString *);
+    virtual bool setFromXmetExprAt(const QString &, int, QPair<int, int> *, QPair<int, int> *, QString *);
     virtual QString xmetExpr() const;
 };
 
@@ -247,6 +330,7 @@ private:
     virtual Polygons apply(const Polygon &) const;
     virtual QVector<Point> intersections(const Polygon &inPoly) const;
     virtual bool intersects(const Point &, const Point &, Point *) const;
+    virtual bool isTrivialForUniformRejection() const { return false; } // apply() may reorient the polygon or clip bulging edges
     bool isNOfFilter() const;
 };
 
@@ -295,7 +379,7 @@ private:
     virtual QVariant toVariant() const;
     virtual bool isValid() const;
     virtual bool intersects(const Point &, const Point &, Point *) const;
-    virtual bool setFromXmetExpr(const QString &, QPair<int, int> *, QPair<int, int> *, QString *);
+    virtual bool setFromXmetExprAt(const QString &, int, QPair<int, int> *, QPair<int, int> *, QString *);
     virtual QString xmetExpr() const;
     virtual bool rejected(const Point &) const;
 };
@@ -377,6 +461,40 @@ typedef QSharedPointer<FilterBase> Filter;
 typedef QSharedPointer<QList<Filter> > Filters;
 
 
+/**
+ * Filter sequence prepared for being applied to polygons with as little work as possible: for each polygon, the rejection status
+ * of each point is evaluated for all the filters in a single pass, and a filter is only applied if it may actually clip the polygon
+ * (see FilterBase::isTrivialForUniformRejection()). The result is the same as that of applying the filters one after another.
+ * \note Only the filters that are valid when the chain is constructed are applied. The filters are prepared (see FilterBase::prepare())
+ * when the chain is constructed, so a chain may be applied from several threads at once as long as the filters aren't modified.
+ */
+class FilterChain
+{
+public:
+    FilterChain(const Filters &filters);
+
+    /** Applies the filter sequence to a set of polygons (see applyFilters()). */
+    Polygons apply(const Polygons &polygons) const;
+
+    /**
+     * Applies the filter sequence to a set of polygons using up to \c threadCount threads (see applyFiltersInParallel()).
+     * \note This is an overloaded function.
+     */
+    Polygons apply(const Polygons &polygons, int threadCount) const;
+
+    /**
+     * Applies the filter sequence to a single polygon.
+     * \note This is an overloaded function.
+     */
+    Polygons apply(const Polygon &polygon) const;
+
+private:
+    void apply(const Polygon &polygon, int first, QVector<Polygon> *outPolys) const;
+    QVector<Filter> filters_; // valid filters
+    QVector<bool> trivial_; // whether the filter is trivial for uniform rejection
+};
+
+
 class FIR
 {
 public:
@@ -403,6 +521,29 @@ public:
      */
     Polygon polygon(Code fir) const;
 
+    /**
+     * Converts a FIR code to a prepared polygon.
+     * @param[in] fir FIR code.
+     * @return a non-empty prepared polygon for a supported FIR code, otherwise an empty prepared polygon.
+     */
+    const math::PreparedPolygon &preparedPolygon(Code fir) const;
+
+    /**
+     * Converts a FIR code to a simplified polygon (see simplifiedPolygon()). Each level of detail is computed once and cached.
+     * @param[in] fir FIR code.
+     * @param[in] toleranceKm Maximum deviation (km) from the full-resolution polygon. If zero or negative, the full-resolution polygon is returned.
+     * @return a non-empty polygon for a supported FIR code, otherwise an empty polygon.
+     */
+    Polygon polygon(Code fir, double toleranceKm) const;
+
+    /**
+     * Converts a FIR code to a simplified prepared polygon (see simplifiedPolygon()). Each level of detail is computed once and cached.
+     * @param[in] fir FIR code.
+     * @param[in] toleranceKm Maximum deviation (km) from the full-resolution polygon. If zero or negative, the full-resolution polygon is returned.
+     * @return a non-empty prepared polygon for a supported FIR code, otherwise an empty prepared polygon.
+     */
+    const math::PreparedPolygon &preparedPolygon(Code fir, double toleranceKm) const;
+
     /**
      * Returns the first supported FIR found in a text.
      * @param[in] text Text.
@@ -416,15 +557,143 @@ private:
     struct FIRInfo
     {
         Polygon polygon_;
+        QSharedPointer<math::PreparedPolygon> prepared_;
         QString name_;
         FIRInfo() {}
-        FIRInfo(const Polygon &polygon, const QString &name)
-            : polygon_(polygon)
-            , name_(name)
-        {}
+        FIRInfo(const QSharedPointer<math::PreparedPolygon> &prepared, const QString &name);
     };
 
     QHash<Code, FIRInfo> fir_;
+    mutable QMutex lodMutex_;
+    mutable QMap<QPair<int, double>, QSharedPointer<math::PreparedPolygon> > lods_; // simplified FIRs keyed on code and tolerance
+};
+
+
+/**
+ * Set of polygons organized for finding their intersections with other polygons (typically a layer of administrative regions
+ * like municipalities). A layer can't be modified once constructed, so a single layer may be queried from several threads at once.
+ * Copying a layer is cheap since the underlying data is shared.
+ */
+class IntersectionLayer
+{
+public:
+    /** Constructs an empty layer. */
+    IntersectionLayer();
+
+    /**
+     * Constructs a layer from a list of intersectable polygons.
+     * @param polygons The list of intersectable polygons indexed from 0 to n-1.
+     */
+    IntersectionLayer(const Polygons &polygons);
+
+    /**
+     * Constructs a layer from the polygons of a store. The polygons are read directly from the store (which is kept open by the layer)
+     * rather than being copied and prepared up front, so this is fast even for very large layers.
+     * @param store The store of intersectable polygons indexed from 0 to n-1.
+     */
+    IntersectionLayer(const PolygonStore &store);
+
+    /** Returns the intersectable polygons (copied from the store if the layer was constructed from one). */
+    Polygons polygons() const;
+
+    /**
+     * Intersects the polygons of the layer.
+     * @param intersectors The polygons used for intersecting.
+     * @param threadCount Maximum number of threads to use (including the calling thread). If zero or negative,
+     * QThread::idealThreadCount() is used. The other threads are taken from QThreadPool::globalInstance(), so concurrent calls
+     * share its thread limit.
+     * @return A list consisting of the following for each intersected polygon P (in increasing order of the index):
+     *   1) the (zero-based) index of P in the list passed to the constructor
+     *   2) the intersected subpolygons within P
+     */
+    QList<QPair<int, Polygons> > intersection(const Polygons &intersectors, int threadCount = 0) const;
+
+    /**
+     * Intersects simplified versions of the polygons of the layer with simplified versions of the intersectors (see
+     * simplifiedPolygon()). The simplified layer for each tolerance is computed once and shared by all copies of the layer. For a
+     * layer constructed from a store, the polygons are simplified one at a time from the store rather than copied as a whole first.
+     * @param intersectors The polygons used for intersecting.
+     * @param threadCount Maximum number of threads to use. If zero or negative, QThread::idealThreadCount() is used.
+     * @param toleranceKm Maximum deviation (km) of the simplified polygons. If zero or negative, the polygons are not simplified.
+     * @return As for intersection(const Polygons &, int), except that the subpolygons are taken from the simplified polygons.
+     */
+    QList<QPair<int, Polygons> > intersection(const Polygons &intersectors, int threadCount, double toleranceKm) const;
+
+private:
+    struct LevelsOfDetail {
+        QMutex mutex_;
+        QMap<double, QSharedPointer<const PolygonIntersector> > intersectors_; // keyed on tolerance
+    };
+
+    QSharedPointer<const PolygonIntersector> intersector_;
+    QSharedPointer<LevelsOfDetail> lods_;
+};
+
+
+/**
+ * Bounded cache of the results of applying filter sequences to base polygons (typically FIRs). This is useful when the same area
+ * expression is evaluated repeatedly, like when a SIGMET/AIRMET is reissued or amended without changing its area. An entry is keyed
+ * on a string identifying the base polygon and the canonical SIGMET/AIRMET expression of the filters (see xmetExprFromFilters()).
+ * The least recently used entries are evicted when the total size of the cached results would exceed a limit.
+ * \note A cached result is only used if the filter values are exactly the same as those it was computed from (the canonical
+ * expression has a resolution of one minute). All functions may be called concurrently.
+ */
+class FilterResultCache
+{
+public:
+    /** Constructs a cache that holds at most \c maxBytes bytes of results. */
+    FilterResultCache(int maxBytes = 64 * 1024 * 1024);
+
+    /**
+     * Returns the result of applying a filter sequence to a base polygon, computing it only if it is not already cached.
+     * \param[in] polygonKey String that uniquely identifies \c polygon (like the name of a FIR).
+     * \param[in] polygon    Base polygon.
+     * \param[in] filters    Sequence of zero or more filters.
+     * \return The same as applyFilters(polygon, filters).
+     */
+    Polygons applyFilters(const QString &polygonKey, const Polygon &polygon, const Filters &filters);
+
+    /**
+     * Returns the result of applying a filter sequence to a FIR, computing it only if it is not already cached.
+     * \note This is an overloaded function.
+     */
+    Polygons applyFilters(FIR::Code fir, const Filters &filters);
+
+    /** Returns the maximum total size of the cached results in bytes. */
+    int maxBytes() const;
+
+    /** Sets the maximum total size of the cached results in bytes, evicting entries as needed. */
+    void setMaxBytes(int maxBytes);
+
+    /** Returns the (approximate) total size of the cached results in bytes. */
+    int bytes() const;
+
+    /** Returns the number of cached results. */
+    int count() const;
+
+    /** Returns the number of requests that were served from the cache. */
+    qint64 hits() const;
+
+    /** Returns the number of requests that required the result to be computed. */
+    qint64 misses() const;
+
+    /** Removes all cached results and resets the hit and miss counters. */
+    void clear();
+
+private:
+    struct Entry
+    {
+        Polygons polygons_;
+        QVariantList filterValues_; // exact values of the filters that polygons_ was computed from
+    };
+
+    template <typename BasePolygon>
+    Polygons cachedApplyFilters(const QString &polygonKey, const BasePolygon &polygon, const Filters &filters);
+
+    mutable QMutex mutex_;
+    QCache<QString, Entry> cache_;
+    qint64 hits_;
+    qint64 misses_;
 };
 
 // --- END classes --------------------------------------------------
@@ -435,21 +704,49 @@ private:
 /**
  * Applies a filter sequence to a set of polygons.
  *
- * \param[in] polygons Set of zero or more polygons.
- * \param[in] filters  Sequence of zero or more filters.
+ * \param[in] polygons    Set of zero or more polygons.
+ * \param[in] filters     Sequence of zero or more filters.
+ * \param[in] toleranceKm If positive, the polygons are simplified with this tolerance (see simplifiedPolygon()) before the filters
+ *                        are applied.
  * \return The list of polygons that results from applying \c filters to \c polygons.
  */
-Polygons applyFilters(const Polygons &polygons, const Filters &filters);
+Polygons applyFilters(const Polygons &polygons, const Filters &filters, double toleranceKm = 0);
 
 /**
  * Applies a filter sequence to a single polygon.
  *
  * \note This is an overloaded function.
- * \param[in] polygon Polygon.
+ * \param[in] polygon     Polygon.
+ * \param[in] filters     Sequence of zero or more filters.
+ * \param[in] toleranceKm If positive, the polygon is simplified with this tolerance (see simplifiedPolygon()) before the filters
+ *                        are applied. For a FIR, consider applyFilters(FIR::instance().preparedPolygon(fir, toleranceKm), filters)
+ *                        instead, which reuses the cached level of detail.
+ * \return The list of polygons that results from applying \c filters to \c polygon.
+ */
+Polygons applyFilters(const Polygon &polygon, const Filters &filters, double toleranceKm = 0);
+
+/**
+ * Applies a filter sequence to a single prepared polygon.
+ *
+ * \note This is an overloaded function. It is useful when the same (typically large) polygon is filtered repeatedly.
+ * \param[in] polygon Prepared polygon.
  * \param[in] filters Sequence of zero or more filters.
  * \return The list of polygons that results from applying \c filters to \c polygon.
  */
-Polygons applyFilters(const Polygon &polygon, const Filters &filters);
+Polygons applyFilters(const math::PreparedPolygon &polygon, const Filters &filters);
+
+/**
+ * Applies a filter sequence to a set of polygons, processing several input polygons at once.
+ *
+ * \note The result is the same as that of applyFilters(const Polygons &, const Filters &), including the order of the output polygons.
+ * The filters must not be modified while this function runs.
+ * \param[in] polygons    Set of zero or more polygons.
+ * \param[in] filters     Sequence of zero or more filters.
+ * \param[in] threadCount Maximum number of threads to use (including the calling thread). If zero or negative, QThread::idealThreadCount() is used.
+ *                        The other threads are taken from QThreadPool::globalInstance(), so concurrent calls share its thread limit.
+ * \return The list of polygons that results from applying \c filters to \c polygons.
+ */
+Polygons applyFiltersInParallel(const Polygons &polygons, const Filters &filters, int threadCount = 0);
 
 /**
  * Converts a filter sequence to a SIGMET/AIRMET area expression.
@@ -493,14 +790,24 @@ QString xmetFormatLon(double val);
  */
 QString xmetFormatLat(double val);
 
+/**
+ * Returns a string as a quoted JSON string, escaping quotes, backslashes and control characters.
+ * Example:
+ *   a"b -> "a\"b"
+ */
+QString jsonString(const QString &s);
+
 /**
  * Sets the list of polygons that will be intersected in intersectedPolygons().
+ * \note This function and intersectedPolygons() operate on a global IntersectionLayer. They may be called from different threads,
+ * but use separate IntersectionLayer objects when working with more than one set of intersectable polygons.
  * @param polygons The list of intersectable polygons indexed from 0 to n-1.
  */
 void setIntersectablePolygons(const Polygons &polygons);
 
 /**
- * Intersects the polygons last specified in setIntersectablePolygons().
+ * Intersects the polygons last specified in setIntersectablePolygons(). The intersection is done in the calling thread only (see
+ * IntersectionLayer::intersection() for a concurrent version).
  * @param intersectors The polygons used for intersecting.
  * @return A list consisting of the following for each intersected polygon P:
  *   1) the (zero-based) index of P in the list passed to setIntersectedPolygons()
@@ -508,6 +815,29 @@ void setIntersectablePolygons(const Polygons &polygons);
  */
 QList<QPair<int, Polygons> > intersectedPolygons(const Polygons &intersectors);
 
+/**
+ * Simplifies a polygon so that its vertex count is reduced while it deviates at most a given distance from the original.
+ *
+ * The Douglas-Peucker algorithm is applied on the sphere, so each removed vertex is within \c toleranceKm of the great circle edge
+ * that replaces it. Since SIGMET/AIRMET coordinates have a resolution of one minute (up to about 1.85 km), a tolerance well below
+ * that is typically invisible in the result while considerably reducing the cost of filtering and intersecting dense polygons.
+ *
+ * \param[in] polygon     Polygon.
+ * \param[in] toleranceKm Maximum deviation in km. If zero or negative, the polygon is returned as is.
+ * \return The simplified polygon (or the polygon itself if it cannot be simplified).
+ */
+Polygon simplifiedPolygon(const Polygon &polygon, double toleranceKm);
+
+/**
+ * Simplifies each polygon in a list (see simplifiedPolygon()).
+ *
+ * \note This is an overloaded function.
+ * \param[in] polygons    Set of zero or more polygons.
+ * \param[in] toleranceKm Maximum deviation in km.
+ * \return The simplified polygons in the same order.
+ */
+Polygons simplifiedPolygons(const Polygons &polygons, double toleranceKm);
+
 /**
  * Computes the area of a polygon.
  * \param[in] polygon Polygon.
@@ -522,6 +852,13 @@ double area(const Polygon &polygon);
  */
 double area(const Polygons &polygons);
 
+/**
+ * Computes the area of each polygon in a set.
+ * \param[in] polygons Polygons.
+ * \return The area of each polygon in square kilometers (in the same order as \c polygons).
+ */
+QVector<double> areas(const Polygons &polygons);
+
 /**
  * Returns the polygons for the Norwegian municipalities.
  */
@@ -1,11 +1,14 @@
 #include "mgpmath.h"
 #include <math.h>
-#include <QHash>
 #include <QList>
-#include <QLinkedList>
+#include <QStack>
+#include <QMutex>
+#include <QElapsedTimer>
 #include <float.h>
 #include <stdexcept>
 #include <algorithm>
+#include <functional>
+#include <queue>
 #include <iostream>
 #include <cstdio>
 #include <QDebug>
@@ -481,6 +484,337 @@ _3DPoint _3DPoint::normalized(const _3DPoint &p)
     return np;
 }
 
+BoundingBox::BoundingBox()
+    : minLon_(0)
+    , maxLon_(0)
+    , minLat_(0)
+    , maxLat_(0)
+    , empty_(true)
+{
+}
+
+BoundingBox::BoundingBox(double minLon, double maxLon, double minLat, double maxLat)
+    : minLon_(minLon)
+    , maxLon_(maxLon)
+    , minLat_(minLat)
+    , maxLat_(maxLat)
+    , empty_(false)
+{
+}
+
+// Extends [minLat, maxLat] to include the great circle arc from a to b (both unit vectors). Only the interior extremes of the arc
+// are considered; the endpoints are assumed to be included already.
+static void extendLatRangeByArc(const _3DPoint &a, const _3DPoint &b, double &minLat, double &maxLat)
+{
+    const _3DPoint n = _3DPoint::cross(a, b); // normal of great circle plane
+    const double nxy2 = n.x() * n.x() + n.y() * n.y();
+    if ((nxy2 < DBL_MIN) || (n.norm() < FLT_MIN))
+        return; // arc along the equator or endpoints (nearly) coinciding, so the extremes are at the endpoints
+
+    // the northernmost point of the great circle is the projection of the north pole onto the great circle plane, and the
+    // southernmost point is the opposite one
+    const _3DPoint v(-n.x() * n.z(), -n.y() * n.z(), nxy2);
+    const double extLat = asin(qMin(1.0, v.z() / v.norm()));
+    for (int sign = -1; sign <= 1; sign += 2) {
+        const _3DPoint w(sign * v.x(), sign * v.y(), sign * v.z());
+        if ((_3DPoint::dot(_3DPoint::cross(a, w), n) > 0) && (_3DPoint::dot(_3DPoint::cross(w, b), n) > 0)) {
+            // the extreme lies inside the arc
+            if (sign > 0)
+                maxLat = qMax(maxLat, extLat);
+            else
+                minLat = qMin(minLat, -extLat);
+        }
+    }
+}
+
+BoundingBox BoundingBox::fromPolygon(const Polygon &polygon, double margin)
+{
+    return fromPolygon(PolygonView(polygon), margin);
+}
+
+BoundingBox BoundingBox::fromPolygon(const PolygonView &polygon, double margin)
+{
+    if (polygon.isEmpty())
+        return BoundingBox();
+
+    const int n = polygon.size();
+
+    // compute the latitude range, accounting for the poleward bulge of the edges, and the total longitude winding
+    double minLat = polygon.at(0).second;
+    double maxLat = minLat;
+    double winding = 0;
+    QVector<double> lons(n);
+    for (int i = 0; i < n; ++i) {
+        const Point &p1 = polygon.at(i);
+        const Point &p2 = polygon.at((i + 1) % n);
+        minLat = qMin(minLat, p1.second);
+        maxLat = qMax(maxLat, p1.second);
+        extendLatRangeByArc(_3DPoint(p1), _3DPoint(p2), minLat, maxLat);
+        lons[i] = fmod(p1.first + 3 * M_PI, 2 * M_PI) - M_PI; // normalize to [-M_PI, M_PI)
+        double dlon = p2.first - p1.first;
+        dlon = fmod(dlon + 3 * M_PI, 2 * M_PI) - M_PI;
+        winding += dlon;
+    }
+
+    // a polygon that winds around a pole encloses the pole nearest to its vertices
+    const bool enclosesPole = (qAbs(winding) > M_PI);
+    if (enclosesPole) {
+        if ((M_PI_2 - maxLat) < (minLat + M_PI_2))
+            maxLat = M_PI_2;
+        else
+            minLat = -M_PI_2;
+    }
+
+    // the longitude range is the complement of the largest gap between the vertex longitudes; if that gap is less than M_PI,
+    // an edge could span it, so use the full range to be on the safe side
+    double minLon = -M_PI;
+    double maxLon = M_PI;
+    if (!enclosesPole) {
+        qSort(lons.begin(), lons.end());
+        double maxGap = (lons.first() + 2 * M_PI) - lons.last(); // gap across the antimeridian
+        int maxGapIndex = n - 1;
+        for (int i = 0; i < (n - 1); ++i) {
+            const double gap = lons.at(i + 1) - lons.at(i);
+            if (gap > maxGap) {
+                maxGap = gap;
+                maxGapIndex = i;
+            }
+        }
+        if (maxGap >= M_PI) {
+            minLon = lons.at((maxGapIndex + 1) % n);
+            maxLon = lons.at(maxGapIndex);
+        }
+    }
+
+    // apply margin
+    if (margin > 0) {
+        minLat = qMax(-M_PI_2, minLat - margin);
+        maxLat = qMin(M_PI_2, maxLat + margin);
+        const double maxAbsLat = qMax(qAbs(minLat), qAbs(maxLat));
+        const double lonMargin = (maxAbsLat < (M_PI_2 - margin)) ? (margin / cos(maxAbsLat)) : (2 * M_PI);
+        const double lonSpan = (minLon <= maxLon) ? (maxLon - minLon) : (maxLon + 2 * M_PI - minLon);
+        if ((lonSpan + 2 * lonMargin) >= (2 * M_PI)) {
+            minLon = -M_PI;
+            maxLon = M_PI;
+        } else {
+            minLon -= lonMargin;
+            if (minLon < -M_PI)
+                minLon += 2 * M_PI;
+            maxLon += lonMargin;
+            if (maxLon > M_PI)
+                maxLon -= 2 * M_PI;
+        }
+    }
+
+    return BoundingBox(minLon, maxLon, minLat, maxLat);
+}
+
+bool BoundingBox::intersects(const BoundingBox &other) const
+{
+    if (empty_ || other.empty_)
+        return false;
+
+    if ((maxLat_ < other.minLat_) || (other.maxLat_ < minLat_))
+        return false;
+
+    if (wrapsLon() && other.wrapsLon())
+        return true; // both ranges include the antimeridian
+    if (wrapsLon())
+        return (other.minLon_ <= maxLon_) || (other.maxLon_ >= minLon_);
+    if (other.wrapsLon())
+        return (minLon_ <= other.maxLon_) || (maxLon_ >= other.minLon_);
+    return (minLon_ <= other.maxLon_) && (other.minLon_ <= maxLon_);
+}
+
+bool BoundingBox::contains(const Point &point) const
+{
+    if (empty_ || (point.second < minLat_) || (point.second > maxLat_))
+        return false;
+    const double lon = fmod(point.first + 3 * M_PI, 2 * M_PI) - M_PI;
+    return wrapsLon() ? ((lon >= minLon_) || (lon <= maxLon_)) : ((lon >= minLon_) && (lon <= maxLon_));
+}
+
+PreparedPolygon::PreparedPolygon()
+    : capRadius_(M_PI)
+    , capCos_(-1)
+{
+    updateExternalPoint();
+}
+
+PreparedPolygon::PreparedPolygon(const Polygon &polygon)
+    : polygon_(polygon)
+    , capRadius_(M_PI)
+    , capCos_(-1)
+{
+    if (polygon)
+        points_ = *polygon;
+    init();
+}
+
+PreparedPolygon::PreparedPolygon(const PolygonView &polygon)
+    : points_(polygon.size())
+    , capRadius_(M_PI)
+    , capCos_(-1)
+{
+    std::copy(polygon.constData(), polygon.constData() + polygon.size(), points_.begin());
+    init();
+}
+
+PreparedPolygon::PreparedPolygon(const Geometry &geometry)
+    : points_(geometry.size)
+    , vertices_(geometry.size)
+    , normals_(geometry.size)
+    , capCenter_(geometry.capCenter[0], geometry.capCenter[1], geometry.capCenter[2])
+    , capRadius_(geometry.capRadius)
+    , capCos_(geometry.capCos)
+    , extPoint_(geometry.externalPoint[0], geometry.externalPoint[1])
+    , extVertex_(geometry.externalVertex[0], geometry.externalVertex[1], geometry.externalVertex[2])
+{
+    for (int i = 0; i < geometry.size; ++i) {
+        points_[i] = Point(geometry.points[2 * i], geometry.points[2 * i + 1]);
+        vertices_[i] = _3DPoint(geometry.vertices[3 * i], geometry.vertices[3 * i + 1], geometry.vertices[3 * i + 2]);
+        normals_[i] = _3DPoint(geometry.normals[3 * i], geometry.normals[3 * i + 1], geometry.normals[3 * i + 2]);
+    }
+
+    // let the polygon share the points so that isPreparedFrom(polygon()) holds
+    polygon_ = Polygon(new QVector<Point>(points_));
+}
+
+void PreparedPolygon::init()
+{
+    const int n = points_.size();
+    vertices_.reserve(n);
+    for (int i = 0; i < n; ++i)
+        vertices_.append(_3DPoint::fromSpherical(points_.at(i).first, points_.at(i).second));
+    normals_.resize(n);
+    for (int i = 0; i < n; ++i)
+        updateNormal(i);
+
+    updateCap();
+    updateExternalPoint();
+}
+
+Polygon PreparedPolygon::polygon() const
+{
+    return polygon_ ? polygon_ : Polygon(new QVector<Point>(points_));
+}
+
+bool PreparedPolygon::isPreparedFrom(const Polygon &polygon) const
+{
+    return polygon && (polygon == polygon_) && (*polygon == points_);
+}
+
+bool PreparedPolygon::capContains(const _3DPoint &v) const
+{
+    return (capRadius_ >= M_PI) || (_3DPoint::dot(v, capCenter_) >= capCos_);
+}
+
+bool PreparedPolygon::capIntersects(const PreparedPolygon &other, double margin) const
+{
+    if ((capRadius_ >= M_PI) || (other.capRadius_ >= M_PI))
+        return true;
+    const double dist = acos(qMax(-1.0, qMin(1.0, _3DPoint::dot(capCenter_, other.capCenter_))));
+    return dist <= (capRadius_ + other.capRadius_ + margin);
+}
+
+void PreparedPolygon::setPoint(int i, const Point &point)
+{
+    polygon_.clear(); // no longer identical to the original polygon
+    points_[i] = point;
+    vertices_[i] = _3DPoint::fromSpherical(point.first, point.second);
+    updateNormal((i - 1 + size()) % size());
+    updateNormal(i);
+    if (!capContains(vertices_.at(i)))
+        updateCap();
+    updateExternalPoint();
+}
+
+void PreparedPolygon::removePoint(int i)
+{
+    polygon_.clear(); // no longer identical to the original polygon
+    points_.remove(i);
+    vertices_.remove(i);
+    normals_.remove(i);
+    if (!points_.isEmpty())
+        updateNormal((i - 1 + size()) % size());
+    updateCap();
+    updateExternalPoint();
+}
+
+void PreparedPolygon::updateNormal(int i)
+{
+    normals_[i] = _3DPoint::cross(vertices_.at(i), vertices_.at((i + 1) % size()));
+}
+
+void PreparedPolygon::updateCap()
+{
+    capRadius_ = M_PI;
+    capCos_ = -1;
+
+    // center the cap at the normalized vertex sum and let it reach the vertex furthest away (note that a great circle arc
+    // between two points inside a cap smaller than a hemisphere is also inside the cap)
+    double x = 0;
+    double y = 0;
+    double z = 0;
+    for (int i = 0; i < vertices_.size(); ++i) {
+        x += vertices_.at(i).x();
+        y += vertices_.at(i).y();
+        z += vertices_.at(i).z();
+    }
+    const double nrm = Math::norm(x, y, z);
+    if (nrm < FLT_MIN)
+        return;
+    capCenter_ = _3DPoint(x / nrm, y / nrm, z / nrm);
+
+    double minDot = 1;
+    for (int i = 0; i < vertices_.size(); ++i)
+        minDot = qMin(minDot, _3DPoint::dot(vertices_.at(i), capCenter_));
+    const double radius = acos(qMax(-1.0, minDot)) + 1e-9;
+    if (radius < M_PI_2) {
+        capRadius_ = radius;
+        capCos_ = cos(radius);
+    }
+}
+
+void PreparedPolygon::updateExternalPoint()
+{
+    // define an external point (i.e. a point that is assumed to be outside the polygon)
+    if (points_.isEmpty()) {
+        extPoint_ = Point(0, 0.99 * M_PI_2);
+    } else {
+        double avgLon = 0;
+        double minLat;
+        double maxLat;
+        minLat = maxLat = points_.first().second;
+        for (int i = 0; i < points_.size(); ++i) {
+            avgLon += points_.at(i).first;
+            const double lat = points_.at(i).second;
+            minLat = qMin(lat, minLat);
+            maxLat = qMax(lat, maxLat);
+        }
+        avgLon /= points_.size();
+        extPoint_ = Point(avgLon, 0.99 * M_PI_2);
+        if ((M_PI_2 - maxLat) < (minLat - (-M_PI_2)))
+            // polygon is closer to the north pole, so use a point close to the south pole as the external point
+            extPoint_.second = -extPoint_.second;
+    }
+    extVertex_ = _3DPoint::fromSpherical(extPoint_.first, extPoint_.second);
+}
+
+QVector<BoundingBox> BoundingBox::splitAtAntimeridian() const
+{
+    QVector<BoundingBox> boxes;
+    if (empty_)
+        return boxes;
+    if (wrapsLon()) {
+        boxes.append(BoundingBox(minLon_, M_PI, minLat_, maxLat_));
+        boxes.append(BoundingBox(-M_PI, maxLon_, minLat_, maxLat_));
+    } else {
+        boxes.append(*this);
+    }
+    return boxes;
+}
+
 bool greatCircleArcsIntersect(const Point &p1, const Point &p2, const Point &p3, const Point &p4, Point *isctPoint)
 {
     // Adopted from http://www.mathworks.com/matlabcentral/newsreader/view_thread/276271 .
@@ -497,6 +831,13 @@ bool greatCircleArcsIntersect(const Point &p1, const Point &p2, const Point &p3,
     const _3DPoint p = _3DPoint::cross(a0, a1); // normal of plane 1
     const _3DPoint q = _3DPoint::cross(b0, b1); // normal of plane 2
 
+    return greatCircleArcsIntersect(a0, a1, p, b0, b1, q, isctPoint);
+}
+
+bool greatCircleArcsIntersect(
+        const _3DPoint &a0, const _3DPoint &a1, const _3DPoint &p, const _3DPoint &b0, const _3DPoint &b1, const _3DPoint &q,
+        Point *isctPoint)
+{
     const _3DPoint t = _3DPoint::cross(p, q);
     if (t.norm() < FLT_MIN)
         return false; // arcs lie (approximately) in the same plane => no intersections
@@ -717,32 +1058,26 @@ QVector<_3DPoint> greatCirclePoints(const QPair<double, double> &p1, const QPair
     return points;
 }
 
-bool pointInPolygon(const Point &point, const Polygon &polygon)
+// Returns true iff a point (given as unit vector) is considered inside a prepared polygon.
+static bool pointInPolygon(const _3DPoint &v, const PreparedPolygon &polygon)
 {
-    // define an external point (i.e. a point that is assumed to be outside the polygon)
-    double avgLon = 0;
-    double minLat;
-    double maxLat;
-    minLat = maxLat = polygon->first().second;
-    for (int i = 0; i < polygon->size(); ++i) {
-        avgLon += polygon->at(i).first;
-        const double lat = polygon->at(i).second;
-        minLat = qMin(lat, minLat);
-        maxLat = qMax(lat, maxLat);
-    }
-    avgLon /= polygon->size();
-    Point extPoint(avgLon, 0.99 * M_PI_2);
-    if ((M_PI_2 - maxLat) < (minLat - (-M_PI_2)))
-        // polygon is closer to the north pole, so use a point close to the south pole as the external point
-        extPoint.second = -extPoint.second;
+    if (polygon.isEmpty())
+        return false;
+
+    // a point outside the bounding cap is outside the polygon (unless the external point is inside the cap as well, in which
+    // case the ray casting below is done as usual for consistency)
+    if ((!polygon.capContains(v)) && (!polygon.capContains(polygon.externalVertex())))
+        return false;
 
     // compute the number of intersections between 1) the arc from the point to the external point and
     // 2) argcs forming the polygon
+    const _3DPoint &ev = polygon.externalVertex();
+    const _3DPoint p = _3DPoint::cross(v, ev);
     int nisct = 0;
-    for (int i = 0; i < polygon->size(); ++i) {
+    for (int i = 0; i < polygon.size(); ++i) {
         if (greatCircleArcsIntersect(
-                    point, extPoint,
-                    polygon->at(i), polygon->at((i + 1) % polygon->size())))
+                    v, ev, p,
+                    polygon.vertex(i), polygon.vertex((i + 1) % polygon.size()), polygon.normal(i)))
             nisct++;
     }
 
@@ -750,13 +1085,234 @@ bool pointInPolygon(const Point &point, const Polygon &polygon)
     return nisct % 2;
 }
 
+bool pointInPolygon(const Point &point, const PreparedPolygon &polygon)
+{
+    return pointInPolygon(_3DPoint::fromSpherical(point.first, point.second), polygon);
+}
+
+QBitArray pointsInPolygon(const Point *points, int n, const PreparedPolygon &polygon)
+{
+    QBitArray result(n);
+    if (polygon.isEmpty())
+        return result;
+
+    const _3DPoint &ev = polygon.externalVertex();
+    const bool useCap = !polygon.capContains(ev);
+
+    // set up per-point quantities in separate arrays (structure of arrays) for the points that need ray casting:
+    // the ray normal p = v x ev along with p x v and ev x p (see greatCircleArcsIntersect())
+    QVector<int> index;
+    QVector<double> px, py, pz, ux, uy, uz, wx, wy, wz;
+    index.reserve(n);
+    for (int k = 0; k < n; ++k) {
+        const _3DPoint v = _3DPoint::fromSpherical(points[k].first, points[k].second);
+        if (useCap && (!polygon.capContains(v)))
+            continue; // outside the bounding cap, so outside the polygon
+        const _3DPoint p = _3DPoint::cross(v, ev);
+        const _3DPoint u = _3DPoint::cross(p, v);
+        const _3DPoint w = _3DPoint::cross(ev, p);
+        index.append(k);
+        px.append(p.x()); py.append(p.y()); pz.append(p.z());
+        ux.append(u.x()); uy.append(u.y()); uz.append(u.z());
+        wx.append(w.x()); wy.append(w.y()); wz.append(w.z());
+    }
+
+    // pad the arrays to a whole number of blocks (a zero ray normal never intersects anything)
+    const int m = index.size();
+    const int blockSize = 256;
+    const int mpadded = ((m + blockSize - 1) / blockSize) * blockSize;
+    px.resize(mpadded); py.resize(mpadded); pz.resize(mpadded);
+    ux.resize(mpadded); uy.resize(mpadded); uz.resize(mpadded);
+    wx.resize(mpadded); wy.resize(mpadded); wz.resize(mpadded);
+
+    // count the intersections between each ray and each edge, looping over the points in the inner loop so that it
+    // is branch free and may be vectorized by the compiler (the points are processed in blocks small enough to stay in the cache
+    // while looping over the edges)
+    const double minNorm2 = double(FLT_MIN) * FLT_MIN; // same as comparing the norm against FLT_MIN, but without sqrt()
+    for (int first = 0; first < m; first += blockSize) {
+        const double *Px = px.constData() + first, *Py = py.constData() + first, *Pz = pz.constData() + first;
+        const double *Ux = ux.constData() + first, *Uy = uy.constData() + first, *Uz = uz.constData() + first;
+        const double *Wx = wx.constData() + first, *Wy = wy.constData() + first, *Wz = wz.constData() + first;
+        double nisct[blockSize];
+        for (int k = 0; k < blockSize; ++k)
+            nisct[k] = 0;
+        for (int i = 0; i < polygon.size(); ++i) {
+            const _3DPoint &q = polygon.normal(i);
+            const _3DPoint b0 = _3DPoint::cross(q, polygon.vertex(i));
+            const _3DPoint b1 = _3DPoint::cross(polygon.vertex((i + 1) % polygon.size()), q);
+            const double qx = q.x(), qy = q.y(), qz = q.z();
+            const double b0x = b0.x(), b0y = b0.y(), b0z = b0.z();
+            const double b1x = b1.x(), b1y = b1.y(), b1z = b1.z();
+            for (int k = 0; k < blockSize; ++k) {
+                const double tx = Py[k] * qz - Pz[k] * qy;
+                const double ty = Pz[k] * qx - Px[k] * qz;
+                const double tz = Px[k] * qy - Py[k] * qx;
+                const double s1 = Ux[k] * tx + Uy[k] * ty + Uz[k] * tz;
+                const double s2 = Wx[k] * tx + Wy[k] * ty + Wz[k] * tz;
+                const double s3 = b0x * tx + b0y * ty + b0z * tz;
+                const double s4 = b1x * tx + b1y * ty + b1z * tz;
+                const bool valid = ((tx * tx + ty * ty + tz * tz) >= minNorm2);
+                const bool pos = (s1 > 0) & (s2 > 0) & (s3 > 0) & (s4 > 0);
+                const bool neg = (s1 < 0) & (s2 < 0) & (s3 < 0) & (s4 < 0);
+                nisct[k] += (valid & (pos | neg)) ? 1.0 : 0.0;
+            }
+        }
+
+        // a point is considered inside the polygon if there is an odd number of intersections
+        for (int k = 0; (k < blockSize) && ((first + k) < m); ++k)
+            if (int(nisct[k]) % 2)
+                result.setBit(index.at(first + k));
+    }
+
+    return result;
+}
+
+QBitArray pointsInPolygon(const QVector<Point> &points, const PreparedPolygon &polygon)
+{
+    return pointsInPolygon(points.constData(), points.size(), polygon);
+}
+
+PointInPolygonIndex::PointInPolygonIndex()
+    : minLon_(0)
+    , minLat_(0)
+    , lonSpan_(0)
+    , latSpan_(0)
+    , resolution_(0)
+{
+}
+
+PointInPolygonIndex::PointInPolygonIndex(const PreparedPolygon &polygon, int resolution)
+    : polygon_(polygon)
+    , minLon_(0)
+    , minLat_(0)
+    , lonSpan_(0)
+    , latSpan_(0)
+    , resolution_(0)
+{
+    const int n = polygon_.size();
+    if (n < 3)
+        return;
+
+    // check if the polygon is suitable for a grid
+    const double maxAbsLat = DEG2RAD(80);
+    const BoundingBox box = BoundingBox::fromPolygon(polygon_.polygon());
+    const double lonSpan = box.wrapsLon() ? (box.maxLon() + 2 * M_PI - box.minLon()) : (box.maxLon() - box.minLon());
+    if ((lonSpan >= M_PI) || (box.minLat() < -maxAbsLat) || (box.maxLat() > maxAbsLat))
+        return;
+
+    minLon_ = box.minLon();
+    minLat_ = box.minLat();
+    lonSpan_ = qMax(lonSpan, 1e-9);
+    latSpan_ = qMax(box.maxLat() - box.minLat(), 1e-9);
+    resolution_ = (resolution > 0) ? resolution : qBound(8, int(2 * sqrt(double(n))), 256);
+    const double dLon = lonSpan_ / resolution_;
+    const double dLat = latSpan_ / resolution_;
+
+    // find the cells that may be crossed by each edge, i.e. those overlapping the bounding box of the edge extended by half a cell
+    // (which also accounts for the arc from a point to the center of its cell bulging slightly out of the cell)
+    QVector<QPair<int, int> > cellEdges; // (cell, edge)
+    for (int i = 0; i < n; ++i) {
+        const Point &p1 = polygon_.point(i);
+        const Point &p2 = polygon_.point((i + 1) % n);
+        const double lon1 = localLon(p1.first);
+        const double lon2 = localLon(p2.first);
+        double minLat = qMin(p1.second, p2.second);
+        double maxLat = qMax(p1.second, p2.second);
+        extendLatRangeByArc(polygon_.vertex(i), polygon_.vertex((i + 1) % n), minLat, maxLat);
+
+        const int i0 = qBound(0, int(floor((qMin(lon1, lon2) - dLon / 2) / dLon)), resolution_ - 1);
+        const int i1 = qBound(0, int(floor((qMax(lon1, lon2) + dLon / 2) / dLon)), resolution_ - 1);
+        const int j0 = qBound(0, int(floor((minLat - minLat_ - dLat / 2) / dLat)), resolution_ - 1);
+        const int j1 = qBound(0, int(floor((maxLat - minLat_ + dLat / 2) / dLat)), resolution_ - 1);
+        for (int j = j0; j <= j1; ++j)
+            for (int k = i0; k <= i1; ++k)
+                cellEdges.append(qMakePair(j * resolution_ + k, i));
+    }
+    std::sort(cellEdges.begin(), cellEdges.end());
+
+    // classify the cells
+    cells_.resize(resolution_ * resolution_);
+    QVector<Point> centers(cells_.size());
+    for (int c = 0; c < cells_.size(); ++c)
+        centers[c] = Point(minLon_ + ((c % resolution_) + 0.5) * dLon, minLat_ + ((c / resolution_) + 0.5) * dLat);
+    const QBitArray centersInside = pointsInPolygon(centers, polygon_);
+    edges_.reserve(cellEdges.size());
+    int e = 0;
+    for (int c = 0; c < cells_.size(); ++c) {
+        Cell &cell = cells_[c];
+        cell.center_ = _3DPoint::fromSpherical(centers.at(c).first, centers.at(c).second);
+        const bool centerInside = centersInside.testBit(c);
+        cell.firstEdge_ = edges_.size();
+        for (; (e < cellEdges.size()) && (cellEdges.at(e).first == c); ++e)
+            edges_.append(cellEdges.at(e).second);
+        cell.edgeCount_ = edges_.size() - cell.firstEdge_;
+        if (cell.edgeCount_ > 0) {
+            cell.state_ = Boundary;
+            cell.centerInside_ = centerInside;
+        } else {
+            cell.state_ = centerInside ? Inside : Outside;
+        }
+    }
+}
+
+double PointInPolygonIndex::localLon(double lon) const
+{
+    double x = fmod(lon - minLon_ + 4 * M_PI, 2 * M_PI);
+    if (x > ((lonSpan_ + 2 * M_PI) / 2))
+        x -= 2 * M_PI;
+    return x;
+}
+
+bool PointInPolygonIndex::contains(const Point &point) const
+{
+    if (cells_.isEmpty())
+        return pointInPolygon(point, polygon_);
+
+    // points outside the grid are outside the polygon
+    const double x = localLon(point.first);
+    const double y = point.second - minLat_;
+    if ((x < 0) || (x > lonSpan_) || (y < 0) || (y > latSpan_))
+        return false;
+
+    const int i = qMin(int(x / (lonSpan_ / resolution_)), resolution_ - 1);
+    const int j = qMin(int(y / (latSpan_ / resolution_)), resolution_ - 1);
+    const Cell &cell = cells_.at(j * resolution_ + i);
+    if (cell.state_ != Boundary)
+        return cell.state_ == Inside;
+
+    // count the intersections between the arc from the point to the cell center and the edges crossing the cell; the point is
+    // inside iff the cell center is inside and the count is even or vice versa
+    const _3DPoint v = _3DPoint::fromSpherical(point.first, point.second);
+    const _3DPoint p = _3DPoint::cross(v, cell.center_);
+    int nisct = 0;
+    for (int k = cell.firstEdge_; k < (cell.firstEdge_ + cell.edgeCount_); ++k) {
+        const int edge = edges_.at(k);
+        if (greatCircleArcsIntersect(
+                    v, cell.center_, p,
+                    polygon_.vertex(edge), polygon_.vertex((edge + 1) % polygon_.size()), polygon_.normal(edge)))
+            nisct++;
+    }
+    return cell.centerInside_ != bool(nisct % 2);
+}
+
+bool pointInPolygon(const Point &point, const Polygon &polygon)
+{
+    return pointInPolygon(point, PreparedPolygon(polygon));
+}
+
+bool pointInPolygon(const Point &point, const PolygonView &polygon)
+{
+    return pointInPolygon(point, PreparedPolygon(polygon));
+}
+
 struct IsctInfo {
     int isctId_; // non-negative intersection ID
     int c_; // intersection on line (c, (c + 1) % C.size()) in clip polygon C for 0 <= c < C.size()
     int s_; // intersection on line (s, (s + 1) % S.size()) in subject polygon S for 0 <= s < S.size()
     Point point_; // lon,lat radians of intersection point
-    double cdist_; // distance between C->at(c) and point_
-    double sdist_; // distance between S->at(s) and point_
+    double cdist_; // distance between C.point(c) and point_
+    double sdist_; // distance between S.point(s) and point_
+    IsctInfo() : isctId_(-1), c_(-1), s_(-1), cdist_(0), sdist_(0) {}
     IsctInfo(int isctId, int c, int s, const Point &point, double cdist, double sdist)
         : isctId_(isctId)
         , c_(c)
@@ -767,26 +1323,56 @@ struct IsctInfo {
     {}
 };
 
+// Orders intersections on increasing distance from the first vertex of the subject edge. Intersections at the same distance
+// are ordered on decreasing ID (i.e. the one found last comes first).
+struct SubjectEdgeLessThan {
+    bool operator()(const IsctInfo &i1, const IsctInfo &i2) const
+    {
+        if (i1.s_ != i2.s_)
+            return i1.s_ < i2.s_;
+        if (i1.sdist_ != i2.sdist_)
+            return i1.sdist_ < i2.sdist_;
+        return i1.isctId_ > i2.isctId_;
+    }
+};
+
+// Orders intersections on increasing distance from the first vertex of the clip edge. Intersections at the same distance
+// are ordered on decreasing ID (i.e. the one found last comes first).
+struct ClipEdgeLessThan {
+    bool operator()(const IsctInfo &i1, const IsctInfo &i2) const
+    {
+        if (i1.c_ != i2.c_)
+            return i1.c_ < i2.c_;
+        if (i1.cdist_ != i2.cdist_)
+            return i1.cdist_ < i2.cdist_;
+        return i1.isctId_ > i2.isctId_;
+    }
+};
+
 struct Node {
     Point point_; // lon,lat radians of point represented by the node
     int isctId_; // non-negative intersection ID, or < 0 if the node does not represent an intersection
-    QLinkedList<Node>::iterator neighbour_; // pointer to corresponding intersection node in other list
+    int neighbour_; // index of corresponding intersection node in other list
     bool entry_; // whether the intersection node represents an entry into (true) or an exit from (false) the clipped polygon
     bool visited_; // whether the intersection node has already been processed in the generation of output polygons
-    Node(const Point &point, int isctId = -1) : point_(point), isctId_(isctId), entry_(false), visited_(false) {}
+    Node() : isctId_(-1), neighbour_(-1), entry_(false), visited_(false) {}
+    Node(const Point &point, int isctId = -1) : point_(point), isctId_(isctId), neighbour_(-1), entry_(false), visited_(false) {}
 };
 
-static void printLists(const QString &tag, const QLinkedList<Node> &slist, const QLinkedList<Node> &clist)
+// Circular list of nodes stored contiguously, i.e. the node following the one at index i is at index (i + 1) % size().
+typedef QVector<Node> NodeList;
+
+static void printLists(const QString &tag, const NodeList &slist, const NodeList &clist)
 {
     {
         std::cout << tag.toLatin1().data() << "; subj: ";
-        QLinkedList<Node>::const_iterator it;
-        for (it = slist.constBegin(); it != slist.constEnd(); ++it) {
-            if (it->isctId_ < 0) {
+        for (int i = 0; i < slist.size(); ++i) {
+            const Node &node = slist.at(i);
+            if (node.isctId_ < 0) {
                 std::cout << "V  ";
             } else {
-                std::cout << it->isctId_ << "<" << (it->entry_ ? "entry" : "exit") << ">  ";
-                Q_ASSERT(it->isctId_ == it->neighbour_->isctId_);
+                std::cout << node.isctId_ << "<" << (node.entry_ ? "entry" : "exit") << ">  ";
+                Q_ASSERT(node.isctId_ == clist.at(node.neighbour_).isctId_);
             }
         }
         std::cout << std::endl;
@@ -794,13 +1380,13 @@ static void printLists(const QString &tag, const QLinkedList<Node> &slist, const
 
     {
         std::cout << tag.toLatin1().data() << "; clip: ";
-        QLinkedList<Node>::const_iterator it;
-        for (it = clist.constBegin(); it != clist.constEnd(); ++it) {
-            if (it->isctId_ < 0) {
+        for (int i = 0; i < clist.size(); ++i) {
+            const Node &node = clist.at(i);
+            if (node.isctId_ < 0) {
                 std::cout << "V  ";
             } else {
-                std::cout << it->isctId_ << "<" << (it->entry_ ? "entry" : "exit") << ">  ";
-                Q_ASSERT(it->isctId_ == it->neighbour_->isctId_);
+                std::cout << node.isctId_ << "<" << (node.entry_ ? "entry" : "exit") << ">  ";
+                Q_ASSERT(node.isctId_ == slist.at(node.neighbour_).isctId_);
             }
         }
         std::cout << std::endl << std::endl;
@@ -808,13 +1394,56 @@ static void printLists(const QString &tag, const QLinkedList<Node> &slist, const
 }
 
 
+// Creates the list of original vertices and intersections for a polygon of n vertices. The intersections are assumed to be sorted
+// on edge, then on position along the edge (edgeOf() returning the edge of an intersection). The index of the node of each
+// intersection is stored in nodeIndex (indexed by intersection ID).
+template <typename EdgeOf>
+static NodeList createNodeList(
+        const PreparedPolygon &p, const QVector<IsctInfo> &iscts, EdgeOf edgeOf, QVector<int> *nodeIndex)
+{
+    NodeList list;
+    list.reserve(p.size() + iscts.size());
+    int j = 0;
+    for (int i = 0; i < p.size(); ++i) {
+        // append node for point i
+        list.append(Node(p.point(i)));
+
+        // append nodes for intersections on line (i, (i + 1) % p.size())
+        for (; (j < iscts.size()) && (edgeOf(iscts.at(j)) == i); ++j) {
+            (*nodeIndex)[iscts.at(j).isctId_] = list.size();
+            list.append(Node(iscts.at(j).point_, iscts.at(j).isctId_));
+        }
+    }
+    Q_ASSERT(j == iscts.size());
+    return list;
+}
+
+struct SubjectEdgeOf { int operator()(const IsctInfo &isct) const { return isct.s_; } };
+struct ClipEdgeOf { int operator()(const IsctInfo &isct) const { return isct.c_; } };
+
+// Sets the entry/exit status of each intersection node in a list. The first node is assumed to be an original vertex.
+static void setEntryStatus(NodeList *list, const PreparedPolygon &other)
+{
+    // whether the next intersection represents an entry into the other polygon
+    bool entry = !pointInPolygon(list->first().point_, other);
+
+    for (int i = 0; i < list->size(); ++i) {
+        Node &node = (*list)[i];
+        if (node.isctId_ >= 0) {
+            node.entry_ = entry;
+            entry = !entry; // if this intersection was an entry, the next one must be an exit and vice versa
+        }
+    }
+}
+
+
 // Removes coincident neighbours in p.
-static void removeCoincidentNeighbours(const Polygon &p)
+static void removeCoincidentNeighbours(PreparedPolygon *p)
 {
     const double epsilon = 0.001;
     for (int i = p->size() - 1; i >= 0; --i) {
-        if (Math::distance(p->at(i), p->at((i + 1) % p->size())) < epsilon)
-            p->remove(i);
+        if (Math::distance(p->point(i), p->point((i + 1) % p->size())) < epsilon)
+            p->removePoint(i);
     }
 
 }
@@ -838,37 +1467,293 @@ static Point perturbedVertex(const Point &p0, const Point &p1, const Point &p2,
 // Attempts to ensure that each edge in the clip polygon (c) is intersectable with relevant edges in the subject polygon (s)
 // by eliminating degenerate cases as far as possible. This reduces the possibility of polygonIntersection() generating a false
 // result. Degenerate cases are essentially those in which a vertex is too close to an edge. This may in turn lead to ambiguities
-// that cause the main algorithm to fail.
+// that cause the main algorithm to fail. Returns the number of perturbed vertices.
 //
-static void fixDegenerate(const Polygon &s, const Polygon &c)
+static int fixDegenerate(PreparedPolygon *s, PreparedPolygon *c)
 {
     const double epsilon = 0.0001; // seems appropriate for cases we have encountered in practice so far
     const int nc = c->size();
     const int ns = s->size();
 
+    // a vertex farther than 2 * epsilon from the great circle of an edge (i.e. |vertex . unit normal| > sin(2 * epsilon))
+    // is also farther than epsilon from the edge itself, so the expensive distance computation can be skipped
+    const double maxSinDist = sin(2 * epsilon);
+
+    int perturbations = 0;
+
     // *** STEP 1: perturb each vertex in s so that none is too close to an edge in c. ***
     for (int i = 0; i < nc; ++i) {
+        const double nnorm = c->normal(i).norm();
         for (int j = 0; j < ns; ++j) {
-            if (distanceToGreatCircleArc(s->at(j), c->at(i), c->at((i + 1) % nc)) < epsilon) {
+            if ((nnorm >= FLT_MIN) && (qAbs(_3DPoint::dot(s->vertex(j), c->normal(i))) > (maxSinDist * nnorm)))
+                continue;
+            if (distanceToGreatCircleArc(s->point(j), c->point(i), c->point((i + 1) % nc)) < epsilon) {
                 // vertex(s, j) is too close to edge(c, i, i + 1), so perturb vertex(s, j) ...
-                (*s)[j] = perturbedVertex(s->at(j), c->at(i), c->at((i + 1) % nc), epsilon);
+                s->setPoint(j, perturbedVertex(s->point(j), c->point(i), c->point((i + 1) % nc), epsilon));
+                perturbations++;
             }
         }
     }
 
     // *** STEP 2: perturb each vertex in c so that none is too close to an edge in s. ***
     for (int j = 0; j < ns; ++j) {
+        const double nnorm = s->normal(j).norm();
         for (int i = 0; i < nc; ++i) {
-            if (distanceToGreatCircleArc(c->at(i), s->at(j), s->at((j + 1) % ns)) < epsilon) {
+            if ((nnorm >= FLT_MIN) && (qAbs(_3DPoint::dot(c->vertex(i), s->normal(j))) > (maxSinDist * nnorm)))
+                continue;
+            if (distanceToGreatCircleArc(c->point(i), s->point(j), s->point((j + 1) % ns)) < epsilon) {
                 // vertex(c, i) is too close to edge(s, j, j + 1), so perturb vertex(c, i) ...
-                (*c)[i] = perturbedVertex(c->at(i), s->at(j), s->at((j + 1) % ns), epsilon);
+                c->setPoint(i, perturbedVertex(c->point(i), s->point(j), s->point((j + 1) % ns), epsilon));
+                perturbations++;
             }
         }
     }
+
+    return perturbations;
+}
+
+
+// Axis-aligned box in 3D space enclosing a great circle arc (i.e. the minor arc between two unit vectors).
+struct ArcBox {
+    double min_[3];
+    double max_[3];
+    int edge_; // index of first vertex of the edge
+    ArcBox() : edge_(-1) {}
+    ArcBox(const _3DPoint &a0, const _3DPoint &a1, int edge)
+        : edge_(edge)
+    {
+        // no point on the arc is farther from the chord than the sagitta 1 - cos(theta / 2), where theta is the arc angle
+        const double cosTheta = qMax(-1.0, qMin(1.0, _3DPoint::dot(a0, a1)));
+        const double margin = 1 - sqrt((1 + cosTheta) / 2) + 1e-9;
+        for (int i = 0; i < 3; ++i) {
+            min_[i] = qMin(a0.get(i), a1.get(i)) - margin;
+            max_[i] = qMax(a0.get(i), a1.get(i)) + margin;
+        }
+    }
+    bool intersects(const ArcBox &other) const
+    {
+        for (int i = 0; i < 3; ++i)
+            if ((max_[i] < other.min_[i]) || (other.max_[i] < min_[i]))
+                return false;
+        return true;
+    }
+};
+
+struct ArcBoxMinLessThan {
+    int axis_;
+    ArcBoxMinLessThan(int axis) : axis_(axis) {}
+    bool operator()(const ArcBox &b1, const ArcBox &b2) const { return b1.min_[axis_] < b2.min_[axis_]; }
+};
+
+static QVector<ArcBox> arcBoxes(const PreparedPolygon &p)
+{
+    QVector<ArcBox> boxes;
+    boxes.reserve(p.size());
+    for (int i = 0; i < p.size(); ++i)
+        boxes.append(ArcBox(p.vertex(i), p.vertex((i + 1) % p.size()), i));
+    return boxes;
+}
+
+// Returns the pairs (s, c) of edges in S and C that may intersect (i.e. whose arc boxes overlap), sorted on s, then c.
+// The pairs are found by sweeping along the coordinate axis in which the boxes have the largest extent, so that only boxes
+// that overlap along that axis are compared.
+static QVector<QPair<int, int> > candidateEdgePairs(const PreparedPolygon &S, const PreparedPolygon &C)
+{
+    QVector<QPair<int, int> > pairs;
+
+    QVector<ArcBox> sboxes = arcBoxes(S);
+    QVector<ArcBox> cboxes = arcBoxes(C);
+    if (sboxes.isEmpty() || cboxes.isEmpty())
+        return pairs;
+
+    // find the sweep axis
+    int axis = 0;
+    {
+        double maxExtent = -1;
+        for (int i = 0; i < 3; ++i) {
+            double minVal = sboxes.first().min_[i];
+            double maxVal = sboxes.first().max_[i];
+            for (int j = 0; j < sboxes.size(); ++j) {
+                minVal = qMin(minVal, sboxes.at(j).min_[i]);
+                maxVal = qMax(maxVal, sboxes.at(j).max_[i]);
+            }
+            for (int j = 0; j < cboxes.size(); ++j) {
+                minVal = qMin(minVal, cboxes.at(j).min_[i]);
+                maxVal = qMax(maxVal, cboxes.at(j).max_[i]);
+            }
+            if ((maxVal - minVal) > maxExtent) {
+                maxExtent = maxVal - minVal;
+                axis = i;
+            }
+        }
+    }
+
+    std::sort(sboxes.begin(), sboxes.end(), ArcBoxMinLessThan(axis));
+    std::sort(cboxes.begin(), cboxes.end(), ArcBoxMinLessThan(axis));
+
+    // sweep, keeping track of the boxes in each polygon that are still active (i.e. that may overlap the next box along the axis)
+    QVector<ArcBox> sactive;
+    QVector<ArcBox> cactive;
+    int si = 0;
+    int ci = 0;
+    while ((si < sboxes.size()) || (ci < cboxes.size())) {
+        const bool nextIsS = (ci == cboxes.size()) || ((si < sboxes.size()) && (sboxes.at(si).min_[axis] <= cboxes.at(ci).min_[axis]));
+        const ArcBox &box = nextIsS ? sboxes.at(si++) : cboxes.at(ci++);
+        QVector<ArcBox> &others = nextIsS ? cactive : sactive;
+
+        // remove boxes of the other polygon that end before this one starts, and compare against the remaining ones
+        for (int i = others.size() - 1; i >= 0; --i) {
+            if (others.at(i).max_[axis] < box.min_[axis]) {
+                others[i] = others.last();
+                others.removeLast();
+            } else if (box.intersects(others.at(i))) {
+                pairs.append(nextIsS ? qMakePair(box.edge_, others.at(i).edge_) : qMakePair(others.at(i).edge_, box.edge_));
+            }
+        }
+
+        (nextIsS ? sactive : cactive).append(box);
+    }
+
+    std::sort(pairs.begin(), pairs.end());
+    return pairs;
+}
+
+QVector<EdgeIntersection> edgeIntersections(const PreparedPolygon &S, const PreparedPolygon &C, int *edgeTests)
+{
+    QVector<EdgeIntersection> iscts;
+    const QVector<QPair<int, int> > edgePairs = candidateEdgePairs(S, C);
+    for (int k = 0; k < edgePairs.size(); ++k) {
+        const int s = edgePairs.at(k).first;
+        const int c = edgePairs.at(k).second;
+        Point isctPoint;
+        if (greatCircleArcsIntersect(
+                    S.vertex(s), S.vertex((s + 1) % S.size()), S.normal(s),
+                    C.vertex(c), C.vertex((c + 1) % C.size()), C.normal(c), &isctPoint))
+            iscts.append(EdgeIntersection(s, c, isctPoint));
+    }
+    if (edgeTests)
+        *edgeTests = edgePairs.size();
+    return iscts;
+}
+
+IntersectionStats::IntersectionStats()
+    : calls(0)
+    , edgeTests(0)
+    , intersections(0)
+    , perturbations(0)
+    , bailouts(0)
+{
+    for (int i = 0; i < PhaseCount; ++i)
+        nsecs[i] = 0;
+}
+
+IntersectionStats &IntersectionStats::operator+=(const IntersectionStats &other)
+{
+    calls += other.calls;
+    for (int i = 0; i < PhaseCount; ++i)
+        nsecs[i] += other.nsecs[i];
+    edgeTests += other.edgeTests;
+    intersections += other.intersections;
+    perturbations += other.perturbations;
+    bailouts += other.bailouts;
+    return *this;
+}
+
+qint64 IntersectionStats::totalNsecs() const
+{
+    qint64 total = 0;
+    for (int i = 0; i < PhaseCount; ++i)
+        total += nsecs[i];
+    return total;
+}
+
+const char *IntersectionStats::phaseName(Phase phase)
+{
+    switch (phase) {
+    case RemoveCoincidentNeighbours: return "removeCoincidentNeighbours";
+    case FixDegenerate: return "fixDegenerate";
+    case FindIntersections: return "findIntersections";
+    case Containment: return "containment";
+    case CreateLists: return "createLists";
+    case ConnectNodes: return "connectNodes";
+    case SetEntryStatus: return "setEntryStatus";
+    case TracePolygons: return "tracePolygons";
+    default: return "";
+    }
+}
+
+static QMutex intersectionStatsMutex;
+static IntersectionStats accumulatedIntersectionStats;
+
+#ifdef MGP_INTERSECTION_STATS
+
+// Records the statistics of a single call to polygonIntersection() and adds them to the accumulated ones when going out of scope
+// (so that the global mutex is only locked once per call).
+class IntersectionStatsRecorder
+{
+public:
+    IntersectionStatsRecorder() : last_(0) { stats_.calls = 1; timer_.start(); }
+    ~IntersectionStatsRecorder()
+    {
+        QMutexLocker locker(&intersectionStatsMutex);
+        accumulatedIntersectionStats += stats_;
+    }
+
+    // Adds the time elapsed since the end of the previous phase to a phase.
+    void endPhase(IntersectionStats::Phase phase)
+    {
+        const qint64 now = timer_.nsecsElapsed();
+        stats_.nsecs[phase] += (now - last_);
+        last_ = now;
+    }
+
+    IntersectionStats stats_;
+
+private:
+    QElapsedTimer timer_;
+    qint64 last_;
+};
+
+#define MGP_STATS(statement) statement
+
+#else
+
+#define MGP_STATS(statement)
+
+#endif // MGP_INTERSECTION_STATS
+
+bool intersectionStatsEnabled()
+{
+#ifdef MGP_INTERSECTION_STATS
+    return true;
+#else
+    return false;
+#endif
+}
+
+IntersectionStats intersectionStats()
+{
+    QMutexLocker locker(&intersectionStatsMutex);
+    return accumulatedIntersectionStats;
 }
 
+void resetIntersectionStats()
+{
+    QMutexLocker locker(&intersectionStatsMutex);
+    accumulatedIntersectionStats = IntersectionStats();
+}
 
 Polygons polygonIntersection(const Polygon &subject, const Polygon &clip)
+{
+    return polygonIntersection(PreparedPolygon(subject), PreparedPolygon(clip));
+}
+
+Polygons polygonIntersection(const PolygonView &subject, const PolygonView &clip)
+{
+    return polygonIntersection(PreparedPolygon(subject), PreparedPolygon(clip));
+}
+
+Polygons polygonIntersection(const PreparedPolygon &subject, const PreparedPolygon &clip)
 {
     // This function implements the Greiner-Hormann clipping algorithm:
     // - http://www.inf.usi.ch/hormann/papers/Greiner.1998.ECO.pdf
@@ -878,92 +1763,68 @@ Polygons polygonIntersection(const Polygon &subject, const Polygon &clip)
     // - https://en.wikipedia.org/wiki/Weiler%E2%80%93Atherton_clipping_algorithm
     // - https://www.jasondavies.com/maps/clip/
 
+    MGP_STATS(IntersectionStatsRecorder recorder);
+
     // set up output polygons
     Polygons outPolys = Polygons(new QVector<Polygon>());
 
-#if 0
-    // set up input polygons and ensure they are oriented clockwise
-    Polygon subject_orient(isClockwise(subject) ? subject : reversed(subject));
-    Q_ASSERT(isClockwise(subject_orient));
-    Polygon clip_orient(isClockwise(clip) ? clip : reversed(clip));
-    Q_ASSERT(isClockwise(clip_orient));
-#else
-    // set up input polygons regardless of orientation (seems to work fine ... but check both cases!)
-    Polygon subject_orient(new QVector<Point>(*subject.data()));
-    Polygon clip_orient(new QVector<Point>(*clip.data()));
-#endif
-
-    // deep-copy both polygons in order not to modify the originals (hm ... maybe do this right at the beginning instead?)
-    const Polygon S(new QVector<Point>(*subject_orient.data()));
-    const Polygon C(new QVector<Point>(*clip_orient.data()));
+    // copy both polygons in order not to modify the originals (the cached geometry is implicitly shared until modified)
+    PreparedPolygon S(subject);
+    PreparedPolygon C(clip);
 
     // eliminate coincident neighbours in C (assuming for now that S doesn't have any)
-    removeCoincidentNeighbours(C);
+    removeCoincidentNeighbours(&C);
+    MGP_STATS(recorder.endPhase(IntersectionStats::RemoveCoincidentNeighbours));
 
     // ensure that C is still large enough for an intersection to make sense
-    if (C->size() < 3)
+    if (C.size() < 3)
         return Polygons();
 
+    // the polygons are disjoint if their bounding caps are too far apart to be bridged by fixDegenerate()
+    if (!S.capIntersects(C, 0.01))
+        return outPolys;
+
     // eliminate degenerate cases
-    fixDegenerate(S, C);
-
-    // find intersections
-    int isctId = 0;
-    QHash<int, QList<IsctInfo> > sIscts; // intersections for edges in S
-    QHash<int, QList<IsctInfo> > cIscts; // intersections for edges in C
-    for (int s = 0; s < S->size(); ++s) { // loop over vertices in S
-        for (int c = 0; c < C->size(); ++c) { // loop over vertices in C
-            Point isctPoint;
-            if (greatCircleArcsIntersect(S->at(s), S->at((s + 1) % S->size()), C->at(c), C->at((c + 1) % C->size()), &isctPoint)) {
-                const IsctInfo isctInfo(
-                            isctId++, c, s, isctPoint,
-                            Math::distance(C->at(c), isctPoint),
-                            Math::distance(S->at(s), isctPoint));
-
-                // insert the intersection for the S edge in increasing distance from vertex s
-                if (!sIscts.contains(s))
-                    sIscts.insert(s, QList<IsctInfo>());
-                QList<IsctInfo> &silist = sIscts[s];
-                {
-                    int i = 0;
-                    for (; (i < silist.size()) && (silist.at(i).sdist_ < isctInfo.sdist_); ++i) ;
-                    silist.insert(i, isctInfo);
-                }
-
-                // insert the intersection for the C edge in increasing distance from vertex c
-                if (!cIscts.contains(c))
-                    cIscts.insert(c, QList<IsctInfo>());
-                QList<IsctInfo> &cilist = cIscts[c];
-                {
-                    int i = 0;
-                    for (; (i < cilist.size()) && (cilist.at(i).cdist_ < isctInfo.cdist_); ++i) ;
-                    cilist.insert(i, isctInfo);
-                }
-            }
-        }
+    const int perturbations = fixDegenerate(&S, &C);
+    MGP_STATS(recorder.stats_.perturbations = perturbations);
+    MGP_STATS(recorder.endPhase(IntersectionStats::FixDegenerate));
+    Q_UNUSED(perturbations);
+
+    // find intersections (in the same order as if all edge pairs were tested by looping over vertices in S, then in C)
+    int edgeTests = 0;
+    const QVector<EdgeIntersection> edgeIscts = edgeIntersections(S, C, &edgeTests);
+    Q_UNUSED(edgeTests);
+    QVector<IsctInfo> iscts;
+    iscts.reserve(edgeIscts.size());
+    for (int k = 0; k < edgeIscts.size(); ++k) {
+        const EdgeIntersection &isct = edgeIscts.at(k);
+        iscts.append(IsctInfo(
+                         iscts.size(), isct.c, isct.s, isct.point,
+                         Math::distance(C.point(isct.c), isct.point),
+                         Math::distance(S.point(isct.s), isct.point)));
     }
-
-    Q_ASSERT(!sIscts.isEmpty() || cIscts.isEmpty());
-    Q_ASSERT(!cIscts.isEmpty() || sIscts.isEmpty());
+    MGP_STATS(recorder.stats_.edgeTests = edgeTests);
+    MGP_STATS(recorder.stats_.intersections = iscts.size());
+    MGP_STATS(recorder.endPhase(IntersectionStats::FindIntersections));
 
 
     // ************************************************************************
     // * CASE 1: No intersections exist between clip and subject polygons     *
     // ************************************************************************
-    if (sIscts.isEmpty()) {
-        Q_ASSERT(cIscts.isEmpty());
+    if (iscts.isEmpty()) {
 
         // compute number of subject points inside clip polygon
         int sPointsInC = 0;
-        for (int i = 0; i < S->size(); ++i)
-            if (pointInPolygon(S->at(i), C))
+        for (int i = 0; i < S.size(); ++i)
+            if (pointInPolygon(S.vertex(i), C))
                 sPointsInC++;
 
-        if (sPointsInC == S->size()) {
+        if (sPointsInC == S.size()) {
             // the subject polygon is completely enclosed within the clip polygon, so return a list with one item:
             // a deep copy (although implicitly shared for efficiency) of the subject polygon
-            Polygon sCopy(new QVector<Point>(*S.data()));
+            Polygon sCopy(new QVector<Point>(S.points()));
             outPolys->append(sCopy);
+            MGP_STATS(recorder.endPhase(IntersectionStats::Containment));
             return outPolys;
         }
 
@@ -974,15 +1835,16 @@ Polygons polygonIntersection(const Polygon &subject, const Polygon &clip)
 
         // compute number of clip points inside subject polygon
         int cPointsInS = 0;
-        for (int i = 0; i < C->size(); ++i)
-            if (pointInPolygon(C->at(i), S))
+        for (int i = 0; i < C.size(); ++i)
+            if (pointInPolygon(C.vertex(i), S))
                 cPointsInS++;
 
-        if (cPointsInS == C->size()) {
+        if (cPointsInS == C.size()) {
             // the clip polygon is completely enclosed within the subject polygon, so return a list with one item:
             // a deep copy (although implicitly shared for efficiency) of the clip polygon
-            Polygon cCopy(new QVector<Point>(*C.data()));
+            Polygon cCopy(new QVector<Point>(C.points()));
             outPolys->append(cCopy);
+            MGP_STATS(recorder.endPhase(IntersectionStats::Containment));
             return outPolys;
         }
 
@@ -992,6 +1854,7 @@ Polygons polygonIntersection(const Polygon &subject, const Polygon &clip)
         // Q_ASSERT(cPointsInS == 0); // otherwise there would be at least one intersection!
 
         // at this point, the clip and subject polygons are completely disjoint, so return an empty list
+        MGP_STATS(recorder.endPhase(IntersectionStats::Containment));
         return outPolys;
     }
 
@@ -1000,87 +1863,34 @@ Polygons polygonIntersection(const Polygon &subject, const Polygon &clip)
     // * CASE 2: Intersections exist between clip and subject polygons      *
     // **********************************************************************
 
-    // *** PHASE 0: Create initial linked lists *********
+    // *** PHASE 0: Create initial lists *********
 
-    // create list with original vertices and intersections for subject polygon
-    QLinkedList<Node> slist;
-    for (int i = 0; i < S->size(); ++i) {
-        // append node for point i
-        slist.push_back(Node(S->at(i)));
-
-        // append nodes for intersections on line (i, (i + 1) % S.size())
-        if (sIscts.contains(i)) {
-            const QList<IsctInfo> silist = sIscts.value(i);
-            for (int j = 0; j < silist.size(); ++j) {
-                Q_ASSERT((j == 0) || (silist.at(j - 1).sdist_ <= silist.at(j).sdist_));
-                slist.push_back(Node(silist.at(j).point_, silist.at(j).isctId_));
-            }
-        }
-    }
+    // create list with original vertices and intersections for subject polygon (intersections in increasing distance from vertex s)
+    QVector<int> sNodeIndex(iscts.size(), -1); // index of intersection node in slist for each intersection ID
+    std::sort(iscts.begin(), iscts.end(), SubjectEdgeLessThan());
+    NodeList slist = createNodeList(S, iscts, SubjectEdgeOf(), &sNodeIndex);
 
-    // create list with original vertices and intersections for clip polygon
-    QLinkedList<Node> clist;
-    for (int i = 0; i < C->size(); ++i) {
-        // append node for point i
-        clist.push_back(Node(C->at(i)));
-
-        // append nodes for intersections on line (i, (i + 1) % C.size())
-        if (cIscts.contains(i)) {
-            const QList<IsctInfo> cilist = cIscts.value(i);
-            for (int j = 0; j < cilist.size(); ++j) {
-                Q_ASSERT((j == 0) || (cilist.at(j - 1).cdist_ <= cilist.at(j).cdist_));
-                clist.push_back(Node(cilist.at(j).point_, cilist.at(j).isctId_));
-            }
-        }
-    }
+    // create list with original vertices and intersections for clip polygon (intersections in increasing distance from vertex c)
+    QVector<int> cNodeIndex(iscts.size(), -1); // index of intersection node in clist for each intersection ID
+    std::sort(iscts.begin(), iscts.end(), ClipEdgeLessThan());
+    NodeList clist = createNodeList(C, iscts, ClipEdgeOf(), &cNodeIndex);
+    MGP_STATS(recorder.endPhase(IntersectionStats::CreateLists));
 
 
     // *** PHASE 1: Connect corresponding intersection nodes *********
 
-    {
-        QLinkedList<Node>::iterator sit;
-        for (sit = slist.begin(); sit != slist.end(); ++sit) {
-            if (sit->isctId_ >= 0) {
-                // find the corresponding intersection node in the clist and connect them together
-                QLinkedList<Node>::iterator cit;
-                for (cit = clist.begin(); cit != clist.end(); ++cit) {
-                    if (cit->isctId_ == sit->isctId_) {
-                        sit->neighbour_ = cit;
-                        cit->neighbour_ = sit;
-                    }
-                }
-            }
-        }
+    for (int i = 0; i < iscts.size(); ++i) {
+        slist[sNodeIndex.at(i)].neighbour_ = cNodeIndex.at(i);
+        clist[cNodeIndex.at(i)].neighbour_ = sNodeIndex.at(i);
     }
+    MGP_STATS(recorder.endPhase(IntersectionStats::ConnectNodes));
 
 
     // *** PHASE 2: Set entry/exit status for each intersection node *********
 
-    {
-        // whether the next intersection represents an entry into the clip polygon
-        bool entry = !pointInPolygon(slist.first().point_, C);
-
-        QLinkedList<Node>::iterator it;
-        for (it = slist.begin(); it != slist.end(); ++it) {
-            if (it->isctId_ >= 0) {
-                it->entry_ = entry;
-                entry = !entry; // if this intersection was an entry, the next one must be an exit and vice versa
-            }
-        }
-    }
-
-    {
-        // whether the next intersection represents an entry into the subject polygon
-        bool entry = !pointInPolygon(clist.first().point_, S);
-
-        QLinkedList<Node>::iterator it;
-        for (it = clist.begin(); it != clist.end(); ++it) {
-            if (it->isctId_ >= 0) {
-                it->entry_ = entry;
-                entry = !entry; // if this intersection was an entry, the next one must be an exit and vice versa
-            }
-        }
-    }
+    setEntryStatus(&slist, C);
+    setEntryStatus(&clist, S);
+    MGP_STATS(recorder.endPhase(IntersectionStats::SetEntryStatus));
 
     if (false) {
         static int nn = 0;
@@ -1090,56 +1900,52 @@ Polygons polygonIntersection(const Polygon &subject, const Polygon &clip)
 
     // *** PHASE 3: Generate clipped polygons *********
     {
+        NodeList *lists[2] = { &slist, &clist };
 
         // loop over original vertices and intersections in subject polygon
-        QLinkedList<Node>::iterator sit;
-        for (sit = slist.begin(); sit != slist.end(); ++sit) {
-            if ((sit->isctId_ >= 0) && (!sit->visited_)) {
+        for (int si = 0; si < slist.size(); ++si) {
+            const Node &snode = slist.at(si);
+            if ((snode.isctId_ >= 0) && (!snode.visited_)) {
                 // this is an unvisited intersection, so start tracing a new polygon
                 Polygon poly(new QVector<Point>());
 
-                QLinkedList<Node>::iterator it(sit);
-                bool forward = it->entry_;
+                int list = 0; // current list (0 = subject, 1 = clip)
+                int i = si; // current node in current list
+                bool forward = snode.entry_;
                 do {
 
                     // move one step along the current list
-                    if (forward) {
-                        it++;
-                        if (it == slist.end())
-                            it = slist.begin();
-                        else if (it == clist.end())
-                            it = clist.begin();
-                    } else {
-                        if (it == slist.begin())
-                            it = slist.end();
-                        else if (it == clist.begin())
-                            it = clist.end();
-                        it--;
-                    }
-
-                    if (it->isctId_ < 0) {
-                        // original vertex
-                        poly->append(it->point_); // append to new polygon
-                    } else {
-                        // intersection
-                        poly->append(it->point_); // append to new polygon
-                        it = it->neighbour_; // move to corresponding intersection in other list
-                        it->visited_ = it->neighbour_->visited_ = true; // indicate that we're done with this intersection
-                        forward = it->entry_; // update direction
+                    const int n = lists[list]->size();
+                    i = forward ? ((i + 1) % n) : ((i - 1 + n) % n);
+
+                    const Node &node = lists[list]->at(i);
+                    poly->append(node.point_); // append to new polygon
+                    if (node.isctId_ >= 0) {
+                        // intersection, so move to corresponding intersection in other list
+                        const int neighbour = node.neighbour_;
+                        (*lists[list])[i].visited_ = true; // indicate that we're done with this intersection
+                        list = 1 - list;
+                        i = neighbour;
+                        (*lists[list])[i].visited_ = true;
+                        forward = lists[list]->at(i).entry_; // update direction
                     }
 
                     // return an empty result if the algorithm has seemed to entered an infinite loop
                     // (this could for example happen when Math::greatCircleArcsIntersect() fails to find an intersection)
-                    if (poly->size() > 2 * S->size() * C->size())
+                    if (poly->size() > 2 * S.size() * C.size()) {
+                        MGP_STATS(recorder.stats_.bailouts = 1);
+                        MGP_STATS(recorder.endPhase(IntersectionStats::TracePolygons));
                         return Polygons();
+                    }
 
-                } while (it->isctId_ != sit->isctId_); // as long as tracing has not got back to where it started
+                } while (lists[list]->at(i).isctId_ != snode.isctId_); // as long as tracing has not got back to where it started
 
                 if (poly->size() >= 3) // hm ... wouldn't this always be the case?
                     outPolys->append(poly);
             }
         }
     }
+    MGP_STATS(recorder.endPhase(IntersectionStats::TracePolygons));
 
     return outPolys;
 }
@@ -1227,85 +2033,167 @@ bool isClockwise(const Polygon &polygon)
     return (sum > 0);
 }
 
-Polygon removeInvalidVertices(const Polygon &polygon, double minDegrees)
+double sphericalArea(const QVector<Point> &polygon)
 {
-    const double minRadians = DEG2RAD(minDegrees);
-    Polygon outPoly(new QVector<Point>());
-    Polygon p1(new QVector<Point>(*polygon.data()));
-
-    // loop over vertex scans until either 1) at least three vertices remain after a scan that found no invalid vertices, or 2) fewer than three vertices remain after a scan
-    int k = 0;
-    while (true) {
-
-        Polygon p2(new QVector<Point>());
-        int invalidIndex = -1; // index of first invalid vertex in this scan, or -1 if no invalid vertex has been found
-
-        const int n = p1->size();
-        // scan vertices, removing at most one invalid one
-        for (int i = 0; i < n; ++i) {
-
-            if (invalidIndex == -1) {
-                // check if vertex i is the invalid vertex in this scan
-
-                const int i1 = (i - 1 + n) % n; // index of vertex before i (circular)
-                const int i2 = (i + 1) % n; // index of vertex after i (circular)
-                //{
-                //    bool validComp2 = true;
-                //    qDebug() << "k:" << k << ", i1 i i2:" << i1 << i << i2 << ", angle:" << Math::angle(p1->at(i), p1->at(i1), p1->at(i2), &validComp2, true)
-                //             << ", minRadians:" << minRadians << ", valid:" << validComp2;
-                //}
-
-                if ((p1->at(i) != p1->at(i1)) && (p1->at(i) != p1->at(i2))) {
-                    bool validComp = true;
-                    const double angle = Math::angle(p1->at(i), p1->at(i1), p1->at(i2), &validComp);
-                    if (validComp) {
-                        //qDebug() << "    valid computation, allowing angles to be compared";
-                        if (angle < minRadians) {
-                            //qDebug() << "    sharp angle!";
-                            invalidIndex = i; // vertex i is at a sharp angle, so remove it
-                        }
-                    } else {
-                        //qDebug() << "    invalid computation!";
-                        invalidIndex = i; // vertex i was involved in an invalid computation, so remove it
-                    }
-                } else {
-                    //qDebug() << "    coinciding!";
-                    invalidIndex = i; // vertex i coincides with one of its neighbours, so remove it
-                }
-            }
+    const int n = polygon.size();
+    if (n < 3)
+        return 0;
 
-            if (i != invalidIndex) {
-                // vertex i is either 1) valid or 2) invalid, but not the first one in this scan, so keep it
-                //qDebug() << "    keeping vertex" << i;
-                p2->append(p1->at(i));
-            } else {
-                // vertex i is the first invalid vertex in this scan, so remove it (by not copying it to p2)
-                //qDebug() << "    removing vertex" << i << "!";
+    // sum the signed spherical excesses of the triangles fanning out from the first vertex, each computed from the
+    // formula of Van Oosterom and Strackee: tan(E / 2) = a . (b x c) / (1 + a . b + b . c + c . a)
+    const _3DPoint a = _3DPoint::fromSpherical(polygon.first().first, polygon.first().second);
+    _3DPoint b = _3DPoint::fromSpherical(polygon.at(1).first, polygon.at(1).second);
+    double excess = 0;
+    for (int i = 2; i < n; ++i) {
+        const _3DPoint c = _3DPoint::fromSpherical(polygon.at(i).first, polygon.at(i).second);
+        const double numer = _3DPoint::dot(a, _3DPoint::cross(b, c));
+        const double denom = 1 + _3DPoint::dot(a, b) + _3DPoint::dot(b, c) + _3DPoint::dot(c, a);
+        excess += 2 * atan2(numer, denom);
+        b = c;
+    }
+
+    const double area = qAbs(excess);
+    return (area > (2 * M_PI)) ? (4 * M_PI - area) : area;
+}
+
+// Returns true iff vertex p is invalid given its neighbours prev and next, i.e. if it coincides with one of them, is at a sharp
+// angle, or is involved in an invalid angle computation.
+static bool isInvalidVertex(const Point &p, const Point &prev, const Point &next, double minRadians)
+{
+    if ((p == prev) || (p == next))
+        return true; // p coincides with one of its neighbours
+
+    bool validComp = true;
+    const double angle = Math::angle(p, prev, next, &validComp);
+    return (!validComp) || (angle < minRadians);
+}
+
+// Returns the distance (radians) from unit vector v to the great circle arc from a to b, where n = a x b.
+static double distanceToArc(const _3DPoint &v, const _3DPoint &a, const _3DPoint &b, const _3DPoint &n)
+{
+    const double nnorm = n.norm();
+    if ((nnorm >= FLT_MIN) && (_3DPoint::dot(_3DPoint::cross(a, v), n) >= 0) && (_3DPoint::dot(_3DPoint::cross(v, b), n) >= 0))
+        return asin(qMin(1.0, qAbs(_3DPoint::dot(v, n)) / nnorm)); // the projection of v is on the arc
+    return acos(qMax(-1.0, qMin(1.0, qMax(_3DPoint::dot(v, a), _3DPoint::dot(v, b))))); // the nearest endpoint is closest
+}
+
+Polygon simplified(const Polygon &polygon, double maxDistance)
+{
+    if ((!polygon) || (polygon->size() < 4) || (maxDistance <= 0))
+        return polygon;
+
+    const int n = polygon->size();
+    QVector<_3DPoint> vertices(n);
+    for (int i = 0; i < n; ++i)
+        vertices[i] = _3DPoint::fromSpherical(polygon->at(i).first, polygon->at(i).second);
+
+    // split the polygon in two chains at vertex 0 and the vertex furthest away from it, and keep the vertex deviating most from
+    // the arc between the ends of a chain as long as it deviates too much (a chain (first, last) is represented with
+    // last == n for the closing chain back to vertex 0)
+    int far = 1;
+    for (int i = 2; i < n; ++i) {
+        if (_3DPoint::dot(vertices.at(i), vertices.at(0)) < _3DPoint::dot(vertices.at(far), vertices.at(0)))
+            far = i;
+    }
+    QVector<bool> keep(n, false);
+    keep[0] = keep[far] = true;
+    keep[n - 1] = (polygon->last() == polygon->first()); // preserve an explicitly closed ring
+
+    QStack<QPair<int, int> > chains;
+    chains.push(qMakePair(0, far));
+    chains.push(qMakePair(far, n));
+    while (!chains.isEmpty()) {
+        const QPair<int, int> chain = chains.pop();
+        const int first = chain.first;
+        const int last = chain.second;
+        if ((last - first) < 2)
+            continue;
+
+        const _3DPoint &a = vertices.at(first);
+        const _3DPoint &b = vertices.at(last % n);
+        const _3DPoint normal = _3DPoint::cross(a, b);
+        int maxIndex = -1;
+        double maxDist = -1;
+        for (int i = first + 1; i < last; ++i) {
+            const double dist = distanceToArc(vertices.at(i), a, b, normal);
+            if (dist > maxDist) {
+                maxDist = dist;
+                maxIndex = i;
             }
         }
-
-        if (p2->size() < 3) {
-            // too many invalid vertices found, so return an empty polygon
-            //qDebug() << "    too many invalid vertices found; returning an empty polygon!";
-            outPoly = Polygon();
-            break;
+        if (maxDist > maxDistance) {
+            keep[maxIndex] = true;
+            chains.push(qMakePair(first, maxIndex));
+            chains.push(qMakePair(maxIndex, last));
         }
+    }
+
+    Polygon result = Polygon(new QVector<Point>());
+    for (int i = 0; i < n; ++i) {
+        if (keep.at(i))
+            result->append(polygon->at(i));
+    }
+    return (result->size() >= 3) ? result : polygon;
+}
 
-        if (p1->size() == p2->size()) {
-            // no invalid vertices found in this scan, so return final result
-            //qDebug() << "    no invalid vertices found in this scan; return final result ...";
-            outPoly = p2;
-            break;
+Polygon removeInvalidVertices(const Polygon &polygon, double minDegrees)
+{
+    // The vertices are repeatedly removed one at a time, always removing the first (lowest-index) invalid vertex, until no invalid
+    // vertices remain or fewer than three vertices remain. Since the validity of a vertex depends only on its neighbours, only the
+    // neighbours of a removed vertex need to be checked again. The remaining vertices are kept in a circular doubly-linked list
+    // of indices, and the vertices are checked in increasing index order by advancing a frontier over the vertices that have not
+    // been checked yet and by taking the vertices to be checked again from a min-heap whenever they precede the frontier.
+
+    if (!polygon)
+        return Polygon();
+
+    const double minRadians = DEG2RAD(minDegrees);
+    const int n = polygon->size();
+    QVector<int> prev(n);
+    QVector<int> next(n);
+    QVector<bool> removed(n, false);
+    for (int i = 0; i < n; ++i) {
+        prev[i] = (i - 1 + n) % n;
+        next[i] = (i + 1) % n;
+    }
+
+    int size = n;
+    int frontier = 0; // vertices [frontier, n) have not been checked yet
+    std::priority_queue<int, std::vector<int>, std::greater<int> > recheck;
+    while (size >= 3) {
+        int i;
+        if ((!recheck.empty()) && (recheck.top() < frontier)) {
+            i = recheck.top();
+            recheck.pop();
+            if (removed.at(i))
+                continue;
+        } else if (frontier < n) {
+            i = frontier++;
+        } else {
+            break; // no more vertices to check
         }
 
-        // copy p2 to p1, empty p2, and iterate
-        //qDebug() << "    invalid vertices found in this scan; iterating ...";
-        p1 = Polygon(new QVector<Point>(*p2.data()));
-        p2 = Polygon(new QVector<Point>());
+        if (isInvalidVertex(polygon->at(i), polygon->at(prev.at(i)), polygon->at(next.at(i)), minRadians)) {
+            // vertex i is the first invalid vertex, so remove it and check its neighbours again
+            removed[i] = true;
+            next[prev.at(i)] = next.at(i);
+            prev[next.at(i)] = prev.at(i);
+            recheck.push(prev.at(i));
+            recheck.push(next.at(i));
+            size--;
+        }
+    }
 
-        k++;
+    if ((size < 3) || (n < 3)) {
+        // too many invalid vertices found, so return an empty polygon
+        return Polygon();
     }
 
+    Polygon outPoly(new QVector<Point>());
+    outPoly->reserve(size);
+    for (int i = 0; i < n; ++i)
+        if (!removed.at(i))
+            outPoly->append(polygon->at(i));
     return outPoly;
 }
 
@@ -2,6 +2,7 @@
 #define MGPMATH_H
 
 #include "mgp.h"
+#include <QBitArray>
 
 #define MGPMATH_BEGIN_NAMESPACE namespace math {
 #define MGPMATH_END_NAMESPACE }
@@ -90,6 +91,178 @@ private:
     double c_[3];
 };
 
+// Longitude/latitude bounding box (radians) of a region on the unit sphere. The longitude range wraps around the antimeridian
+// iff minLon() > maxLon().
+class BoundingBox
+{
+public:
+    // Constructs an empty box.
+    BoundingBox();
+    BoundingBox(double minLon, double maxLon, double minLat, double maxLat);
+
+    // Returns the smallest box that encloses a polygon, including the parts of its great circle edges that bulge poleward of
+    // the vertices, and any pole enclosed by the polygon. The box is extended by margin radians in each direction.
+    static BoundingBox fromPolygon(const Polygon &polygon, double margin = 0);
+    static BoundingBox fromPolygon(const PolygonView &polygon, double margin = 0);
+
+    bool isEmpty() const { return empty_; }
+    bool wrapsLon() const { return minLon_ > maxLon_; }
+    double minLon() const { return minLon_; }
+    double maxLon() const { return maxLon_; }
+    double minLat() const { return minLat_; }
+    double maxLat() const { return maxLat_; }
+
+    // Returns true iff the two boxes overlap.
+    bool intersects(const BoundingBox &other) const;
+
+    // Returns true iff the box contains a point.
+    bool contains(const Point &point) const;
+
+    // Returns the box as one box, or as two boxes that meet at the antimeridian if the longitude range wraps.
+    QVector<BoundingBox> splitAtAntimeridian() const;
+
+private:
+    double minLon_;
+    double maxLon_;
+    double minLat_;
+    double maxLat_;
+    bool empty_;
+};
+
+// Polygon with cached unit sphere geometry: the unit vector of each vertex, the great circle plane normal of each edge, a bounding
+// cap, and the external point used by pointInPolygon(). The trigonometry is thus done once when the polygon is prepared rather than
+// in each call to pointInPolygon(), polygonIntersection() etc.
+class PreparedPolygon
+{
+public:
+    // Precomputed geometry of a polygon in the same form as cached by this class, typically generated at build time
+    // (see tools/firtables). The arrays have size entries of two (points) or three (vertices and normals) values each.
+    struct Geometry {
+        int size;
+        const double *points; // lon and lat (radians) of each vertex
+        const double *vertices; // unit vector of each vertex
+        const double *normals; // great circle plane normal of each edge
+        double capCenter[3];
+        double capRadius;
+        double capCos;
+        double externalPoint[2];
+        double externalVertex[3];
+    };
+
+    // Constructs an empty polygon.
+    PreparedPolygon();
+    explicit PreparedPolygon(const Polygon &polygon);
+    // Constructs a polygon from a view. The vertices are copied, so the view may be released afterwards.
+    explicit PreparedPolygon(const PolygonView &polygon);
+    // Constructs a polygon from precomputed geometry. The values are copied as is, i.e. without any trigonometry.
+    explicit PreparedPolygon(const Geometry &geometry);
+
+    // Returns the polygon in its current state.
+    Polygon polygon() const;
+
+    // Returns true iff this object was prepared from a polygon with the same identity and vertices as the given one.
+    bool isPreparedFrom(const Polygon &polygon) const;
+
+    int size() const { return points_.size(); }
+    bool isEmpty() const { return points_.isEmpty(); }
+    const QVector<Point> &points() const { return points_; }
+    const Point &point(int i) const { return points_.at(i); }
+
+    // Returns the unit vector of vertex i.
+    const _3DPoint &vertex(int i) const { return vertices_.at(i); }
+
+    // Returns the normal of the great circle plane of edge (i, (i + 1) % size()), i.e. vertex(i) x vertex((i + 1) % size())
+    // (not normalized).
+    const _3DPoint &normal(int i) const { return normals_.at(i); }
+
+    // Returns the center (unit vector) and angular radius of a cap enclosing the polygon. The radius is M_PI if the polygon is
+    // not enclosed by a cap smaller than a hemisphere.
+    const _3DPoint &capCenter() const { return capCenter_; }
+    double capRadius() const { return capRadius_; }
+
+    // Returns true iff a point (given as unit vector) is inside the bounding cap.
+    bool capContains(const _3DPoint &v) const;
+
+    // Returns true iff the bounding caps of two polygons are closer than margin radians.
+    bool capIntersects(const PreparedPolygon &other, double margin = 0) const;
+
+    // Returns the point (and its unit vector) that is assumed to be outside the polygon when casting rays in pointInPolygon().
+    const Point &externalPoint() const { return extPoint_; }
+    const _3DPoint &externalVertex() const { return extVertex_; }
+
+    // Replaces vertex i.
+    void setPoint(int i, const Point &point);
+
+    // Removes vertex i.
+    void removePoint(int i);
+
+private:
+    void init();
+    void updateNormal(int i);
+    void updateCap();
+    void updateExternalPoint();
+
+    Polygon polygon_;
+    QVector<Point> points_;
+    QVector<_3DPoint> vertices_;
+    QVector<_3DPoint> normals_;
+    _3DPoint capCenter_;
+    double capRadius_;
+    double capCos_; // cos(capRadius_)
+    Point extPoint_;
+    _3DPoint extVertex_;
+};
+
+// Lon/lat grid over a prepared polygon for fast repeated point-in-polygon tests. Each cell is classified once as either inside,
+// outside or boundary (i.e. possibly crossed by an edge). A point in an inside or outside cell is classified directly, while a
+// point in a boundary cell is classified by casting a ray to the cell center and testing it against the edges crossing the cell
+// only. The cost per point is thus roughly constant rather than linear in the number of vertices.
+// NOTE: The grid is only built for polygons that span less than M_PI in longitude and stay away from the poles. For other polygons
+// contains() falls back to pointInPolygon().
+class PointInPolygonIndex
+{
+public:
+    // Constructs an index of an empty polygon.
+    PointInPolygonIndex();
+
+    // Constructs an index of a polygon using a grid of resolution x resolution cells (or a size based on the number of vertices
+    // if resolution is not positive).
+    explicit PointInPolygonIndex(const PreparedPolygon &polygon, int resolution = 0);
+
+    const PreparedPolygon &polygon() const { return polygon_; }
+
+    // Returns true iff the index uses a grid (as opposed to falling back to pointInPolygon()).
+    bool isGridded() const { return !cells_.isEmpty(); }
+
+    // Returns true iff a point is considered inside the polygon. The result is the same as that of pointInPolygon() except
+    // possibly for points (almost) on the boundary of the polygon.
+    bool contains(const Point &point) const;
+
+private:
+    enum CellState { Outside, Inside, Boundary };
+
+    struct Cell {
+        unsigned char state_;
+        bool centerInside_; // whether the cell center is inside the polygon (boundary cells only)
+        _3DPoint center_; // unit vector of the cell center (boundary cells only)
+        int firstEdge_; // edges crossing the cell are edges_[firstEdge_, firstEdge_ + edgeCount_) (boundary cells only)
+        int edgeCount_;
+        Cell() : state_(Outside), centerInside_(false), firstEdge_(0), edgeCount_(0) {}
+    };
+
+    // Returns the longitude relative to the western edge of the grid, mapped to the range that is closest to the grid.
+    double localLon(double lon) const;
+
+    PreparedPolygon polygon_;
+    double minLon_;
+    double minLat_;
+    double lonSpan_;
+    double latSpan_;
+    int resolution_;
+    QVector<Cell> cells_; // resolution_ x resolution_ cells in row-major order (south to north)
+    QVector<int> edges_;
+};
+
 class Math
 {
 public:
@@ -132,6 +305,50 @@ public:
     static void computeLatLon(double x, double y, double z, double &lat, double &lon);
 };
 
+// Intersection point between edge s (from vertex s to vertex s + 1) of a subject polygon and edge c of a clip polygon
+// (see edgeIntersections()).
+struct EdgeIntersection
+{
+    EdgeIntersection() : s(-1), c(-1) {}
+    EdgeIntersection(int s_, int c_, const Point &point_) : s(s_), c(c_), point(point_) {}
+    int s;
+    int c;
+    Point point;
+};
+
+// Accumulated wall time and counters of the phases of polygonIntersection(). The statistics are only recorded if the library is
+// built with MGP_INTERSECTION_STATS defined (qmake CONFIG+=mgp_stats), otherwise they remain zero (see intersectionStatsEnabled()).
+struct IntersectionStats
+{
+    enum Phase {
+        RemoveCoincidentNeighbours, // copying the polygons and removing coincident neighbours in the clip polygon
+        FixDegenerate, // perturbing vertices that are too close to an edge in the other polygon
+        FindIntersections, // finding candidate edge pairs and testing them for intersection
+        Containment, // testing for containment if no intersections were found
+        CreateLists, // PHASE 0: creating the lists of vertices and intersections
+        ConnectNodes, // PHASE 1: connecting corresponding intersection nodes
+        SetEntryStatus, // PHASE 2: marking intersection nodes as entries or exits
+        TracePolygons, // PHASE 3: tracing the output polygons
+        PhaseCount
+    };
+
+    qint64 calls; // number of calls to polygonIntersection()
+    qint64 nsecs[PhaseCount]; // wall time (nanoseconds) spent in each phase
+    qint64 edgeTests; // number of edge pairs tested for intersection
+    qint64 intersections; // number of intersections found
+    qint64 perturbations; // number of vertices perturbed by FixDegenerate
+    qint64 bailouts; // number of calls that gave up due to a seemingly infinite loop in TracePolygons
+
+    IntersectionStats();
+    IntersectionStats &operator+=(const IntersectionStats &other);
+
+    // Returns the total wall time (nanoseconds) spent in all phases.
+    qint64 totalNsecs() const;
+
+    // Returns the name of a phase.
+    static const char *phaseName(Phase phase);
+};
+
 // --- END classes --------------------------------------------------
 
 // --- BEGIN global functions --------------------------------------------------
@@ -142,6 +359,12 @@ public:
 // intersections!).
 bool greatCircleArcsIntersect(const Point &p1, const Point &p2, const Point &p3, const Point &p4, Point *isctPoint = 0);
 
+// Overload of the above function that takes the arcs as unit vectors along with the normals of their great circle planes
+// (p = a0 x a1 and q = b0 x b1).
+bool greatCircleArcsIntersect(
+        const _3DPoint &a0, const _3DPoint &a1, const _3DPoint &p, const _3DPoint &b0, const _3DPoint &b1, const _3DPoint &q,
+        Point *isctPoint = 0);
+
 // Returns true iff the great circle through p1 and p2 intersects the great circle through p3 and p4.
 // The two intersection points are returned in isctPoint1 and isctPoint2.
 // NOTE: If the two great circles lie (approximately) in the same plane, the function returns false (although there are infinitely many
@@ -167,9 +390,43 @@ QVector<_3DPoint> greatCirclePoints(const QPair<double, double> &p1, const QPair
 // Returns true iff a point is considered inside a polygon.
 bool pointInPolygon(const Point &point, const Polygon &polygon);
 
+// Overload of the above function for a prepared polygon.
+bool pointInPolygon(const Point &point, const PreparedPolygon &polygon);
+
+// Overload of the above function for a polygon view.
+bool pointInPolygon(const Point &point, const PolygonView &polygon);
+
+// Classifies n points against a prepared polygon. Bit i in the result is set iff points[i] is considered inside the polygon
+// (the result for each point is the same as that of pointInPolygon()). This is considerably faster than calling pointInPolygon()
+// for each point when n is large.
+QBitArray pointsInPolygon(const Point *points, int n, const PreparedPolygon &polygon);
+
+// Overload of the above function for a vector of points.
+QBitArray pointsInPolygon(const QVector<Point> &points, const PreparedPolygon &polygon);
+
+// Returns the intersections between the edges of two polygons, ordered on the subject edge, then the clip edge (i.e. in the same
+// order as if greatCircleArcsIntersect() was called for all edge pairs by looping over the edges of the subject, then the clip).
+// Only the edge pairs whose bounding boxes overlap are tested, and their number is returned in edgeTests if non-null.
+QVector<EdgeIntersection> edgeIntersections(const PreparedPolygon &subject, const PreparedPolygon &clip, int *edgeTests = 0);
+
 // Returns the polygons that form the intersection of two polygons. If an error occurs or intersection is not possible, an empty result is returned.
 Polygons polygonIntersection(const Polygon &subject, const Polygon &clip);
 
+// Overload of the above function for prepared polygons.
+Polygons polygonIntersection(const PreparedPolygon &subject, const PreparedPolygon &clip);
+
+// Overload of the above function for polygon views.
+Polygons polygonIntersection(const PolygonView &subject, const PolygonView &clip);
+
+// Returns true iff the library is built to record IntersectionStats.
+bool intersectionStatsEnabled();
+
+// Returns the IntersectionStats accumulated by all threads since startup or the last call to resetIntersectionStats().
+IntersectionStats intersectionStats();
+
+// Resets the accumulated IntersectionStats to zero.
+void resetIntersectionStats();
+
 // Returns the points (0, 1 or 2) where lat intersects the great circle arc from p1 to p2.
 // If two intersections are found, the one closest to p1 appears first in the result vector.
 QVector<Point> latitudeIntersections(const Point &p1, const Point &p2, double lat);
@@ -183,12 +440,23 @@ Polygon reversed(const Polygon &polygon);
 // Returns true iff a polygon is oriented clockwise.
 bool isClockwise(const Polygon &polygon);
 
+// Returns the area of a polygon on the unit sphere (i.e. its spherical excess in steradians) regardless of orientation. The smaller
+// of the two regions bounded by the polygon is assumed. A polygon with fewer than three vertices has zero area.
+double sphericalArea(const QVector<Point> &polygon);
+
 // Returns a polygon with invalid vertices removed. An invalid vertex is one at a sharp angle or one coinciding with a neighbour.
 Polygon removeInvalidVertices(const Polygon &polygon, double minDegrees = 5.0);
 
 // Convenience function that calls removeInvalidVertices(const Polygon &, double) for a list of polygons, returning the result in a corresponding list.
 Polygons removeInvalidVertices(const Polygons &polygons, double minDegrees = 5.0);
 
+// Returns a polygon simplified with the Douglas-Peucker algorithm on the unit sphere: each removed vertex is at most maxDistance
+// radians from the great circle edge of the simplified polygon that replaces it. Polygons with fewer than four vertices, and
+// polygons that cannot be simplified to at least three vertices, are returned as is.
+// NOTE: As usual for Douglas-Peucker, the simplified polygon may self-intersect if maxDistance is large relative to the
+// distance between non-adjacent parts of the polygon.
+Polygon simplified(const Polygon &polygon, double maxDistance);
+
 // --- END global functions --------------------------------------------------
 
 MGPMATH_END_NAMESPACE
@@ -0,0 +1,110 @@
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include "mgp.h"
+#include <QAtomicInt>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QRunnable>
+#include <QSharedPointer>
+#include <QThread>
+#include <QThreadPool>
+#include <QWaitCondition>
+
+MGP_BEGIN_NAMESPACE
+
+// --- BEGIN classes --------------------------------------------------
+
+// State shared by the calling thread and the helper tasks of parallelFor(). The state is reference counted, so that a helper task
+// that is started only after all the work is done (and parallelFor() has returned) can still find that there is nothing left to do.
+class ParallelForState
+{
+public:
+    ParallelForState(int count) : count_(count), done_(0) {}
+
+    // Returns the next index to process, or -1 if all indices have been taken.
+    int take()
+    {
+        const int i = next_.fetchAndAddRelaxed(1);
+        return (i < count_) ? i : -1;
+    }
+
+    // Registers that an index has been processed.
+    void finish()
+    {
+        QMutexLocker locker(&mutex_);
+        if (++done_ == count_)
+            allDone_.wakeAll();
+    }
+
+    // Waits until all indices have been processed.
+    void wait()
+    {
+        QMutexLocker locker(&mutex_);
+        while (done_ < count_)
+            allDone_.wait(&mutex_);
+    }
+
+private:
+    QAtomicInt next_;
+    const int count_;
+    int done_;
+    QMutex mutex_;
+    QWaitCondition allDone_;
+};
+
+// Helper task of parallelFor() that repeatedly takes the next unprocessed index and processes it.
+template <typename Work>
+class ParallelForTask : public QRunnable
+{
+public:
+    ParallelForTask(const QSharedPointer<ParallelForState> &state, const Work *work)
+        : state_(state), work_(work) {}
+
+    virtual void run()
+    {
+        // (the work is only accessed while some index remains unprocessed, i.e. while parallelFor() is still waiting)
+        for (int i = state_->take(); i >= 0; i = state_->take()) {
+            (*work_)(i);
+            state_->finish();
+        }
+    }
+
+private:
+    QSharedPointer<ParallelForState> state_;
+    const Work *work_;
+};
+
+// --- END classes --------------------------------------------------
+
+// --- BEGIN global functions --------------------------------------------------
+
+// Calls work(i) for each i in [0, count) using up to threadCount threads (QThread::idealThreadCount() if zero or negative),
+// including the calling thread. The threads pull indices one at a time (rather than splitting the range up front) since the
+// amount of work may vary a lot between indices, so work(i) should store its result separately for each index.
+// The helper threads are taken from QThreadPool::globalInstance(), so concurrent and nested calls share one thread limit. The
+// calling thread processes indices too, so the work is done even if no helper thread becomes available.
+template <typename Work>
+void parallelFor(int count, int threadCount, const Work &work)
+{
+    if (threadCount <= 0)
+        threadCount = QThread::idealThreadCount();
+    threadCount = qMin(threadCount, count);
+    if (threadCount <= 1) {
+        for (int i = 0; i < count; ++i)
+            work(i);
+        return;
+    }
+
+    const QSharedPointer<ParallelForState> state(new ParallelForState(count));
+    for (int i = 1; i < threadCount; ++i)
+        QThreadPool::globalInstance()->start(new ParallelForTask<Work>(state, &work)); // (auto-deleted by the pool)
+    ParallelForTask<Work>(state, &work).run();
+    state->wait();
+}
+
+// --- END global functions --------------------------------------------------
+
+MGP_END_NAMESPACE
+
+#endif // PARALLEL_H
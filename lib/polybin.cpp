@@ -0,0 +1,135 @@
+#include "polybin.h"
+#include <QVector>
+#include <QtEndian>
+#include <string.h>
+#include <limits.h>
+
+POLYBIN_BEGIN_NAMESPACE
+
+static const quint32 magic = 0x4250474d; // 'MGPB' when stored as little-endian
+static const quint32 version = 1;
+
+// Returns the size of the header (i.e. everything before the point values) for a given number of polygons.
+static qint64 headerSize(quint32 npolys)
+{
+    const qint64 size = 3 * sizeof(quint32) + qint64(npolys) * sizeof(quint32);
+    return (size + 7) & ~qint64(7);
+}
+
+#if Q_BYTE_ORDER != Q_LITTLE_ENDIAN
+static double doubleFromLittleEndian(const char *src)
+{
+    const quint64 bits = qFromLittleEndian<quint64>(reinterpret_cast<const uchar *>(src));
+    double val;
+    memcpy(&val, &bits, sizeof(val));
+    return val;
+}
+#endif
+
+static void doubleToLittleEndian(double val, char *dst)
+{
+    quint64 bits;
+    memcpy(&bits, &val, sizeof(bits));
+    qToLittleEndian<quint64>(bits, reinterpret_cast<uchar *>(dst));
+}
+
+bool readLayout(const char *data, qint64 size, QVector<int> *sizes, qint64 *pointsOffset, QString *error)
+{
+    *error = QString();
+
+    const uchar *udata = reinterpret_cast<const uchar *>(data);
+    if ((size < qint64(3 * sizeof(quint32))) || (qFromLittleEndian<quint32>(udata) != magic)) {
+        *error = "not a binary polygon structure";
+        return false;
+    }
+    if (qFromLittleEndian<quint32>(udata + 4) != version) {
+        *error = QString("unsupported binary polygon format version: %1").arg(qFromLittleEndian<quint32>(udata + 4));
+        return false;
+    }
+
+    // get the number of points in each polygon
+    const quint32 npolys = qFromLittleEndian<quint32>(udata + 8);
+    if (size < headerSize(npolys)) {
+        *error = QString("binary polygon structure too small for %1 polygons: %2 bytes").arg(npolys).arg(size);
+        return false;
+    }
+    sizes->resize(npolys);
+    qint64 npoints = 0;
+    for (quint32 i = 0; i < npolys; ++i) {
+        const quint32 n = qFromLittleEndian<quint32>(udata + 12 + 4 * i);
+        npoints += n;
+        if (npoints > INT_MAX) {
+            *error = QString("too many points in binary polygon structure: %1").arg(npoints);
+            return false;
+        }
+        (*sizes)[i] = n;
+    }
+    if (size != (headerSize(npolys) + npoints * 2 * qint64(sizeof(double)))) {
+        *error = QString("binary polygon structure has wrong size for %1 points: %2 bytes").arg(npoints).arg(size);
+        return false;
+    }
+
+    *pointsOffset = headerSize(npolys);
+    return true;
+}
+
+mgp::Polygons polybin2polygons(const char *data, qint64 size, QString *error)
+{
+    QVector<int> sizes;
+    qint64 pointsOffset = 0;
+    if (!readLayout(data, size, &sizes, &pointsOffset, error))
+        return mgp::Polygons(new QVector<mgp::Polygon>);
+
+    // copy the points directly into the polygons
+    mgp::Polygons polygons = mgp::Polygons(new QVector<mgp::Polygon>);
+    polygons->reserve(sizes.size());
+    const char *src = data + pointsOffset;
+    for (int i = 0; i < sizes.size(); ++i) {
+        const int n = sizes.at(i);
+        mgp::Polygon polygon = mgp::Polygon(new QVector<mgp::Point>(n));
+#if Q_BYTE_ORDER == Q_LITTLE_ENDIAN
+        Q_STATIC_ASSERT(sizeof(mgp::Point) == (2 * sizeof(double)));
+        memcpy(polygon->data(), src, n * sizeof(mgp::Point));
+#else
+        for (int j = 0; j < n; ++j)
+            (*polygon)[j] = qMakePair(doubleFromLittleEndian(src + 16 * j), doubleFromLittleEndian(src + 16 * j + 8));
+#endif
+        src += n * 2 * sizeof(double);
+        polygons->append(polygon);
+    }
+
+    return polygons;
+}
+
+mgp::Polygons polybin2polygons(const QByteArray &data, QString *error)
+{
+    return polybin2polygons(data.constData(), data.size(), error);
+}
+
+QByteArray polygons2polybin(const mgp::Polygons &polygons)
+{
+    const quint32 npolys = polygons ? polygons->size() : 0;
+    qint64 npoints = 0;
+    for (quint32 i = 0; i < npolys; ++i)
+        npoints += polygons->at(i)->size();
+
+    QByteArray data(headerSize(npolys) + npoints * 2 * sizeof(double), '\0');
+    uchar *udata = reinterpret_cast<uchar *>(data.data());
+    qToLittleEndian<quint32>(magic, udata);
+    qToLittleEndian<quint32>(version, udata + 4);
+    qToLittleEndian<quint32>(npolys, udata + 8);
+    char *dst = data.data() + headerSize(npolys);
+    for (quint32 i = 0; i < npolys; ++i) {
+        const mgp::Polygon &polygon = polygons->at(i);
+        qToLittleEndian<quint32>(polygon->size(), udata + 12 + 4 * i);
+        for (int j = 0; j < polygon->size(); ++j) {
+            doubleToLittleEndian(polygon->at(j).first, dst);
+            doubleToLittleEndian(polygon->at(j).second, dst + 8);
+            dst += 16;
+        }
+    }
+
+    return data;
+}
+
+POLYBIN_END_NAMESPACE
@@ -0,0 +1,38 @@
+#ifndef POLYBIN_H
+#define POLYBIN_H
+
+#include "mgp.h"
+#include <QString>
+#include <QByteArray>
+#include <QVector>
+
+#define POLYBIN_BEGIN_NAMESPACE namespace polybin {
+#define POLYBIN_END_NAMESPACE }
+
+POLYBIN_BEGIN_NAMESPACE
+
+// Compact binary format for a list of polygons. The format is designed to be loaded without any text parsing (typically from
+// a file converted from KML at build time; see tools/kml2polybin). It consists of the following little-endian values:
+//
+//   quint32     magic number ('MGPB')
+//   quint32     format version (1)
+//   quint32     number of polygons (n)
+//   n * quint32 number of points in each polygon
+//   (zero padding up to a multiple of 8 bytes)
+//   double      lon and lat (in radians) of each point of each polygon in turn
+
+// Validates the layout of a binary polygon structure without reading the point values. Upon success, the function returns true,
+// the number of points in each polygon in \a sizes and the byte offset of the first point value in \a pointsOffset. Upon failure,
+// the function returns false and a failure reason in \a error.
+bool readLayout(const char *data, qint64 size, QVector<int> *sizes, qint64 *pointsOffset, QString *error);
+
+// Returns the polygons found in a binary polygon structure. Sets \a error to a non-empty string iff the operation fails.
+mgp::Polygons polybin2polygons(const char *data, qint64 size, QString *error);
+mgp::Polygons polybin2polygons(const QByteArray &data, QString *error);
+
+// Returns the binary polygon structure representing a list of polygons.
+QByteArray polygons2polybin(const mgp::Polygons &polygons);
+
+POLYBIN_END_NAMESPACE
+
+#endif // POLYBIN_H
@@ -0,0 +1,153 @@
+#include "polygongenerator.h"
+#include "mgpmath.h"
+#include <QVector>
+#include <algorithm>
+
+MGP_BEGIN_NAMESPACE
+
+PolygonGenerator::PolygonGenerator(quint64 seed)
+{
+    setSeed(seed);
+}
+
+void PolygonGenerator::setSeed(quint64 seed)
+{
+    state_ = seed;
+}
+
+// Returns the next 64-bit number of the SplitMix64 sequence. Unlike qrand(), this is independent of the platform and of other users.
+quint64 PolygonGenerator::next()
+{
+    quint64 z = (state_ += Q_UINT64_C(0x9e3779b97f4a7c15));
+    z = (z ^ (z >> 30)) * Q_UINT64_C(0xbf58476d1ce4e5b9);
+    z = (z ^ (z >> 27)) * Q_UINT64_C(0x94d049bb133111eb);
+    return z ^ (z >> 31);
+}
+
+double PolygonGenerator::uniform()
+{
+    return (next() >> 11) * (1.0 / (Q_UINT64_C(1) << 53));
+}
+
+// Returns a random index in [0, n).
+int PolygonGenerator::index(int n)
+{
+    return qMin(n - 1, int(uniform() * n));
+}
+
+Point PolygonGenerator::randomPoint()
+{
+    const double lon = -M_PI + 2 * M_PI * uniform();
+    const double lat = asin(2 * uniform() - 1);
+    return qMakePair(lon, lat);
+}
+
+// Returns the point at a given bearing and angular distance from another point.
+static Point destination(const Point &from, double bearing, double dist)
+{
+    const double lat1 = from.second;
+    const double lat2 = asin(qBound(-1.0, sin(lat1) * cos(dist) + cos(lat1) * sin(dist) * cos(bearing), 1.0));
+    double lon2 = from.first + atan2(sin(bearing) * sin(dist) * cos(lat1), cos(dist) - sin(lat1) * sin(lat2));
+    lon2 = fmod(lon2 + 3 * M_PI, 2 * M_PI) - M_PI; // normalize to [-M_PI, M_PI)
+    return qMakePair(lon2, lat2);
+}
+
+Polygon PolygonGenerator::randomPolygon(int n, const Point &center, double radiusKm, double concavity)
+{
+    n = qMax(3, n);
+    const double radius = qBound(0.0, radiusKm / earthRadius, 0.99 * M_PI_2);
+    concavity = qBound(0.0, concavity, 0.99);
+
+    // divide the full circle into n equal sectors and place one vertex at a random bearing within each sector (away from the
+    // sector boundaries so that consecutive bearings are strictly increasing)
+    const double sector = 2 * M_PI / n;
+    const double offset = 2 * M_PI * uniform();
+    Polygon polygon = Polygon(new QVector<Point>());
+    polygon->reserve(n);
+    for (int i = 0; i < n; ++i) {
+        const double bearing = offset + sector * (i + 0.1 + 0.8 * uniform());
+        const double dist = radius * (1 - concavity * uniform());
+        polygon->append(destination(center, bearing, dist));
+    }
+    return polygon;
+}
+
+Polygon PolygonGenerator::randomPolygon(int n, double radiusKm, double concavity)
+{
+    const Point center = randomPoint();
+    return randomPolygon(n, center, radiusKm, concavity);
+}
+
+// Returns a random point on the great circle arc of edge i (from vertex i to vertex i + 1) of a polygon, away from the end points
+// of the edge. The point is interpolated between the unit vectors of the end points, so this also works for edges crossing the
+// antimeridian or passing close to a pole.
+Point PolygonGenerator::randomEdgePoint(const Polygon &polygon, int i)
+{
+    const Point &p1 = polygon->at(i);
+    const Point &p2 = polygon->at((i + 1) % polygon->size());
+    const math::_3DPoint v1 = math::_3DPoint::fromSpherical(p1.first, p1.second);
+    const math::_3DPoint v2 = math::_3DPoint::fromSpherical(p2.first, p2.second);
+    const double frac = 0.1 + 0.8 * uniform();
+    const math::_3DPoint v(
+                (1 - frac) * v1.x() + frac * v2.x(), (1 - frac) * v1.y() + frac * v2.y(), (1 - frac) * v1.z() + frac * v2.z());
+    if (v.norm() < 1e-12)
+        return p1; // antipodal end points (not the case for a valid polygon edge)
+    return math::_3DPoint::normalized(v).toSpherical();
+}
+
+// Returns a random point on a random edge of a polygon (see above).
+Point PolygonGenerator::randomEdgePoint(const Polygon &polygon)
+{
+    return randomEdgePoint(polygon, index(polygon->size()));
+}
+
+// Returns a line between random points on two distinct edges of a polygon, ordered on increasing longitude or latitude.
+// (The end points are kept away from the vertices since the filters don't handle a line passing exactly through a vertex.)
+QPair<Point, Point> PolygonGenerator::randomLine(const Polygon &polygon, bool sortOnLon)
+{
+    const int i1 = index(polygon->size());
+    int i2 = index(polygon->size());
+    while (i2 == i1)
+        i2 = index(polygon->size());
+    Point p1 = randomEdgePoint(polygon, i1);
+    Point p2 = randomEdgePoint(polygon, i2);
+    if (sortOnLon ? (p1.first > p2.first) : (p1.second > p2.second))
+        std::swap(p1, p2);
+    return qMakePair(p1, p2);
+}
+
+Filters PolygonGenerator::randomFilters(int count, const Polygon &polygon)
+{
+    Filters filters = Filters(new QList<Filter>());
+    if ((!polygon) || (polygon->size() < 3))
+        return filters;
+
+    for (int k = 0; k < count; ++k) {
+        const Point p = randomEdgePoint(polygon);
+        switch (index(13)) {
+        case 0: filters->append(Filter(new EOfFilter(p.first))); break;
+        case 1: filters->append(Filter(new WOfFilter(p.first))); break;
+        case 2: filters->append(Filter(new NOfFilter(p.second))); break;
+        case 3: filters->append(Filter(new SOfFilter(p.second))); break;
+        case 4: filters->append(Filter(new EOfLineFilter(randomLine(polygon, false)))); break;
+        case 5: filters->append(Filter(new WOfLineFilter(randomLine(polygon, false)))); break;
+        case 6: filters->append(Filter(new NOfLineFilter(randomLine(polygon, true)))); break;
+        case 7: filters->append(Filter(new SOfLineFilter(randomLine(polygon, true)))); break;
+        case 8: filters->append(Filter(new NEOfLineFilter(randomLine(polygon, true)))); break;
+        case 9: filters->append(Filter(new NWOfLineFilter(randomLine(polygon, true)))); break;
+        case 10: filters->append(Filter(new SEOfLineFilter(randomLine(polygon, true)))); break;
+        case 11: filters->append(Filter(new SWOfLineFilter(randomLine(polygon, true)))); break;
+        default: {
+            // a WI polygon with a radius of about half the distance from a point on one of the edges of the polygon to one of
+            // its vertices, centered at that point
+            const double radiusKm = earthRadius * math::Math::distance(p, polygon->at(index(polygon->size())));
+            filters->append(Filter(new WithinFilter(randomPolygon(3 + index(8), p, qMax(1.0, radiusKm / 2), 0.3))));
+            break;
+        }
+        }
+    }
+
+    return filters;
+}
+
+MGP_END_NAMESPACE
@@ -0,0 +1,71 @@
+#ifndef POLYGONGENERATOR_H
+#define POLYGONGENERATOR_H
+
+#include "mgp.h"
+
+MGP_BEGIN_NAMESPACE
+
+// --- BEGIN classes --------------------------------------------------
+
+/**
+ * Deterministic generator of random spherical polygons and filter sets, typically used as synthetic input for stress and scaling
+ * tests. The same seed always gives the same sequence of results on all platforms.
+ *
+ * A polygon is generated by placing its vertices at increasing bearings (i.e. clockwise as seen from above) around a center, each
+ * at a random distance from it. The polygon is thus star-shaped with respect to the center, and therefore simple, as long as it stays
+ * within a hemisphere (the radius is limited accordingly). This holds also for polygons near or around a pole and for polygons crossing
+ * the antimeridian (longitudes are normalized to [-M_PI, M_PI)). Note however that the filters assume polygons that neither enclose
+ * a pole nor cross the antimeridian, so such polygons are only useful as input to the purely spherical functions (like
+ * polygonIntersection()).
+ */
+class PolygonGenerator
+{
+public:
+    /** Constructs a generator with a given seed. */
+    explicit PolygonGenerator(quint64 seed = 0);
+
+    /** Restarts the sequence of random numbers from a given seed. */
+    void setSeed(quint64 seed);
+
+    /** Returns a uniformly distributed random number in [0, 1). */
+    double uniform();
+
+    /** Returns a uniformly distributed random point on the sphere. */
+    Point randomPoint();
+
+    /**
+     * Returns a random simple polygon.
+     * @param n Number of vertices (at least 3).
+     * @param center Center of the polygon.
+     * @param radiusKm Maximum distance (km) of a vertex from the center (limited to a quarter of the circumference of the Earth).
+     * @param concavity Value in [0, 1) controlling how deep the polygon may be indented: a vertex is placed at a distance in
+     * [(1 - concavity) * radiusKm, radiusKm] from the center, so a concavity of 0 gives a convex polygon.
+     */
+    Polygon randomPolygon(int n, const Point &center, double radiusKm, double concavity = 0);
+
+    /** Overload of the above function for a random center (see randomPoint()). */
+    Polygon randomPolygon(int n, double radiusKm, double concavity = 0);
+
+    /**
+     * Returns a random filter sequence intended for a given polygon: the lon/lat values, lines and WI polygons are placed at random
+     * points on the edges of the polygon so that each filter typically cuts through it.
+     * @param count Number of filters.
+     * @param polygon Polygon to be filtered (with at least 3 vertices).
+     */
+    Filters randomFilters(int count, const Polygon &polygon);
+
+private:
+    quint64 next();
+    int index(int n);
+    Point randomEdgePoint(const Polygon &polygon, int i);
+    Point randomEdgePoint(const Polygon &polygon);
+    QPair<Point, Point> randomLine(const Polygon &polygon, bool sortOnLon);
+
+    quint64 state_;
+};
+
+// --- END classes --------------------------------------------------
+
+MGP_END_NAMESPACE
+
+#endif // POLYGONGENERATOR_H
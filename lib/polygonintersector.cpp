@@ -1,44 +1,250 @@
 #include "polygonintersector.h"
-#include "mgpmath.h"
+#include "parallel.h"
+#include "tracing.h"
+#include <algorithm>
 
 MGP_BEGIN_NAMESPACE
 
-PolygonIntersector &PolygonIntersector::instance()
+// Margin (radians) added to each bounding box. This accounts for polygonIntersection() perturbing vertices slightly
+// in order to eliminate degenerate cases.
+static const double boxMargin = 0.001;
+
+// Max number of entries in a leaf node.
+static const int leafSize = 4;
+
+
+static double lonCenter(const math::BoundingBox &box)
+{
+    return (box.minLon() + box.maxLon()) / 2;
+}
+
+static double latCenter(const math::BoundingBox &box)
+{
+    return (box.minLat() + box.maxLat()) / 2;
+}
+
+// Returns the smallest box enclosing two non-wrapping boxes.
+static math::BoundingBox unite(const math::BoundingBox &box1, const math::BoundingBox &box2)
+{
+    if (box1.isEmpty())
+        return box2;
+    if (box2.isEmpty())
+        return box1;
+    return math::BoundingBox(
+                qMin(box1.minLon(), box2.minLon()), qMax(box1.maxLon(), box2.maxLon()),
+                qMin(box1.minLat(), box2.minLat()), qMax(box1.maxLat(), box2.maxLat()));
+}
+
+struct LonCenterLessThan {
+    template <typename T> bool operator()(const T &e1, const T &e2) const { return lonCenter(e1.box_) < lonCenter(e2.box_); }
+};
+
+struct LatCenterLessThan {
+    template <typename T> bool operator()(const T &e1, const T &e2) const { return latCenter(e1.box_) < latCenter(e2.box_); }
+};
+
+// Builds the subtree for entries_[first, first + count) and returns the index of its root node.
+int PolygonIntersector::build(int first, int count)
+{
+    Node node;
+    for (int i = first; i < (first + count); ++i)
+        node.box_ = unite(node.box_, entries_.at(i).box_);
+
+    const int index = nodes_.size();
+    nodes_.append(node);
+
+    if (count <= leafSize) {
+        nodes_[index].first_ = first;
+        nodes_[index].count_ = count;
+        return index;
+    }
+
+    // split the entries in two halves along the longest side of the box
+    Entry *begin = entries_.data() + first;
+    Entry *end = begin + count;
+    if ((node.box_.maxLon() - node.box_.minLon()) > (node.box_.maxLat() - node.box_.minLat()))
+        std::sort(begin, end, LonCenterLessThan());
+    else
+        std::sort(begin, end, LatCenterLessThan());
+
+    const int half = count / 2;
+    const int left = build(first, half);
+    const int right = build(first + half, count - half);
+    nodes_[index].left_ = left;
+    nodes_[index].right_ = right;
+    return index;
+}
+
+PolygonIntersector::PolygonIntersector(const Polygons &polygons)
+    : polygons_(polygons)
+    , size_(polygons ? polygons->size() : 0)
 {
-    static PolygonIntersector pi;
-    return pi;
+    // prepare the polygons once rather than in each call to intersection()
+    prepared_.reserve(size_);
+    for (int i = 0; i < size_; ++i)
+        prepared_.append(math::PreparedPolygon(polygons_->at(i)));
+
+    buildHierarchy();
 }
 
-PolygonIntersector::PolygonIntersector()
+PolygonIntersector::PolygonIntersector(const PolygonStore &store)
+    : store_(store)
+    , size_(store.size())
 {
+    buildHierarchy();
 }
 
-void PolygonIntersector::setPolygons(const Polygons &polygons)
+Polygons PolygonIntersector::polygons() const
 {
-    polygons_ = polygons; // later, the polygons should be represented in a tree structure (quadtree, BSP tree etc.) in order to reduce
-                          // the complexity of intersection() from O(n) to O(log n) ... TBD
+    return (store_.size() > 0) ? store_.polygons() : polygons_;
 }
 
-QList<QPair<int, Polygons> > PolygonIntersector::intersection(const Polygons &intersectors) const
+Polygons PolygonIntersector::simplified(double toleranceKm) const
+{
+    if (store_.size() == 0)
+        return simplifiedPolygons(polygons_, toleranceKm);
+
+    Polygons result(new QVector<Polygon>());
+    result->reserve(size_);
+    for (int i = 0; i < size_; ++i)
+        result->append(simplifiedPolygon(store_.polygon(i).toPolygon(), toleranceKm));
+    return result;
+}
+
+// Computes the bounding boxes of the polygons and organizes them in a bounding volume hierarchy in order to
+// reduce the complexity of finding the candidates for intersection from O(n) to O(log n).
+void PolygonIntersector::buildHierarchy()
+{
+    for (int i = 0; i < size_; ++i) {
+        const math::BoundingBox box = prepared_.isEmpty()
+                ? math::BoundingBox::fromPolygon(store_.polygon(i), boxMargin)
+                : math::BoundingBox::fromPolygon(polygons_->at(i), boxMargin);
+        const QVector<math::BoundingBox> boxes = box.splitAtAntimeridian();
+        for (int j = 0; j < boxes.size(); ++j)
+            entries_.append(Entry(boxes.at(j), i));
+    }
+
+    if (!entries_.isEmpty())
+        build(0, entries_.size());
+}
+
+// Appends to indices the polygons whose (non-wrapping) entries overlap a non-wrapping box. found is used for
+// avoiding duplicates.
+void PolygonIntersector::query(const math::BoundingBox &box, QVector<int> *indices, QVector<bool> *found) const
+{
+    if (nodes_.isEmpty())
+        return;
+
+    QVector<int> stack;
+    stack.append(0);
+    while (!stack.isEmpty()) {
+        const Node &node = nodes_.at(stack.last());
+        stack.removeLast();
+        if (!node.box_.intersects(box))
+            continue;
+        if (node.left_ < 0) {
+            for (int i = node.first_; i < (node.first_ + node.count_); ++i) {
+                const Entry &entry = entries_.at(i);
+                if ((!found->at(entry.index_)) && entry.box_.intersects(box)) {
+                    (*found)[entry.index_] = true;
+                    indices->append(entry.index_);
+                }
+            }
+        } else {
+            stack.append(node.right_);
+            stack.append(node.left_);
+        }
+    }
+}
+
+QVector<int> PolygonIntersector::candidates(const Polygon &polygon) const
+{
+    QVector<int> indices;
+    if (size_ == 0)
+        return indices;
+
+    QVector<bool> found(size_, false);
+    const QVector<math::BoundingBox> boxes = math::BoundingBox::fromPolygon(polygon, boxMargin).splitAtAntimeridian();
+    for (int i = 0; i < boxes.size(); ++i)
+        query(boxes.at(i), &indices, &found);
+
+    qSort(indices.begin(), indices.end());
+    return indices;
+}
+
+// Returns the union of the intersections between polygon index and the candidate intersectors (in increasing order).
+Polygons PolygonIntersector::intersection(
+        int index, const QVector<int> &cands, const QVector<math::PreparedPolygon> &preparedIntersectors) const
+{
+    // a polygon of a store is prepared from its view here (once for all the candidates)
+    const math::PreparedPolygon clip = prepared_.isEmpty() ? math::PreparedPolygon(store_.polygon(index)) : prepared_.at(index);
+
+    Polygons ipolys = Polygons(new QVector<Polygon>());
+    TraceScope trace("PolygonIntersector::intersection(index)", clip.size(), &ipolys);
+    for (int k = 0; k < cands.size(); ++k) {
+        const Polygons ipolys2 = math::polygonIntersection(preparedIntersectors.at(cands.at(k)), clip);
+        if (ipolys2 && (!ipolys2->isEmpty()))
+            *ipolys += *ipolys2;
+    }
+    return ipolys;
+}
+
+// Intersects polygon i with its candidate intersectors (see parallelFor()).
+class IntersectionWork
+{
+public:
+    IntersectionWork(
+            const PolygonIntersector *intersector, const QVector<QVector<int> > *candIntersectors,
+            const QVector<math::PreparedPolygon> *preparedIntersectors, Polygons *results)
+        : intersector_(intersector), candIntersectors_(candIntersectors), preparedIntersectors_(preparedIntersectors)
+        , results_(results) {}
+
+    void operator()(int i) const
+    {
+        if (!candIntersectors_->at(i).isEmpty())
+            results_[i] = intersector_->intersection(i, candIntersectors_->at(i), *preparedIntersectors_);
+    }
+
+private:
+    const PolygonIntersector *intersector_;
+    const QVector<QVector<int> > *candIntersectors_;
+    const QVector<math::PreparedPolygon> *preparedIntersectors_;
+    Polygons *results_;
+};
+
+QList<QPair<int, Polygons> > PolygonIntersector::intersection(const Polygons &intersectors, int threadCount) const
 {
     QList<QPair<int, Polygons> > isct;
+    TraceScope trace("PolygonIntersector::intersection", intersectors);
 
-    if (!polygons_)
+    if ((size_ == 0) || (!intersectors))
         return isct;
 
-    // trivial O(n) algorithm
-    for (int i = 0; i < polygons_->size(); ++i) {
-        Polygons ipolys = Polygons(new QVector<Polygon>());
-        for (int j = 0; j < intersectors->size(); ++j) {
-            const Polygons ipolys2 = math::polygonIntersection(intersectors->at(j), polygons_->at(i));
-            if (!ipolys2->isEmpty())
-                *ipolys += *ipolys2;
-        }
-        if (!ipolys->isEmpty()) {
+    // find the intersectors (in increasing order) that are candidates for intersecting each polygon
+    QVector<QVector<int> > candIntersectors(size_);
+    for (int j = 0; j < intersectors->size(); ++j) {
+        const QVector<int> cands = candidates(intersectors->at(j));
+        for (int k = 0; k < cands.size(); ++k)
+            candIntersectors[cands.at(k)].append(j);
+    }
+
+    QVector<math::PreparedPolygon> preparedIntersectors;
+    preparedIntersectors.reserve(intersectors->size());
+    for (int j = 0; j < intersectors->size(); ++j)
+        preparedIntersectors.append(math::PreparedPolygon(intersectors->at(j)));
+
+    // run the full intersection only for the candidate pairs
+    QVector<Polygons> results(size_);
+    parallelFor(size_, threadCount, IntersectionWork(this, &candIntersectors, &preparedIntersectors, results.data()));
+
+    // collect the results in polygon order
+    for (int i = 0; i < results.size(); ++i) {
+        const Polygons &ipolys = results.at(i);
+        if (ipolys && (!ipolys->isEmpty()))
             isct.append(qMakePair(i, ipolys));
-        }
     }
 
+    trace.setOutputSize(isct.size());
     return isct;
 }
 
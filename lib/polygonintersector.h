@@ -2,22 +2,72 @@
 #define POLYGONINTERSECTOR_H
 
 #include "mgp.h"
+#include "mgpmath.h"
+#include "polygonstore.h"
 #include <QList>
 #include <QPair>
+#include <QVector>
 
 MGP_BEGIN_NAMESPACE
 
+// Bounding volume hierarchy over a set of polygons, used for implementing IntersectionLayer. The object is immutable once
+// constructed, so its functions may be called concurrently.
 class PolygonIntersector
 {
 public:
-    static PolygonIntersector &instance();
+    PolygonIntersector(const Polygons &polygons);
 
-    void setPolygons(const Polygons &polygons);
-    QList<QPair<int, Polygons> > intersection(const Polygons &intersectors) const;
+    // Constructs an intersector for the polygons of a store. Only the bounding boxes are computed up front; each polygon is prepared
+    // from its view when intersected.
+    PolygonIntersector(const PolygonStore &store);
+
+    Polygons polygons() const;
+
+    // Returns the polygons simplified with a tolerance (see simplifiedPolygon()). The polygons of a store are simplified one at a
+    // time from their views, so the store is never copied as a whole.
+    Polygons simplified(double toleranceKm) const;
+
+    // Intersects the polygons with intersectors (see intersectedPolygons()). The polygons are processed concurrently using up to
+    // threadCount threads (QThread::idealThreadCount() if zero or negative). The result is ordered by polygon index regardless.
+    QList<QPair<int, Polygons> > intersection(const Polygons &intersectors, int threadCount = 0) const;
+
+    // Returns the indices (in increasing order) of the polygons whose bounding boxes overlap the bounding box of a given polygon.
+    QVector<int> candidates(const Polygon &polygon) const;
 
 private:
-    PolygonIntersector();
+    // Node in a bounding volume hierarchy of the polygon bounding boxes. A leaf node refers to the range
+    // [first_, first_ + count_) in entries_, while an internal node refers to its two children.
+    struct Node {
+        math::BoundingBox box_;
+        int left_;
+        int right_;
+        int first_;
+        int count_;
+        Node() : left_(-1), right_(-1), first_(0), count_(0) {}
+    };
+
+    // Bounding box of (part of) an intersectable polygon. A box that wraps around the antimeridian is represented as two entries.
+    struct Entry {
+        math::BoundingBox box_;
+        int index_; // index of polygon
+        Entry() : index_(-1) {}
+        Entry(const math::BoundingBox &box, int index) : box_(box), index_(index) {}
+    };
+
+    friend class IntersectionWork;
+
+    void buildHierarchy();
+    int build(int first, int count);
+    void query(const math::BoundingBox &box, QVector<int> *indices, QVector<bool> *found) const;
+    Polygons intersection(
+            int index, const QVector<int> &cands, const QVector<math::PreparedPolygon> &preparedIntersectors) const;
+
     Polygons polygons_;
+    PolygonStore store_; // used instead of polygons_ if non-empty
+    int size_; // number of polygons
+    QVector<math::PreparedPolygon> prepared_; // prepared versions of polygons_ (empty if store_ is used)
+    QVector<Entry> entries_;
+    QVector<Node> nodes_;
 };
 
 // --- END classes --------------------------------------------------
@@ -0,0 +1,83 @@
+#include "polygonstore.h"
+#include "polybin.h"
+#include <QFile>
+
+MGP_BEGIN_NAMESPACE
+
+PolygonStore::PolygonStore()
+    : points_(0)
+{
+}
+
+void PolygonStore::clear()
+{
+    file_.clear();
+    pointsCopy_.clear();
+    points_ = 0;
+    offsets_.clear();
+}
+
+bool PolygonStore::open(const QString &fileName, QString *error)
+{
+    clear();
+
+    QSharedPointer<QFile> file(new QFile(fileName));
+    if (!file->open(QIODevice::ReadOnly)) {
+        *error = QString("failed to open %1 for reading: %2").arg(fileName).arg(file->errorString());
+        return false;
+    }
+    const qint64 size = file->size();
+    const uchar *data = file->map(0, size);
+    if (!data) {
+        *error = QString("failed to map %1: %2").arg(fileName).arg(file->errorString());
+        return false;
+    }
+
+    if (!setData(reinterpret_cast<const char *>(data), size, error))
+        return false;
+    file_ = file; // keep the file mapped
+    return true;
+}
+
+bool PolygonStore::setData(const char *data, qint64 size, QString *error)
+{
+    clear();
+
+    QVector<int> sizes;
+    qint64 pointsOffset = 0;
+    if (!polybin::readLayout(data, size, &sizes, &pointsOffset, error))
+        return false;
+
+    offsets_.resize(sizes.size() + 1);
+    offsets_[0] = 0;
+    for (int i = 0; i < sizes.size(); ++i)
+        offsets_[i + 1] = offsets_.at(i) + sizes.at(i);
+
+#if Q_BYTE_ORDER == Q_LITTLE_ENDIAN
+    // the points are stored as consecutive pairs of little-endian doubles, so they can be used in place if properly aligned
+    // (which they are when the data is mapped from a file, since the header is padded to a multiple of 8 bytes)
+    Q_STATIC_ASSERT(sizeof(Point) == (2 * sizeof(double)));
+    if ((quintptr(data + pointsOffset) % Q_ALIGNOF(Point)) == 0) {
+        points_ = reinterpret_cast<const Point *>(data + pointsOffset);
+        return true;
+    }
+#endif
+
+    const Polygons polygons = polybin::polybin2polygons(data, size, error);
+    pointsCopy_.reserve(offsets_.last());
+    for (int i = 0; i < polygons->size(); ++i)
+        pointsCopy_ += *polygons->at(i);
+    points_ = pointsCopy_.constData();
+    return true;
+}
+
+Polygons PolygonStore::polygons() const
+{
+    Polygons polygons = Polygons(new QVector<Polygon>);
+    polygons->reserve(size());
+    for (int i = 0; i < size(); ++i)
+        polygons->append(polygon(i).toPolygon());
+    return polygons;
+}
+
+MGP_END_NAMESPACE
@@ -0,0 +1,67 @@
+#ifndef POLYGONSTORE_H
+#define POLYGONSTORE_H
+
+#include "mgp.h"
+#include <QSharedPointer>
+#include <QString>
+#include <QVector>
+
+class QFile;
+
+MGP_BEGIN_NAMESPACE
+
+// --- BEGIN classes --------------------------------------------------
+
+/**
+ * Read-only store of polygons in the binary polygon format (see polybin.h), typically memory-mapped from a file. The store consists of
+ * an offset table and one contiguous array of points that the polygons are exposed as views into, so opening a store only involves
+ * validating the layout, and several processes mapping the same file share the same page cache copy.
+ * \note Copying a store is cheap, and the underlying data is kept open until the last copy is destroyed.
+ */
+class PolygonStore
+{
+public:
+    /** Constructs an empty store. */
+    PolygonStore();
+
+    /**
+     * Memory-maps a file in the binary polygon format.
+     * @param fileName The name of the file.
+     * @param error Set to a non-empty string iff the operation fails.
+     * @return True iff the operation succeeds. The store is empty upon failure.
+     */
+    bool open(const QString &fileName, QString *error);
+
+    /**
+     * Uses data in the binary polygon format that is already in memory (like the data of a resource).
+     * \note The data is not copied, so it must remain valid for as long as the store (or any copy of it) is in use.
+     * @param data The data.
+     * @param size The size of the data in bytes.
+     * @param error Set to a non-empty string iff the operation fails.
+     * @return True iff the operation succeeds. The store is empty upon failure.
+     */
+    bool setData(const char *data, qint64 size, QString *error);
+
+    /** Returns the number of polygons in the store. */
+    int size() const { return offsets_.isEmpty() ? 0 : (offsets_.size() - 1); }
+
+    /** Returns a view of polygon i. The view remains valid for as long as the store (or any copy of it) is in use. */
+    PolygonView polygon(int i) const { return PolygonView(points_ + offsets_.at(i), offsets_.at(i + 1) - offsets_.at(i)); }
+
+    /** Returns a copy of all the polygons. */
+    Polygons polygons() const;
+
+private:
+    void clear();
+
+    QSharedPointer<QFile> file_; // mapped file (if any)
+    QVector<Point> pointsCopy_; // owned copy of the points if they can't be used in place (i.e. on big-endian hosts)
+    const Point *points_;
+    QVector<int> offsets_; // index of the first point of each polygon, followed by the total number of points
+};
+
+// --- END classes --------------------------------------------------
+
+MGP_END_NAMESPACE
+
+#endif // POLYGONSTORE_H
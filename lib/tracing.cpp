@@ -0,0 +1,123 @@
+#include "tracing.h"
+#include <QAtomicPointer>
+#include <QIODevice>
+#include <QThread>
+
+MGP_BEGIN_NAMESPACE
+
+static QAtomicPointer<TraceSink> currentTraceSink; // 0 if tracing is disabled
+
+void setTraceSink(TraceSink *sink)
+{
+    currentTraceSink.storeRelease(sink);
+}
+
+TraceSink *traceSink()
+{
+    static NullTraceSink nullTraceSink;
+    TraceSink *sink = currentTraceSink.loadAcquire();
+    return sink ? sink : &nullTraceSink;
+}
+
+// Returns the total number of vertices in a set of polygons.
+static int vertexCount(const Polygons &polygons)
+{
+    int n = 0;
+    for (int i = 0; polygons && (i < polygons->size()); ++i)
+        n += (polygons->at(i) ? polygons->at(i)->size() : 0);
+    return n;
+}
+
+TraceScope::TraceScope(const char *name, int inputSize, const Polygons *output)
+    : sink_(currentTraceSink.loadAcquire())
+    , name_(name)
+    , output_(output)
+    , outputSize_(0)
+{
+    if (sink_)
+        sink_->begin(name_, inputSize, QString());
+}
+
+TraceScope::TraceScope(const char *name, const Polygons &input, const Polygons *output)
+    : sink_(currentTraceSink.loadAcquire())
+    , name_(name)
+    , output_(output)
+    , outputSize_(0)
+{
+    if (sink_)
+        sink_->begin(name_, vertexCount(input), QString());
+}
+
+TraceScope::TraceScope(const char *name, const QString &expr)
+    : sink_(currentTraceSink.loadAcquire())
+    , name_(name)
+    , output_(0)
+    , outputSize_(0)
+{
+    if (sink_)
+        sink_->begin(name_, expr.size(), expr);
+}
+
+TraceScope::~TraceScope()
+{
+    if (!sink_)
+        return;
+    if (output_)
+        outputSize_ = (*output_) ? (*output_)->size() : 0;
+    sink_->end(name_, outputSize_);
+}
+
+void TraceScope::setOutputSize(int outputSize)
+{
+    outputSize_ = outputSize;
+    output_ = 0;
+}
+
+ChromeTraceSink::ChromeTraceSink(QIODevice *device)
+    : device_(device)
+    , first_(true)
+{
+    timer_.start();
+    device_->write("[\n");
+}
+
+ChromeTraceSink::~ChromeTraceSink()
+{
+    device_->write("\n]\n");
+}
+
+void ChromeTraceSink::begin(const char *name, int inputSize, const QString &detail)
+{
+    QString args = QString("\"input\":%1").arg(inputSize);
+    if (!detail.isEmpty())
+        args += ",\"detail\":" + jsonString(detail);
+    write(name, 'B', args);
+}
+
+void ChromeTraceSink::end(const char *name, int outputSize)
+{
+    write(name, 'E', QString("\"output\":%1").arg(outputSize));
+}
+
+void ChromeTraceSink::write(const char *name, char phase, const QString &args)
+{
+    const Qt::HANDLE thread = QThread::currentThreadId();
+
+    QMutexLocker locker(&mutex_);
+    if (!threadIds_.contains(thread))
+        threadIds_.insert(thread, threadIds_.size() + 1);
+
+    // (the arguments are appended rather than passed to QString::arg() since the expression may contain '%')
+    QString event = first_ ? QString() : QString(",\n");
+    event += QString("{\"name\":\"%1\",\"cat\":\"mgp\",\"ph\":\"%2\",\"ts\":%3,\"pid\":1,\"tid\":%4,\"args\":{")
+            .arg(name)
+            .arg(QChar(phase))
+            .arg(QString::number(timer_.nsecsElapsed() / 1000.0, 'f', 3))
+            .arg(threadIds_.value(thread));
+    event += args;
+    event += "}}";
+    device_->write(event.toUtf8());
+    first_ = false;
+}
+
+MGP_END_NAMESPACE
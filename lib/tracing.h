@@ -0,0 +1,125 @@
+#ifndef TRACING_H
+#define TRACING_H
+
+#include "mgp.h"
+#include <QElapsedTimer>
+#include <QHash>
+#include <QMutex>
+#include <QString>
+
+class QIODevice;
+
+MGP_BEGIN_NAMESPACE
+
+// --- BEGIN classes --------------------------------------------------
+
+/**
+ * Interface for receiving begin/end events from the potentially expensive operations of the library: applyFilters(), the apply()
+ * function of each filter, filtersFromXmetExpr() and the intersection of polygon layers (see setTraceSink()).
+ * \note The functions may be called concurrently from several threads. Events from the same thread are properly nested.
+ */
+class TraceSink
+{
+public:
+    virtual ~TraceSink() {}
+
+    /**
+     * Called when an operation begins.
+     * @param name The name of the operation (a string literal).
+     * @param inputSize The size of the input: the number of vertices, or the number of characters for filtersFromXmetExpr().
+     * @param detail Additional information about the input (e.g. the SIGMET/AIRMET expression), possibly empty.
+     */
+    virtual void begin(const char *name, int inputSize, const QString &detail) = 0;
+
+    /**
+     * Called when an operation ends.
+     * @param name The name of the operation (the same as in the corresponding call to begin()).
+     * @param outputSize The size of the output: the number of polygons, or the number of filters for filtersFromXmetExpr().
+     */
+    virtual void end(const char *name, int outputSize) = 0;
+};
+
+/** Sink that ignores all events. This is the default sink. */
+class NullTraceSink : public TraceSink
+{
+public:
+    virtual void begin(const char *, int, const QString &) {}
+    virtual void end(const char *, int) {}
+};
+
+/**
+ * Sink that writes the events to a device in the Chrome trace event format (a JSON array of duration events), which can be
+ * viewed in chrome://tracing or https://ui.perfetto.dev . The array is closed when the sink is destroyed.
+ */
+class ChromeTraceSink : public TraceSink
+{
+public:
+    /** Constructs a sink that writes to an open device (not owned by the sink). */
+    explicit ChromeTraceSink(QIODevice *device);
+    virtual ~ChromeTraceSink();
+
+    virtual void begin(const char *name, int inputSize, const QString &detail);
+    virtual void end(const char *name, int outputSize);
+
+private:
+    void write(const char *name, char phase, const QString &args);
+
+    QIODevice *device_;
+    QMutex mutex_;
+    QElapsedTimer timer_;
+    QHash<Qt::HANDLE, int> threadIds_; // small thread IDs for readability
+    bool first_; // whether no event has been written yet
+};
+
+/**
+ * Reports a traced operation to the current sink on construction (begin) and destruction (end). If no sink is set, the
+ * overhead is that of checking a pointer.
+ */
+class TraceScope
+{
+public:
+    /**
+     * @param name The name of the operation (a string literal).
+     * @param inputSize The number of input vertices.
+     * @param output If non-null, the number of polygons in *output at the end of the scope is reported as the output size
+     * (unless setOutputSize() is called).
+     */
+    TraceScope(const char *name, int inputSize, const Polygons *output = 0);
+
+    /** Overload of the above constructor that reports the total number of vertices in a set of polygons as the input size. */
+    TraceScope(const char *name, const Polygons &input, const Polygons *output = 0);
+
+    /** Overload of the above constructor for an operation on a SIGMET/AIRMET expression. */
+    TraceScope(const char *name, const QString &expr);
+
+    ~TraceScope();
+
+    /** Sets the output size reported at the end of the scope. */
+    void setOutputSize(int outputSize);
+
+private:
+    TraceSink *sink_; // 0 if tracing is disabled
+    const char *name_;
+    const Polygons *output_;
+    int outputSize_;
+};
+
+// --- END classes --------------------------------------------------
+
+// --- BEGIN global functions --------------------------------------------------
+
+/**
+ * Sets the sink that receives trace events (not owned by the library). Passing 0 disables tracing (equivalent to a NullTraceSink,
+ * but without the cost of the calls).
+ * \note The sink should only be changed while no traced operations are running, and must stay alive until it is replaced.
+ */
+void setTraceSink(TraceSink *sink);
+
+/** Returns the current trace sink (a NullTraceSink if none is set). */
+TraceSink *traceSink();
+
+// --- END global functions --------------------------------------------------
+
+MGP_END_NAMESPACE
+
+#endif // TRACING_H
@@ -5,6 +5,9 @@
 #include <QToolTip>
 #include <QAction>
 #include <QMenu>
+#include <QTextCursor>
+#include <QTextCharFormat>
+#include <QTextDocument>
 
 #include <QDebug>
 
@@ -13,6 +16,11 @@ XMETAreaEdit::XMETAreaEdit(QWidget *parent, bool wiExclusive__, bool wiOnly__, b
     , wiExclusive_(wiExclusive__)
     , wiOnly_(wiOnly__)
     , wiKeywordImplicit_(wiKeywordImplicit__)
+    , updated_(false)
+    , changedFirst_(-1)
+    , changedLast_(-1)
+    , changedSizeDelta_(0)
+    , highlighting_(false)
 {
     init();
 }
@@ -22,6 +30,11 @@ XMETAreaEdit::XMETAreaEdit(const QString &text, QWidget *parent, bool wiExclusiv
     , wiExclusive_(wiExclusive__)
     , wiOnly_(wiOnly__)
     , wiKeywordImplicit_(wiKeywordImplicit__)
+    , updated_(false)
+    , changedFirst_(-1)
+    , changedLast_(-1)
+    , changedSizeDelta_(0)
+    , highlighting_(false)
 {
     init();
 }
@@ -36,14 +49,33 @@ void XMETAreaEdit::init()
     dialogEditAction_->setShortcut(Qt::CTRL | Qt::Key_E);
 
     connect(dialogEditAction_, SIGNAL(triggered()), this, SLOT(editInDialog()));
+    connect(document(), SIGNAL(contentsChange(int, int, int)), this, SLOT(contentsChange(int, int, int)));
 }
 
-void XMETAreaEdit::resetHighlighting()
+// Ensures that the next update() parses and highlights the entire text.
+void XMETAreaEdit::invalidate()
 {
-    setPlainText(toPlainText());
-    matched_ = QBitArray(toPlainText().size(), false);
-    incomplete_ = QBitArray(toPlainText().size(), false);
-    reason_.clear();
+    updated_ = false;
+    filterFromExpr_.clear();
+}
+
+// Keeps track of the range of characters changed since the last update.
+void XMETAreaEdit::contentsChange(int pos, int charsRemoved, int charsAdded)
+{
+    if (highlighting_)
+        return; // ignore changes caused by the highlighting itself
+
+    const int delta = charsAdded - charsRemoved;
+    if (changedFirst_ < 0) {
+        changedFirst_ = pos;
+        changedLast_ = pos + charsAdded - 1;
+    } else {
+        // shift the previously changed range according to this change and merge the two ranges
+        const int prevLast = (changedLast_ >= (pos + charsRemoved)) ? (changedLast_ + delta) : qMin(changedLast_, pos + charsAdded - 1);
+        changedFirst_ = qMin(changedFirst_, pos);
+        changedLast_ = qMax(prevLast, pos + charsAdded - 1);
+    }
+    changedSizeDelta_ += delta;
 }
 
 void XMETAreaEdit::addMatchedRange(const QPair<int, int> &range)
@@ -58,69 +90,81 @@ void XMETAreaEdit::addIncompleteRange(const QPair<int, int> &range, const QStrin
         reason_.insert(i, reason);
 }
 
-void XMETAreaEdit::showHighlighting()
+// Sets the highlighting of the characters in the range [first, last].
+void XMETAreaEdit::setHighlighting(int first, int last, bool match, bool incom)
 {
-    const QString defaultColor("#f00");
-    const QString defaultBGColor("#fff");
-    const QString defaultWeight("regular");
+    const QColor defaultColor("#f00");
+    const QColor defaultBGColor("#fff");
+
+    //const QColor matchColor("#088");
+    const QColor matchColor("#000");
+    const QColor matchBGColor("#fff");
+
+    //const QColor incomColor("#088");
+    const QColor incomColor("#000");
+    const QColor incomBGColor("#ff0");
+
+    // prioritize incompleteness
+    QTextCharFormat format;
+    format.setForeground(incom ? incomColor : (match ? matchColor : defaultColor));
+    format.setBackground(incom ? incomBGColor : (match ? matchBGColor : defaultBGColor));
+    format.setFontWeight(QFont::Normal);
+
+    QTextCursor cursor(document());
+    cursor.setPosition(first);
+    cursor.setPosition(last + 1, QTextCursor::KeepAnchor);
+    cursor.setCharFormat(format);
+}
 
-    //const QString matchColor("#088");
-    const QString matchColor("#000");
-    const QString matchBGColor("#fff");
-    //const QString matchWeight("bold");
-    const QString matchWeight("regular");
+// Updates the highlighting of the characters that have changed since the last update, either by being edited or by
+// changing their matched or incomplete status.
+void XMETAreaEdit::showHighlighting(const QBitArray &prevMatched, const QBitArray &prevIncomplete)
+{
+    const int size = matched_.size();
+    if (size == 0)
+        return;
 
-    //const QString incomColor("#088");
-    const QString incomColor("#000");
-    const QString incomBGColor("#ff0");
-    //const QString incomWeight("bold");
-    const QString incomWeight("regular");
+    // find the range of edited characters (everything if the previous state is unknown)
+    int editedFirst = 0;
+    int editedLast = size - 1;
+    if (updated_) {
+        editedFirst = qMin(changedFirst_ < 0 ? size : changedFirst_, size);
+        editedLast = qMin(changedLast_, size - 1);
+    }
 
-    QString html;
-    const QString text(toPlainText());
-    if (text.isEmpty()|| matched_.isEmpty())
-        return;
+    highlighting_ = true;
+    QTextCursor editCursor(document());
+    editCursor.joinPreviousEditBlock(); // undo the highlighting along with the edit that caused it
 
-    Q_ASSERT(!incomplete_.isEmpty());
-
-    bool prevMatch = matched_.testBit(0);
-    bool prevIncom = incomplete_.testBit(0);
-
-    for (int i = 0; i < text.size(); ++i) {
-        const int currMatch = matched_.testBit(i);
-        const int currIncom = incomplete_.testBit(i);
-        if ((i == 0) || (prevMatch != currMatch) || (prevIncom != currIncom)) {
-            if (i > 0)
-                html += "</span>"; // end current span
-
-            // start new span, prioritizing incompleteness
-            QString color;
-            QString bgcolor;
-            QString weight;
-            if (prevIncom != currIncom) {
-                color = currIncom ? incomColor : defaultColor;
-                bgcolor = currIncom ? incomBGColor : defaultBGColor;
-                weight = currIncom ? incomWeight : defaultWeight;
-            } else if (prevMatch != currMatch) {
-                color = currMatch ? matchColor : defaultColor;
-                bgcolor = currMatch ? matchBGColor : defaultBGColor;
-                weight = currMatch ? matchWeight : defaultWeight;
+    int spanFirst = -1;
+    for (int i = 0; i <= size; ++i) {
+        bool changed = false;
+        if (i < size) {
+            if ((i >= editedFirst) && (i <= editedLast)) {
+                changed = true;
             } else {
-                Q_ASSERT(i == 0);
-                color = currIncom ? incomColor : (currMatch ? matchColor : defaultColor);
-                bgcolor = currIncom ? incomBGColor : (currMatch ? matchBGColor : defaultBGColor);
-                weight = currIncom ? incomWeight : (currMatch ? matchWeight : defaultWeight);
+                // compare with the status of the same character in the previous update
+                const int prevIndex = (i < editedFirst) ? i : (i - changedSizeDelta_);
+                changed = (prevIndex < 0) || (prevIndex >= prevMatched.size())
+                        || (prevMatched.testBit(prevIndex) != matched_.testBit(i))
+                        || (prevIncomplete.testBit(prevIndex) != incomplete_.testBit(i));
             }
-            html += QString("<span style='color:%1; background-color:%2; font-weight:%3'>").arg(color).arg(bgcolor).arg(weight);
         }
 
-        prevMatch = currMatch;
-        prevIncom = currIncom;
+        // end the current span of changed characters with equal status
+        if ((spanFirst >= 0) && ((!changed) || (i == size)
+                                 || (matched_.testBit(i) != matched_.testBit(spanFirst))
+                                 || (incomplete_.testBit(i) != incomplete_.testBit(spanFirst)))) {
+            setHighlighting(spanFirst, i - 1, matched_.testBit(spanFirst), incomplete_.testBit(spanFirst));
+            spanFirst = -1;
+        }
 
-        html += (QChar(text[i]).isSpace() ? QString("&nbsp;") : QString(text[i])); // add character itself
+        if (changed && (spanFirst < 0))
+            spanFirst = i;
     }
 
-    setHtml(html);
+    editCursor.endEditBlock();
+    highlighting_ = false;
 }
 
 void XMETAreaEdit::mouseMoveEvent(QMouseEvent *event)
@@ -166,30 +210,45 @@ bool XMETAreaEdit::update()
 {
     const QString text = toPlainText();
 
-    // update FIR from expression
-    fir_ = mgp::FIR::instance().firFromText(text);
-
-    // update filters from expression
-    QList<QPair<int, int> > matchedRanges;
-    QList<QPair<QPair<int, int>, QString> > incompleteRanges;
-    filters_ = mgp::filtersFromXmetExpr(text, &matchedRanges, &incompleteRanges, wiExclusive_, wiOnly_, wiKeywordImplicit_);
-
-    // update highlighting from matched and incomplete ranges
-
-    QTextCursor cursor(textCursor());
-    const int cursorPos = cursor.position();
-    blockSignals(true);
-
-    resetHighlighting();
-    for (int i = 0; i < matchedRanges.size(); ++i)
-        addMatchedRange(matchedRanges.at(i));
-    for (int i = 0; i < incompleteRanges.size(); ++i)
-        addIncompleteRange(incompleteRanges.at(i).first, incompleteRanges.at(i).second);
-    showHighlighting();
-
-    blockSignals(false);
-    cursor.setPosition(cursorPos);
-    setTextCursor(cursor);
+    if (!(updated_ && (changedFirst_ < 0) && (changedSizeDelta_ == 0))) {
+        // update FIR from expression
+        fir_ = mgp::FIR::instance().firFromText(text);
+
+        // update filters from expression
+        QList<QPair<int, int> > matchedRanges;
+        QList<QPair<QPair<int, int>, QString> > incompleteRanges;
+        filters_ = mgp::filtersFromXmetExpr(text, &matchedRanges, &incompleteRanges, wiExclusive_, wiOnly_, wiKeywordImplicit_);
+
+        // reuse the filters whose expressions are unchanged since the last update (the first matched ranges correspond to the filters)
+        QHash<QString, mgp::Filter> filterFromExpr;
+        for (int i = 0; i < filters_->size(); ++i) {
+            const QString expr = text.mid(matchedRanges.at(i).first, matchedRanges.at(i).second - matchedRanges.at(i).first + 1);
+            const mgp::Filter prevFilter = filterFromExpr_.value(expr);
+            if (prevFilter && (prevFilter->type() == filters_->at(i)->type()))
+                (*filters_)[i] = prevFilter;
+            filterFromExpr.insert(expr, filters_->at(i));
+        }
+        filterFromExpr_ = filterFromExpr;
+
+        // update highlighting from matched and incomplete ranges
+        const QBitArray prevMatched = matched_;
+        const QBitArray prevIncomplete = incomplete_;
+        matched_ = QBitArray(text.size(), false);
+        incomplete_ = QBitArray(text.size(), false);
+        reason_.clear();
+        for (int i = 0; i < matchedRanges.size(); ++i)
+            addMatchedRange(matchedRanges.at(i));
+        for (int i = 0; i < incompleteRanges.size(); ++i)
+            addIncompleteRange(incompleteRanges.at(i).first, incompleteRanges.at(i).second);
+
+        blockSignals(true);
+        showHighlighting(prevMatched, prevIncomplete);
+        blockSignals(false);
+
+        updated_ = true;
+        changedFirst_ = changedLast_ = -1;
+        changedSizeDelta_ = 0;
+    }
 
     // return true iff at least one non-whitespace character is found outside any matched range
     for (int i = 0; i < matched_.size(); ++i)
@@ -213,6 +272,7 @@ mgp::FIR::Code XMETAreaEdit::fir()
 void XMETAreaEdit::setWIExclusive(bool on)
 {
     wiExclusive_ = on;
+    invalidate();
 }
 
 bool XMETAreaEdit::wiExclusive() const
@@ -223,6 +283,7 @@ bool XMETAreaEdit::wiExclusive() const
 void XMETAreaEdit::setWIOnly(bool on)
 {
     wiOnly_ = on;
+    invalidate();
 }
 
 bool XMETAreaEdit::wiOnly() const
@@ -233,6 +294,7 @@ bool XMETAreaEdit::wiOnly() const
 void XMETAreaEdit::setWIKeywordImplicit(bool on)
 {
     wiKeywordImplicit_ = on;
+    invalidate();
 }
 
 bool XMETAreaEdit::wiKeywordImplicit() const
@@ -30,7 +30,8 @@ public:
 //    XMETAreaEdit(const QString &text, QWidget *parent = 0, bool wiExclusive = true, bool wiOnly = false, bool wiKeywordImplicit = false);
 
     /**
-     * Updates filters and highlighting.
+     * Updates filters and highlighting. Only the characters that were edited or whose highlighting changed since the last update are
+     * re-highlighted, and filters whose expressions are unchanged are reused. Nothing is done if the text is unchanged.
      * \return True iff each non-whitespace character is part of a matched range.
      */
     bool update();
@@ -85,19 +86,27 @@ private:
     virtual void mousePressEvent(QMouseEvent *);
     virtual void contextMenuEvent(QContextMenuEvent *);
 
-    void resetHighlighting();
+    void invalidate();
     void addMatchedRange(const QPair<int, int> &);
     void addIncompleteRange(const QPair<int, int> &, const QString &);
-    void showHighlighting();
+    void showHighlighting(const QBitArray &prevMatched, const QBitArray &prevIncomplete);
+    void setHighlighting(int first, int last, bool match, bool incom);
     QBitArray matched_;
     QBitArray incomplete_;
     QHash<int, QString> reason_;
     mgp::Filters filters_;
+    QHash<QString, mgp::Filter> filterFromExpr_; // filters of the last update keyed on their expressions
     mgp::FIR::Code fir_;
     bool wiExclusive_;
     bool wiOnly_;
     bool wiKeywordImplicit_;
 
+    bool updated_; // whether the state reflects the current text and modes (apart from the changed range below)
+    int changedFirst_; // first character changed since the last update (-1 if none)
+    int changedLast_; // last character changed since the last update
+    int changedSizeDelta_; // change in text size since the last update
+    bool highlighting_; // whether the highlighting is currently being changed
+
 protected:
     QAction *dialogEditAction_;
     XMETAreaEditDialog *xmetAreaEditDialog_;
@@ -105,6 +114,7 @@ protected:
 
 private slots:
     void editInDialog();
+    void contentsChange(int, int, int);
 };
 
 #endif // XMETAREAEDIT_H
@@ -1,3 +1,3 @@
 TEMPLATE = subdirs
-SUBDIRS = lib apps tests
+SUBDIRS = tools lib apps tests benchmarks
 CONFIG += ordered
@@ -1,5 +1,12 @@
 #include "testmgp.h"
 #include "mgpmath.h"
+#include "polybin.h"
+#include "kml.h"
+#include "polygonstore.h"
+#include "polygongenerator.h"
+#include "tracing.h"
+#include "xmetareaedit.h"
+#include <QTextCursor>
 
 Q_DECLARE_METATYPE(mgp::Point)
 Q_DECLARE_METATYPE(mgp::Polygon)
@@ -202,4 +209,863 @@ void TestMgp::applyFiltersOverload()
     QVERIFY((inside && (nInsides > 0)) || ((!inside) && (nInsides == 0)));
 }
 
+// Returns a polygon with vertices at the corners of a lon/lat rectangle (degrees).
+static mgp::Polygon rectangle(double lon1, double lat1, double lon2, double lat2)
+{
+    mgp::Polygon polygon(new QVector<mgp::Point>());
+    polygon->append(qMakePair(DEG2RAD(lon1), DEG2RAD(lat1)));
+    polygon->append(qMakePair(DEG2RAD(lon1), DEG2RAD(lat2)));
+    polygon->append(qMakePair(DEG2RAD(lon2), DEG2RAD(lat2)));
+    polygon->append(qMakePair(DEG2RAD(lon2), DEG2RAD(lat1)));
+    return polygon;
+}
+
+void TestMgp::intersectedPolygons_data()
+{
+    QTest::addColumn<mgp::Polygons>("intersectables");
+    QTest::addColumn<mgp::Polygons>("intersectors");
+    QTest::addColumn<QList<int> >("expectedIndexes");
+
+    mgp::Polygons intersectables(new QVector<mgp::Polygon>());
+    intersectables->append(rectangle(179, 60, -179, 62)); // across the antimeridian
+    intersectables->append(rectangle(0, 60, 2, 62));
+    intersectables->append(rectangle(10, 60, 12, 62));
+    intersectables->append(rectangle(1, 61, 11, 63)); // overlaps the previous two
+
+    mgp::Polygons intersectors1(new QVector<mgp::Polygon>());
+    intersectors1->append(rectangle(179.5, 60.5, -179.5, 61.5));
+
+    mgp::Polygons intersectors2(new QVector<mgp::Polygon>());
+    intersectors2->append(rectangle(0.5, 60.5, 1.5, 61.5));
+    intersectors2->append(rectangle(10.5, 60.5, 11.5, 61.5));
+
+    mgp::Polygons intersectors3(new QVector<mgp::Polygon>());
+    intersectors3->append(rectangle(100, 10, 101, 11));
+
+    QTest::newRow("antimeridian") << intersectables << intersectors1 << (QList<int>() << 0);
+    QTest::newRow("two intersectors") << intersectables << intersectors2 << (QList<int>() << 1 << 2 << 3);
+    QTest::newRow("far away") << intersectables << intersectors3 << QList<int>();
+}
+
+void TestMgp::intersectedPolygons()
+{
+    QFETCH(mgp::Polygons, intersectables);
+    QFETCH(mgp::Polygons, intersectors);
+    QFETCH(QList<int>, expectedIndexes);
+
+    mgp::setIntersectablePolygons(intersectables);
+    const QList<QPair<int, mgp::Polygons> > result = mgp::intersectedPolygons(intersectors);
+    QCOMPARE(result.size(), expectedIndexes.size());
+    for (int i = 0; i < result.size(); ++i) {
+        QCOMPARE(result.at(i).first, expectedIndexes.at(i));
+        QVERIFY(!empty(result.at(i).second));
+    }
+    // a separate layer gives the same result regardless of the number of threads, and is unaffected by the global layer
+    const mgp::IntersectionLayer layer(intersectables);
+    mgp::setIntersectablePolygons(mgp::Polygons(new QVector<mgp::Polygon>()));
+    for (int threadCount = 1; threadCount <= 3; ++threadCount) {
+        const QList<QPair<int, mgp::Polygons> > layerResult = layer.intersection(intersectors, threadCount);
+        QCOMPARE(layerResult.size(), result.size());
+        for (int i = 0; i < layerResult.size(); ++i) {
+            QCOMPARE(layerResult.at(i).first, result.at(i).first);
+            QVERIFY(equal(layerResult.at(i).second, result.at(i).second));
+        }
+    }
+}
+
+void TestMgp::applyFiltersPrepared_data()
+{
+    QTest::addColumn<mgp::Polygon>("polygon");
+    QTest::addColumn<mgp::Filters>("filters");
+
+    mgp::Filters filters1(new QList<mgp::Filter>());
+    filters1->append(mgp::Filter(new mgp::WithinFilter(rectangle(1, 61, 11, 63))));
+
+    mgp::Filters filters2(new QList<mgp::Filter>());
+    filters2->append(mgp::Filter(new mgp::NOfFilter(DEG2RAD(61))));
+    filters2->append(mgp::Filter(new mgp::WithinFilter(rectangle(1, 61, 11, 63))));
+
+    QTest::newRow("WI") << rectangle(0, 60, 10, 62) << filters1;
+    QTest::newRow("N_OF WI") << rectangle(0, 60, 10, 62) << filters2;
+    QTest::newRow("WI disjoint") << rectangle(100, 10, 101, 11) << filters1;
+}
+
+void TestMgp::applyFiltersPrepared()
+{
+    QFETCH(mgp::Polygon, polygon);
+    QFETCH(mgp::Filters, filters);
+
+    const mgp::math::PreparedPolygon prepared(polygon);
+    QVERIFY(prepared.isPreparedFrom(polygon));
+    QVERIFY(equal(mgp::applyFilters(prepared, filters), mgp::applyFilters(polygon, filters)));
+
+    const mgp::Point center = qMakePair(DEG2RAD(5), DEG2RAD(61));
+    QCOMPARE(mgp::math::pointInPolygon(center, prepared), mgp::math::pointInPolygon(center, polygon));
+}
+
+void TestMgp::edgeIntersections_data()
+{
+    QTest::addColumn<mgp::Polygon>("subject");
+    QTest::addColumn<mgp::Polygon>("clip");
+    QTest::addColumn<bool>("intersecting");
+
+    mgp::PolygonGenerator generator(3);
+    const mgp::Point north = qMakePair(DEG2RAD(10.0), DEG2RAD(65.0));
+    const mgp::Point antimeridian = qMakePair(DEG2RAD(180.0), DEG2RAD(0.0));
+    const mgp::Point pole = qMakePair(DEG2RAD(0.0), DEG2RAD(89.5));
+
+    QTest::newRow("FIR") << mgp::FIR::instance().polygon(mgp::FIR::ENOR) << generator.randomPolygon(50, north, 500, 0.5) << true;
+    QTest::newRow("overlapping") << generator.randomPolygon(200, north, 400, 0.5)
+                                 << generator.randomPolygon(200, qMakePair(DEG2RAD(13.0), DEG2RAD(66.0)), 400, 0.5) << true;
+    QTest::newRow("antimeridian") << generator.randomPolygon(100, antimeridian, 300, 0.5)
+                                  << generator.randomPolygon(100, qMakePair(DEG2RAD(-178.0), DEG2RAD(1.0)), 300, 0.5) << true;
+    QTest::newRow("around pole") << generator.randomPolygon(100, pole, 200, 0.5)
+                                 << generator.randomPolygon(100, qMakePair(DEG2RAD(90.0), DEG2RAD(88.5)), 200, 0.5) << true;
+    QTest::newRow("disjoint") << generator.randomPolygon(50, north, 100, 0.5) << generator.randomPolygon(50, antimeridian, 100, 0.5)
+                              << false;
+}
+
+void TestMgp::edgeIntersections()
+{
+    QFETCH(mgp::Polygon, subject);
+    QFETCH(mgp::Polygon, clip);
+    QFETCH(bool, intersecting);
+
+    const mgp::math::PreparedPolygon S(subject);
+    const mgp::math::PreparedPolygon C(clip);
+    int edgeTests = -1;
+    const QVector<mgp::math::EdgeIntersection> iscts = mgp::math::edgeIntersections(S, C, &edgeTests);
+    QVERIFY((edgeTests >= iscts.size()) && (edgeTests <= (S.size() * C.size())));
+
+    // the candidate edge pairs must give the same intersections in the same order as testing all edge pairs
+    QVector<mgp::math::EdgeIntersection> expected;
+    for (int s = 0; s < S.size(); ++s) {
+        for (int c = 0; c < C.size(); ++c) {
+            mgp::Point isctPoint;
+            if (mgp::math::greatCircleArcsIntersect(
+                        S.vertex(s), S.vertex((s + 1) % S.size()), S.normal(s),
+                        C.vertex(c), C.vertex((c + 1) % C.size()), C.normal(c), &isctPoint))
+                expected.append(mgp::math::EdgeIntersection(s, c, isctPoint));
+        }
+    }
+    QCOMPARE(iscts.size(), expected.size());
+    QCOMPARE(!iscts.isEmpty(), intersecting);
+    for (int i = 0; i < iscts.size(); ++i) {
+        QCOMPARE(iscts.at(i).s, expected.at(i).s);
+        QCOMPARE(iscts.at(i).c, expected.at(i).c);
+        QCOMPARE(iscts.at(i).point, expected.at(i).point);
+    }
+}
+
+void TestMgp::pointsInPolygon_data()
+{
+    QTest::addColumn<mgp::Polygon>("polygon");
+
+    mgp::Polygon triangle(new QVector<mgp::Point>());
+    triangle->append(qMakePair(DEG2RAD(0), DEG2RAD(60)));
+    triangle->append(qMakePair(DEG2RAD(10), DEG2RAD(60)));
+    triangle->append(qMakePair(DEG2RAD(5), DEG2RAD(70)));
+
+    QTest::newRow("rectangle") << rectangle(1, 61, 11, 63);
+    QTest::newRow("triangle") << triangle;
+    QTest::newRow("ENOR FIR") << mgp::FIR::instance().polygon(mgp::FIR::ENOR);
+}
+
+void TestMgp::pointsInPolygon()
+{
+    QFETCH(mgp::Polygon, polygon);
+
+    QVector<mgp::Point> points;
+    for (int i = 0; i <= 40; ++i)
+        for (int j = 0; j <= 30; ++j)
+            points.append(qMakePair(DEG2RAD(-10 + i), DEG2RAD(55 + j)));
+
+    const mgp::math::PreparedPolygon prepared(polygon);
+    const QBitArray inside = mgp::math::pointsInPolygon(points, prepared);
+    QCOMPARE(inside.size(), points.size());
+    for (int i = 0; i < points.size(); ++i)
+        QCOMPARE(inside.testBit(i), mgp::math::pointInPolygon(points.at(i), polygon));
+}
+
+void TestMgp::pointInPolygonIndex_data()
+{
+    QTest::addColumn<mgp::Polygon>("polygon");
+    QTest::addColumn<bool>("gridded");
+
+    QTest::newRow("rectangle") << rectangle(1, 61, 11, 63) << true;
+    QTest::newRow("across the antimeridian") << rectangle(179, 60, -179, 62) << true;
+    QTest::newRow("ENOR FIR") << mgp::FIR::instance().polygon(mgp::FIR::ENOR) << true;
+    QTest::newRow("near the pole") << rectangle(0, 80, 10, 85) << false;
+}
+
+void TestMgp::pointInPolygonIndex()
+{
+    QFETCH(mgp::Polygon, polygon);
+    QFETCH(bool, gridded);
+
+    const mgp::math::PointInPolygonIndex index((mgp::math::PreparedPolygon(polygon)));
+    QCOMPARE(index.isGridded(), gridded);
+    // (the points are kept off the rectangle edges, where the results may legitimately differ)
+    for (int i = 0; i < 720; ++i) {
+        for (int j = 0; j < 72; ++j) {
+            const mgp::Point point = qMakePair(DEG2RAD(-179.75 + 0.5 * i), DEG2RAD(50.25 + 0.5 * j));
+            QCOMPARE(index.contains(point), mgp::math::pointInPolygon(point, polygon));
+        }
+    }
+}
+
+void TestMgp::area_data()
+{
+    QTest::addColumn<mgp::Polygon>("polygon");
+    QTest::addColumn<double>("expectedArea");
+    QTest::addColumn<double>("tolerance");
+
+    const double earthArea = 4 * M_PI * mgp::earthRadius * mgp::earthRadius;
+
+    mgp::Polygon octant(new QVector<mgp::Point>());
+    octant->append(qMakePair(DEG2RAD(0), DEG2RAD(0)));
+    octant->append(qMakePair(DEG2RAD(90), DEG2RAD(0)));
+    octant->append(qMakePair(DEG2RAD(0), DEG2RAD(90)));
+
+    QTest::newRow("octant") << octant << (earthArea / 8) << 1e-6;
+    QTest::newRow("octant reversed") << mgp::math::reversed(octant) << (earthArea / 8) << 1e-6;
+    QTest::newRow("1 x 1 degrees at equator") << rectangle(10, 0, 11, 1) << (111.19 * 111.19) << 1e-3;
+    QTest::newRow("empty") << mgp::Polygon(new QVector<mgp::Point>()) << 0.0 << 0.0;
+}
+
+void TestMgp::area()
+{
+    QFETCH(mgp::Polygon, polygon);
+    QFETCH(double, expectedArea);
+    QFETCH(double, tolerance);
+
+    QVERIFY(qAbs(mgp::area(polygon) - expectedArea) <= (tolerance * expectedArea));
+
+    mgp::Polygons polygons(new QVector<mgp::Polygon>());
+    polygons->append(polygon);
+    polygons->append(polygon);
+    const QVector<double> areas = mgp::areas(polygons);
+    QCOMPARE(areas.size(), 2);
+    QCOMPARE(areas.at(0), mgp::area(polygon));
+    QCOMPARE(mgp::area(polygons), areas.at(0) + areas.at(1));
+}
+
+// Returns a polygon with vertices at lon/lat pairs (degrees).
+static mgp::Polygon polygonFromDegrees(const double (*lonLat)[2], int size)
+{
+    mgp::Polygon polygon(new QVector<mgp::Point>());
+    for (int i = 0; i < size; ++i)
+        polygon->append(qMakePair(DEG2RAD(lonLat[i][0]), DEG2RAD(lonLat[i][1])));
+    return polygon;
+}
+
+// Reference implementation of mgp::math::removeInvalidVertices(): repeatedly removes the first invalid vertex and scans the
+// polygon again from the start.
+static mgp::Polygon removeInvalidVerticesByRescanning(const mgp::Polygon &polygon, double minDegrees)
+{
+    mgp::Polygon result(new QVector<mgp::Point>(*polygon));
+    while (result->size() >= 3) {
+        const int n = result->size();
+        int invalidIndex = -1;
+        for (int i = 0; (i < n) && (invalidIndex == -1); ++i) {
+            const mgp::Point &p = result->at(i);
+            const mgp::Point &prev = result->at((i - 1 + n) % n);
+            const mgp::Point &next = result->at((i + 1) % n);
+            bool validComp = true;
+            if ((p == prev) || (p == next) || (mgp::math::Math::angle(p, prev, next, &validComp) < DEG2RAD(minDegrees))
+                    || (!validComp))
+                invalidIndex = i;
+        }
+        if (invalidIndex == -1)
+            return result;
+        result->remove(invalidIndex);
+    }
+    return mgp::Polygon();
+}
+
+void TestMgp::removeInvalidVertices_data()
+{
+    QTest::addColumn<mgp::Polygon>("polygon");
+    QTest::addColumn<double>("minDegrees");
+    QTest::addColumn<int>("expectedSize"); // -1 for a null polygon, or 0 to only compare with the reference implementation
+
+    const double duplicate[][2] = { { 0, 60 }, { 0, 62 }, { 0, 62 }, { 10, 62 }, { 10, 60 } };
+    // spikes with staggered sides, so that removing the tip makes a neighbour sharp, and so on
+    const double spike[][2] = { { 0, 60 }, { 0, 62 }, { 4, 62 }, { 4.99, 64 }, { 5, 68 }, { 5.01, 66 }, { 5.02, 63 }, { 6, 62 },
+                                { 10, 62 }, { 10, 60 } };
+    const double longSpike[][2] = { { 0, 60 }, { 0, 62 }, { 4, 62 }, { 4.97, 63 }, { 4.98, 65 }, { 4.99, 67 }, { 5, 68 },
+                                    { 5.01, 66 }, { 5.02, 64 }, { 6, 62 }, { 10, 62 }, { 10, 60 } };
+    const double longSpikeAtStart[][2] = { { 5.01, 66 }, { 5.02, 64 }, { 6, 62 }, { 10, 62 }, { 10, 60 }, { 0, 60 }, { 0, 62 },
+                                           { 4, 62 }, { 4.97, 63 }, { 4.98, 65 }, { 4.99, 67 }, { 5, 68 } };
+    const double thinTriangle[][2] = { { 0, 60 }, { 0.01, 65 }, { 0.02, 60 } };
+    const double needle[][2] = { { 0, 60 }, { 0.01, 62 }, { 0.02, 64 }, { 0.03, 66 }, { 0.02, 63 }, { 0.01, 61 } };
+
+    QTest::newRow("valid") << rectangle(0, 60, 10, 62) << 5.0 << 4;
+    QTest::newRow("coinciding neighbours") << polygonFromDegrees(duplicate, 5) << 5.0 << 4;
+    QTest::newRow("cascading spike") << polygonFromDegrees(spike, 10) << 5.0 << 8;
+    QTest::newRow("long cascading spike") << polygonFromDegrees(longSpike, 12) << 5.0 << 8;
+    QTest::newRow("cascade across start") << polygonFromDegrees(longSpikeAtStart, 12) << 5.0 << 8;
+    QTest::newRow("thin triangle") << polygonFromDegrees(thinTriangle, 3) << 5.0 << -1;
+    QTest::newRow("collapsing needle") << polygonFromDegrees(needle, 6) << 5.0 << -1;
+
+    // strongly concave random polygons, where many vertices are removed
+    mgp::PolygonGenerator generator(1);
+    const mgp::Polygon random = generator.randomPolygon(200, qMakePair(DEG2RAD(10.0), DEG2RAD(65.0)), 300, 0.9);
+    QTest::newRow("random 5") << random << 5.0 << 0;
+    QTest::newRow("random 30") << random << 30.0 << 0;
+    QTest::newRow("random 60") << random << 60.0 << 0;
+    QTest::newRow("random antimeridian")
+            << generator.randomPolygon(100, qMakePair(DEG2RAD(179.9), DEG2RAD(0.0)), 300, 0.9) << 45.0 << 0;
+    QTest::newRow("random near pole")
+            << generator.randomPolygon(100, qMakePair(DEG2RAD(0.0), DEG2RAD(89.0)), 300, 0.9) << 45.0 << 0;
+}
+
+void TestMgp::removeInvalidVertices()
+{
+    QFETCH(mgp::Polygon, polygon);
+    QFETCH(double, minDegrees);
+    QFETCH(int, expectedSize);
+
+    const mgp::Polygon result = mgp::math::removeInvalidVertices(polygon, minDegrees);
+    const mgp::Polygon expected = removeInvalidVerticesByRescanning(polygon, minDegrees);
+    QCOMPARE(bool(result), bool(expected));
+    if (expected)
+        QCOMPARE(*result, *expected);
+    if (expectedSize != 0)
+        QCOMPARE(result ? result->size() : -1, expectedSize);
+}
+
+void TestMgp::filterChain_data()
+{
+    QTest::addColumn<mgp::Polygon>("polygon");
+    QTest::addColumn<QString>("expr");
+
+    QTest::newRow("N_OF E_OF") << mgp::FIR::instance().polygon(mgp::FIR::ENOR) << QString("N OF N6500 AND E OF E01000");
+    QTest::newRow("S_OF_LINE N_OF") << mgp::FIR::instance().polygon(mgp::FIR::ENOR)
+                                    << QString("S OF LINE N6000 E00000 - N7000 E02000 AND N OF N6200");
+    QTest::newRow("E_OF W_OF S_OF") << mgp::FIR::instance().polygon(mgp::FIR::ENOR) << QString("E OF W03000 AND W OF E04000 AND S OF N8500");
+    QTest::newRow("uniformly rejected") << rectangle(0, 60, 10, 62) << QString("N OF N7000 AND E OF E00500");
+}
+
+void TestMgp::filterChain()
+{
+    QFETCH(mgp::Polygon, polygon);
+    QFETCH(QString, expr);
+
+    QList<QPair<int, int> > matchedRanges;
+    QList<QPair<QPair<int, int>, QString> > incompleteRanges;
+    const mgp::Filters filters = mgp::filtersFromXmetExpr(expr, &matchedRanges, &incompleteRanges, false, false);
+    QVERIFY(incompleteRanges.isEmpty());
+
+    // apply the filters one by one
+    mgp::Polygons expected(new QVector<mgp::Polygon>());
+    expected->append(polygon);
+    for (int i = 0; i < filters->size(); ++i) {
+        mgp::Polygons next(new QVector<mgp::Polygon>());
+        for (int j = 0; j < expected->size(); ++j) {
+            const mgp::Polygons outPolys = filters->at(i)->apply(expected->at(j));
+            if (outPolys)
+                *next += *outPolys;
+        }
+        expected = next;
+    }
+
+    QVERIFY(equal(mgp::FilterChain(filters).apply(mgp::Polygons(new QVector<mgp::Polygon>(1, polygon))),
+                  mgp::math::removeInvalidVertices(expected)));
+}
+
+void TestMgp::applyFiltersInParallel_data()
+{
+    QTest::addColumn<mgp::Filters>("filters");
+    QTest::addColumn<int>("threadCount");
+
+    mgp::Filters filters(new QList<mgp::Filter>());
+    filters->append(mgp::Filter(new mgp::NOfFilter(DEG2RAD(61))));
+    filters->append(mgp::Filter(new mgp::WithinFilter(mgp::FIR::instance().polygon(mgp::FIR::ENOR))));
+
+    QTest::newRow("1 thread") << filters << 1;
+    QTest::newRow("3 threads") << filters << 3;
+    QTest::newRow("ideal thread count") << filters << 0;
+}
+
+void TestMgp::applyFiltersInParallel()
+{
+    QFETCH(mgp::Filters, filters);
+    QFETCH(int, threadCount);
+
+    mgp::Polygons polygons(new QVector<mgp::Polygon>());
+    for (int i = 0; i < 10; ++i)
+        for (int j = 0; j < 10; ++j)
+            polygons->append(rectangle(i * 3 - 5, j * 2 + 55, i * 3 - 2, j * 2 + 56));
+
+    QVERIFY(equal(mgp::applyFiltersInParallel(polygons, filters, threadCount), mgp::applyFilters(polygons, filters)));
+}
+
+void TestMgp::filtersFromXmetExpr_data()
+{
+    QTest::addColumn<QString>("expr");
+    QTest::addColumn<QList<int> >("expectedMatched"); // (lo, hi) pairs
+    QTest::addColumn<QList<int> >("expectedIncomplete"); // (lo, hi) pairs
+
+    QTest::newRow("E_OF AND N_OF") << QString("E OF E01000 AND N OF N6000")
+                                   << (QList<int>() << 0 << 10 << 16 << 25 << 11 << 15) << QList<int>();
+    QTest::newRow("WI too few points") << QString("WI N6000 E01000 - N6100 E01100")
+                                       << QList<int>() << (QList<int>() << 0 << 29);
+    QTest::newRow("missing AND") << QString("S OF LINE N6000 E00000 - N7000 E02000 N OF N6200")
+                                 << (QList<int>() << 38 << 47) << (QList<int>() << 0 << 36);
+    QTest::newRow("incomplete line") << QString("E OF LINE N6000")
+                                     << QList<int>() << (QList<int>() << 0 << 3 << 0 << 8);
+}
+
+void TestMgp::filtersFromXmetExpr()
+{
+    QFETCH(QString, expr);
+    QFETCH(QList<int>, expectedMatched);
+    QFETCH(QList<int>, expectedIncomplete);
+
+    QList<QPair<int, int> > matchedRanges;
+    QList<QPair<QPair<int, int>, QString> > incompleteRanges;
+    const mgp::Filters filters = mgp::filtersFromXmetExpr(expr, &matchedRanges, &incompleteRanges, true, false);
+
+    QCOMPARE(matchedRanges.size() * 2, expectedMatched.size());
+    for (int i = 0; i < matchedRanges.size(); ++i) {
+        QCOMPARE(matchedRanges.at(i).first, expectedMatched.at(2 * i));
+        QCOMPARE(matchedRanges.at(i).second, expectedMatched.at(2 * i + 1));
+    }
+    QCOMPARE(incompleteRanges.size() * 2, expectedIncomplete.size());
+    for (int i = 0; i < incompleteRanges.size(); ++i) {
+        QCOMPARE(incompleteRanges.at(i).first.first, expectedIncomplete.at(2 * i));
+        QCOMPARE(incompleteRanges.at(i).first.second, expectedIncomplete.at(2 * i + 1));
+    }
+
+    // the ranges are optional
+    QCOMPARE(mgp::filtersFromXmetExpr(expr, 0, 0, true, false)->size(), filters->size());
+}
+
+void TestMgp::filterResultCache_data()
+{
+    QTest::addColumn<mgp::Polygon>("polygon");
+    QTest::addColumn<QString>("expr");
+    QTest::addColumn<bool>("degenerate");
+
+    QTest::newRow("FIR") << mgp::FIR::instance().polygon(mgp::FIR::ENOR) << QString("N OF N6500 AND E OF E01000") << false;
+
+    // a polygon with a thin spike just crossing E01300, so that the filter result includes a sliver that removeInvalidVertices()
+    // turns into a null polygon
+    const double coords[][2] = {
+        { 10, 60 }, { 10, 61.5 }, { 12.99, 61.5 }, { 13.01, 61.25 }, { 12.99, 61 }, { 12, 61 }, { 12, 60.5 }, { 14, 60.5 }, { 14, 60 }
+    };
+    mgp::Polygon spike(new QVector<mgp::Point>());
+    for (int i = 0; i < 9; ++i)
+        spike->append(qMakePair(DEG2RAD(coords[i][0]), DEG2RAD(coords[i][1])));
+    QTest::newRow("degenerate piece") << spike << QString("E OF E01300") << true;
+}
+
+void TestMgp::filterResultCache()
+{
+    QFETCH(mgp::Polygon, polygon);
+    QFETCH(QString, expr);
+    QFETCH(bool, degenerate);
+
+    mgp::FilterResultCache cache;
+    const mgp::Filters filters = mgp::filtersFromXmetExpr(expr, 0, 0, true, false);
+    const mgp::Polygons expected = mgp::applyFilters(polygon, filters);
+    QVERIFY(!empty(expected));
+    QCOMPARE(expected->contains(mgp::Polygon()), degenerate);
+
+    QVERIFY(equal(cache.applyFilters("key", polygon, filters), expected));
+    QCOMPARE(cache.misses(), qint64(1));
+    const mgp::Polygons cached = cache.applyFilters("key", polygon, filters);
+    QVERIFY(equal(cached, expected));
+    QCOMPARE(cached->size(), expected->size());
+    QCOMPARE(cache.hits(), qint64(1));
+    QCOMPARE(cache.count(), 1);
+    QVERIFY(cache.bytes() > 0);
+
+    // a filter value that differs by less than the resolution of the canonical expression is not a hit
+    mgp::Filters filters2(new QList<mgp::Filter>());
+    filters2->append(mgp::Filter(new mgp::NOfFilter(DEG2RAD(60.001))));
+    filters2->append(mgp::Filter(new mgp::EOfFilter(DEG2RAD(10))));
+    QVERIFY(equal(cache.applyFilters("key", polygon, filters2), mgp::applyFilters(polygon, filters2)));
+    QCOMPARE(cache.misses(), qint64(2));
+
+    // a FIR is keyed on its code
+    QVERIFY(equal(cache.applyFilters(mgp::FIR::ENOR, filters),
+                  mgp::applyFilters(mgp::FIR::instance().polygon(mgp::FIR::ENOR), filters)));
+    QCOMPARE(cache.misses(), qint64(3));
+
+    // the least recently used results are evicted when the size limit is lowered
+    cache.setMaxBytes(cache.bytes() - 1);
+    QVERIFY(cache.count() < 3);
+    cache.clear();
+    QCOMPARE(cache.count(), 0);
+    QCOMPARE(cache.hits(), qint64(0));
+}
+
+// Replaces the characters [pos, pos + removed) of an XMETAreaEdit with inserted.
+static void editText(XMETAreaEdit *edit, int pos, int removed, const QString &inserted)
+{
+    QTextCursor cursor(edit->document());
+    cursor.setPosition(pos);
+    cursor.setPosition(pos + removed, QTextCursor::KeepAnchor);
+    if (inserted.isEmpty())
+        cursor.removeSelectedText();
+    else
+        cursor.insertText(inserted);
+}
+
+// Returns the result of update(), the canonical expression of the filters and the colors of each character (apart from line
+// breaks) of an XMETAreaEdit.
+static QStringList xmetAreaEditState(XMETAreaEdit *edit)
+{
+    QStringList state;
+    state.append(edit->update() ? "matched" : "unmatched");
+    state.append(mgp::xmetExprFromFilters(edit->filters()));
+
+    const QString text = edit->toPlainText();
+    QTextCursor cursor(edit->document());
+    for (int i = 0; i < text.size(); ++i) {
+        if (text.at(i) == QLatin1Char('\n'))
+            continue;
+        cursor.setPosition(i + 1); // (the format of the character before the cursor)
+        const QTextCharFormat format = cursor.charFormat();
+        state.append(QString("%1: %2 %3").arg(i).arg(format.foreground().color().name()).arg(format.background().color().name()));
+    }
+    return state;
+}
+
+// Returns the state of an XMETAreaEdit freshly constructed with the same text and modes as another one.
+static QStringList freshXmetAreaEditState(XMETAreaEdit *edit)
+{
+    XMETAreaEdit fresh(edit->toPlainText(), 0, edit->wiExclusive(), edit->wiOnly(), edit->wiKeywordImplicit());
+    return xmetAreaEditState(&fresh);
+}
+
+void TestMgp::xmetAreaEdit_data()
+{
+    QTest::addColumn<QString>("text");
+    QTest::addColumn<QList<int> >("edits"); // (position, number of characters removed) pairs
+    QTest::addColumn<QStringList>("inserted"); // characters inserted by each edit
+
+    const QString text("E OF E01000 AND N OF N6000");
+    QTest::newRow("insert before") << text << (QList<int>() << 0 << 0) << (QStringList() << "W ");
+    QTest::newRow("insert inside") << text << (QList<int>() << 7 << 0) << (QStringList() << "5");
+    QTest::newRow("insert after") << text << (QList<int>() << 26 << 0) << (QStringList() << " AND S OF N7000");
+    QTest::newRow("delete before") << QString("XX E OF E01000") << (QList<int>() << 0 << 3) << (QStringList() << "");
+    QTest::newRow("delete inside") << text << (QList<int>() << 12 << 4) << (QStringList() << "");
+    QTest::newRow("delete after") << QString("E OF E01000 XX") << (QList<int>() << 11 << 3) << (QStringList() << "");
+    QTest::newRow("replace before") << QString("XX E OF E01000") << (QList<int>() << 0 << 2) << (QStringList() << "N OF N6000 AND");
+    QTest::newRow("replace inside") << text << (QList<int>() << 5 << 6) << (QStringList() << "W00500");
+    QTest::newRow("replace after") << QString("E OF E01000 XX") << (QList<int>() << 12 << 2) << (QStringList() << "AND N OF N6000");
+    QTest::newRow("replace across ranges") << text << (QList<int>() << 8 << 12) << (QStringList() << "00 AND S OF");
+    QTest::newRow("multiple edits") << text << (QList<int>() << 26 << 0 << 5 << 6 << 0 << 0)
+                                    << (QStringList() << "\nAND S OF N7000" << "W00500" << "  ");
+    QTest::newRow("multiple lines") << QString("E OF E01000\nAND N OF N6000") << (QList<int>() << 11 << 1 << 0 << 0)
+                                    << (QStringList() << " " << "N OF N5000 AND\n");
+    QTest::newRow("WI") << QString("WI N6000 E01000 - N6100 E01100 - N6100 E00900 - N6000 E01000")
+                        << (QList<int>() << 9 << 6 << 0 << 3) << (QStringList() << "E01200" << "");
+}
+
+void TestMgp::xmetAreaEdit()
+{
+    QFETCH(QString, text);
+    QFETCH(QList<int>, edits);
+    QFETCH(QStringList, inserted);
+
+    // update after each edit
+    XMETAreaEdit edit(text, 0, true, false);
+    QCOMPARE(xmetAreaEditState(&edit), freshXmetAreaEditState(&edit));
+    for (int i = 0; i < inserted.size(); ++i) {
+        editText(&edit, edits.at(2 * i), edits.at(2 * i + 1), inserted.at(i));
+        QCOMPARE(xmetAreaEditState(&edit), freshXmetAreaEditState(&edit));
+    }
+
+    // update once after all the edits
+    XMETAreaEdit edit2(text, 0, true, false);
+    edit2.update();
+    for (int i = 0; i < inserted.size(); ++i)
+        editText(&edit2, edits.at(2 * i), edits.at(2 * i + 1), inserted.at(i));
+    QCOMPARE(xmetAreaEditState(&edit2), xmetAreaEditState(&edit));
+
+    // change the modes
+    edit.setWIOnly(true);
+    QCOMPARE(xmetAreaEditState(&edit), freshXmetAreaEditState(&edit));
+    edit.setWIExclusive(false);
+    QCOMPARE(xmetAreaEditState(&edit), freshXmetAreaEditState(&edit));
+    edit.setWIKeywordImplicit(true);
+    QCOMPARE(xmetAreaEditState(&edit), freshXmetAreaEditState(&edit));
+    edit.setWIOnly(false);
+    QCOMPARE(xmetAreaEditState(&edit), freshXmetAreaEditState(&edit));
+
+    // edit again in the new modes
+    editText(&edit, 0, 0, "WI ");
+    QCOMPARE(xmetAreaEditState(&edit), freshXmetAreaEditState(&edit));
+}
+
+void TestMgp::xmetAreaEditFilterReuse()
+{
+    XMETAreaEdit edit(QString("E OF E01000 AND N OF N6000"), 0, true, false);
+    const mgp::Filters filters = edit.filters();
+    QCOMPARE(filters->size(), 2);
+
+    // an edit outside the filter expressions keeps all the filters
+    editText(&edit, 26, 0, " ");
+    mgp::Filters filters2 = edit.filters();
+    QCOMPARE(filters2->size(), 2);
+    QVERIFY(filters2->at(0) == filters->at(0));
+    QVERIFY(filters2->at(1) == filters->at(1));
+
+    // an edit inside a filter expression replaces that filter only
+    editText(&edit, 21, 5, "N6100");
+    filters2 = edit.filters();
+    QCOMPARE(filters2->size(), 2);
+    QVERIFY(filters2->at(0) == filters->at(0));
+    QVERIFY(filters2->at(1) != filters->at(1));
+
+    // a mode change replaces all the filters
+    edit.setWIExclusive(false);
+    filters2 = edit.filters();
+    QCOMPARE(filters2->size(), 2);
+    QVERIFY(filters2->at(0) != filters->at(0));
+}
+
+void TestMgp::polybin()
+{
+    const mgp::Polygons polygons = mgp::norwegianMunicipalities();
+    QVERIFY(!empty(polygons));
+
+    QString error;
+    const QByteArray data = polybin::polygons2polybin(polygons);
+    QVERIFY(equal(polybin::polybin2polygons(data, &error), polygons));
+    QVERIFY(error.isEmpty());
+
+    // truncated data is rejected
+    QVERIFY(empty(polybin::polybin2polygons(data.left(data.size() - 1), &error)));
+    QVERIFY(!error.isEmpty());
+}
+
+void TestMgp::kml2polygons_data()
+{
+    QTest::addColumn<QByteArray>("kml");
+    QTest::addColumn<int>("polygons");
+    QTest::addColumn<int>("points");
+    QTest::addColumn<bool>("error");
+
+    QTest::newRow("two polygons") << QByteArray(
+        "<kml><Placemark><Polygon><coordinates>5,60 6,60,0\n6,61 5,60</coordinates></Polygon></Placemark>"
+        "<Placemark><Polygon><coordinates>10,70 11,70 11,71</coordinates></Polygon></Placemark></kml>") << 2 << 4 << false;
+    QTest::newRow("empty coordinates") << QByteArray("<kml><coordinates/></kml>") << 1 << 0 << false;
+    QTest::newRow("missing latitude") << QByteArray("<kml><coordinates>5,60 6</coordinates></kml>") << 0 << 0 << true;
+    QTest::newRow("invalid number") << QByteArray("<kml><coordinates>5,6x0</coordinates></kml>") << 0 << 0 << true;
+    QTest::newRow("malformed XML") << QByteArray("<kml><coordinates>5,60</kml>") << 0 << 0 << true;
+}
+
+void TestMgp::kml2polygons()
+{
+    QFETCH(QByteArray, kml);
+    QFETCH(int, polygons);
+    QFETCH(int, points);
+    QFETCH(bool, error);
+
+    QBuffer buffer(&kml);
+    buffer.open(QIODevice::ReadOnly);
+    QString errorString;
+    const mgp::Polygons result = kml::kml2polygons(&buffer, &errorString);
+    QCOMPARE(!errorString.isEmpty(), error);
+    QCOMPARE(result->size(), polygons);
+    if (polygons > 0)
+        QCOMPARE(result->first()->size(), points);
+    if (points > 0)
+        QCOMPARE(result->first()->first(), qMakePair(DEG2RAD(5.0), DEG2RAD(60.0)));
+}
+
+void TestMgp::polygonStore()
+{
+    const mgp::Polygons polygons = mgp::norwegianMunicipalities();
+    QTemporaryFile file;
+    QVERIFY(file.open());
+    QVERIFY(file.write(polybin::polygons2polybin(polygons)) > 0);
+    file.close();
+
+    mgp::PolygonStore store;
+    QString error;
+    QVERIFY(store.open(file.fileName(), &error));
+    QVERIFY(error.isEmpty());
+    QCOMPARE(store.size(), polygons->size());
+    QVERIFY(equal(store.polygons(), polygons));
+
+    // views give the same results as the polygons they were stored from
+    const mgp::Point point = qMakePair(DEG2RAD(10.75), DEG2RAD(59.95)); // Oslo
+    for (int i = 0; i < store.size(); ++i)
+        QCOMPARE(mgp::math::pointInPolygon(point, store.polygon(i)), mgp::math::pointInPolygon(point, polygons->at(i)));
+
+    mgp::Polygons intersectors = mgp::Polygons(new QVector<mgp::Polygon>());
+    intersectors->append(mgp::FIR::instance().polygon(mgp::FIR::ENOR));
+    const QList<QPair<int, mgp::Polygons> > expected = mgp::IntersectionLayer(polygons).intersection(intersectors);
+    const QList<QPair<int, mgp::Polygons> > actual = mgp::IntersectionLayer(store).intersection(intersectors);
+    QCOMPARE(actual.size(), expected.size());
+    for (int i = 0; i < actual.size(); ++i) {
+        QCOMPARE(actual.at(i).first, expected.at(i).first);
+        QVERIFY(equal(actual.at(i).second, expected.at(i).second));
+    }
+}
+
+void TestMgp::firTables()
+{
+    // the geometry generated at build time is the same as when preparing the FIR polygon at run time
+    const mgp::FIR::Code codes[] = { mgp::FIR::ENOR, mgp::FIR::ENOB };
+    for (int c = 0; c < 2; ++c) {
+        const mgp::math::PreparedPolygon &generated = mgp::FIR::instance().preparedPolygon(codes[c]);
+        const mgp::math::PreparedPolygon prepared(mgp::FIR::instance().polygon(codes[c]));
+        QVERIFY(generated.isPreparedFrom(mgp::FIR::instance().polygon(codes[c])));
+        QCOMPARE(generated.size(), prepared.size());
+        for (int i = 0; i < prepared.size(); ++i) {
+            for (int k = 0; k < 3; ++k) {
+                QCOMPARE(generated.vertex(i).get(k), prepared.vertex(i).get(k));
+                QCOMPARE(generated.normal(i).get(k), prepared.normal(i).get(k));
+            }
+        }
+        for (int k = 0; k < 3; ++k)
+            QCOMPARE(generated.capCenter().get(k), prepared.capCenter().get(k));
+        QCOMPARE(generated.capRadius(), prepared.capRadius());
+        QCOMPARE(generated.externalPoint(), prepared.externalPoint());
+    }
+}
+
+void TestMgp::simplifiedPolygon_data()
+{
+    QTest::addColumn<double>("toleranceKm");
+
+    QTest::newRow("0.1 km") << 0.1;
+    QTest::newRow("0.5 km") << 0.5;
+    QTest::newRow("2 km") << 2.0;
+}
+
+void TestMgp::simplifiedPolygon()
+{
+    QFETCH(double, toleranceKm);
+
+    const mgp::Polygon polygon = mgp::FIR::instance().polygon(mgp::FIR::ENOR);
+    const mgp::Polygon simplified = mgp::simplifiedPolygon(polygon, toleranceKm);
+    QVERIFY(simplified->size() >= 3);
+    QVERIFY(simplified->size() < polygon->size());
+
+    // each original vertex is within the tolerance of the simplified polygon
+    for (int i = 0; i < polygon->size(); ++i) {
+        double minDist = M_PI;
+        for (int j = 0; j < simplified->size(); ++j)
+            minDist = qMin(minDist, mgp::math::distanceToGreatCircleArc(
+                               polygon->at(i), simplified->at(j), simplified->at((j + 1) % simplified->size())));
+        QVERIFY((minDist * mgp::earthRadius) <= (toleranceKm + 1e-6));
+    }
+
+    // the level of detail of a FIR is cached
+    QVERIFY(&mgp::FIR::instance().preparedPolygon(mgp::FIR::ENOR, toleranceKm)
+            == &mgp::FIR::instance().preparedPolygon(mgp::FIR::ENOR, toleranceKm));
+    QCOMPARE(mgp::FIR::instance().polygon(mgp::FIR::ENOR, toleranceKm)->size(), simplified->size());
+}
+
+void TestMgp::polygonGenerator()
+{
+    // the same seed gives the same polygons and filters
+    mgp::PolygonGenerator gen1(42);
+    mgp::PolygonGenerator gen2(42);
+    const mgp::Point center = qMakePair(DEG2RAD(10.0), DEG2RAD(65.0));
+    const mgp::Polygon polygon = gen1.randomPolygon(100, center, 500, 0.5);
+    QVERIFY(equal(polygon, gen2.randomPolygon(100, center, 500, 0.5)));
+    QCOMPARE(polygon->size(), 100);
+    QVERIFY(mgp::math::isClockwise(polygon));
+
+    for (int i = 0; i < polygon->size(); ++i)
+        QVERIFY((mgp::math::Math::distance(center, polygon->at(i)) * mgp::earthRadius) <= (500 + 1e-6));
+
+    const mgp::Filters filters = gen1.randomFilters(3, polygon);
+    QCOMPARE(filters->size(), 3);
+    QCOMPARE(mgp::xmetExprFromFilters(filters), mgp::xmetExprFromFilters(gen2.randomFilters(3, polygon)));
+
+    // a different seed gives a different polygon
+    QVERIFY(!equal(polygon, mgp::PolygonGenerator(43).randomPolygon(100, center, 500, 0.5)));
+
+    // random filter sequences can be applied to random polygons and give valid polygons
+    for (int i = 0; i < 50; ++i) {
+        const mgp::Polygon randomPolygon = gen1.randomPolygon(3 + i, center, 800, 0.4);
+        const mgp::Polygons result = mgp::applyFilters(randomPolygon, gen1.randomFilters(1 + i % 3, randomPolygon));
+        QVERIFY(result);
+        for (int j = 0; j < result->size(); ++j) {
+            const mgp::Polygon &resultPolygon = result->at(j);
+            if (!resultPolygon)
+                continue; // a degenerate piece (see removeInvalidVertices())
+            QVERIFY(resultPolygon->size() >= 3);
+            for (int k = 0; k < resultPolygon->size(); ++k) {
+                QVERIFY(qIsFinite(resultPolygon->at(k).first));
+                QVERIFY(qAbs(resultPolygon->at(k).second) <= M_PI_2);
+            }
+        }
+    }
+}
+
+void TestMgp::intersectionStats()
+{
+    mgp::PolygonGenerator generator(1);
+    const mgp::Polygon subject = generator.randomPolygon(200, qMakePair(DEG2RAD(10.0), DEG2RAD(65.0)), 400, 0.3);
+    const mgp::Polygon clip = generator.randomPolygon(200, qMakePair(DEG2RAD(13.0), DEG2RAD(66.0)), 400, 0.3);
+
+    mgp::math::resetIntersectionStats();
+    const mgp::Polygons result = mgp::math::polygonIntersection(subject, clip);
+    const mgp::math::IntersectionStats stats = mgp::math::intersectionStats();
+
+    if (!mgp::math::intersectionStatsEnabled()) {
+        QCOMPARE(stats.calls, qint64(0));
+        QCOMPARE(stats.totalNsecs(), qint64(0));
+        return;
+    }
+
+    QCOMPARE(stats.calls, qint64(1));
+    QVERIFY(stats.edgeTests >= stats.intersections);
+    QVERIFY(stats.intersections > 0);
+    QVERIFY(!result->isEmpty());
+    QCOMPARE(stats.bailouts, qint64(0));
+    QVERIFY(stats.totalNsecs() > 0);
+
+    mgp::math::resetIntersectionStats();
+    QCOMPARE(mgp::math::intersectionStats().calls, qint64(0));
+}
+
+void TestMgp::chromeTraceSink()
+{
+    QBuffer buffer;
+    QVERIFY(buffer.open(QIODevice::WriteOnly));
+    {
+        mgp::ChromeTraceSink sink(&buffer);
+        mgp::setTraceSink(&sink);
+        QCOMPARE(mgp::traceSink(), static_cast<mgp::TraceSink *>(&sink));
+        const mgp::Filters filters = mgp::filtersFromXmetExpr("N OF N6500 AND \"E\" OF E01000", 0, 0, true, false);
+        mgp::applyFilters(mgp::FIR::instance().polygon(mgp::FIR::ENOR), filters);
+        mgp::setTraceSink(0);
+    }
+    QVERIFY(dynamic_cast<mgp::NullTraceSink *>(mgp::traceSink()));
+
+    // the output is a JSON array of properly nested begin/end events
+    const QJsonDocument doc = QJsonDocument::fromJson(buffer.data());
+    QVERIFY(doc.isArray());
+    QStringList names;
+    QStack<QString> open;
+    foreach (const QJsonValue &value, doc.array()) {
+        const QJsonObject event = value.toObject();
+        const QString name = event.value("name").toString();
+        if (event.value("ph").toString() == "B") {
+            open.push(name);
+            names.append(name);
+        } else {
+            QCOMPARE(event.value("ph").toString(), QString("E"));
+            QVERIFY(!open.isEmpty());
+            QCOMPARE(open.pop(), name);
+        }
+    }
+    QVERIFY(open.isEmpty());
+    QVERIFY(names.contains("filtersFromXmetExpr"));
+    QVERIFY(names.contains("applyFilters"));
+    QVERIFY(names.contains("LatFilter::apply"));
+}
+
 QTEST_MAIN(TestMgp)
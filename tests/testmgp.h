@@ -27,4 +27,60 @@ private slots:
 
     void applyFiltersOverload_data();
     void applyFiltersOverload();
+
+    void intersectedPolygons_data();
+    void intersectedPolygons();
+
+    void applyFiltersPrepared_data();
+    void applyFiltersPrepared();
+
+    void edgeIntersections_data();
+    void edgeIntersections();
+
+    void pointsInPolygon_data();
+    void pointsInPolygon();
+
+    void pointInPolygonIndex_data();
+    void pointInPolygonIndex();
+
+    void area_data();
+    void area();
+
+    void removeInvalidVertices_data();
+    void removeInvalidVertices();
+
+    void filterChain_data();
+    void filterChain();
+
+    void applyFiltersInParallel_data();
+    void applyFiltersInParallel();
+
+    void filtersFromXmetExpr_data();
+    void filtersFromXmetExpr();
+
+    void filterResultCache_data();
+    void filterResultCache();
+
+    void xmetAreaEdit_data();
+    void xmetAreaEdit();
+
+    void xmetAreaEditFilterReuse();
+
+    void polybin();
+
+    void kml2polygons_data();
+    void kml2polygons();
+
+    void polygonStore();
+
+    void firTables();
+
+    void simplifiedPolygon_data();
+    void simplifiedPolygon();
+
+    void polygonGenerator();
+
+    void intersectionStats();
+
+    void chromeTraceSink();
 };
@@ -1,4 +1,4 @@
-QT += xml xmlpatterns testlib
+QT += xml xmlpatterns widgets testlib
 TEMPLATE = app
 TARGET = testmgp
 
@@ -0,0 +1,14 @@
+TEMPLATE = app
+TARGET = firtables
+QT -= gui
+
+CONFIG += console debug
+CONFIG -= app_bundle
+
+# The generator is needed for building the library itself (see ../../lib/lib.pro), so it compiles the library source
+# it needs directly instead of linking against libmgp.
+INCLUDEPATH += . ../../lib
+DEPENDPATH += . ../../lib
+
+HEADERS += ../../lib/mgpmath.h ../../lib/data/enor_fir.h ../../lib/data/enob_fir.h
+SOURCES += main.cpp ../../lib/mgpmath.cpp
@@ -0,0 +1,88 @@
+// This program generates the prepared geometry of the supported FIRs as C++ tables, so that no conversion or trigonometry
+// is needed when the FIRs are loaded at run time (see FIR::FIR()).
+// Usage: firtables <output header file>
+
+#include "mgpmath.h"
+#include "data/enor_fir.h"
+#include "data/enob_fir.h"
+#include <cstdio>
+#include <cmath>
+
+using namespace mgp;
+
+// Returns the polygon of a FIR table in the format lat1, lon1, lat2, lon2, ..., lonN (degrees).
+static Polygon createPolygon(const double *table, int size)
+{
+    Polygon polygon = Polygon(new QVector<Point>);
+    for (int i = 0; i < (size / 2); ++i)
+        polygon->append(qMakePair(DEG2RAD(table[2 * i + 1]), DEG2RAD(table[2 * i])));
+    return polygon;
+}
+
+// Writes the values of an array with full precision.
+static void writeArray(FILE *file, const char *base, const char *suffix, const QVector<double> &values, int columns)
+{
+    fprintf(file, "static const double %s_%s[] = {", base, suffix);
+    for (int i = 0; i < values.size(); ++i)
+        fprintf(file, "%s%.17g%s", ((i % columns) == 0) ? "\n    " : "", values.at(i),
+                (i == (values.size() - 1)) ? "" : (((i + 1) % columns) == 0) ? "," : ", ");
+    fprintf(file, "\n};\n\n");
+}
+
+// Writes the tables for the prepared version of a polygon.
+static void writeGeometry(FILE *file, const char *name, const Polygon &polygon)
+{
+    const math::PreparedPolygon prepared(polygon);
+
+    QVector<double> points, vertices, normals;
+    for (int i = 0; i < prepared.size(); ++i) {
+        points << prepared.point(i).first << prepared.point(i).second;
+        vertices << prepared.vertex(i).x() << prepared.vertex(i).y() << prepared.vertex(i).z();
+        normals << prepared.normal(i).x() << prepared.normal(i).y() << prepared.normal(i).z();
+    }
+
+    fprintf(file, "// %s\n\n", name);
+    const QByteArray base = QString(name).toLower().toLatin1();
+    writeArray(file, base.constData(), "points", points, 2);
+    writeArray(file, base.constData(), "vertices", vertices, 3);
+    writeArray(file, base.constData(), "normals", normals, 3);
+
+    const double capRadius = prepared.capRadius();
+    const double capCos = (capRadius < M_PI) ? cos(capRadius) : -1;
+    fprintf(file, "static const mgp::math::PreparedPolygon::Geometry %s_geometry = {\n", base.constData());
+    fprintf(file, "    %d, %s_points, %s_vertices, %s_normals,\n", prepared.size(), base.constData(), base.constData(), base.constData());
+    fprintf(file, "    { %.17g, %.17g, %.17g }, %.17g, %.17g,\n",
+            prepared.capCenter().x(), prepared.capCenter().y(), prepared.capCenter().z(), capRadius, capCos);
+    fprintf(file, "    { %.17g, %.17g }, { %.17g, %.17g, %.17g }\n",
+            prepared.externalPoint().first, prepared.externalPoint().second,
+            prepared.externalVertex().x(), prepared.externalVertex().y(), prepared.externalVertex().z());
+    fprintf(file, "};\n\n");
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc != 2) {
+        fprintf(stderr, "usage: %s <output header file>\n", argv[0]);
+        return 1;
+    }
+
+    FILE *file = fopen(argv[1], "w");
+    if (!file) {
+        fprintf(stderr, "failed to open %s for writing\n", argv[1]);
+        return 1;
+    }
+
+    fprintf(file, "#ifndef FIR_TABLES_H\n#define FIR_TABLES_H\n\n");
+    fprintf(file, "// Generated by tools/firtables from enor_fir.h and enob_fir.h. Do not edit.\n\n");
+    fprintf(file, "#include \"mgpmath.h\"\n\n");
+    writeGeometry(file, "ENOR_FIR", createPolygon(enor_fir, sizeof(enor_fir) / sizeof(double)));
+    writeGeometry(file, "ENOB_FIR", createPolygon(enob_fir, sizeof(enob_fir) / sizeof(double)));
+    fprintf(file, "#endif // FIR_TABLES_H\n");
+
+    if (fclose(file) != 0) {
+        fprintf(stderr, "failed to write %s\n", argv[1]);
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,15 @@
+TEMPLATE = app
+TARGET = kml2polybin
+QT += xml xmlpatterns
+QT -= gui
+
+CONFIG += console debug
+CONFIG -= app_bundle
+
+# The converter is needed for building the library itself (see ../../lib/lib.pro), so it compiles the few library sources
+# it needs directly instead of linking against libmgp.
+INCLUDEPATH += . ../../lib
+DEPENDPATH += . ../../lib
+
+HEADERS += ../../lib/kml.h ../../lib/polybin.h
+SOURCES += main.cpp ../../lib/kml.cpp ../../lib/polybin.cpp
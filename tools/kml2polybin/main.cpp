@@ -0,0 +1,41 @@
+// This program converts the polygons of a KML file into the binary polygon format of polybin.h.
+// Usage: kml2polybin <input KML file> <output binary file>
+
+#include "kml.h"
+#include "polybin.h"
+#include <QCoreApplication>
+#include <QFile>
+#include <QStringList>
+#include <cstdio>
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+
+    const QStringList args = app.arguments();
+    if (args.size() != 3) {
+        fprintf(stderr, "usage: %s <input KML file> <output binary file>\n", argv[0]);
+        return 1;
+    }
+
+    QFile inFile(args.at(1));
+    if (!inFile.open(QIODevice::ReadOnly)) {
+        fprintf(stderr, "failed to open %s for reading\n", args.at(1).toLocal8Bit().constData());
+        return 1;
+    }
+
+    QString error;
+    const mgp::Polygons polygons = kml::kml2polygons(&inFile, &error);
+    if (!error.isEmpty()) {
+        fprintf(stderr, "failed to extract polygons from KML file: %s\n", error.toLocal8Bit().constData());
+        return 1;
+    }
+
+    QFile outFile(args.at(2));
+    if ((!outFile.open(QIODevice::WriteOnly)) || (outFile.write(polybin::polygons2polybin(polygons)) < 0)) {
+        fprintf(stderr, "failed to write %s\n", args.at(2).toLocal8Bit().constData());
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,3 @@
+TEMPLATE = subdirs
+SUBDIRS = kml2polybin firtables
+CONFIG += ordered